@@ -78,6 +78,11 @@ namespace AZ
 
         void Submit(Internal::Task& task);
 
+        uint32_t GetThreadCount() const
+        {
+            return m_threadCount;
+        }
+
     private:
         friend class Internal::TaskWorker;
         friend class TaskGraphEvent;
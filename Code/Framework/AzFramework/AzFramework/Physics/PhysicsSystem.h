@@ -112,7 +112,8 @@ namespace AzPhysics
         virtual void RemoveAllScenes() = 0;
 
         //! Helper to find the SceneHandle and SimulatedBodyHandle of a body related to the requested EntityId.
-        //! @note This will search all scenes and maybe slow if there are many Scenes.
+        //! Implementations are expected to keep an index of the bodies by entity, this is called while activating entities.
+        //! When several bodies belong to the entity, any one of them may be returned.
         //! @param entityId The entity to search for.
         //! @return Will return a AZStd::pair of SceneHandle and SimulatedBodyHandle of the requested entityid, otherwise will return AzPhysics::InvalidSceneHandle, AzPhysics::SimulatedBodyHandle.
         virtual AZStd::pair<SceneHandle, SimulatedBodyHandle> FindAttachedBodyHandleFromEntityId(AZ::EntityId entityId) = 0;
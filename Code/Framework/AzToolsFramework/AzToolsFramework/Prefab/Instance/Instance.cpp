@@ -173,6 +173,23 @@ namespace AzToolsFramework
             return true;
         }
 
+        bool Instance::AddDeserializedEntity(AZStd::unique_ptr<AZ::Entity> entity)
+        {
+            auto instanceToTemplateEntityIdIterator = m_instanceToTemplateEntityIdMap.find(entity->GetId());
+            if (instanceToTemplateEntityIdIterator == m_instanceToTemplateEntityIdMap.end())
+            {
+                AZ_Assert(false,
+                    "Prefab - Entity with id %s was not registered with the Prefab Instance derived from source asset %s "
+                    "while being deserialized.",
+                    entity->GetId().ToString().c_str(),
+                    m_templateSourcePath.c_str());
+
+                return false;
+            }
+
+            return m_entities.emplace(instanceToTemplateEntityIdIterator->second, AZStd::move(entity)).second;
+        }
+
         AZStd::unique_ptr<AZ::Entity> Instance::DetachEntity(const AZ::EntityId& entityId)
         {
             EntityAlias entityAliasToRemove;
@@ -46,7 +46,7 @@ namespace AzToolsFramework
         using InstanceOptionalConstReference = AZStd::optional<AZStd::reference_wrapper<const Instance>>;
 
         using InstanceSet = AZStd::unordered_set<Instance*>;
-        using InstanceSetConstReference = AZStd::optional<AZStd::reference_wrapper<const InstanceSet>>;
+        using InstanceSetOptional = AZStd::optional<InstanceSet>;
         using EntityOptionalReference = AZStd::optional<AZStd::reference_wrapper<AZ::Entity>>;
         using EntityOptionalConstReference = AZStd::optional<AZStd::reference_wrapper<const AZ::Entity>>;
 
@@ -84,6 +84,15 @@ namespace AzToolsFramework
 
             bool AddEntity(AZ::Entity& entity);
             bool AddEntity(AZ::Entity& entity, EntityAlias entityAlias);
+
+            /**
+            * Takes ownership of an entity that was registered with this instance while being deserialized.
+            * Unlike AddEntity, the entity's id is expected to already map to an alias of this instance.
+            * @param entity The deserialized entity.
+            * @return bool on whether the entity was added.
+            */
+            bool AddDeserializedEntity(AZStd::unique_ptr<AZ::Entity> entity);
+
             AZStd::unique_ptr<AZ::Entity> DetachEntity(const AZ::EntityId& entityId);
             void DetachEntities(const AZStd::function<void(AZStd::unique_ptr<AZ::Entity>)>& callback);
 
@@ -27,16 +27,19 @@ namespace AzToolsFramework
 
         bool InstanceEntityMapper::RegisterEntityToInstance(const AZ::EntityId& entityId, Instance& instance)
         {
+            AZStd::lock_guard<AZStd::shared_mutex> lock(m_entityToInstanceMapMutex);
             return m_entityToInstanceMap.emplace(AZStd::make_pair(entityId, &instance)).second;
         }
 
         bool InstanceEntityMapper::UnregisterEntity(const AZ::EntityId& entityId)
         {
+            AZStd::lock_guard<AZStd::shared_mutex> lock(m_entityToInstanceMapMutex);
             return m_entityToInstanceMap.erase(entityId) != 0;
         }
 
         InstanceOptionalReference InstanceEntityMapper::FindOwningInstance(const AZ::EntityId& entityId) const
         {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_entityToInstanceMapMutex);
             auto findResult = m_entityToInstanceMap.find(entityId);
 
             if (findResult != m_entityToInstanceMap.end())
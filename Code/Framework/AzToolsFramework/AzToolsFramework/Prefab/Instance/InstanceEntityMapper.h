@@ -11,6 +11,7 @@
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceEntityMapperInterface.h>
 namespace AzToolsFramework
 {
@@ -34,6 +35,8 @@ namespace AzToolsFramework
 
         private:
             AZStd::unordered_map<AZ::EntityId, Instance*> m_entityToInstanceMap;
+            // Instances are loaded concurrently when converting prefabs to spawnables, see PrefabProcessorContext::ListPrefabs.
+            mutable AZStd::shared_mutex m_entityToInstanceMapMutex;
         };
     }
 }
@@ -73,11 +73,57 @@ namespace AzToolsFramework
                 instanceToExcludePtr = &(instanceToExclude->get());
             }
 
-            for (auto instance : findInstancesResult->get())
+            for (auto instance : *findInstancesResult)
             {
                 if (instance != instanceToExcludePtr)
                 {
                     m_instancesUpdateQueue.emplace_back(instance);
+                    m_entityAliasesToUpdate.erase(instance);
+                }
+            }
+        }
+
+        void InstanceUpdateExecutor::AddTemplateInstancesToQueueForPatches(
+            TemplateId instanceTemplateId, const PrefabDomValue& templatePatches, InstanceOptionalReference instanceToExclude)
+        {
+            // The patches are the same for every instance of the template, so only map them to entities once.
+            EntityAliasSet changedEntityAliases;
+            if (!PrefabDomUtils::GetEntityAliasesChangedByPatches(templatePatches, changedEntityAliases) ||
+                changedEntityAliases.empty())
+            {
+                AddTemplateInstancesToQueue(instanceTemplateId, instanceToExclude);
+                return;
+            }
+
+            auto findInstancesResult =
+                m_templateInstanceMapperInterface->FindInstancesOwnedByTemplate(instanceTemplateId);
+            if (!findInstancesResult.has_value())
+            {
+                AZ_Warning("Prefab", false,
+                    "InstanceUpdateExecutor::AddTemplateInstancesToQueueForPatches - "
+                    "Could not find Template with Id '%llu' in Template Instance Mapper.",
+                    instanceTemplateId);
+
+                return;
+            }
+
+            Instance* instanceToExcludePtr = nullptr;
+            if (instanceToExclude.has_value())
+            {
+                instanceToExcludePtr = &(instanceToExclude->get());
+            }
+
+            for (auto instance : *findInstancesResult)
+            {
+                if (instance != instanceToExcludePtr)
+                {
+                    // An instance that is already waiting for an entity update only needs to reload more entities.
+                    auto [entityAliasesIterator, isNewEntry] = m_entityAliasesToUpdate.try_emplace(instance);
+                    entityAliasesIterator->second.insert(changedEntityAliases.begin(), changedEntityAliases.end());
+                    if (isNewEntry)
+                    {
+                        m_instancesUpdateQueue.emplace_back(instance);
+                    }
                 }
             }
         }
@@ -88,6 +134,43 @@ namespace AzToolsFramework
             {
                 return entry == instance;
             });
+            m_entityAliasesToUpdate.erase(instance);
+        }
+
+        bool InstanceUpdateExecutor::UpdateInstanceEntities(
+            Instance& instance, const EntityAliasSet& entityAliases, const PrefabDomValue& instanceDom)
+        {
+            PrefabDomValueConstReference entitiesDom = PrefabDomUtils::FindPrefabDomValue(instanceDom, PrefabDomUtils::EntitiesName);
+            if (!entitiesDom.has_value())
+            {
+                return false;
+            }
+
+            // Check all entities before replacing any of them, so a failure leaves the instance untouched for the full update.
+            AZStd::vector<AZStd::pair<const EntityAlias*, const PrefabDomValue*>> entitiesToLoad;
+            entitiesToLoad.reserve(entityAliases.size());
+            for (const EntityAlias& entityAlias : entityAliases)
+            {
+                PrefabDomValueConstReference entityDom = PrefabDomUtils::FindPrefabDomValue(entitiesDom->get(), entityAlias.c_str());
+                if (!entityDom.has_value() || !instance.GetEntityId(entityAlias).IsValid())
+                {
+                    return false;
+                }
+                entitiesToLoad.emplace_back(&entityAlias, &(entityDom->get()));
+            }
+
+            Instance::EntityList newEntities;
+            for (const auto& [entityAlias, entityDom] : entitiesToLoad)
+            {
+                if (!PrefabDomUtils::LoadEntityFromPrefabDom(instance, *entityAlias, *entityDom, newEntities))
+                {
+                    return false;
+                }
+            }
+
+            AzToolsFramework::EditorEntityContextRequestBus::Broadcast(
+                &AzToolsFramework::EditorEntityContextRequests::HandleEntitiesAdded, newEntities);
+            return true;
         }
 
         bool InstanceUpdateExecutor::UpdateTemplateInstancesInQueue()
@@ -121,6 +204,14 @@ namespace AzToolsFramework
                         m_instancesUpdateQueue.pop_front();
                         AZ_Assert(instanceToUpdate != nullptr, "Invalid instance on update queue.");
 
+                        EntityAliasSet entityAliasesToUpdate;
+                        if (auto entityAliasesIterator = m_entityAliasesToUpdate.find(instanceToUpdate);
+                            entityAliasesIterator != m_entityAliasesToUpdate.end())
+                        {
+                            entityAliasesToUpdate = AZStd::move(entityAliasesIterator->second);
+                            m_entityAliasesToUpdate.erase(entityAliasesIterator);
+                        }
+
                         TemplateId instanceTemplateId = instanceToUpdate->GetTemplateId();
                         if (currentTemplateId != instanceTemplateId)
                         {
@@ -146,7 +237,7 @@ namespace AzToolsFramework
                             instanceTemplateId);
 
                         if (findInstancesResult == AZStd::nullopt ||
-                            findInstancesResult->get().find(instanceToUpdate) == findInstancesResult->get().end())
+                            !findInstancesResult->contains(instanceToUpdate))
                         {
                             // Since nested instances get reconstructed during propagation, remove any nested instance that no longer
                             // maps to a template.
@@ -202,6 +293,14 @@ namespace AzToolsFramework
                             continue;
                         }
 
+                        // When the template only changed inside of existing entities, reload just those entities. Entities that fail
+                        // to reload are recreated by the full update below.
+                        if (!entityAliasesToUpdate.empty() &&
+                            UpdateInstanceEntities(*instanceToUpdate, entityAliasesToUpdate, instanceDomFromRoot->get()))
+                        {
+                            continue;
+                        }
+
                         // If a link was created for a nested instance before the changes were propagated,
                         // then we associate it correctly here
                         instanceDomFromRootDocument.CopyFrom(instanceDomFromRoot->get(), instanceDomFromRootDocument.GetAllocator());
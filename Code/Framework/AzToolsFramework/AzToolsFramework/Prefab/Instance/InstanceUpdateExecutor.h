@@ -11,6 +11,8 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceUpdateExecutorInterface.h>
 #include <AzToolsFramework/Prefab/PrefabIdTypes.h>
 
@@ -32,6 +34,9 @@ namespace AzToolsFramework
             explicit InstanceUpdateExecutor(int instanceCountToUpdateInBatch = 0);
 
             void AddTemplateInstancesToQueue(TemplateId instanceTemplateId, InstanceOptionalReference instanceToExclude = AZStd::nullopt) override;
+            void AddTemplateInstancesToQueueForPatches(
+                TemplateId instanceTemplateId, const PrefabDomValue& templatePatches,
+                InstanceOptionalReference instanceToExclude = AZStd::nullopt) override;
             bool UpdateTemplateInstancesInQueue() override;
             virtual void RemoveTemplateInstanceFromQueue(const Instance* instance) override;
 
@@ -39,10 +44,19 @@ namespace AzToolsFramework
             void UnregisterInstanceUpdateExecutorInterface();
 
         private:
+            using EntityAliasSet = AZStd::unordered_set<EntityAlias>;
+
+            // Reloads only the given entities of an Instance from its DOM. Returns false if any of the entities can't be
+            // reloaded, in which case the whole Instance needs to be updated.
+            bool UpdateInstanceEntities(Instance& instance, const EntityAliasSet& entityAliases, const PrefabDomValue& instanceDom);
+
             PrefabSystemComponentInterface* m_prefabSystemComponentInterface = nullptr;
             TemplateInstanceMapperInterface* m_templateInstanceMapperInterface = nullptr;
             int m_instanceCountToUpdateInBatch = 0;
             AZStd::deque<Instance*> m_instancesUpdateQueue;
+            // Entities to reload for queued Instances whose Template only changed inside of existing entities.
+            // Queued Instances without an entry in this map are fully updated.
+            AZStd::unordered_map<const Instance*, EntityAliasSet> m_entityAliasesToUpdate;
             bool m_updatingTemplateInstancesInQueue { false };
         };
     }
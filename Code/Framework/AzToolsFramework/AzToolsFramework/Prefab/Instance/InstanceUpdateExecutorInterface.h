@@ -10,6 +10,7 @@
 
 #include <AzCore/RTTI/RTTI.h>
 #include <AzToolsFramework/Prefab/Instance/Instance.h>
+#include <AzToolsFramework/Prefab/PrefabDomTypes.h>
 #include <AzToolsFramework/Prefab/PrefabIdTypes.h>
 
 namespace AzToolsFramework
@@ -25,6 +26,12 @@ namespace AzToolsFramework
             // Add all Instances of Template with given Id into a queue for updating them later.
             virtual void AddTemplateInstancesToQueue(TemplateId instanceTemplateId, InstanceOptionalReference instanceToExclude = AZStd::nullopt) = 0;
 
+            // Add all Instances of Template with given Id into a queue for updating only the entities touched by the given patches.
+            // If the patches change the structure of the Template, the Instances are fully updated instead.
+            virtual void AddTemplateInstancesToQueueForPatches(
+                TemplateId instanceTemplateId, const PrefabDomValue& templatePatches,
+                InstanceOptionalReference instanceToExclude = AZStd::nullopt) = 0;
+
             // Update Instances in the waiting queue.
             virtual bool UpdateTemplateInstancesInQueue() = 0;
 
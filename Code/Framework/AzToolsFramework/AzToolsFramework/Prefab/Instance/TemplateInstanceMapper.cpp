@@ -29,6 +29,7 @@ namespace AzToolsFramework
 
         bool TemplateInstanceMapper::RegisterTemplate(TemplateId templateId)
         {
+            AZStd::lock_guard<AZStd::shared_mutex> lock(m_templateIdToInstancesMapMutex);
             const bool result = m_templateIdToInstancesMap.emplace(templateId, InstanceSet()).second;
             AZ_Assert(result,
                 "Prefab - PrefabSystemComponent::RegisterTemplate - "
@@ -41,6 +42,7 @@ namespace AzToolsFramework
 
         bool TemplateInstanceMapper::UnregisterTemplate(TemplateId templateId)
         {
+            AZStd::lock_guard<AZStd::shared_mutex> lock(m_templateIdToInstancesMapMutex);
             const bool result = m_templateIdToInstancesMap.erase(templateId) != 0;
             AZ_Assert(result,
                 "Prefab - PrefabSystemComponent::UnregisterTemplate - "
@@ -60,6 +62,7 @@ namespace AzToolsFramework
             }
             else
             {
+                AZStd::lock_guard<AZStd::shared_mutex> lock(m_templateIdToInstancesMapMutex);
                 auto found = m_templateIdToInstancesMap.find(templateId);
                 return found != m_templateIdToInstancesMap.end() &&
                     found->second.emplace(&instance).second;
@@ -68,6 +71,9 @@ namespace AzToolsFramework
 
         bool TemplateInstanceMapper::UnregisterInstance(Instance& instance)
         {
+            // The lock also serializes the queue update below when instances are destroyed on several threads.
+            AZStd::lock_guard<AZStd::shared_mutex> lock(m_templateIdToInstancesMapMutex);
+
             // The InstanceUpdateExecutor queries the TemplateInstanceMapper for a list of instances related to a template.
             // Consequently, if an instance gets unregistered for a template, we need to notify the InstanceUpdateExecutor as well
             // so that it clears any internal associations that it might have in its queue.
@@ -79,8 +85,10 @@ namespace AzToolsFramework
                 found->second.erase(&instance) != 0;
         }
 
-        InstanceSetConstReference TemplateInstanceMapper::FindInstancesOwnedByTemplate(TemplateId templateId) const
+        InstanceSetOptional TemplateInstanceMapper::FindInstancesOwnedByTemplate(TemplateId templateId) const
         {
+            // Return a copy, as other threads can register and unregister instances once the lock is released.
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_templateIdToInstancesMapMutex);
             auto found = m_templateIdToInstancesMap.find(templateId);
 
             if (found != m_templateIdToInstancesMap.end())
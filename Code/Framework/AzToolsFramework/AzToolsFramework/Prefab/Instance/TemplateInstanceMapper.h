@@ -10,6 +10,7 @@
 
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 #include <AzToolsFramework/Prefab/Instance/TemplateInstanceMapperInterface.h>
 
 namespace AzToolsFramework
@@ -26,7 +27,7 @@ namespace AzToolsFramework
             TemplateInstanceMapper();
             ~TemplateInstanceMapper() override;
 
-            InstanceSetConstReference FindInstancesOwnedByTemplate(TemplateId templateId) const override;
+            InstanceSetOptional FindInstancesOwnedByTemplate(TemplateId templateId) const override;
 
             bool RegisterTemplate(TemplateId templateId);
             bool UnregisterTemplate(TemplateId templateId);
@@ -37,6 +38,8 @@ namespace AzToolsFramework
 
         private:
             AZStd::unordered_map<TemplateId, InstanceSet> m_templateIdToInstancesMap;
+            // Instances are loaded concurrently when converting prefabs to spawnables, see PrefabProcessorContext::ListPrefabs.
+            mutable AZStd::shared_mutex m_templateIdToInstancesMapMutex;
         };
     }
 }
@@ -48,6 +48,27 @@ namespace AzToolsFramework
 
                     return result;
                 }
+
+                // some assets may come in from the JSON serialzier with no AssetID, but have an asset hint
+                // this attempts to fix up the assets using the assetHint field
+                void FixUpInvalidAsset(AZ::Data::Asset<AZ::Data::AssetData>& asset)
+                {
+                    if (!asset.GetId().IsValid() && !asset.GetHint().empty())
+                    {
+                        AZ::Data::AssetId assetId;
+                        AZ::Data::AssetCatalogRequestBus::BroadcastResult(
+                            assetId,
+                            &AZ::Data::AssetCatalogRequestBus::Events::GetAssetIdByPath,
+                            asset.GetHint().c_str(),
+                            AZ::Data::s_invalidAssetType,
+                            false);
+
+                        if (assetId.IsValid())
+                        {
+                            asset.Create(assetId, false);
+                        }
+                    }
+                }
             }
 
             PrefabDomValueReference FindPrefabDomValue(PrefabDomValue& parentValue, const char* valueName)
@@ -246,29 +267,8 @@ namespace AzToolsFramework
                     entityIdMapper.SetEntityIdGenerationApproach(InstanceEntityIdMapper::EntityIdGenerationApproach::Random);
                 }
 
-                // some assets may come in from the JSON serialzier with no AssetID, but have an asset hint
-                // this attempts to fix up the assets using the assetHint field
-                auto fixUpInvalidAssets = [](AZ::Data::Asset<AZ::Data::AssetData>& asset)
-                {
-                    if (!asset.GetId().IsValid() && !asset.GetHint().empty())
-                    {
-                        AZ::Data::AssetId assetId;
-                        AZ::Data::AssetCatalogRequestBus::BroadcastResult(
-                            assetId,
-                            &AZ::Data::AssetCatalogRequestBus::Events::GetAssetIdByPath,
-                            asset.GetHint().c_str(),
-                            AZ::Data::s_invalidAssetType,
-                            false);
-
-                        if (assetId.IsValid())
-                        {
-                            asset.Create(assetId, false);
-                        }
-                    }
-                };
-
                 auto tracker = AZ::Data::SerializedAssetTracker{};
-                tracker.SetAssetFixUp(fixUpInvalidAssets);
+                tracker.SetAssetFixUp(&Internal::FixUpInvalidAsset);
 
                 AZ::JsonDeserializerSettings settings;
                 // The InstanceEntityIdMapper is registered twice because it's used in several places during deserialization where one is
@@ -305,6 +305,114 @@ namespace AzToolsFramework
                 return true;
             }
 
+            bool LoadEntityFromPrefabDom(
+                Instance& instance, const EntityAlias& entityAlias, const PrefabDomValue& entityDom,
+                Instance::EntityList& newlyAddedEntities)
+            {
+                // Suspend asset release for the same reason as when loading a whole instance, see LoadInstanceFromPrefabDom.
+                AZ::Data::AssetManager::Instance().SuspendAssetRelease();
+
+                // The entity id is generated from the alias, so the old entity has to be unregistered before its replacement
+                // can be loaded.
+                AZ::EntityId entityId = instance.GetEntityId(entityAlias);
+                if (entityId.IsValid())
+                {
+                    instance.DetachEntity(entityId).reset();
+                }
+
+                InstanceEntityIdMapper entityIdMapper;
+                entityIdMapper.SetLoadingInstance(instance);
+
+                auto tracker = AZ::Data::SerializedAssetTracker{};
+                tracker.SetAssetFixUp(&Internal::FixUpInvalidAsset);
+
+                AZ::JsonDeserializerSettings settings;
+                // See LoadInstanceFromPrefabDom for why the InstanceEntityIdMapper is registered twice.
+                settings.m_metadata.Add(static_cast<AZ::JsonEntityIdSerializer::JsonEntityIdMapper*>(&entityIdMapper));
+                settings.m_metadata.Add(&entityIdMapper);
+                settings.m_metadata.Add(tracker);
+
+                AZStd::string scratchBuffer;
+                auto issueReportingCallback = [&scratchBuffer](
+                    AZStd::string_view message, AZ::JsonSerializationResult::ResultCode result,
+                    AZStd::string_view path) -> AZ::JsonSerializationResult::ResultCode
+                {
+                    return Internal::JsonIssueReporter(scratchBuffer, message, result, path);
+                };
+                settings.m_reporting = AZStd::move(issueReportingCallback);
+
+                AZStd::unique_ptr<AZ::Entity> entity;
+                AZ::JsonSerializationResult::ResultCode result =
+                    AZ::JsonSerialization::Load(&entity, azrtti_typeid<decltype(entity)>(), entityDom, settings);
+
+                AZ::Data::AssetManager::Instance().ResumeAssetRelease();
+
+                if (result.GetProcessing() == AZ::JsonSerializationResult::Processing::Halted || !entity)
+                {
+                    AZ_Error("Prefab", false,
+                        "Failed to de-serialize entity '%s' from Prefab DOM. "
+                        "Unable to proceed.", entityAlias.c_str());
+
+                    return false;
+                }
+
+                AZ::Entity* newEntity = entity.get();
+                if (!instance.AddDeserializedEntity(AZStd::move(entity)))
+                {
+                    return false;
+                }
+
+                newlyAddedEntities.emplace_back(newEntity);
+                return true;
+            }
+
+            bool GetEntityAliasesChangedByPatches(const PrefabDomValue& patches, AZStd::unordered_set<EntityAlias>& entityAliases)
+            {
+                if (!patches.IsArray())
+                {
+                    return false;
+                }
+
+                for (const PrefabDomValue& patch : patches.GetArray())
+                {
+                    PrefabDomValueConstReference operation = FindPrefabDomValue(patch, "op");
+                    PrefabDomValueConstReference path = FindPrefabDomValue(patch, "path");
+                    if (!operation.has_value() || !operation->get().IsString() || !path.has_value() || !path->get().IsString())
+                    {
+                        return false;
+                    }
+
+                    // Moves and copies read from a second path, so they're not limited to a single entity.
+                    AZStd::string_view operationName(operation->get().GetString(), operation->get().GetStringLength());
+                    if (operationName != "add" && operationName != "remove" && operationName != "replace")
+                    {
+                        return false;
+                    }
+
+                    PrefabDomPath patchPath(path->get().GetString(), path->get().GetStringLength());
+                    if (!patchPath.IsValid() || patchPath.GetTokenCount() < 2)
+                    {
+                        return false;
+                    }
+
+                    const PrefabDomPath::Token* tokens = patchPath.GetTokens();
+                    if (AZStd::string_view(tokens[0].name, tokens[0].length) != EntitiesName)
+                    {
+                        return false;
+                    }
+
+                    // Adding or removing a whole entity changes the structure of the instance, replacing it doesn't.
+                    if (patchPath.GetTokenCount() == 2 && operationName != "replace")
+                    {
+                        return false;
+                    }
+
+                    entityAliases.emplace(tokens[1].name, tokens[1].length);
+                }
+
+                return true;
+            }
+
             void GetTemplateSourcePaths(const PrefabDomValue& prefabDom, AZStd::unordered_set<AZ::IO::Path>& templateSourcePaths)
             {
                 PrefabDomValueConstReference findSourceResult = PrefabDomUtils::FindPrefabDomValue(prefabDom, PrefabDomUtils::SourceName);
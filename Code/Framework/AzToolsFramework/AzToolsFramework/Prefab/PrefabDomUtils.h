@@ -122,6 +122,28 @@ namespace AzToolsFramework
                 Instance& instance, Instance::EntityList& newlyAddedEntities, const PrefabDom& prefabDom,
                 LoadFlags flags = LoadFlags::None);
 
+            /**
+            * Replaces an entity of an Instance with one loaded from the entity's DOM. The entity keeps its id, which allows
+            * updating individual entities without reloading the whole Instance.
+            * @param instance The Instance owning the entity.
+            * @param entityAlias The alias of the entity to replace.
+            * @param entityDom The DOM of the entity, as found under the Entities member of the Instance DOM.
+            * @param newlyAddedEntities The new entity is added to this list if it was loaded.
+            * @return bool on whether the operation succeeded.
+            */
+            bool LoadEntityFromPrefabDom(
+                Instance& instance, const EntityAlias& entityAlias, const PrefabDomValue& entityDom,
+                Instance::EntityList& newlyAddedEntities);
+
+            /**
+            * Collects the aliases of the entities that are changed by a list of patches.
+            * @param patches The patches as applied to a Template DOM.
+            * @param[out] entityAliases The aliases of the entities touched by the patches.
+            * @return False if any of the patches changes the structure of the DOM, such as adding or removing entities or
+            *         nested instances, or changes anything outside of existing entities.
+            */
+            bool GetEntityAliasesChangedByPatches(const PrefabDomValue& patches, AZStd::unordered_set<EntityAlias>& entityAliases);
+
             inline PrefabDomPath GetPrefabDomInstancePath(const char* instanceName)
             {
                 return PrefabDomPath()
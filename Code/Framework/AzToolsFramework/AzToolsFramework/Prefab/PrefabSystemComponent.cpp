@@ -163,7 +163,18 @@ namespace AzToolsFramework
         void PrefabSystemComponent::PropagateTemplateChanges(TemplateId templateId, InstanceOptionalReference instanceToExclude)
         {
             UpdatePrefabInstances(templateId, instanceToExclude);
+            UpdateLinkedInstances(templateId);
+        }
 
+        void PrefabSystemComponent::PropagateTemplatePatches(
+            TemplateId templateId, const PrefabDomValue& patches, InstanceOptionalReference instanceToExclude)
+        {
+            m_instanceUpdateExecutor.AddTemplateInstancesToQueueForPatches(templateId, patches, instanceToExclude);
+            UpdateLinkedInstances(templateId);
+        }
+
+        void PrefabSystemComponent::UpdateLinkedInstances(TemplateId templateId)
+        {
             auto templateIdToLinkIdsIterator = m_templateToLinkIdsMap.find(templateId);
             if (templateIdToLinkIdsIterator != m_templateToLinkIdsMap.end())
             {
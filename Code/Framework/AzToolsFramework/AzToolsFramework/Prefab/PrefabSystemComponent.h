@@ -232,6 +232,8 @@ namespace AzToolsFramework
             void UpdatePrefabTemplate(TemplateId templateId, const PrefabDom& updatedDom) override;
 
             void PropagateTemplateChanges(TemplateId templateId, InstanceOptionalReference instanceToExclude = AZStd::nullopt) override;
+            void PropagateTemplatePatches(
+                TemplateId templateId, const PrefabDomValue& patches, InstanceOptionalReference instanceToExclude = AZStd::nullopt) override;
 
             /**
              * Updates all Instances owned by a Template.
@@ -268,6 +270,13 @@ namespace AzToolsFramework
              */
             void UpdateLinkedInstances(AZStd::queue<LinkIds>& linkIdsQueue);
 
+            /**
+             * Updates the instances linked to the given template.
+             *
+             * @param templateId The id of the source template of the links to update.
+             */
+            void UpdateLinkedInstances(TemplateId templateId);
+
             /**
              * Given a vector of link ids to update, splits them into smaller lists based on the target template id of the links.
              * 
@@ -68,6 +68,10 @@ namespace AzToolsFramework
             virtual PrefabDom& FindTemplateDom(TemplateId templateId) = 0;
             virtual void UpdatePrefabTemplate(TemplateId templateId, const PrefabDom& updatedDom) = 0;
             virtual void PropagateTemplateChanges(TemplateId templateId, InstanceOptionalReference instanceToExclude = AZStd::nullopt) = 0;
+            //! Propagates changes that were made to a template by applying the given patches to it. Instances only reload the
+            //! entities touched by the patches, unless the patches change the structure of the template.
+            virtual void PropagateTemplatePatches(
+                TemplateId templateId, const PrefabDomValue& patches, InstanceOptionalReference instanceToExclude = AZStd::nullopt) = 0;
 
             virtual AZStd::unique_ptr<Instance> InstantiatePrefab(
                 AZ::IO::PathView filePath, InstanceOptionalReference parent = AZStd::nullopt) = 0;
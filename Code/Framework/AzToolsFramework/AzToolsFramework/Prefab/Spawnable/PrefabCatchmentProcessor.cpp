@@ -28,6 +28,12 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
             });
     }
 
+    bool PrefabCatchmentProcessor::IsThreadSafe() const
+    {
+        // Every prefab is converted into its own spawnable, the only shared state are the results stored in the context.
+        return true;
+    }
+
     void PrefabCatchmentProcessor::Reflect(AZ::ReflectContext* context)
     {
         if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
@@ -87,7 +93,7 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
                 }
             }
             SpawnableUtils::SortEntitiesByTransformHierarchy(*spawnable);
-            context.GetProcessedObjects().push_back(AZStd::move(object));
+            context.AddProcessedObject(AZStd::move(object));
         }
         else
         {
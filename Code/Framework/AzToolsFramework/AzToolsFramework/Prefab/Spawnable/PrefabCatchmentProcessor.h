@@ -36,6 +36,7 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
         ~PrefabCatchmentProcessor() override = default;
 
         void Process(PrefabProcessorContext& context) override;
+        bool IsThreadSafe() const override;
 
         static void Reflect(AZ::ReflectContext* context);
 
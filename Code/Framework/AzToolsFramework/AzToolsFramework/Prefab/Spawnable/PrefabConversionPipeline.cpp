@@ -9,6 +9,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzToolsFramework/Prefab/Spawnable/PrefabConversionPipeline.h>
 
 namespace AzToolsFramework::Prefab::PrefabConversionUtils
@@ -50,11 +51,23 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
 
     void PrefabConversionPipeline::ProcessPrefab(PrefabProcessorContext& context)
     {
+        // Processors run one after the other as each one depends on the results of the ones before it. Within a processor
+        // the prefabs can be processed concurrently if the processor allows it.
         for (auto& processor : m_processors)
         {
+            const AZStd::chrono::monotonic_clock::time_point start = AZStd::chrono::monotonic_clock::now();
+
+            context.SetConcurrentIteration(processor->IsThreadSafe());
             processor->Process(context);
+            context.SetConcurrentIteration(false);
+
+            const auto duration = AZStd::chrono::duration_cast<AZStd::chrono::duration<float, AZStd::milli>>(
+                AZStd::chrono::monotonic_clock::now() - start);
+            AZ_TracePrintf("PrefabConversionPipeline", "    Processor '%s' finished in %.2fms.\n",
+                processor->RTTI_GetTypeName(), duration.count());
         }
     }
+
     size_t PrefabConversionPipeline::CalculateProcessorFingerprint(AZ::SerializeContext* context)
     {
         size_t fingerprint = 0;
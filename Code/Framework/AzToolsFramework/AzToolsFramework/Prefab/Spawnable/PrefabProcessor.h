@@ -23,5 +23,10 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
         virtual ~PrefabProcessor() = default;
 
         virtual void Process(PrefabProcessorContext& context) = 0;
+
+        //! Processors that only change the prefab they're given and report their results through the thread-safe functions of
+        //! the context can return true. The pipeline will then let the context call the ListPrefabs callback concurrently for
+        //! the prefabs it holds.
+        virtual bool IsThreadSafe() const { return false; }
     };
 } // namespace AzToolsFramework::Prefab::PrefabConversionUtils
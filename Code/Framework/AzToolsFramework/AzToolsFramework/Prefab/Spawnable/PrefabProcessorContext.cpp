@@ -6,12 +6,27 @@
  *
  */
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzFramework/Spawnable/Spawnable.h>
 
 #include <AzToolsFramework/Prefab/Spawnable/PrefabProcessorContext.h>
 
 namespace AzToolsFramework::Prefab::PrefabConversionUtils
 {
+    namespace
+    {
+        // The products of the prefab that the current job processes. They're appended to the context after all jobs
+        // have completed, in the order of the prefabs rather than the order in which the jobs happened to finish.
+        struct ConcurrentProductSlot
+        {
+            const PrefabProcessorContext* m_context{ nullptr };
+            PrefabProcessorContext::ProcessedObjectStoreContainer* m_products{ nullptr };
+        };
+        thread_local ConcurrentProductSlot s_concurrentProductSlot;
+    }
+
     PrefabProcessorContext::PrefabProcessorContext(const AZ::Uuid& sourceUuid)
         : m_sourceUuid(sourceUuid)
     {}
@@ -25,9 +40,43 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
     void PrefabProcessorContext::ListPrefabs(const AZStd::function<void(AZStd::string_view, PrefabDom&)>& callback)
     {
         m_isIterating = true;
-        for (auto& it : m_prefabs)
+        if (m_concurrentIteration && m_prefabs.size() > 1 && AZ::JobContext::GetGlobalContext())
         {
-            callback(it.first, it.second);
+            // Prefabs in the context are self-contained, nested instances are part of the DOM of the prefab that owns them,
+            // so every prefab can be processed independently.
+            AZStd::vector<ProcessedObjectStoreContainer> prefabProducts(m_prefabs.size());
+            AZ::JobCompletion completion;
+            size_t prefabIndex = 0;
+            for (auto& it : m_prefabs)
+            {
+                ProcessedObjectStoreContainer* products = &prefabProducts[prefabIndex++];
+                AZ::Job* job = AZ::CreateJobFunction([this, &callback, &it, products]()
+                    {
+                        // A worker can pick up another job while this one waits, so restore the slot rather than clearing it.
+                        const ConcurrentProductSlot previousSlot = s_concurrentProductSlot;
+                        s_concurrentProductSlot = { this, products };
+                        callback(it.first, it.second);
+                        s_concurrentProductSlot = previousSlot;
+                    }, true);
+                job->SetDependent(&completion);
+                job->Start();
+            }
+            completion.StartAndWaitForCompletion();
+
+            for (ProcessedObjectStoreContainer& products : prefabProducts)
+            {
+                for (ProcessedObjectStore& product : products)
+                {
+                    m_products.push_back(AZStd::move(product));
+                }
+            }
+        }
+        else
+        {
+            for (auto& it : m_prefabs)
+            {
+                callback(it.first, it.second);
+            }
         }
         m_isIterating = false;
     }
@@ -45,6 +94,16 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
         return !m_prefabs.empty();
     }
 
+    void PrefabProcessorContext::SetConcurrentIteration(bool concurrentIteration)
+    {
+        m_concurrentIteration = concurrentIteration;
+    }
+
+    bool PrefabProcessorContext::IsIteratingConcurrently() const
+    {
+        return m_concurrentIteration;
+    }
+
     bool PrefabProcessorContext::RegisterSpawnableProductAssetDependency(AZStd::string prefabName, AZStd::string dependentPrefabName)
     {
         using ConversionUtils = PrefabConversionUtils::ProcessedObjectStore;
@@ -80,9 +139,22 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
 
     bool PrefabProcessorContext::RegisterProductAssetDependency(const AZ::Data::AssetId& assetId, const AZ::Data::AssetId& dependentAssetId)
     {
+        AZStd::scoped_lock lock(m_resultsMutex);
         return m_registeredProductAssetDependencies[assetId].emplace(dependentAssetId).second;
     }
 
+    void PrefabProcessorContext::AddProcessedObject(ProcessedObjectStore object)
+    {
+        if (s_concurrentProductSlot.m_context == this)
+        {
+            s_concurrentProductSlot.m_products->push_back(AZStd::move(object));
+            return;
+        }
+
+        AZStd::scoped_lock lock(m_resultsMutex);
+        m_products.push_back(AZStd::move(object));
+    }
+
     PrefabProcessorContext::ProcessedObjectStoreContainer& PrefabProcessorContext::GetProcessedObjects()
     {
         return m_products;
@@ -125,6 +197,7 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
 
     void PrefabProcessorContext::ErrorEncountered()
     {
+        AZStd::scoped_lock lock(m_resultsMutex);
         m_completedSuccessfully = false;
     }
 } // namespace AzToolsFramework::Prefab::PrefabConversionUtils
@@ -14,6 +14,7 @@
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
 #include <AzToolsFramework/Prefab/PrefabDomTypes.h>
@@ -39,11 +40,20 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
         virtual void ListPrefabs(const AZStd::function<void(AZStd::string_view, const PrefabDom&)>& callback) const;
         virtual bool HasPrefabs() const;
 
+        //! When enabled, the callback passed to ListPrefabs is called concurrently for the prefabs in the context.
+        //! Only enable this while running processors that are thread-safe, see PrefabProcessor::IsThreadSafe.
+        virtual void SetConcurrentIteration(bool concurrentIteration);
+        virtual bool IsIteratingConcurrently() const;
+
         virtual bool RegisterSpawnableProductAssetDependency(AZStd::string prefabName, AZStd::string dependentPrefabName);
         virtual bool RegisterSpawnableProductAssetDependency(AZStd::string prefabName, const AZ::Data::AssetId& dependentAssetId);
         virtual bool RegisterSpawnableProductAssetDependency(uint32_t spawnableAssetSubId, uint32_t dependentSpawnableAssetSubId);
         virtual bool RegisterProductAssetDependency(const AZ::Data::AssetId& assetId, const AZ::Data::AssetId& dependentAssetId);
 
+        //! Adds a processed object. Unlike changing the container returned by GetProcessedObjects, this is safe to call from
+        //! concurrently called ListPrefabs callbacks. Objects are stored in the same order as when the prefabs are listed
+        //! one after the other.
+        virtual void AddProcessedObject(ProcessedObjectStore object);
         virtual ProcessedObjectStoreContainer& GetProcessedObjects();
         virtual const ProcessedObjectStoreContainer& GetProcessedObjects() const;
 
@@ -66,7 +76,9 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
 
         AZ::PlatformTagSet m_platformTags;
         AZ::Uuid m_sourceUuid;
+        AZStd::mutex m_resultsMutex; //!< Guards the products, dependencies and success state during concurrent iteration.
         bool m_isIterating{ false };
+        bool m_concurrentIteration{ false };
         bool m_completedSuccessfully{ true };
     };
 } // namespace AzToolsFramework::Prefab::PrefabConversionUtils
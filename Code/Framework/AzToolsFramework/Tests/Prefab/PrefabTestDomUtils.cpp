@@ -69,7 +69,7 @@ namespace UnitTest
             ASSERT_TRUE(templateId != AzToolsFramework::Prefab::InvalidTemplateId);
             auto instancesReference = templateInstanceMapper->FindInstancesOwnedByTemplate(templateId);
             ASSERT_TRUE(instancesReference.has_value());
-            auto& actualInstances = instancesReference->get();
+            const InstanceSet& actualInstances = *instancesReference;
 
             for (auto instance : actualInstances)
             {
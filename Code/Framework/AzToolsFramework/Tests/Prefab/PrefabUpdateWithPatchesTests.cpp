@@ -145,4 +145,99 @@ namespace UnitTest
         PrefabTestDomUtils::ValidatePrefabDomInstances(axleInstanceAliasesUnderCar, carTemplateDom, axleTemplateDom);
     }
 
+    TEST_F(PrefabUpdateWithPatchesTest, PatchEntityInTemplate_ComponentUpdated_OnlyPatchedEntityIsReloaded)
+    {
+        // Create a wheel template with two entities, one of which has a PrefabTestComponent.
+        AZ::Entity* wheelEntity = CreateEntity("WheelEntity", false);
+        PrefabTestComponent* prefabTestComponent = aznew PrefabTestComponent(true);
+        wheelEntity->AddComponent(prefabTestComponent);
+        AZ::Entity* tireEntity = CreateEntity("TireEntity", false);
+
+        AzToolsFramework::EditorEntityContextRequestBus::Broadcast(
+            &AzToolsFramework::EditorEntityContextRequests::HandleEntitiesAdded, AzToolsFramework::EntityList{ wheelEntity, tireEntity });
+        AZStd::unique_ptr<Instance> wheelIsolatedInstance = m_prefabSystemComponent->CreatePrefab({ wheelEntity, tireEntity },
+            {}, WheelPrefabMockFilePath);
+        const TemplateId wheelTemplateId = wheelIsolatedInstance->GetTemplateId();
+        const EntityAlias wheelEntityAlias = wheelIsolatedInstance->GetEntityAlias(wheelEntity->GetId())->get();
+        const EntityAlias tireEntityAlias = wheelIsolatedInstance->GetEntityAlias(tireEntity->GetId())->get();
+
+        AZStd::unique_ptr<Instance> wheelInstance = m_prefabSystemComponent->InstantiatePrefab(wheelTemplateId);
+        ASSERT_TRUE(wheelInstance);
+        const AZ::EntityId wheelEntityIdInInstance = wheelInstance->GetEntityId(wheelEntityAlias);
+
+        auto findEntity = [](Instance& instance, const AZ::EntityId& entityId)
+        {
+            AZ::Entity* foundEntity = nullptr;
+            instance.GetEntities([&foundEntity, entityId](AZStd::unique_ptr<AZ::Entity>& entity)
+            {
+                if (entity->GetId() == entityId)
+                {
+                    foundEntity = entity.get();
+                    return false;
+                }
+                return true;
+            });
+            return foundEntity;
+        };
+        AZ::Entity* tireEntityInInstance = findEntity(*wheelInstance, wheelInstance->GetEntityId(tireEntityAlias));
+        ASSERT_NE(nullptr, tireEntityInInstance);
+
+        // Change a property of the component and patch the wheel template with it.
+        PrefabDom entityDomBefore;
+        m_instanceToTemplateInterface->GenerateDomForEntity(entityDomBefore, *wheelEntity);
+        prefabTestComponent->m_intProperty = 5;
+        PrefabDom entityDomAfter;
+        m_instanceToTemplateInterface->GenerateDomForEntity(entityDomAfter, *wheelEntity);
+
+        PrefabDom patch;
+        m_instanceToTemplateInterface->GeneratePatch(patch, entityDomBefore, entityDomAfter);
+        ASSERT_TRUE(m_instanceToTemplateInterface->PatchEntityInTemplate(patch, wheelEntity->GetId()));
+        m_instanceUpdateExecutorInterface->UpdateTemplateInstancesInQueue();
+
+        // Validate that the untouched entity was kept and the patched entity was reloaded with the same id.
+        EXPECT_EQ(tireEntityInInstance, findEntity(*wheelInstance, wheelInstance->GetEntityId(tireEntityAlias)));
+        EXPECT_EQ(wheelEntityIdInInstance, wheelInstance->GetEntityId(wheelEntityAlias));
+
+        AZ::Entity* wheelEntityInInstance = findEntity(*wheelInstance, wheelEntityIdInInstance);
+        ASSERT_NE(nullptr, wheelEntityInInstance);
+        PrefabTestComponent* wheelComponentInInstance = wheelEntityInInstance->FindComponent<PrefabTestComponent>();
+        ASSERT_NE(nullptr, wheelComponentInInstance);
+        EXPECT_EQ(wheelComponentInInstance->m_intProperty, 5);
+    }
+
+    TEST_F(PrefabUpdateWithPatchesTest, GetEntityAliasesChangedByPatches_EntityContentPatches_ReturnsEntityAliases)
+    {
+        PrefabDom patches;
+        patches.Parse(R"([
+            { "op": "replace", "path": "/Entities/Entity_[1]/Components/Component_[2]/IntProperty", "value": 5 },
+            { "op": "add", "path": "/Entities/Entity_[3]/Components/Component_[4]", "value": {} },
+            { "op": "replace", "path": "/Entities/Entity_[1]", "value": {} }
+        ])");
+
+        AZStd::unordered_set<EntityAlias> entityAliases;
+        EXPECT_TRUE(PrefabDomUtils::GetEntityAliasesChangedByPatches(patches, entityAliases));
+        EXPECT_EQ(entityAliases.size(), 2);
+        EXPECT_TRUE(entityAliases.contains("Entity_[1]"));
+        EXPECT_TRUE(entityAliases.contains("Entity_[3]"));
+    }
+
+    TEST_F(PrefabUpdateWithPatchesTest, GetEntityAliasesChangedByPatches_StructuralPatches_ReturnsFalse)
+    {
+        const char* structuralPatches[] = {
+            R"([{ "op": "add", "path": "/Entities/Entity_[1]", "value": {} }])",
+            R"([{ "op": "remove", "path": "/Entities/Entity_[1]" }])",
+            R"([{ "op": "remove", "path": "/Instances/Instance_[1]" }])",
+            R"([{ "op": "replace", "path": "/ContainerEntity/Components/Component_[2]/IntProperty", "value": 5 }])",
+            R"([{ "op": "move", "from": "/Entities/Entity_[1]/Name", "path": "/Entities/Entity_[2]/Name" }])"
+        };
+
+        for (const char* structuralPatch : structuralPatches)
+        {
+            PrefabDom patches;
+            patches.Parse(structuralPatch);
+
+            AZStd::unordered_set<EntityAlias> entityAliases;
+            EXPECT_FALSE(PrefabDomUtils::GetEntityAliasesChangedByPatches(patches, entityAliases)) << structuralPatch;
+        }
+    }
 }
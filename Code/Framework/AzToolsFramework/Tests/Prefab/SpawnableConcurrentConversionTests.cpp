@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Prefab/PrefabTestFixture.h>
+
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/utils.h>
+#include <AzCore/std/sort.h>
+#include <AzFramework/Spawnable/Spawnable.h>
+#include <AzToolsFramework/Prefab/Spawnable/PrefabCatchmentProcessor.h>
+#include <AzToolsFramework/Prefab/Spawnable/PrefabProcessorContext.h>
+
+namespace UnitTest
+{
+    using namespace AzToolsFramework::Prefab::PrefabConversionUtils;
+
+    class SpawnableConcurrentConversionTest
+        : public PrefabTestFixture
+    {
+    protected:
+        // The id and entity names of every spawnable, in the order in which the context stores them. The products are what
+        // the concurrent pass collects from the jobs, so their order is compared as is. The entities of a spawnable are
+        // loaded by a single job in either mode; their names are sorted so a mismatch reads as a missing entity.
+        using SpawnableEntityNames = AZStd::vector<AZStd::pair<AZStd::string, AZStd::vector<AZStd::string>>>;
+
+        static constexpr int PrefabCount = 8;
+
+        void AddPrefabs(PrefabProcessorContext& context)
+        {
+            for (const auto& [name, templateId] : m_templateIds)
+            {
+                PrefabDom prefabDom;
+                prefabDom.CopyFrom(m_prefabSystemComponent->FindTemplateDom(templateId), prefabDom.GetAllocator());
+                EXPECT_TRUE(context.AddPrefab(name, AZStd::move(prefabDom)));
+            }
+        }
+
+        SpawnableEntityNames Convert(bool concurrent)
+        {
+            PrefabProcessorContext context(AZ::Uuid::CreateRandom());
+            AddPrefabs(context);
+
+            // the pipeline enables concurrent iteration for processors that are thread-safe, see PrefabConversionPipeline::ProcessPrefab
+            PrefabCatchmentProcessor processor;
+            EXPECT_TRUE(processor.IsThreadSafe());
+            context.SetConcurrentIteration(concurrent);
+            processor.Process(context);
+            context.SetConcurrentIteration(false);
+
+            EXPECT_TRUE(context.HasCompletedSuccessfully());
+
+            SpawnableEntityNames result;
+            for (const ProcessedObjectStore& object : context.GetProcessedObjects())
+            {
+                EXPECT_EQ(object.GetAssetType(), azrtti_typeid<AzFramework::Spawnable>());
+                const auto& spawnable = static_cast<const AzFramework::Spawnable&>(object.GetAsset());
+
+                AZStd::vector<AZStd::string>& names = result.emplace_back(object.GetId(), AZStd::vector<AZStd::string>()).second;
+                for (const auto& entity : spawnable.GetEntities())
+                {
+                    names.push_back(entity->GetName());
+                }
+                AZStd::sort(names.begin(), names.end());
+            }
+            return result;
+        }
+
+        void SetUpEditorFixtureImpl() override
+        {
+            PrefabTestFixture::SetUpEditorFixtureImpl();
+
+            // Every prefab nests another one, so that loading the instances during conversion registers entities and nested
+            // instances with the mappers from several threads at once
+            for (int i = 0; i < PrefabCount; ++i)
+            {
+                AZStd::unique_ptr<Instance> nestedInstance(m_prefabSystemComponent->CreatePrefab(
+                    { CreateEntity(AZStd::string::format("Nested_%i", i).c_str()) }, {},
+                    AZStd::string::format("test/nested%i", i).c_str()));
+                ASSERT_TRUE(nestedInstance);
+
+                AZStd::vector<AZ::Entity*> entities;
+                for (int j = 0; j < 4; ++j)
+                {
+                    entities.push_back(CreateEntity(AZStd::string::format("Entity_%i_%i", i, j).c_str()));
+                }
+
+                AZStd::unique_ptr<Instance> instance(m_prefabSystemComponent->CreatePrefab(
+                    entities, MakeInstanceList(AZStd::move(nestedInstance)), AZStd::string::format("test/path%i", i).c_str()));
+                ASSERT_TRUE(instance);
+
+                m_templateIds.emplace_back(AZStd::string::format("Prefab_%i", i), instance->GetTemplateId());
+                m_instances.push_back(AZStd::move(instance));
+            }
+        }
+
+        void TearDownEditorFixtureImpl() override
+        {
+            m_instances.clear();
+            m_templateIds.clear();
+
+            PrefabTestFixture::TearDownEditorFixtureImpl();
+        }
+
+        AZStd::vector<AZStd::pair<AZStd::string, TemplateId>> m_templateIds;
+        AZStd::vector<AZStd::unique_ptr<Instance>> m_instances;
+    };
+
+    TEST_F(SpawnableConcurrentConversionTest, ConcurrentConversion_MatchesSerialConversion)
+    {
+        // Without a job context ListPrefabs quietly falls back to iterating serially
+        ASSERT_NE(AZ::JobContext::GetGlobalContext(), nullptr);
+
+        const SpawnableEntityNames serial = Convert(false);
+        const SpawnableEntityNames concurrent = Convert(true);
+
+        EXPECT_EQ(serial.size(), PrefabCount);
+        ASSERT_EQ(concurrent.size(), serial.size());
+        for (size_t i = 0; i < serial.size(); ++i)
+        {
+            // the products are expected in the same order, not just the same set of products
+            EXPECT_EQ(concurrent[i].first, serial[i].first) << "Spawnable " << i << " differs from the serial conversion.";
+            EXPECT_EQ(concurrent[i].second, serial[i].second);
+
+            // 4 entities, the nested entity and the container entities of the prefab and its nested instance
+            EXPECT_EQ(serial[i].second.size(), 7);
+        }
+    }
+
+    TEST_F(SpawnableConcurrentConversionTest, ConcurrentConversion_RepeatedRuns_ProduceTheSameSpawnables)
+    {
+        ASSERT_NE(AZ::JobContext::GetGlobalContext(), nullptr);
+
+        // repeat the conversion so that different interleavings of the jobs are covered, every run has to store the
+        // products in the same order as the serial conversion
+        const SpawnableEntityNames expected = Convert(false);
+        for (int run = 0; run < 8; ++run)
+        {
+            const SpawnableEntityNames actual = Convert(true);
+            ASSERT_EQ(actual.size(), expected.size());
+            for (size_t i = 0; i < expected.size(); ++i)
+            {
+                EXPECT_EQ(actual[i].first, expected[i].first) << "Run " << run << " stored spawnable " << i << " out of order.";
+                EXPECT_EQ(actual[i].second, expected[i].second);
+            }
+        }
+    }
+}
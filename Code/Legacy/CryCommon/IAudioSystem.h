@@ -825,6 +825,12 @@ namespace Audio
             , nCountUnusedAudioTriggers(0)
             , nCountUsedAudioEvents(0)
             , nCountUnusedAudioEvents(0)
+            , nCountRequestsLastUpdate(0)
+            , nCountCoalescedRequestsLastUpdate(0)
+            , nCountAudibleAudioObjects(0)
+            , nCountVirtualAudioObjects(0)
+            , nFileCacheResidentBytes(0)
+            , nFileCachePeakBytes(0)
         {}
 
         AZStd::size_t nCountUsedAudioTriggers;
@@ -832,6 +838,20 @@ namespace Audio
         AZStd::size_t nCountUsedAudioEvents;
         AZStd::size_t nCountUnusedAudioEvents;
 
+        // Requests the audio thread drained from the request queues during its last update, and how many of those
+        // were redundant position/RTPC updates that were coalesced before reaching the ATL.
+        AZStd::size_t nCountRequestsLastUpdate;
+        AZStd::size_t nCountCoalescedRequestsLastUpdate;
+
+        // Audio objects with active events during the last update, split by whether they were close enough to the
+        // listener to be audible or were virtualized because of their distance.
+        AZStd::size_t nCountAudibleAudioObjects;
+        AZStd::size_t nCountVirtualAudioObjects;
+
+        // Sound bank memory held by the file cache as of the last update, and the most it has held at once.
+        AZStd::size_t nFileCacheResidentBytes;
+        AZStd::size_t nFileCachePeakBytes;
+
         AZ::Vector3 oListenerPos;
     };
 
@@ -966,10 +986,9 @@ namespace Audio
         virtual ~AudioSystemThreadSafeRequests() = default;
 
         ///////////////////////////////////////////////////////////////////////////////////////////////
-        // EBusTraits - Single Bus Address, Single Handler, Mutex, Queued
+        // EBusTraits - Single Bus Address, Single Handler, Mutex
         static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
         static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
-        static const bool EnableEventQueue = true;
         using MutexType = AZStd::recursive_mutex;
         ///////////////////////////////////////////////////////////////////////////////////////////////
 
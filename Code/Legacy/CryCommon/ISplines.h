@@ -667,10 +667,26 @@ namespace spline
         inline int seek_key(float t)
         {
             assert(num_keys() < (1 << 15));
-            if ((m_curr >= num_keys()) || (time(m_curr) > t))
+            if ((m_curr >= num_keys()) || (time(m_curr) > t) || ((m_curr + 2 < num_keys()) && (time(m_curr + 2) <= t)))
             {
-                // Search from begining.
-                m_curr = 0;
+                // Not in the current or the next segment (seeking backwards or skipping ahead), binary search for the
+                // last key at or before t instead of scanning from the beginning.
+                int low = 0;
+                int high = num_keys();
+                while (low < high)
+                {
+                    const int mid = (low + high) / 2;
+                    if (time(mid) <= t)
+                    {
+                        low = mid + 1;
+                    }
+                    else
+                    {
+                        high = mid;
+                    }
+                }
+                m_curr = static_cast<int16>(low > 0 ? low - 1 : 0);
+                return m_curr;
             }
             while ((m_curr < num_keys() - 1) && (time(m_curr + 1) <= t))
             {
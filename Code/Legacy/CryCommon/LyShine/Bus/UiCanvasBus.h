@@ -339,6 +339,11 @@ public: // member functions
     //! cleared and rebuilt on the next render.
     virtual void MarkRenderGraphDirty() = 0;
 
+    //! Mark a single element as needing to be re-rendered into the render graph on the next render. The rest
+    //! of the graph is kept, unless the element now renders something that cannot replace what it rendered
+    //! before, in which case the whole graph gets rebuilt.
+    virtual void MarkRenderGraphElementDirty(AZ::EntityId elementId) = 0;
+
 public: // static member data
 
     //! Only one component on an entity can implement the events
@@ -29,6 +29,15 @@ namespace AZ
                 virtual ISceneNodeSelectionList& GetSceneNodeSelectionList(size_t index) = 0;
                 virtual const ISceneNodeSelectionList& GetSceneNodeSelectionList(size_t index) const = 0;
                 virtual size_t GetLodCount() const = 0;
+
+                //! Number of LODs that are generated by simplifying LOD0 when no LOD meshes have been assigned.
+                virtual size_t GetGeneratedLodCount() const = 0;
+                //! Fraction of the LOD0 triangle count the generated LOD at the given index aims for.
+                virtual float GetGeneratedLodTriangleRatio(size_t index) const = 0;
+                //! Largest simplification error allowed for the generated LOD at the given index, relative to the size of the mesh.
+                //! This is the screen-space error at a screen coverage of 1, so it scales with the distance the LOD is shown at.
+                //! A value of 0 means only the triangle ratio limits the simplification.
+                virtual float GetGeneratedLodMaxError(size_t index) const = 0;
             };
         }  // DataTypes
     }  // SceneAPI
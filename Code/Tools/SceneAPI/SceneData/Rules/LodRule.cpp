@@ -57,6 +57,21 @@ namespace AZ
                 return m_nodeSelectionLists.size();
             }
 
+            size_t LodRule::GetGeneratedLodCount() const
+            {
+                return m_generatedLods.size();
+            }
+
+            float LodRule::GetGeneratedLodTriangleRatio(size_t index) const
+            {
+                return index < m_generatedLods.size() ? m_generatedLods[index].m_triangleRatio : 1.0f;
+            }
+
+            float LodRule::GetGeneratedLodMaxError(size_t index) const
+            {
+                return index < m_generatedLods.size() ? m_generatedLods[index].m_maxError : 0.0f;
+            }
+
             void LodRule::AddLod()
             {
                 if (m_nodeSelectionLists.size() < m_nodeSelectionLists.capacity())
@@ -65,16 +80,59 @@ namespace AZ
                 }
             }
 
+            void LodRule::AddGeneratedLod(float triangleRatio, float maxError)
+            {
+                if (m_generatedLods.size() < m_generatedLods.capacity())
+                {
+                    GeneratedLodSettings settings;
+                    settings.m_triangleRatio = triangleRatio;
+                    settings.m_maxError = maxError;
+                    m_generatedLods.push_back(settings);
+                }
+            }
+
+            void GeneratedLodSettings::Reflect(ReflectContext* context)
+            {
+                SerializeContext* serializeContext = azrtti_cast<SerializeContext*>(context);
+                if (!serializeContext)
+                {
+                    return;
+                }
+
+                serializeContext->Class<GeneratedLodSettings>()->Version(1)
+                    ->Field("triangleRatio", &GeneratedLodSettings::m_triangleRatio)
+                    ->Field("maxError", &GeneratedLodSettings::m_maxError);
+
+                EditContext* editContext = serializeContext->GetEditContext();
+                if (editContext)
+                {
+                    editContext->Class<GeneratedLodSettings>("Generated LOD", "Simplification targets for a LOD generated from LOD0.")
+                        ->ClassElement(Edit::ClassElements::EditorData, "")
+                            ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+                        ->DataElement(Edit::UIHandlers::Slider, &GeneratedLodSettings::m_triangleRatio, "Triangle ratio",
+                            "Fraction of the LOD0 triangles to keep. Simplification may stop earlier to respect the error limit or to preserve seams and borders.")
+                            ->Attribute(Edit::Attributes::Min, 0.01f)
+                            ->Attribute(Edit::Attributes::Max, 1.0f)
+                        ->DataElement(Edit::UIHandlers::Default, &GeneratedLodSettings::m_maxError, "Max error",
+                            "Largest allowed deviation from LOD0 relative to the mesh size, which equals the screen-space error when the mesh covers the screen. 0 disables the limit.")
+                            ->Attribute(Edit::Attributes::Min, 0.0f)
+                            ->Attribute(Edit::Attributes::Max, 1.0f);
+                }
+            }
+
             void LodRule::Reflect(ReflectContext* context)
             {
+                GeneratedLodSettings::Reflect(context);
+
                 SerializeContext* serializeContext = azrtti_cast<SerializeContext*>(context);
                 if (!serializeContext)
                 {
                     return;
                 }
 
-                serializeContext->Class<LodRule, DataTypes::ILodRule>()->Version(1)
-                    ->Field("nodeSelectionList", &LodRule::m_nodeSelectionLists);
+                serializeContext->Class<LodRule, DataTypes::ILodRule>()->Version(2)
+                    ->Field("nodeSelectionList", &LodRule::m_nodeSelectionLists)
+                    ->Field("generatedLods", &LodRule::m_generatedLods);
 
                 EditContext* editContext = serializeContext->GetEditContext();
                 if (editContext)
@@ -85,7 +143,9 @@ namespace AZ
                             ->Attribute(AZ::Edit::Attributes::NameLabelOverride, "")
                         ->DataElement(Edit::UIHandlers::Default, &LodRule::m_nodeSelectionLists, "Lod Meshes", "Select the meshes to assign to each level of detail.")
                             ->ElementAttribute(AZ_CRC("FilterName", 0xf49ce62e), "Lod meshes")
-                            ->ElementAttribute(AZ_CRC("FilterType", 0x2661cf01), DataTypes::IMeshData::TYPEINFO_Uuid());
+                            ->ElementAttribute(AZ_CRC("FilterType", 0x2661cf01), DataTypes::IMeshData::TYPEINFO_Uuid())
+                        ->DataElement(Edit::UIHandlers::Default, &LodRule::m_generatedLods, "Generated LODs",
+                            "LODs generated by simplifying LOD0. Only used when no LOD meshes have been assigned.");
                 }
             }
         } // namespace SceneData
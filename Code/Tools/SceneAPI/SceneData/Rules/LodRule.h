@@ -9,6 +9,7 @@
  */
 
 #include <AzCore/Memory/Memory.h>
+#include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/fixed_vector.h>
 #include <SceneAPI/SceneCore/DataTypes/Rules/ILodRule.h>
 #include <SceneAPI/SceneData/ManifestBase/SceneNodeSelectionList.h>
@@ -25,6 +26,19 @@ namespace AZ
         }
         namespace SceneData
         {
+            //! Simplification targets for a single LOD generated from LOD0.
+            class GeneratedLodSettings
+            {
+            public:
+                AZ_TYPE_INFO(GeneratedLodSettings, "{2244AC7E-B7D6-4A53-BCD5-01B6F4178258}");
+                AZ_CLASS_ALLOCATOR(GeneratedLodSettings, SystemAllocator, 0);
+
+                static void Reflect(ReflectContext* context);
+
+                float m_triangleRatio = 0.5f;
+                float m_maxError = 0.0f;
+            };
+
             class LodRule
                 : public DataTypes::ILodRule
             {
@@ -40,7 +54,12 @@ namespace AZ
                 const DataTypes::ISceneNodeSelectionList& GetSceneNodeSelectionList(size_t index) const override;
                 size_t GetLodCount() const override;
 
+                size_t GetGeneratedLodCount() const override;
+                float GetGeneratedLodTriangleRatio(size_t index) const override;
+                float GetGeneratedLodMaxError(size_t index) const override;
+
                 void AddLod();
+                void AddGeneratedLod(float triangleRatio, float maxError = 0.0f);
 
                 static void Reflect(ReflectContext* context);
                 //The engine supports 6 total lods.  1 for the base model then 5 more lods.  
@@ -49,6 +68,7 @@ namespace AZ
             protected:
 
                 AZStd::fixed_vector<SceneNodeSelectionList, m_maxLods> m_nodeSelectionLists;
+                AZStd::fixed_vector<GeneratedLodSettings, m_maxLods> m_generatedLods;
             };
         } // SceneData
     } // SceneAPI
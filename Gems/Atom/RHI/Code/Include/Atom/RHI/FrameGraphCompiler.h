@@ -7,18 +7,32 @@
  */
 #pragma once
 
+#include <Atom/RHI.Reflect/AttachmentEnums.h>
+#include <Atom/RHI.Reflect/AttachmentId.h>
 #include <Atom/RHI.Reflect/FrameSchedulerEnums.h>
+#include <Atom/RHI.Reflect/ScopeId.h>
 #include <Atom/RHI/Object.h>
 #include <Atom/RHI/ObjectCache.h>
 #include <Atom/RHI/ImageView.h>
 #include <Atom/RHI/BufferView.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/utils.h>
+
+namespace AZ
+{
+    class TaskGraphActiveInterface;
+}
 
 namespace AZ
 {
     namespace RHI
     {
+        class BufferFrameAttachment;
         class FrameGraph;
         class FrameGraphAttachmentDatabase;
+        class ImageFrameAttachment;
         class ResourcePoolFrameAttachment;
         class TransientAttachmentPool;
 
@@ -43,6 +57,9 @@ namespace AZ
 
             /// Flags controlling statistics of the pools.
             FrameSchedulerStatisticsFlags m_statisticsFlags = FrameSchedulerStatisticsFlags::None;
+
+            /// Controls whether the independent compile phases are allowed to use jobs.
+            JobPolicy m_jobPolicy = JobPolicy::Serial;
         };
 
         /**
@@ -52,7 +69,13 @@ namespace AZ
          * platform-specific scope construction.
          *
          * The compiler is designed to be invoked every frame; the graph is simply rebuilt each time. The compile
-         * operation is also done on a single thread; so overhead should be kept to a minimum.
+         * operation is driven from a single thread; so overhead should be kept to a minimum. Resource view compilation
+         * is independent for each attachment and is split across jobs when the request allows it.
+         *
+         * Most frames have the same structure as the previous one. The compiler records the scopes, their queues,
+         * consumers and attachment usages, and the transient attachment lifetimes of the graph. When they are identical to
+         * the previous frame, the queue-centric graph edges and the sorted transient attachment commands of the previous frame
+         * are replayed instead of being computed again.
          *
          * The RHI base class performs platform-independent compilation before passing control down to the derived
          * platform implementation. The provided FrameGraph instance is compiled in-place according to the
@@ -125,6 +148,9 @@ namespace AZ
              */
             MessageOutcome Compile(const FrameGraphCompileRequest& request);
 
+            /// Returns whether the last compiled frame graph reused the cached results of the previous frame.
+            bool IsCompiledGraphCacheHit() const;
+
         protected:
             FrameGraphCompiler() = default;
 
@@ -146,10 +172,64 @@ namespace AZ
 
             MessageOutcome ValidateCompileRequest(const FrameGraphCompileRequest& request) const;
 
+            /// Everything the queue-centric graph and the transient attachment lifetimes depend on. The results of the
+            /// previous frame are only replayed when the structure of the frame graph compares equal to the previous one.
+            struct CompiledGraphStructure
+            {
+                struct ScopeEntry
+                {
+                    ScopeId m_scopeId;
+                    HardwareQueueClass m_hardwareQueueClass = HardwareQueueClass::Graphics;
+                    uint32_t m_consumerCount = 0;
+                    uint32_t m_attachmentCount = 0;
+
+                    bool operator==(const ScopeEntry& rhs) const;
+                };
+
+                struct ScopeAttachmentEntry
+                {
+                    AttachmentId m_attachmentId;
+                    ScopeAttachmentUsage m_usage = ScopeAttachmentUsage::Uninitialized;
+                    ScopeAttachmentAccess m_access = ScopeAttachmentAccess::ReadWrite;
+                    bool m_isTransient = false;
+
+                    bool operator==(const ScopeAttachmentEntry& rhs) const;
+                };
+
+                struct TransientAttachmentEntry
+                {
+                    AttachmentId m_attachmentId;
+                    uint32_t m_firstScopeIndex = 0;
+                    uint32_t m_lastScopeIndex = 0;
+                    HardwareQueueClassMask m_supportedQueueMask = HardwareQueueClassMask::None;
+
+                    bool operator==(const TransientAttachmentEntry& rhs) const;
+                };
+
+                bool operator==(const CompiledGraphStructure& rhs) const;
+
+                void Clear();
+
+                FrameSchedulerCompileFlags m_compileFlags = FrameSchedulerCompileFlags::None;
+                AZStd::vector<ScopeEntry> m_scopes;
+                AZStd::vector<uint32_t> m_consumerIndices;              //!< Consumers of every scope, in scope order.
+                AZStd::vector<ScopeAttachmentEntry> m_scopeAttachments; //!< Usages of the attachments of every scope, in scope order.
+                AZStd::vector<TransientAttachmentEntry> m_transientBuffers;
+                AZStd::vector<TransientAttachmentEntry> m_transientImages;
+            };
+
+            /// Records the structure of the frame graph that the queue-centric graph and the transient attachment lifetimes depend on.
+            void GetCompiledGraphStructure(const FrameGraph& frameGraph, FrameSchedulerCompileFlags compileFlags, CompiledGraphStructure& structure) const;
+
             void CompileQueueCentricScopeGraph(
                 FrameGraph& frameGraph,
                 FrameSchedulerCompileFlags compileFlags);
 
+            /// Applies the queue-centric graph edges recorded by the last CompileQueueCentricScopeGraph.
+            void ApplyCachedQueueCentricScopeGraph(
+                FrameGraph& frameGraph,
+                FrameSchedulerCompileFlags compileFlags);
+
             void ExtendTransientAttachmentAsyncQueueLifetimes(
                 FrameGraph& frameGraph,
                 FrameSchedulerCompileFlags compileFlags);
@@ -160,16 +240,44 @@ namespace AZ
                 FrameSchedulerCompileFlags compileFlags,
                 FrameSchedulerStatisticsFlags statisticsFlags);
 
-            void CompileResourceViews(const FrameGraphAttachmentDatabase& attachmentDatabase);
+            void CompileResourceViews(const FrameGraphAttachmentDatabase& attachmentDatabase, JobPolicy jobPolicy);
+            void CompileImageViews(ImageFrameAttachment& imageAttachment);
+            void CompileBufferViews(BufferFrameAttachment& bufferAttachment);
 
             //Returns the resource from local cache if it exists within it or create one if it doesn't and add it to the cache
             ImageView* GetImageViewFromLocalCache(Image* image, const ImageViewDescriptor& imageViewDescriptor);
             BufferView* GetBufferViewFromLocalCache(Buffer* buffer, const BufferViewDescriptor& bufferViewDescriptor);
             
             // This cache is mainly for transient resources. It adds a dependency to the resource views and hence they wont be
-            // deleted at the end of the frame and re-created at the start. Mainly used as an optimization.  
-            ObjectCache<ImageView> m_imageViewCache;
-            ObjectCache<BufferView> m_bufferViewCache;
+            // deleted at the end of the frame and re-created at the start. Mainly used as an optimization.
+            // The cache is split in shards selected by the hash of the view, so the resource view compile jobs only wait on
+            // each other when they look up views that fall in the same shard.
+            struct ViewCacheShard
+            {
+                AZStd::mutex m_mutex;
+                ObjectCache<ImageView> m_imageViewCache;
+                ObjectCache<BufferView> m_bufferViewCache;
+            };
+            static constexpr uint32_t ViewCacheShardCount = 8;
+            AZStd::array<ViewCacheShard, ViewCacheShardCount> m_viewCacheShards;
+
+            AZ::TaskGraphActiveInterface* m_taskGraphActive = nullptr;
+
+            // Results of the last compiled frame graph, reused when the structure of the next frame is identical.
+            CompiledGraphStructure m_compiledGraphStructure;
+            CompiledGraphStructure m_nextGraphStructure; //!< Kept between frames so recording the structure doesn't allocate.
+            bool m_hasCompiledGraphStructure = false;
+            bool m_isCompiledGraphCacheHit = false;
+
+            // Producer / consumer scope index pairs, in the order they were linked by CompileQueueCentricScopeGraph.
+            AZStd::vector<AZStd::pair<uint32_t, uint32_t>> m_queueCentricScopeLinks;
+
+            // First and last scope indices of each transient buffer and image, after extending the async queue lifetimes.
+            AZStd::vector<AZStd::pair<uint32_t, uint32_t>> m_transientBufferLifetimes;
+            AZStd::vector<AZStd::pair<uint32_t, uint32_t>> m_transientImageLifetimes;
+
+            // Sorted activation / deactivation commands of the transient attachments.
+            AZStd::vector<uint32_t> m_transientAttachmentCommands;
 
         };
     }
@@ -54,7 +54,8 @@ namespace AZ
             /// Controls whether the phase is allowed to use jobs.
             JobPolicy m_jobPolicy = JobPolicy::Parallel;
 
-            /// Controls the number of ShaderResourceGroups compiled per job.
+            /// Controls the maximum number of ShaderResourceGroups compiled per job. Smaller frames are split
+            /// in smaller jobs to keep all the workers busy.
             uint32_t m_shaderResourceGroupCompilesPerJob = 256;
         };
 
@@ -190,6 +191,7 @@ namespace AZ
             void PrepareProducers();
             void CompileProducers();
             void CompileShaderResourceGroups();
+            uint32_t GetShaderResourceGroupCompilesPerJob(uint32_t compileCount, uint32_t workerCount) const;
             void BuildRayTracingShaderTables();
 
             ScopeProducer* FindScopeProducer(const ScopeId& scopeId);
@@ -225,6 +227,9 @@ namespace AZ
             AZStd::vector<ScopeProducer*> m_scopeProducers;
             AZStd::unordered_map<ScopeId, ScopeProducer*> m_scopeProducerLookup;
 
+            // SRG pools with groups to compile this frame, kept to reuse the allocation
+            AZStd::vector<ShaderResourceGroupPool*> m_shaderResourceGroupPoolsToCompile;
+
             // list of RayTracingShaderTables that should be built this frame
             AZStd::vector<RHI::Ptr<RayTracingShaderTable>> m_rayTracingShaderTablesToBuild;
 
@@ -22,6 +22,20 @@ namespace AZ
 {
     namespace RHI
     {
+        //! Requests that missed the global read-only cache during the last cycle, gathered by PipelineStateCache::Compact.
+        //! Once the cache is warm all requests hit the read-only cache and every count is zero.
+        struct PipelineStateCacheMetrics
+        {
+            //! Requests found in the thread-local cache.
+            uint32_t m_threadLocalCacheHitCount = 0;
+
+            //! Requests found in the pending cache, compiling or compiled by another thread.
+            uint32_t m_pendingCacheHitCount = 0;
+
+            //! Pipeline states compiled.
+            uint32_t m_compileCount = 0;
+        };
+
         /**
          * Problem: High-level rendering code works in 'materials', 'shaders', and 'models', but the RHI works in
          * 'pipeline states'. Therefore, a translation process must exist to resolve a shader variation (plus runtime
@@ -149,6 +163,9 @@ namespace AZ
              */
             void Compact();
 
+            /// Returns the requests that missed the global read-only cache during the last cycle.
+            const PipelineStateCacheMetrics& GetMetrics() const;
+
         private:
             PipelineStateCache(Device& device);
 
@@ -216,6 +233,9 @@ namespace AZ
                  * and uses the initial serialized data passed in at creation time.
                  */
                 Ptr<PipelineLibrary> m_library;
+
+                /// Read-only cache misses of this thread since the last Compact, kept per thread to avoid contention.
+                PipelineStateCacheMetrics m_metrics;
             };
 
             /**
@@ -260,6 +280,9 @@ namespace AZ
             /// to recycle slots in m_globalLibrarySet.
             AZStd::fixed_vector<PipelineLibraryHandle, LibraryCountMax> m_libraryFreeList;
 
+            /// The thread metrics of all libraries, gathered during the last Compact.
+            PipelineStateCacheMetrics m_metrics;
+
             // Friends
             friend class UnitTest::PipelineStateTests;
         };
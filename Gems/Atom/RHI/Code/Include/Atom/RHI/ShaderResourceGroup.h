@@ -66,6 +66,9 @@ namespace AZ
 
             // Gates the Compile() function so that the SRG is only queued once.
             bool m_isQueuedForCompile = false;
+
+            // Set once the platform compiled the group, compiles are never skipped before that.
+            bool m_isCompiled = false;
         };
     }
 }
@@ -183,6 +183,10 @@ namespace AZ
             //! Returns the shader resource layout for this group.
             const ShaderResourceGroupLayout* GetLayout() const;
 
+            //! Returns true if both packets use the same layout, reference the same views and samplers and hold the
+            //! same constant data. The compilation state of the resource types is not compared.
+            bool HasSameContents(const ShaderResourceGroupData& other) const;
+
             enum class ResourceType : uint32_t
             {
                 ConstantData,
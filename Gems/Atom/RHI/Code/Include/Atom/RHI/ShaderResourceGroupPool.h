@@ -59,6 +59,10 @@ namespace AZ
             //! Returns the total number of groups that need to be compiled.
             uint32_t GetGroupsToCompileCount() const;
 
+            //! Returns the number of compile requests skipped since the last compilation of the pool because the
+            //! groups already held the requested data.
+            uint32_t GetSkippedCompileCount() const;
+
             //////////////////////////////////////////////////////////////////////////
 
             //! Returns whether layout in this pool has constants.
@@ -100,6 +104,9 @@ namespace AZ
 
             // Calculate diffs for updating the resource registry.
             void CalculateGroupDataDiff(ShaderResourceGroup& shaderResourceGroup, const ShaderResourceGroupData& groupData);
+
+            // Returns true if compiling the group with the new data would not change what the platform holds for the group.
+            bool IsCompileRedundant(const ShaderResourceGroup& shaderResourceGroup, const ShaderResourceGroupData& groupData) const;
           
             //////////////////////////////////////////////////////////////////////////
             // Platform API
@@ -127,6 +134,7 @@ namespace AZ
 
             mutable AZStd::shared_mutex m_groupsToCompileMutex;
             AZStd::vector<ShaderResourceGroup*> m_groupsToCompile;
+            uint32_t m_skippedCompileCount = 0;
 
             AZStd::mutex m_invalidateRegistryMutex;
             ShaderResourceGroupInvalidateRegistry m_invalidateRegistry;
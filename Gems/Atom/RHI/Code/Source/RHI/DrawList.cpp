@@ -7,12 +7,165 @@
  */
 #include <Atom/RHI/DrawList.h>
 
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/sort.h>
 
+#include <cstring>
+
 namespace AZ
 {
     namespace RHI
     {
+        namespace
+        {
+            // Lists smaller than this are sorted with a comparison sort, for them the cost of
+            // building the radix histograms is higher than what the radix sort saves.
+            constexpr size_t RadixSortMinItemCount = 512;
+
+            constexpr uint32_t RadixDigitBits = 8;
+            constexpr uint32_t RadixBucketCount = 1 << RadixDigitBits;
+            constexpr uint32_t RadixDigitMask = RadixBucketCount - 1;
+
+            // The radix key packs the 64 bit sort key and the 32 bit depth in 96 bits.
+            constexpr uint32_t RadixKeyLowDigitCount = 64 / RadixDigitBits;
+            constexpr uint32_t RadixPassCount = (64 + 32) / RadixDigitBits;
+
+            struct RadixSortEntry
+            {
+                uint64_t m_keyLow;
+                uint32_t m_keyHigh;
+                uint32_t m_itemIndex;
+            };
+
+            // Maps the signed sort key to an unsigned value with the same order.
+            uint64_t GetRadixSortKey(DrawItemSortKey sortKey)
+            {
+                return static_cast<uint64_t>(sortKey) ^ (uint64_t(1) << 63);
+            }
+
+            // Maps the depth to an unsigned value with the same order, or the opposite order when reversed.
+            uint32_t GetRadixDepth(float depth, bool reverse)
+            {
+                uint32_t depthBits;
+                memcpy(&depthBits, &depth, sizeof(depthBits));
+
+                // Negative floats order backwards as integers, so all their bits are flipped.
+                // Positive floats only need the sign bit set to order after the negative ones.
+                depthBits = (depthBits & 0x80000000u) ? ~depthBits : (depthBits | 0x80000000u);
+                return reverse ? ~depthBits : depthBits;
+            }
+
+            RadixSortEntry GetRadixSortEntry(const DrawItemProperties& item, uint32_t itemIndex, DrawListSortType sortType)
+            {
+                const uint64_t sortKey = GetRadixSortKey(item.m_sortKey);
+
+                RadixSortEntry entry;
+                entry.m_itemIndex = itemIndex;
+                switch (sortType)
+                {
+                case DrawListSortType::KeyThenDepth:
+                case DrawListSortType::KeyThenReverseDepth:
+                {
+                    const uint32_t depth = GetRadixDepth(item.m_depth, sortType == DrawListSortType::KeyThenReverseDepth);
+                    entry.m_keyLow = (sortKey << 32) | depth;
+                    entry.m_keyHigh = static_cast<uint32_t>(sortKey >> 32);
+                    break;
+                }
+                case DrawListSortType::DepthThenKey:
+                case DrawListSortType::ReverseDepthThenKey:
+                default:
+                    entry.m_keyLow = sortKey;
+                    entry.m_keyHigh = GetRadixDepth(item.m_depth, sortType == DrawListSortType::ReverseDepthThenKey);
+                    break;
+                }
+                return entry;
+            }
+
+            uint32_t GetRadixDigit(const RadixSortEntry& entry, uint32_t pass)
+            {
+                if (pass < RadixKeyLowDigitCount)
+                {
+                    return static_cast<uint32_t>(entry.m_keyLow >> (pass * RadixDigitBits)) & RadixDigitMask;
+                }
+                return (entry.m_keyHigh >> ((pass - RadixKeyLowDigitCount) * RadixDigitBits)) & RadixDigitMask;
+            }
+
+            // Least significant digit radix sort. The keys are sorted along with the item indices,
+            // which are 16 bytes instead of the 24 bytes of the draw item properties, and the items
+            // are moved only once at the end, in place.
+            void RadixSortDrawList(DrawList& drawList, DrawListSortType sortType)
+            {
+                const size_t itemCount = drawList.size();
+
+                // A single allocation holds the entries and the buffer they are scattered to on each pass.
+                AZStd::vector<RadixSortEntry> entryBuffer;
+                entryBuffer.resize_no_construct(itemCount * 2);
+                RadixSortEntry* entries = entryBuffer.data();
+                RadixSortEntry* scratchEntries = entries + itemCount;
+
+                // The histograms of all the passes are built at once with a single read of the items.
+                AZStd::array<AZStd::array<uint32_t, RadixBucketCount>, RadixPassCount> histograms = {};
+                for (size_t itemIndex = 0; itemIndex < itemCount; ++itemIndex)
+                {
+                    const RadixSortEntry entry = GetRadixSortEntry(drawList[itemIndex], static_cast<uint32_t>(itemIndex), sortType);
+                    entries[itemIndex] = entry;
+                    for (uint32_t pass = 0; pass < RadixPassCount; ++pass)
+                    {
+                        ++histograms[pass][GetRadixDigit(entry, pass)];
+                    }
+                }
+
+                for (uint32_t pass = 0; pass < RadixPassCount; ++pass)
+                {
+                    AZStd::array<uint32_t, RadixBucketCount>& histogram = histograms[pass];
+
+                    // Skip the passes where all the entries share the same digit, which is common for the
+                    // high bytes of the sort key. The entries would not move at all.
+                    if (histogram[GetRadixDigit(entries[0], pass)] == itemCount)
+                    {
+                        continue;
+                    }
+
+                    uint32_t offset = 0;
+                    for (uint32_t& bucket : histogram)
+                    {
+                        const uint32_t bucketSize = bucket;
+                        bucket = offset;
+                        offset += bucketSize;
+                    }
+
+                    for (size_t entryIndex = 0; entryIndex < itemCount; ++entryIndex)
+                    {
+                        const RadixSortEntry& entry = entries[entryIndex];
+                        scratchEntries[histogram[GetRadixDigit(entry, pass)]++] = entry;
+                    }
+                    AZStd::swap(entries, scratchEntries);
+                }
+
+                // Move the items to their sorted position by following the cycles of the permutation. Each entry
+                // is reset to point at itself once its slot holds the right item.
+                for (uint32_t itemIndex = 0; itemIndex < itemCount; ++itemIndex)
+                {
+                    if (entries[itemIndex].m_itemIndex == itemIndex)
+                    {
+                        continue;
+                    }
+
+                    const DrawItemProperties firstItem = drawList[itemIndex];
+                    uint32_t targetIndex = itemIndex;
+                    while (entries[targetIndex].m_itemIndex != itemIndex)
+                    {
+                        const uint32_t sourceIndex = entries[targetIndex].m_itemIndex;
+                        drawList[targetIndex] = drawList[sourceIndex];
+                        entries[targetIndex].m_itemIndex = targetIndex;
+                        targetIndex = sourceIndex;
+                    }
+                    drawList[targetIndex] = firstItem;
+                    entries[targetIndex].m_itemIndex = targetIndex;
+                }
+            }
+        }
+
         DrawListView GetDrawListPartition(DrawListView drawList, size_t partitionIndex, size_t partitionCount)
         {
             if (drawList.empty())
@@ -28,6 +181,12 @@ namespace AZ
 
         void SortDrawList(DrawList& drawList, DrawListSortType sortType)
         {
+            if (drawList.size() >= RadixSortMinItemCount)
+            {
+                RadixSortDrawList(drawList, sortType);
+                return;
+            }
+
             switch (sortType)
             {
             case DrawListSortType::KeyThenDepth:
@@ -17,8 +17,20 @@
 #include <Atom/RHI/Scope.h>
 #include <Atom/RHI/SwapChainFrameAttachment.h>
 #include <Atom/RHI/TransientAttachmentPool.h>
+#include <Atom/RHI.Reflect/Bits.h>
+#include <Atom/RHI.Reflect/Interval.h>
 #include <AzCore/Debug/EventTrace.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Statistics/StatisticalProfilerProxy.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/hash.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/optional.h>
 
@@ -26,6 +38,14 @@ namespace AZ
 {
     namespace RHI
     {
+        static constexpr const char* frameGraphCompileTimeMetricName = "FrameGraph Compile Time";
+        static constexpr AZ::Crc32 frameGraphCompileTimeMetricId = AZ_CRC_CE(frameGraphCompileTimeMetricName);
+        static constexpr const char* frameGraphCacheHitMetricName = "FrameGraph Compile Cache Hits";
+        static constexpr AZ::Crc32 frameGraphCacheHitMetricId = AZ_CRC_CE(frameGraphCacheHitMetricName);
+
+        //! Smallest number of attachments worth a resource view compile job of their own.
+        static constexpr uint32_t MinAttachmentViewCompilesPerJob = 16;
+
         ResultCode FrameGraphCompiler::Init(Device& device)
         {
             if (Validation::IsEnabled())
@@ -42,12 +62,23 @@ namespace AZ
             if (resultCode == ResultCode::Success)
             {
                 // These are immutable for now. Could be configured per-frame using the compile request.
+                // Each shard gets twice its share, so that views that don't spread evenly across the shards still fit.
                 const uint32_t BufferViewCapacity = 128;
-                m_bufferViewCache.SetCapacity(BufferViewCapacity);
-
                 const uint32_t ImageViewCapacity = 128;
-                m_imageViewCache.SetCapacity(ImageViewCapacity);
+                for (ViewCacheShard& viewCacheShard : m_viewCacheShards)
+                {
+                    viewCacheShard.m_bufferViewCache.SetCapacity(2 * BufferViewCapacity / ViewCacheShardCount);
+                    viewCacheShard.m_imageViewCache.SetCapacity(2 * ImageViewCapacity / ViewCacheShardCount);
+                }
+
+                m_taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
 
+                if (auto statsProfiler = AZ::Interface<AZ::Statistics::StatisticalProfilerProxy>::Get(); statsProfiler)
+                {
+                    auto& rhiMetrics = statsProfiler->GetProfiler(rhiMetricsId);
+                    rhiMetrics.GetStatsManager().AddStatistic(frameGraphCompileTimeMetricId, frameGraphCompileTimeMetricName, /*units=*/"clocks", /*failIfExist=*/false);
+                    rhiMetrics.GetStatsManager().AddStatistic(frameGraphCacheHitMetricId, frameGraphCacheHitMetricName, /*units=*/"count", /*failIfExist=*/false);
+                }
 
                 DeviceObject::Init(device);
             }
@@ -59,8 +90,21 @@ namespace AZ
         {
             if (IsInitialized())
             {
-                m_imageViewCache.Clear();
-                m_bufferViewCache.Clear();
+                for (ViewCacheShard& viewCacheShard : m_viewCacheShards)
+                {
+                    viewCacheShard.m_imageViewCache.Clear();
+                    viewCacheShard.m_bufferViewCache.Clear();
+                }
+
+                m_compiledGraphStructure = {};
+                m_nextGraphStructure = {};
+                m_hasCompiledGraphStructure = false;
+                m_isCompiledGraphCacheHit = false;
+                m_queueCentricScopeLinks = {};
+                m_transientBufferLifetimes = {};
+                m_transientImageLifetimes = {};
+                m_transientAttachmentCommands = {};
+                m_taskGraphActive = nullptr;
 
                 ShutdownInternal();
                 DeviceObject::Shutdown();
@@ -101,17 +145,20 @@ namespace AZ
          *          This phase takes the scope graph and compiles a queue-centric scope graph. The former is a simple
          *          producer / consumer graph where certain scopes can produce resources for consumer scopes. The queue-centric
          *          graph is split into tracks according to each hardware queue. Scopes are serialized onto each track according
-         *          to the topological sort, and cross-track dependencies are generated.
+         *          to the topological sort, and cross-track dependencies are generated. When the structure of the graph is
+         *          unchanged from the previous frame, the edges of the previous frame are applied instead.
          *
          *      2) Transient Attachment Compilation:
          *
          *          This phase takes the transient attachment set and acquires physical resources from the Transient
-         *          Attachment Pool. The resources are assigned to the attachments.
+         *          Attachment Pool. The resources are assigned to the attachments. The attachment lifetimes and the sorted
+         *          pool commands are reused from the previous frame when the structure of the graph is unchanged.
          *
          *      3) Resource View Compilation:
          *
          *          After acquiring all transient resources, the compiler creates and assigns resource views
-         *          to each scope attachment. View ownership is managed by an internal cache.
+         *          to each scope attachment. View ownership is managed by an internal cache. Attachments are
+         *          independent from each other, so they are split across jobs when the request allows it.
          *
          *      4) Platform-specific Compilation:
          *
@@ -130,8 +177,33 @@ namespace AZ
 
             FrameGraph& frameGraph = *request.m_frameGraph;
 
+            const AZStd::sys_time_t compileStartTicks = AZStd::GetTimeNowTicks();
+
+            // Reuse the results of the previous frame when the graph has the same structure.
+            if (CheckBitsAny(request.m_compileFlags, FrameSchedulerCompileFlags::DisableCompiledGraphCache))
+            {
+                m_hasCompiledGraphStructure = false;
+                m_isCompiledGraphCacheHit = false;
+            }
+            else
+            {
+                GetCompiledGraphStructure(frameGraph, request.m_compileFlags, m_nextGraphStructure);
+                m_isCompiledGraphCacheHit = m_hasCompiledGraphStructure && m_nextGraphStructure == m_compiledGraphStructure;
+
+                // Swap rather than copy, the previous structure keeps its allocations for the next frame.
+                AZStd::swap(m_compiledGraphStructure, m_nextGraphStructure);
+                m_hasCompiledGraphStructure = true;
+            }
+
             /// [Phase 1] Compiles the cross-queue scope graph.
-            CompileQueueCentricScopeGraph(frameGraph, request.m_compileFlags);
+            if (m_isCompiledGraphCacheHit)
+            {
+                ApplyCachedQueueCentricScopeGraph(frameGraph, request.m_compileFlags);
+            }
+            else
+            {
+                CompileQueueCentricScopeGraph(frameGraph, request.m_compileFlags);
+            }
 
             /// [Phase 2] Compile transient attachments across all scopes.
             CompileTransientAttachments(
@@ -141,7 +213,7 @@ namespace AZ
                 request.m_statisticsFlags);
 
             /// [Phase 3] Compiles buffer / image views and assigns them to scope attachments.
-            CompileResourceViews(frameGraph.GetAttachmentDatabase());
+            CompileResourceViews(frameGraph.GetAttachmentDatabase(), request.m_jobPolicy);
 
             /// [Phase 4] Compile platform-specific scope data after all attachments and views have been compiled.
             {
@@ -154,7 +226,127 @@ namespace AZ
             }
 
             /// Perform platform-specific compilation.
-            return CompileInternal(request);
+            outcome = CompileInternal(request);
+
+            if (auto statsProfiler = AZ::Interface<AZ::Statistics::StatisticalProfilerProxy>::Get(); statsProfiler)
+            {
+                statsProfiler->PushSample(rhiMetricsId, frameGraphCompileTimeMetricId, static_cast<double>(AZStd::GetTimeNowTicks() - compileStartTicks));
+                statsProfiler->PushSample(rhiMetricsId, frameGraphCacheHitMetricId, m_isCompiledGraphCacheHit ? 1.0 : 0.0);
+            }
+
+            return outcome;
+        }
+
+        bool FrameGraphCompiler::IsCompiledGraphCacheHit() const
+        {
+            return m_isCompiledGraphCacheHit;
+        }
+
+        bool FrameGraphCompiler::CompiledGraphStructure::ScopeEntry::operator==(const ScopeEntry& rhs) const
+        {
+            return m_scopeId == rhs.m_scopeId &&
+                m_hardwareQueueClass == rhs.m_hardwareQueueClass &&
+                m_consumerCount == rhs.m_consumerCount &&
+                m_attachmentCount == rhs.m_attachmentCount;
+        }
+
+        bool FrameGraphCompiler::CompiledGraphStructure::ScopeAttachmentEntry::operator==(const ScopeAttachmentEntry& rhs) const
+        {
+            return m_attachmentId == rhs.m_attachmentId &&
+                m_usage == rhs.m_usage &&
+                m_access == rhs.m_access &&
+                m_isTransient == rhs.m_isTransient;
+        }
+
+        bool FrameGraphCompiler::CompiledGraphStructure::TransientAttachmentEntry::operator==(const TransientAttachmentEntry& rhs) const
+        {
+            return m_attachmentId == rhs.m_attachmentId &&
+                m_firstScopeIndex == rhs.m_firstScopeIndex &&
+                m_lastScopeIndex == rhs.m_lastScopeIndex &&
+                m_supportedQueueMask == rhs.m_supportedQueueMask;
+        }
+
+        bool FrameGraphCompiler::CompiledGraphStructure::operator==(const CompiledGraphStructure& rhs) const
+        {
+            return m_compileFlags == rhs.m_compileFlags &&
+                m_scopes == rhs.m_scopes &&
+                m_consumerIndices == rhs.m_consumerIndices &&
+                m_scopeAttachments == rhs.m_scopeAttachments &&
+                m_transientBuffers == rhs.m_transientBuffers &&
+                m_transientImages == rhs.m_transientImages;
+        }
+
+        void FrameGraphCompiler::CompiledGraphStructure::Clear()
+        {
+            m_compileFlags = FrameSchedulerCompileFlags::None;
+            m_scopes.clear();
+            m_consumerIndices.clear();
+            m_scopeAttachments.clear();
+            m_transientBuffers.clear();
+            m_transientImages.clear();
+        }
+
+        void FrameGraphCompiler::GetCompiledGraphStructure(
+            const FrameGraph& frameGraph, FrameSchedulerCompileFlags compileFlags, CompiledGraphStructure& structure) const
+        {
+            AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: GetCompiledGraphStructure");
+
+            structure.Clear();
+            structure.m_compileFlags = compileFlags;
+
+            // The queue-centric graph depends on the queue of each scope and the consumers of each scope.
+            // The async queue lifetime extension also depends on how each scope uses its attachments.
+            for (const Scope* scope : frameGraph.GetScopes())
+            {
+                const auto& consumers = frameGraph.GetConsumers(*scope);
+                const auto& attachments = scope->GetAttachments();
+                const auto& transientAttachments = scope->GetTransientAttachments();
+
+                CompiledGraphStructure::ScopeEntry& scopeEntry = structure.m_scopes.emplace_back();
+                scopeEntry.m_scopeId = scope->GetId();
+                scopeEntry.m_hardwareQueueClass = scope->GetHardwareQueueClass();
+                scopeEntry.m_consumerCount = static_cast<uint32_t>(consumers.size());
+                scopeEntry.m_attachmentCount = static_cast<uint32_t>(attachments.size());
+
+                for (const Scope* consumer : consumers)
+                {
+                    structure.m_consumerIndices.push_back(consumer->GetIndex());
+                }
+
+                for (const ScopeAttachment* scopeAttachment : attachments)
+                {
+                    const bool isTransient =
+                        AZStd::find(transientAttachments.begin(), transientAttachments.end(), scopeAttachment) != transientAttachments.end();
+                    for (const ScopeAttachmentUsageAndAccess& usageAndAccess : scopeAttachment->GetUsageAndAccess())
+                    {
+                        CompiledGraphStructure::ScopeAttachmentEntry& attachmentEntry = structure.m_scopeAttachments.emplace_back();
+                        attachmentEntry.m_attachmentId = scopeAttachment->GetFrameAttachment().GetId();
+                        attachmentEntry.m_usage = usageAndAccess.m_usage;
+                        attachmentEntry.m_access = usageAndAccess.m_access;
+                        attachmentEntry.m_isTransient = isTransient;
+                    }
+                }
+            }
+
+            // The transient attachment commands depend on the order and the lifetime of each transient attachment.
+            const auto addTransientAttachment = [](AZStd::vector<CompiledGraphStructure::TransientAttachmentEntry>& entries, const FrameAttachment* frameAttachment)
+            {
+                CompiledGraphStructure::TransientAttachmentEntry& entry = entries.emplace_back();
+                entry.m_attachmentId = frameAttachment->GetId();
+                entry.m_firstScopeIndex = frameAttachment->GetFirstScope()->GetIndex();
+                entry.m_lastScopeIndex = frameAttachment->GetLastScope()->GetIndex();
+                entry.m_supportedQueueMask = frameAttachment->GetSupportedQueueMask();
+            };
+
+            const FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
+            for (const BufferFrameAttachment* transientBuffer : attachmentDatabase.GetTransientBufferAttachments())
+            {
+                addTransientAttachment(structure.m_transientBuffers, transientBuffer);
+            }
+            for (const ImageFrameAttachment* transientImage : attachmentDatabase.GetTransientImageAttachments())
+            {
+                addTransientAttachment(structure.m_transientImages, transientImage);
+            }
         }
 
         void FrameGraphCompiler::CompileQueueCentricScopeGraph(
@@ -163,6 +355,14 @@ namespace AZ
         {
             AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: CompileQueueCentricScopeGraph");
 
+            // Record the links so they can be applied again while the structure of the graph doesn't change.
+            m_queueCentricScopeLinks.clear();
+            const auto linkProducerConsumerByQueues = [this](Scope* producer, Scope* consumer)
+            {
+                Scope::LinkProducerConsumerByQueues(producer, consumer);
+                m_queueCentricScopeLinks.emplace_back(producer->GetIndex(), consumer->GetIndex());
+            };
+
             const bool disableAsyncQueues = CheckBitsAll(compileFlags, FrameSchedulerCompileFlags::DisableAsyncQueues);
             if (disableAsyncQueues)
             {
@@ -183,7 +383,7 @@ namespace AZ
                     const uint32_t hardwareQueueClassIdx = static_cast<uint32_t>(consumer->GetHardwareQueueClass());
                     if (producer[hardwareQueueClassIdx])
                     {
-                        Scope::LinkProducerConsumerByQueues(producer[hardwareQueueClassIdx], consumer);
+                        linkProducerConsumerByQueues(producer[hardwareQueueClassIdx], consumer);
                     }
                     producer[hardwareQueueClassIdx] = consumer;
                 }
@@ -236,7 +436,7 @@ namespace AZ
 
                         if (foundEarlierConsumerOnSameQueue == false)
                         {
-                            Scope::LinkProducerConsumerByQueues(producerScopeLast, currentScope);
+                            linkProducerConsumerByQueues(producerScopeLast, currentScope);
                         }
                     }
                 }
@@ -278,6 +478,27 @@ namespace AZ
             }
         }
 
+        void FrameGraphCompiler::ApplyCachedQueueCentricScopeGraph(
+            FrameGraph& frameGraph,
+            FrameSchedulerCompileFlags compileFlags)
+        {
+            AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: ApplyCachedQueueCentricScopeGraph");
+
+            const auto& scopes = frameGraph.GetScopes();
+            if (CheckBitsAll(compileFlags, FrameSchedulerCompileFlags::DisableAsyncQueues))
+            {
+                for (Scope* scope : scopes)
+                {
+                    scope->m_hardwareQueueClass = HardwareQueueClass::Graphics;
+                }
+            }
+
+            for (const auto& [producerIndex, consumerIndex] : m_queueCentricScopeLinks)
+            {
+                Scope::LinkProducerConsumerByQueues(scopes[producerIndex], scopes[consumerIndex]);
+            }
+        }
+
         void FrameGraphCompiler::ExtendTransientAttachmentAsyncQueueLifetimes(
             FrameGraph& frameGraph,
             FrameSchedulerCompileFlags compileFlags)
@@ -481,8 +702,6 @@ namespace AZ
 
             AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: CompileTransientAttachments");
 
-            ExtendTransientAttachmentAsyncQueueLifetimes(frameGraph, compileFlags);
-
             /**
              * Builds a sortable key. It iterates each scope and performs deactivations
              * followed by activations on each attachment.
@@ -507,6 +726,11 @@ namespace AZ
                     m_bits.m_attachmentIndex = attachmentIndex;
                 }
 
+                explicit Command(uint32_t command)
+                    : m_command(command)
+                {
+                }
+
                 bool operator < (Command rhs) const
                 {
                     return m_command < rhs.m_command;
@@ -544,52 +768,94 @@ namespace AZ
 
             AZStd::vector<Buffer*> transientBuffers(transientBufferGraphAttachments.size());
             AZStd::vector<Image*> transientImages(transientImageGraphAttachments.size());
-            AZStd::vector<Command> commands;
-            commands.reserve((transientBufferGraphAttachments.size() + transientImageGraphAttachments.size()) * 2);
 
-            if (CheckBitsAny(compileFlags, FrameSchedulerCompileFlags::DisableAttachmentAliasing))
+            if (m_isCompiledGraphCacheHit)
             {
-                const uint32_t ScopeIndexFirst = 0;
-                const uint32_t ScopeIndexLast = static_cast<uint32_t>(scopes.size() - 1);
-
-                // Generate commands for each transient buffer: one for activation, and one for deactivation.
+                // Restore the lifetimes extended for the async queues and reuse the sorted commands of the previous frame.
                 for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientBufferGraphAttachments.size(); ++attachmentIndex)
                 {
-                    commands.emplace_back(ScopeIndexFirst, Action::ActivateBuffer, attachmentIndex);
-                    commands.emplace_back(ScopeIndexLast, Action::DeactivateBuffer, attachmentIndex);
+                    BufferFrameAttachment* transientBuffer = transientBufferGraphAttachments[attachmentIndex];
+                    transientBuffer->m_firstScope = scopes[m_transientBufferLifetimes[attachmentIndex].first];
+                    transientBuffer->m_lastScope = scopes[m_transientBufferLifetimes[attachmentIndex].second];
                 }
 
-                // Generate commands for each transient image: one for activation, and one for deactivation.
                 for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientImageGraphAttachments.size(); ++attachmentIndex)
                 {
-                    commands.emplace_back(ScopeIndexFirst, Action::ActivateImage, attachmentIndex);
-                    commands.emplace_back(ScopeIndexLast, Action::DeactivateImage, attachmentIndex);
+                    ImageFrameAttachment* transientImage = transientImageGraphAttachments[attachmentIndex];
+                    transientImage->m_firstScope = scopes[m_transientImageLifetimes[attachmentIndex].first];
+                    transientImage->m_lastScope = scopes[m_transientImageLifetimes[attachmentIndex].second];
                 }
             }
             else
             {
-                // Generate commands for each transient buffer: one for activation, and one for deactivation.
-                for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientBufferGraphAttachments.size(); ++attachmentIndex)
+                ExtendTransientAttachmentAsyncQueueLifetimes(frameGraph, compileFlags);
+
+                m_transientBufferLifetimes.clear();
+                for (BufferFrameAttachment* transientBuffer : transientBufferGraphAttachments)
                 {
-                    BufferFrameAttachment* transientBuffer = transientBufferGraphAttachments[attachmentIndex];
-                    const uint32_t scopeIndexFirst = transientBuffer->GetFirstScope()->GetIndex();
-                    const uint32_t scopeIndexLast = transientBuffer->GetLastScope()->GetIndex();
-                    commands.emplace_back(scopeIndexFirst, Action::ActivateBuffer, attachmentIndex);
-                    commands.emplace_back(scopeIndexLast, Action::DeactivateBuffer, attachmentIndex);
+                    m_transientBufferLifetimes.emplace_back(transientBuffer->GetFirstScope()->GetIndex(), transientBuffer->GetLastScope()->GetIndex());
                 }
 
-                // Generate commands for each transient image: one for activation, and one for deactivation.
-                for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientImageGraphAttachments.size(); ++attachmentIndex)
+                m_transientImageLifetimes.clear();
+                for (ImageFrameAttachment* transientImage : transientImageGraphAttachments)
                 {
-                    ImageFrameAttachment* transientImage = transientImageGraphAttachments[attachmentIndex];
-                    const uint32_t scopeIndexFirst = transientImage->GetFirstScope()->GetIndex();
-                    const uint32_t scopeIndexLast = transientImage->GetLastScope()->GetIndex();
-                    commands.emplace_back(scopeIndexFirst, Action::ActivateImage, attachmentIndex);
-                    commands.emplace_back(scopeIndexLast, Action::DeactivateImage, attachmentIndex);
+                    m_transientImageLifetimes.emplace_back(transientImage->GetFirstScope()->GetIndex(), transientImage->GetLastScope()->GetIndex());
                 }
-            }
 
-            AZStd::sort(commands.begin(), commands.end());
+                AZStd::vector<Command> commands;
+                commands.reserve((transientBufferGraphAttachments.size() + transientImageGraphAttachments.size()) * 2);
+
+                if (CheckBitsAny(compileFlags, FrameSchedulerCompileFlags::DisableAttachmentAliasing))
+                {
+                    const uint32_t ScopeIndexFirst = 0;
+                    const uint32_t ScopeIndexLast = static_cast<uint32_t>(scopes.size() - 1);
+
+                    // Generate commands for each transient buffer: one for activation, and one for deactivation.
+                    for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientBufferGraphAttachments.size(); ++attachmentIndex)
+                    {
+                        commands.emplace_back(ScopeIndexFirst, Action::ActivateBuffer, attachmentIndex);
+                        commands.emplace_back(ScopeIndexLast, Action::DeactivateBuffer, attachmentIndex);
+                    }
+
+                    // Generate commands for each transient image: one for activation, and one for deactivation.
+                    for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientImageGraphAttachments.size(); ++attachmentIndex)
+                    {
+                        commands.emplace_back(ScopeIndexFirst, Action::ActivateImage, attachmentIndex);
+                        commands.emplace_back(ScopeIndexLast, Action::DeactivateImage, attachmentIndex);
+                    }
+                }
+                else
+                {
+                    // Generate commands for each transient buffer: one for activation, and one for deactivation.
+                    for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientBufferGraphAttachments.size(); ++attachmentIndex)
+                    {
+                        BufferFrameAttachment* transientBuffer = transientBufferGraphAttachments[attachmentIndex];
+                        const uint32_t scopeIndexFirst = transientBuffer->GetFirstScope()->GetIndex();
+                        const uint32_t scopeIndexLast = transientBuffer->GetLastScope()->GetIndex();
+                        commands.emplace_back(scopeIndexFirst, Action::ActivateBuffer, attachmentIndex);
+                        commands.emplace_back(scopeIndexLast, Action::DeactivateBuffer, attachmentIndex);
+                    }
+
+                    // Generate commands for each transient image: one for activation, and one for deactivation.
+                    for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientImageGraphAttachments.size(); ++attachmentIndex)
+                    {
+                        ImageFrameAttachment* transientImage = transientImageGraphAttachments[attachmentIndex];
+                        const uint32_t scopeIndexFirst = transientImage->GetFirstScope()->GetIndex();
+                        const uint32_t scopeIndexLast = transientImage->GetLastScope()->GetIndex();
+                        commands.emplace_back(scopeIndexFirst, Action::ActivateImage, attachmentIndex);
+                        commands.emplace_back(scopeIndexLast, Action::DeactivateImage, attachmentIndex);
+                    }
+                }
+
+                AZStd::sort(commands.begin(), commands.end());
+
+                m_transientAttachmentCommands.clear();
+                m_transientAttachmentCommands.reserve(commands.size());
+                for (Command command : commands)
+                {
+                    m_transientAttachmentCommands.push_back(command.m_command);
+                }
+            }
 
             auto processCommands = [&](TransientAttachmentPoolCompileFlags compileFlags, TransientAttachmentStatistics::MemoryUsage* memoryHint = nullptr)
             {
@@ -599,8 +865,9 @@ namespace AZ
 
                 bool allocateResources = !CheckBitsAny(compileFlags, TransientAttachmentPoolCompileFlags::DontAllocateResources);
 
-                for (Command command : commands)
+                for (uint32_t commandBits : m_transientAttachmentCommands)
                 {
+                    const Command command(commandBits);
                     const uint32_t scopeIndex = command.m_bits.m_scopeIndex;
                     const uint32_t attachmentIndex = command.m_bits.m_attachmentIndex;
                     const Action action = (Action)command.m_bits.m_action;
@@ -720,8 +987,12 @@ namespace AZ
             // [GFX TODO][ATOM-6289] This should be looked into, combining cityhash with AZStd::hash
             const HashValue64 hash = imageViewDescriptor.GetHash(static_cast<HashValue64>(baseHash));
 
+            // The cache is shared by the resource view compile jobs, only the shard holding the view is locked.
+            ViewCacheShard& viewCacheShard = m_viewCacheShards[static_cast<uint64_t>(hash) % ViewCacheShardCount];
+            AZStd::lock_guard<AZStd::mutex> lock(viewCacheShard.m_mutex);
+
             // Attempt to find the image view in the cache.
-            ImageView* imageView = m_imageViewCache.Find(static_cast<uint64_t>(hash));
+            ImageView* imageView = viewCacheShard.m_imageViewCache.Find(static_cast<uint64_t>(hash));
 
             if (!imageView)
             {
@@ -730,7 +1001,7 @@ namespace AZ
                 if (imageViewPtr->Init(*image, imageViewDescriptor) == ResultCode::Success)
                 {
                     imageView = imageViewPtr.get();
-                    m_imageViewCache.Insert(static_cast<uint64_t>(hash), AZStd::move(imageViewPtr));
+                    viewCacheShard.m_imageViewCache.Insert(static_cast<uint64_t>(hash), AZStd::move(imageViewPtr));
                 }
                 else
                 {
@@ -746,8 +1017,12 @@ namespace AZ
             // [GFX TODO][ATOM-6289] This should be looked into, combining cityhash with AZStd::hash
             const HashValue64 hash = bufferViewDescriptor.GetHash(static_cast<HashValue64>(baseHash));
 
+            // The cache is shared by the resource view compile jobs, only the shard holding the view is locked.
+            ViewCacheShard& viewCacheShard = m_viewCacheShards[static_cast<uint64_t>(hash) % ViewCacheShardCount];
+            AZStd::lock_guard<AZStd::mutex> lock(viewCacheShard.m_mutex);
+
             // Attempt to find the buffer view in the cache.
-            BufferView* bufferView = m_bufferViewCache.Find(static_cast<uint64_t>(hash));
+            BufferView* bufferView = viewCacheShard.m_bufferViewCache.Find(static_cast<uint64_t>(hash));
 
             if (!bufferView)
             {
@@ -756,7 +1031,7 @@ namespace AZ
                 if (bufferViewPtr->Init(*buffer, bufferViewDescriptor) == ResultCode::Success)
                 {
                     bufferView = bufferViewPtr.get();
-                    m_bufferViewCache.Insert(static_cast<uint64_t>(hash), AZStd::move(bufferViewPtr));
+                    viewCacheShard.m_bufferViewCache.Insert(static_cast<uint64_t>(hash), AZStd::move(bufferViewPtr));
                 }
                 else
                 {
@@ -766,73 +1041,145 @@ namespace AZ
             return bufferView;
         }
 
-        void FrameGraphCompiler::CompileResourceViews(const FrameGraphAttachmentDatabase& attachmentDatabase)
+        void FrameGraphCompiler::CompileResourceViews(const FrameGraphAttachmentDatabase& attachmentDatabase, JobPolicy jobPolicy)
         {
             AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: CompileResourceViews");
 
-            for (ImageFrameAttachment* imageAttachment : attachmentDatabase.GetImageAttachments())
-            {
-                Image* image = imageAttachment->GetImage();
+            const auto& imageAttachments = attachmentDatabase.GetImageAttachments();
+            const auto& bufferAttachments = attachmentDatabase.GetBufferAttachments();
+            const uint32_t imageAttachmentCount = static_cast<uint32_t>(imageAttachments.size());
+            const uint32_t attachmentCount = imageAttachmentCount + static_cast<uint32_t>(bufferAttachments.size());
 
-                if (!image)
-                {
-                    continue;
-                }
-                // Iterates through every usage of the image, pulls image views
-                // from image's cache or local cache, and assigns them to the scope attachments.
-                for (ImageScopeAttachment* node = imageAttachment->GetFirstScopeAttachment(); node != nullptr; node = node->GetNext())
+            // Each attachment only writes the views of its own scope attachments, so attachments can be compiled in any order.
+            const auto compileViewsForInterval = [this, &imageAttachments, &bufferAttachments, imageAttachmentCount](Interval interval)
+            {
+                for (uint32_t attachmentIndex = interval.m_min; attachmentIndex < interval.m_max; ++attachmentIndex)
                 {
-                    const ImageViewDescriptor& imageViewDescriptor = node->GetDescriptor().m_imageViewDescriptor;
-                    
-                    ImageView* imageView = nullptr;
-                    //Check image's cache first as that contains views provided by higher level code.
-                    if(image->IsInResourceCache(imageViewDescriptor))
+                    if (attachmentIndex < imageAttachmentCount)
                     {
-                        imageView = image->GetImageView(imageViewDescriptor).get();
+                        CompileImageViews(*imageAttachments[attachmentIndex]);
                     }
                     else
                     {
-                        //If the higher level code has not provided a view, check local frame graph compiler's local cache.
-                        //The local cache is special and was mainly added to handle transient resources. This cache adds a dependency to
-                        //the resourceview ensuring they do not get deleted at the end of the frame and recreated at the start of the next frame.
-                        imageView = GetImageViewFromLocalCache(image, imageViewDescriptor);
+                        CompileBufferViews(*bufferAttachments[attachmentIndex - imageAttachmentCount]);
                     }
-                     
-                    node->SetImageView(imageView);
                 }
-            }
+            };
 
-            for (BufferFrameAttachment* bufferAttachment : attachmentDatabase.GetBufferAttachments())
+            AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+            const bool useTaskGraph = m_taskGraphActive && m_taskGraphActive->IsTaskGraphActive();
+            if (jobPolicy == JobPolicy::Serial || attachmentCount < MinAttachmentViewCompilesPerJob * 2 || (!useTaskGraph && !jobContext))
             {
-                Buffer* buffer = bufferAttachment->GetBuffer();
+                compileViewsForInterval(Interval(0, attachmentCount));
+                return;
+            }
+
+            const uint32_t workerCount = useTaskGraph ? AZ::TaskExecutor::Instance().GetThreadCount() : jobContext->GetJobManager().GetNumWorkerThreads();
+            const uint32_t compilesPerJob = AZStd::max(DivideByMultiple(attachmentCount, AZStd::max(workerCount, 1u)), MinAttachmentViewCompilesPerJob);
+            const uint32_t jobCount = DivideByMultiple(attachmentCount, compilesPerJob);
 
-                if (!buffer)
+            if (useTaskGraph)
+            {
+                AZ::TaskGraph taskGraph;
+                const AZ::TaskDescriptor viewCompileDesc{"FrameGraphViewCompile", "Graphics"};
+                for (uint32_t i = 0; i < jobCount; ++i)
                 {
-                    continue;
+                    const Interval interval(i * compilesPerJob, AZStd::min((i + 1) * compilesPerJob, attachmentCount));
+                    taskGraph.AddTask(
+                        viewCompileDesc,
+                        [&compileViewsForInterval, interval]()
+                        {
+                            AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: compileViewsForInterval");
+                            compileViewsForInterval(interval);
+                        });
                 }
 
-                // Iterates through every usage of the buffer attachment, pulls buffer views
-                // from the cache within the buffer, and assigns them to the scope attachments.
-                for (BufferScopeAttachment* node = bufferAttachment->GetFirstScopeAttachment(); node != nullptr; node = node->GetNext())
+                AZ::TaskGraphEvent finishedEvent;
+                taskGraph.Submit(&finishedEvent);
+                finishedEvent.Wait();
+            }
+            else // use Job system
+            {
+                AZ::JobCompletion jobCompletion;
+                for (uint32_t i = 0; i < jobCount; ++i)
                 {
-                    const BufferViewDescriptor& bufferViewDescriptor = node->GetDescriptor().m_bufferViewDescriptor;
-                    
-                    BufferView* bufferView = nullptr;
-                    //Check buffer's cache first as that contains views provided by higher level code.
-                    if(buffer->IsInResourceCache(bufferViewDescriptor))
-                    {
-                        bufferView = buffer->GetBufferView(bufferViewDescriptor).get();
-                    }
-                    else
+                    const Interval interval(i * compilesPerJob, AZStd::min((i + 1) * compilesPerJob, attachmentCount));
+                    const auto compileViewsJobLambda = [&compileViewsForInterval, interval]()
                     {
-                        //If the higher level code has not provided a view, check local frame graph compiler's local cache.
-                        //The local cache is special and was mainly added to handle transient resources. This cache adds a dependency to
-                        //the resourceview ensuring they do not get deleted at the end of the frame and recreated at the start of the next frame.
-                        bufferView = GetBufferViewFromLocalCache(buffer, bufferViewDescriptor);
-                    }
+                        AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: compileViewsForInterval");
+                        compileViewsForInterval(interval);
+                    };
 
-                    node->SetBufferView(bufferView);
+                    AZ::Job* compileViewsJob = AZ::CreateJobFunction(AZStd::move(compileViewsJobLambda), true, jobContext);
+                    compileViewsJob->SetDependent(&jobCompletion);
+                    compileViewsJob->Start();
                 }
+                jobCompletion.StartAndWaitForCompletion();
+            }
+        }
+
+        void FrameGraphCompiler::CompileImageViews(ImageFrameAttachment& imageAttachment)
+        {
+            Image* image = imageAttachment.GetImage();
+
+            if (!image)
+            {
+                return;
+            }
+            // Iterates through every usage of the image, pulls image views
+            // from image's cache or local cache, and assigns them to the scope attachments.
+            for (ImageScopeAttachment* node = imageAttachment.GetFirstScopeAttachment(); node != nullptr; node = node->GetNext())
+            {
+                const ImageViewDescriptor& imageViewDescriptor = node->GetDescriptor().m_imageViewDescriptor;
+
+                ImageView* imageView = nullptr;
+                //Check image's cache first as that contains views provided by higher level code.
+                if(image->IsInResourceCache(imageViewDescriptor))
+                {
+                    imageView = image->GetImageView(imageViewDescriptor).get();
+                }
+                else
+                {
+                    //If the higher level code has not provided a view, check local frame graph compiler's local cache.
+                    //The local cache is special and was mainly added to handle transient resources. This cache adds a dependency to
+                    //the resourceview ensuring they do not get deleted at the end of the frame and recreated at the start of the next frame.
+                    imageView = GetImageViewFromLocalCache(image, imageViewDescriptor);
+                }
+
+                node->SetImageView(imageView);
+            }
+        }
+
+        void FrameGraphCompiler::CompileBufferViews(BufferFrameAttachment& bufferAttachment)
+        {
+            Buffer* buffer = bufferAttachment.GetBuffer();
+
+            if (!buffer)
+            {
+                return;
+            }
+
+            // Iterates through every usage of the buffer attachment, pulls buffer views
+            // from the cache within the buffer, and assigns them to the scope attachments.
+            for (BufferScopeAttachment* node = bufferAttachment.GetFirstScopeAttachment(); node != nullptr; node = node->GetNext())
+            {
+                const BufferViewDescriptor& bufferViewDescriptor = node->GetDescriptor().m_bufferViewDescriptor;
+
+                BufferView* bufferView = nullptr;
+                //Check buffer's cache first as that contains views provided by higher level code.
+                if(buffer->IsInResourceCache(bufferViewDescriptor))
+                {
+                    bufferView = buffer->GetBufferView(bufferViewDescriptor).get();
+                }
+                else
+                {
+                    //If the higher level code has not provided a view, check local frame graph compiler's local cache.
+                    //The local cache is special and was mainly added to handle transient resources. This cache adds a dependency to
+                    //the resourceview ensuring they do not get deleted at the end of the frame and recreated at the start of the next frame.
+                    bufferView = GetBufferViewFromLocalCache(buffer, bufferViewDescriptor);
+                }
+
+                node->SetBufferView(bufferView);
             }
         }
     }
@@ -28,7 +28,10 @@
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Jobs/Algorithms.h>
 #include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Task/TaskGraph.h>
 
 namespace AZ
@@ -37,6 +40,15 @@ namespace AZ
     {
         static constexpr const char* frameTimeMetricName = "Frame to Frame Time";
         static constexpr AZ::Crc32 frameTimeMetricId = AZ_CRC_CE(frameTimeMetricName);
+        static constexpr const char* srgCompileTimeMetricName = "SRG Compile Time";
+        static constexpr AZ::Crc32 srgCompileTimeMetricId = AZ_CRC_CE(srgCompileTimeMetricName);
+        static constexpr const char* srgCompileCountMetricName = "SRG Compiles";
+        static constexpr AZ::Crc32 srgCompileCountMetricId = AZ_CRC_CE(srgCompileCountMetricName);
+        static constexpr const char* srgSkippedCompileCountMetricName = "SRG Compiles Skipped";
+        static constexpr AZ::Crc32 srgSkippedCompileCountMetricId = AZ_CRC_CE(srgSkippedCompileCountMetricName);
+
+        //! Smallest number of SRG compiles worth a job of their own, so small frames don't spend more time scheduling than compiling.
+        static constexpr uint32_t MinShaderResourceGroupCompilesPerJob = 32;
 
         ResultCode FrameScheduler::Init(Device& device, const FrameSchedulerDescriptor& descriptor)
         {
@@ -90,6 +102,9 @@ namespace AZ
 
                 auto& rhiMetrics = statsProfiler->GetProfiler(rhiMetricsId);
                 rhiMetrics.GetStatsManager().AddStatistic(frameTimeMetricId, frameTimeMetricName, /*units=*/"clocks", /*failIfExist=*/false);
+                rhiMetrics.GetStatsManager().AddStatistic(srgCompileTimeMetricId, srgCompileTimeMetricName, /*units=*/"clocks", /*failIfExist=*/false);
+                rhiMetrics.GetStatsManager().AddStatistic(srgCompileCountMetricId, srgCompileCountMetricName, /*units=*/"count", /*failIfExist=*/false);
+                rhiMetrics.GetStatsManager().AddStatistic(srgSkippedCompileCountMetricId, srgSkippedCompileCountMetricName, /*units=*/"count", /*failIfExist=*/false);
             }
 
             m_lastFrameEndTime = AZStd::GetTimeNowTicks();
@@ -203,6 +218,7 @@ namespace AZ
             frameGraphCompileRequest.m_logVerbosity = compileRequest.m_logVerbosity;
             frameGraphCompileRequest.m_compileFlags = compileRequest.m_compileFlags;
             frameGraphCompileRequest.m_statisticsFlags = compileRequest.m_statisticsFlags;
+            frameGraphCompileRequest.m_jobPolicy = compileRequest.m_jobPolicy;
 
             const MessageOutcome outcome = m_frameGraphCompiler->Compile(frameGraphCompileRequest);
             if (outcome.IsSuccess())
@@ -270,23 +286,45 @@ namespace AZ
                 ResourceInvalidateBus::ExecuteQueuedEvents();
             }
 
+            const AZStd::sys_time_t compileStartTicks = AZStd::GetTimeNowTicks();
+
+            // Begin compiling every pool first, so the groups of the whole frame can be split evenly between the workers.
+            // Pools with nothing to compile are ended right away.
+            uint32_t compileCount = 0;
+            uint32_t skippedCompileCount = 0;
+            m_shaderResourceGroupPoolsToCompile.clear();
+            const auto compileGroupsBeginFunction = [this, &compileCount, &skippedCompileCount](ShaderResourceGroupPool* srgPool)
+            {
+                srgPool->CompileGroupsBegin();
+                skippedCompileCount += srgPool->GetSkippedCompileCount();
+
+                const uint32_t compilesInPool = srgPool->GetGroupsToCompileCount();
+                if (compilesInPool == 0)
+                {
+                    srgPool->CompileGroupsEnd();
+                    return;
+                }
+                compileCount += compilesInPool;
+                m_shaderResourceGroupPoolsToCompile.push_back(srgPool);
+            };
+
             const ResourcePoolDatabase& resourcePoolDatabase = m_device->GetResourcePoolDatabase();
+            resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileGroupsBeginFunction)>(compileGroupsBeginFunction);
 
             if (m_compileRequest.m_jobPolicy == JobPolicy::Parallel)
             {
-                // Iterate over each SRG pool and fork jobs to compile SRGs.
-                const uint32_t compilesPerJob = m_compileRequest.m_shaderResourceGroupCompilesPerJob;
                 if (m_taskGraphActive && m_taskGraphActive->IsTaskGraphActive())
                 {
+                    const uint32_t compilesPerJob = GetShaderResourceGroupCompilesPerJob(compileCount, AZ::TaskExecutor::Instance().GetThreadCount());
+
                     AZ::TaskGraph taskGraph;
+                    const AZ::TaskDescriptor srgCompileDesc{"SrgCompile", "Graphics"};
+                    const AZ::TaskDescriptor srgCompileEndDesc{"SrgCompileEnd", "Graphics"};
 
-                    const auto compileIntervalsFunction = [compilesPerJob, &taskGraph](ShaderResourceGroupPool* srgPool)
+                    for (ShaderResourceGroupPool* srgPool : m_shaderResourceGroupPoolsToCompile)
                     {
-                        srgPool->CompileGroupsBegin();
                         const uint32_t compilesInPool = srgPool->GetGroupsToCompileCount();
                         const uint32_t jobCount = DivideByMultiple(compilesInPool, compilesPerJob);
-                        AZ::TaskDescriptor srgCompileDesc{"SrgCompile", "Graphics"};
-                        AZ::TaskDescriptor srgCompileEndDesc{"SrgCompileEnd", "Graphics"};
 
                         auto srgCompileEndTask = taskGraph.AddTask(
                             srgCompileEndDesc,
@@ -305,14 +343,13 @@ namespace AZ
                                 srgCompileDesc,
                                 [srgPool, interval]()
                                 {
-                                AZ_PROFILE_SCOPE(RHI, "FrameScheduler : compileGroupsForIntervalLambda");
+                                    AZ_PROFILE_SCOPE(RHI, "FrameScheduler : compileGroupsForIntervalLambda");
                                     srgPool->CompileGroupsForInterval(interval);
                                 });
-                                compileTask.Precedes(srgCompileEndTask);
+                            compileTask.Precedes(srgCompileEndTask);
                         }
-                    };
+                    }
 
-                    resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileIntervalsFunction)>(AZStd::move(compileIntervalsFunction));
                     if (!taskGraph.IsEmpty())
                     {
                         AZ::TaskGraphEvent finishedEvent;
@@ -322,17 +359,13 @@ namespace AZ
                 }
                 else // use Job system
                 {
-                    const auto compileGroupsBeginFunction = [](ShaderResourceGroupPool* srgPool)
-                    {
-                        srgPool->CompileGroupsBegin();
-                    };
-
-                    resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileGroupsBeginFunction)>(compileGroupsBeginFunction);
+                    AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+                    const uint32_t workerCount = jobContext ? jobContext->GetJobManager().GetNumWorkerThreads() : 1;
+                    const uint32_t compilesPerJob = GetShaderResourceGroupCompilesPerJob(compileCount, workerCount);
 
                     // Iterate over each SRG pool and fork jobs to compile SRGs.
                     AZ::JobCompletion jobCompletion;
-
-                    const auto compileIntervalsFunction = [compilesPerJob, &jobCompletion](ShaderResourceGroupPool* srgPool)
+                    for (ShaderResourceGroupPool* srgPool : m_shaderResourceGroupPoolsToCompile)
                     {
                         const uint32_t compilesInPool = srgPool->GetGroupsToCompileCount();
                         const uint32_t jobCount = DivideByMultiple(compilesInPool, compilesPerJob);
@@ -353,30 +386,30 @@ namespace AZ
                             executeGroupJob->SetDependent(&jobCompletion);
                             executeGroupJob->Start();
                         }
-                    };
-
-                    resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileIntervalsFunction)>(AZStd::move(compileIntervalsFunction));
-
+                    }
                     jobCompletion.StartAndWaitForCompletion();
 
-                    const auto compileGroupsEndFunction = [](ShaderResourceGroupPool* srgPool)
+                    for (ShaderResourceGroupPool* srgPool : m_shaderResourceGroupPoolsToCompile)
                     {
                         srgPool->CompileGroupsEnd();
-                    };
-
-                    resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileGroupsEndFunction)>(compileGroupsEndFunction);
+                    }
                 }
             }
             else
             {
-                const auto compileAllLambda = [](ShaderResourceGroupPool* srgPool)
+                for (ShaderResourceGroupPool* srgPool : m_shaderResourceGroupPoolsToCompile)
                 {
-                    srgPool->CompileGroupsBegin();
                     srgPool->CompileGroupsForInterval(Interval(0, srgPool->GetGroupsToCompileCount()));
                     srgPool->CompileGroupsEnd();
-                };
+                }
+            }
+            m_shaderResourceGroupPoolsToCompile.clear();
 
-                resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileAllLambda)>(compileAllLambda);
+            if (auto statsProfiler = AZ::Interface<AZ::Statistics::StatisticalProfilerProxy>::Get(); statsProfiler)
+            {
+                statsProfiler->PushSample(rhiMetricsId, srgCompileTimeMetricId, static_cast<double>(AZStd::GetTimeNowTicks() - compileStartTicks));
+                statsProfiler->PushSample(rhiMetricsId, srgCompileCountMetricId, static_cast<double>(compileCount));
+                statsProfiler->PushSample(rhiMetricsId, srgSkippedCompileCountMetricId, static_cast<double>(skippedCompileCount));
             }
 
             //It is possible for certain back ends to run out of SRG memory (due to fragmentation) in which case
@@ -385,6 +418,14 @@ namespace AZ
             AZ_Assert(resultCode == RHI::ResultCode::Success, "SRG compaction failed and this can lead to a gpu crash.");
         }
 
+        uint32_t FrameScheduler::GetShaderResourceGroupCompilesPerJob(uint32_t compileCount, uint32_t workerCount) const
+        {
+            // Spread the compiles of the frame over all the workers, but never above the compiles per job of the request.
+            const uint32_t maxCompilesPerJob = AZStd::max(m_compileRequest.m_shaderResourceGroupCompilesPerJob, 1u);
+            const uint32_t balancedCompilesPerJob = DivideByMultiple(compileCount, AZStd::max(workerCount, 1u));
+            return AZStd::clamp(balancedCompilesPerJob, AZStd::min(MinShaderResourceGroupCompilesPerJob, maxCompilesPerJob), maxCompilesPerJob);
+        }
+
         void FrameScheduler::BuildRayTracingShaderTables()
         {
             AZ_PROFILE_SCOPE(RHI, "FrameScheduler: BuildRayTracingShaderTables");
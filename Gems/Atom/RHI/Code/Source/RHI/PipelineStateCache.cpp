@@ -10,6 +10,8 @@
 #include <Atom/RHI/Factory.h>
 
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Statistics/StatisticalProfilerProxy.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/parallel/exponential_backoff.h>
 
@@ -17,6 +19,11 @@ namespace AZ
 {
     namespace RHI
     {
+        static constexpr const char* pipelineStateCacheMissMetricName = "Pipeline State Cache Misses";
+        static constexpr AZ::Crc32 pipelineStateCacheMissMetricId = AZ_CRC_CE(pipelineStateCacheMissMetricName);
+        static constexpr const char* pipelineStateCompileMetricName = "Pipeline State Compiles";
+        static constexpr AZ::Crc32 pipelineStateCompileMetricId = AZ_CRC_CE(pipelineStateCompileMetricName);
+
         Ptr<PipelineStateCache> PipelineStateCache::Create(Device& device)
         {
             return aznew PipelineStateCache(device);
@@ -24,7 +31,14 @@ namespace AZ
 
         PipelineStateCache::PipelineStateCache(Device& device)
             : m_device{&device}
-        {}
+        {
+            if (auto statsProfiler = AZ::Interface<AZ::Statistics::StatisticalProfilerProxy>::Get(); statsProfiler)
+            {
+                auto& rhiMetrics = statsProfiler->GetProfiler(rhiMetricsId);
+                rhiMetrics.GetStatsManager().AddStatistic(pipelineStateCacheMissMetricId, pipelineStateCacheMissMetricName, /*units=*/"count", /*failIfExist=*/false);
+                rhiMetrics.GetStatsManager().AddStatistic(pipelineStateCompileMetricId, pipelineStateCompileMetricName, /*units=*/"count", /*failIfExist=*/false);
+            }
+        }
 
         void PipelineStateCache::ValidateCacheIntegrity() const
         {
@@ -244,26 +258,42 @@ namespace AZ
                 }
             }
 
-            // If we had compilation events, then the thread-local caches are not empty and need to be cleared.
-            if (hasCompiledPipelineStates)
+            // Gather the metrics of every thread. If we had compilation events, then the thread-local caches are
+            // not empty and need to be cleared.
+            m_metrics = {};
+            const size_t libraryCount = m_globalLibrarySet.size();
+            m_threadLibrarySet.ForEach([this, libraryCount, hasCompiledPipelineStates](ThreadLibrarySet& threadLibrarySet)
             {
-                const size_t libraryCount = m_globalLibrarySet.size();
-
-                m_threadLibrarySet.ForEach([this, libraryCount](ThreadLibrarySet& threadLibrarySet)
+                for (size_t i = 0; i < libraryCount; ++i)
                 {
-                    for (size_t i = 0; i < libraryCount; ++i)
+                    ThreadLibraryEntry& threadLibraryEntry = threadLibrarySet[i];
+                    m_metrics.m_threadLocalCacheHitCount += threadLibraryEntry.m_metrics.m_threadLocalCacheHitCount;
+                    m_metrics.m_pendingCacheHitCount += threadLibraryEntry.m_metrics.m_pendingCacheHitCount;
+                    m_metrics.m_compileCount += threadLibraryEntry.m_metrics.m_compileCount;
+                    threadLibraryEntry.m_metrics = {};
+
+                    if (hasCompiledPipelineStates && m_globalLibraryActiveBits[i])
                     {
-                        if (m_globalLibraryActiveBits[i])
-                        {
-                            threadLibrarySet[i].m_threadLocalCache.clear();
-                        }
+                        threadLibraryEntry.m_threadLocalCache.clear();
                     }
-                });
+                }
+            });
+
+            if (auto statsProfiler = AZ::Interface<AZ::Statistics::StatisticalProfilerProxy>::Get(); statsProfiler)
+            {
+                const uint32_t missCount = m_metrics.m_threadLocalCacheHitCount + m_metrics.m_pendingCacheHitCount + m_metrics.m_compileCount;
+                statsProfiler->PushSample(rhiMetricsId, pipelineStateCacheMissMetricId, static_cast<double>(missCount));
+                statsProfiler->PushSample(rhiMetricsId, pipelineStateCompileMetricId, static_cast<double>(m_metrics.m_compileCount));
             }
 
             ValidateCacheIntegrity();
         }
 
+        const PipelineStateCacheMetrics& PipelineStateCache::GetMetrics() const
+        {
+            return m_metrics;
+        }
+
         const PipelineState* PipelineStateCache::FindPipelineState(const PipelineStateSet& pipelineStateSet, const PipelineStateDescriptor& descriptor)
         {
             auto pipelineStateIt = pipelineStateSet.find(PipelineStateEntry(descriptor.GetHash(), nullptr, descriptor));
@@ -306,6 +336,7 @@ namespace AZ
 
                 if (const PipelineState* pipelineState = FindPipelineState(threadLocalCache, descriptor))
                 {
+                    ++threadLibraryEntry.m_metrics.m_threadLocalCacheHitCount;
                     return pipelineState;
                 }
 
@@ -353,6 +384,7 @@ namespace AZ
                 // Another thread may have started compiling this pipeline state. Check the pending cache.
                 if (const PipelineState* pipeline = FindPipelineState(pendingCache, descriptor))
                 {
+                    ++threadLibraryEntry.m_metrics.m_pendingCacheHitCount;
                     return pipeline;
                 }
 
@@ -365,6 +397,7 @@ namespace AZ
             }
 
             ResultCode resultCode = ResultCode::InvalidArgument;
+            ++threadLibraryEntry.m_metrics.m_compileCount;
 
             // Increment the pending compile count on the global entry, which tracks how many pipeline states
             // are currently being compiled across all threads.
@@ -196,6 +196,7 @@ namespace AZ
         bool Resource::IsInResourceCache(const ImageViewDescriptor& imageViewDescriptor)
         {
             const HashValue64 hash = imageViewDescriptor.GetHash();
+            AZStd::lock_guard<AZStd::mutex> registryLock(m_cacheMutex);
             auto it = m_resourceViewCache.find(static_cast<uint64_t>(hash));
             return it != m_resourceViewCache.end();
         }
@@ -203,6 +204,7 @@ namespace AZ
         bool Resource::IsInResourceCache(const BufferViewDescriptor& bufferViewDescriptor)
         {
             const HashValue64 hash = bufferViewDescriptor.GetHash();
+            AZStd::lock_guard<AZStd::mutex> registryLock(m_cacheMutex);
             auto it = m_resourceViewCache.find(static_cast<uint64_t>(hash));
             return it != m_resourceViewCache.end();
         }
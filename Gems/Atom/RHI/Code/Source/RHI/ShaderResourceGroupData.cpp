@@ -360,6 +360,32 @@ namespace AZ
             return m_samplers;
         }
 
+        bool ShaderResourceGroupData::HasSameContents(const ShaderResourceGroupData& other) const
+        {
+            if (m_shaderResourceGroupLayout != other.m_shaderResourceGroupLayout ||
+                m_imageViews != other.m_imageViews ||
+                m_bufferViews != other.m_bufferViews ||
+                m_imageViewsUnboundedArray != other.m_imageViewsUnboundedArray ||
+                m_bufferViewsUnboundedArray != other.m_bufferViewsUnboundedArray ||
+                m_samplers.size() != other.m_samplers.size())
+            {
+                return false;
+            }
+
+            for (size_t i = 0; i < m_samplers.size(); ++i)
+            {
+                if (m_samplers[i].GetHash() != other.m_samplers[i].GetHash())
+                {
+                    return false;
+                }
+            }
+
+            const AZStd::array_view<uint8_t> constantData = GetConstantData();
+            const AZStd::array_view<uint8_t> otherConstantData = other.GetConstantData();
+            return constantData.size() == otherConstantData.size() &&
+                (constantData.empty() || memcmp(constantData.data(), otherConstantData.data(), constantData.size()) == 0);
+        }
+
         void ShaderResourceGroupData::ResetViews()
         {
             m_imageViews.assign(m_imageViews.size(), nullptr);
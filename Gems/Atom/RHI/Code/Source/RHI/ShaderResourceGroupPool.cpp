@@ -69,6 +69,7 @@ namespace AZ
 
                 // Pre-initialize the data so that we can build view diffs later.
                 group.m_data = ShaderResourceGroupData(layout);
+                group.m_isCompiled = false;
 
                 // Cache off the binding slot for one less indirection.
                 group.m_bindingSlot = layout->GetBindingSlot();
@@ -118,6 +119,12 @@ namespace AZ
 
             if (!isQueuedForCompile)
             {
+                if (IsCompileRedundant(shaderResourceGroup, groupData))
+                {
+                    ++m_skippedCompileCount;
+                    return;
+                }
+
                 CalculateGroupDataDiff(shaderResourceGroup, groupData);
 
                 shaderResourceGroup.SetData(groupData);
@@ -156,6 +163,7 @@ namespace AZ
             CalculateGroupDataDiff(group, groupData);
             group.SetData(groupData);
             CompileGroupInternal(group, group.GetData());
+            group.m_isCompiled = true;
         }
 
         void ShaderResourceGroupPool::CalculateGroupDataDiff(ShaderResourceGroup& shaderResourceGroup, const ShaderResourceGroupData& groupData)
@@ -227,6 +235,25 @@ namespace AZ
             }
         }
 
+        bool ShaderResourceGroupPool::IsCompileRedundant(const ShaderResourceGroup& shaderResourceGroup, const ShaderResourceGroupData& groupData) const
+        {
+            /**
+             * Platforms keep several copies of the compiled data so the group can be updated while previous frames are
+             * still in flight, and only rewrite the resource types flagged by the update mask on each compile. The copies
+             * are only known to match the data of the group once the last compile had no update flagged. In that case,
+             * a compile with no updates or with the same contents would only rotate between identical copies.
+             */
+            const ShaderResourceGroupData& compiledData = shaderResourceGroup.GetData();
+            if (!shaderResourceGroup.m_isCompiled ||
+                compiledData.GetLayout() != groupData.GetLayout() ||
+                compiledData.IsAnyResourceTypeUpdated())
+            {
+                return false;
+            }
+
+            return !groupData.IsAnyResourceTypeUpdated() || compiledData.HasSameContents(groupData);
+        }
+
         void ShaderResourceGroupPool::CompileGroupsBegin()
         {
             AZ_Assert(m_isCompiling == false, "Already compiling! Deadlock imminent.");
@@ -239,6 +266,7 @@ namespace AZ
             AZ_Assert(m_isCompiling, "CompileGroupsBegin() was never called.");
             m_isCompiling = false;
             m_groupsToCompile.clear();
+            m_skippedCompileCount = 0;
             m_groupsToCompileMutex.unlock();
         }
 
@@ -248,6 +276,12 @@ namespace AZ
             return static_cast<uint32_t>(m_groupsToCompile.size());
         }
 
+        uint32_t ShaderResourceGroupPool::GetSkippedCompileCount() const
+        {
+            AZ_Assert(m_isCompiling, "You must call this function within a CompileGroups{Begin, End} region!");
+            return m_skippedCompileCount;
+        }
+
         void ShaderResourceGroupPool::CompileGroupsForInterval(Interval interval)
         {
             AZ_TRACE_METHOD_NAME("CompileGroupsForInterval");
@@ -263,6 +297,7 @@ namespace AZ
                 ShaderResourceGroup* group = m_groupsToCompile[i];
                 CompileGroupInternal(*group, group->GetData());
                 group->m_isQueuedForCompile = false;
+                group->m_isCompiled = true;
             }
         }
 
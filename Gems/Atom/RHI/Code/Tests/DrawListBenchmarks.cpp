@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+
+#include <Atom/RHI/DrawList.h>
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/sort.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    namespace DrawListBenchmarkSettings
+    {
+        //! Number of draw items in the sorted list.
+        static const int StartItemCount = 64;
+        static const int EndItemCount = 256 * 1024;
+        static const int ItemCountMultiplier = 8;
+    } // namespace DrawListBenchmarkSettings
+
+    //! Fills a draw list with random sort keys and depths. The keys only use a few hundred values,
+    //! as the sort keys of a scene usually come from a small set of materials and shaders.
+    class DrawListSortBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+        void internalSetUp(const benchmark::State& state)
+        {
+            const size_t itemCount = static_cast<size_t>(state.range(0));
+
+            AZ::SimpleLcgRandom random(1234);
+            m_unsortedList.reserve(itemCount);
+            for (size_t i = 0; i < itemCount; ++i)
+            {
+                RHI::DrawItemProperties drawItemProperties;
+                drawItemProperties.m_sortKey = static_cast<RHI::DrawItemSortKey>(random.GetRandom() % 256);
+                drawItemProperties.m_depth = random.GetRandomFloat() * 1000.0f;
+                m_unsortedList.push_back(drawItemProperties);
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_unsortedList = {};
+            m_drawList = {};
+        }
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        //! Sorts a fresh copy of the unsorted list on every iteration, the copy is not timed.
+        template<typename SortFunction>
+        void RunSortBenchmark(benchmark::State& state, const SortFunction& sortFunction)
+        {
+            for ([[maybe_unused]] auto _ : state)
+            {
+                state.PauseTiming();
+                m_drawList = m_unsortedList;
+                state.ResumeTiming();
+
+                sortFunction(m_drawList);
+                benchmark::DoNotOptimize(m_drawList.data());
+            }
+            state.SetItemsProcessed(state.iterations() * m_unsortedList.size());
+        }
+
+        RHI::DrawList m_unsortedList;
+        RHI::DrawList m_drawList;
+    };
+
+    //! Sorts with RHI::SortDrawList, which switches to a radix sort for big lists.
+    BENCHMARK_DEFINE_F(DrawListSortBenchmarkFixture, BM_SortDrawList_KeyThenDepth)(benchmark::State& state)
+    {
+        RunSortBenchmark(state, [](RHI::DrawList& drawList) { RHI::SortDrawList(drawList, RHI::DrawListSortType::KeyThenDepth); });
+    }
+
+    BENCHMARK_DEFINE_F(DrawListSortBenchmarkFixture, BM_SortDrawList_KeyThenReverseDepth)(benchmark::State& state)
+    {
+        RunSortBenchmark(state, [](RHI::DrawList& drawList) { RHI::SortDrawList(drawList, RHI::DrawListSortType::KeyThenReverseDepth); });
+    }
+
+    BENCHMARK_DEFINE_F(DrawListSortBenchmarkFixture, BM_SortDrawList_DepthThenKey)(benchmark::State& state)
+    {
+        RunSortBenchmark(state, [](RHI::DrawList& drawList) { RHI::SortDrawList(drawList, RHI::DrawListSortType::DepthThenKey); });
+    }
+
+    BENCHMARK_DEFINE_F(DrawListSortBenchmarkFixture, BM_SortDrawList_ReverseDepthThenKey)(benchmark::State& state)
+    {
+        RunSortBenchmark(state, [](RHI::DrawList& drawList) { RHI::SortDrawList(drawList, RHI::DrawListSortType::ReverseDepthThenKey); });
+    }
+
+    //! Reference comparison sort of all list sizes, to compare against the sort used by RHI::SortDrawList.
+    BENCHMARK_DEFINE_F(DrawListSortBenchmarkFixture, BM_ComparisonSort_KeyThenDepth)(benchmark::State& state)
+    {
+        RunSortBenchmark(state, [](RHI::DrawList& drawList)
+            {
+                AZStd::sort(drawList.begin(), drawList.end(), [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+                    {
+                        if (a.m_sortKey != b.m_sortKey)
+                        {
+                            return a.m_sortKey < b.m_sortKey;
+                        }
+                        return a.m_depth < b.m_depth;
+                    });
+            });
+    }
+
+    BENCHMARK_DEFINE_F(DrawListSortBenchmarkFixture, BM_ComparisonSort_DepthThenKey)(benchmark::State& state)
+    {
+        RunSortBenchmark(state, [](RHI::DrawList& drawList)
+            {
+                AZStd::sort(drawList.begin(), drawList.end(), [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+                    {
+                        if (a.m_depth != b.m_depth)
+                        {
+                            return a.m_depth < b.m_depth;
+                        }
+                        return a.m_sortKey < b.m_sortKey;
+                    });
+            });
+    }
+
+    BENCHMARK_REGISTER_F(DrawListSortBenchmarkFixture, BM_SortDrawList_KeyThenDepth)
+        ->RangeMultiplier(DrawListBenchmarkSettings::ItemCountMultiplier)
+        ->Range(DrawListBenchmarkSettings::StartItemCount, DrawListBenchmarkSettings::EndItemCount)
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(DrawListSortBenchmarkFixture, BM_SortDrawList_KeyThenReverseDepth)
+        ->RangeMultiplier(DrawListBenchmarkSettings::ItemCountMultiplier)
+        ->Range(DrawListBenchmarkSettings::StartItemCount, DrawListBenchmarkSettings::EndItemCount)
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(DrawListSortBenchmarkFixture, BM_SortDrawList_DepthThenKey)
+        ->RangeMultiplier(DrawListBenchmarkSettings::ItemCountMultiplier)
+        ->Range(DrawListBenchmarkSettings::StartItemCount, DrawListBenchmarkSettings::EndItemCount)
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(DrawListSortBenchmarkFixture, BM_SortDrawList_ReverseDepthThenKey)
+        ->RangeMultiplier(DrawListBenchmarkSettings::ItemCountMultiplier)
+        ->Range(DrawListBenchmarkSettings::StartItemCount, DrawListBenchmarkSettings::EndItemCount)
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(DrawListSortBenchmarkFixture, BM_ComparisonSort_KeyThenDepth)
+        ->RangeMultiplier(DrawListBenchmarkSettings::ItemCountMultiplier)
+        ->Range(DrawListBenchmarkSettings::StartItemCount, DrawListBenchmarkSettings::EndItemCount)
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(DrawListSortBenchmarkFixture, BM_ComparisonSort_DepthThenKey)
+        ->RangeMultiplier(DrawListBenchmarkSettings::ItemCountMultiplier)
+        ->Range(DrawListBenchmarkSettings::StartItemCount, DrawListBenchmarkSettings::EndItemCount)
+        ->Unit(benchmark::kMicrosecond);
+} // namespace UnitTest
+#endif // HAVE_BENCHMARK
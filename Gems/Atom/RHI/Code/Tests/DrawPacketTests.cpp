@@ -15,6 +15,7 @@
 #include <Atom/RHI/PipelineState.h>
 
 #include <AzCore/Math/Random.h>
+#include <AzCore/std/functional.h>
 #include <AzCore/std/sort.h>
 
 #include <Tests/Factory.h>
@@ -418,6 +419,60 @@ namespace UnitTest
 
         delete drawPacket;
     }
+
+    TEST_F(DrawPacketTest, SortDrawListLargeList_MatchesComparisonSort)
+    {
+        // Large enough to use the radix sort, the keys are kept in a small range so there are items with the same key.
+        const size_t itemCount = 4096;
+
+        AZ::SimpleLcgRandom random(s_randomSeed);
+        RHI::DrawList unsortedList;
+        for (size_t i = 0; i < itemCount; ++i)
+        {
+            RHI::DrawItemProperties drawItemProperties;
+            drawItemProperties.m_sortKey = static_cast<RHI::DrawItemSortKey>(random.GetRandom() % 64) - 32;
+            drawItemProperties.m_depth = (random.GetRandomFloat() - 0.5f) * 200.0f;
+            drawItemProperties.m_drawFilterMask = static_cast<RHI::DrawFilterMask>(i); // Identifies the item after sorting.
+            unsortedList.push_back(drawItemProperties);
+        }
+
+        const auto keyLess = [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b) { return a.m_sortKey < b.m_sortKey; };
+        const auto depthLess = [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b) { return a.m_depth < b.m_depth; };
+        const auto depthGreater = [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b) { return a.m_depth > b.m_depth; };
+
+        const AZStd::pair<RHI::DrawListSortType, AZStd::function<bool(const RHI::DrawItemProperties&, const RHI::DrawItemProperties&)>> sortTypes[] =
+        {
+            { RHI::DrawListSortType::KeyThenDepth, [&](const auto& a, const auto& b) { return keyLess(a, b) || (!keyLess(b, a) && depthLess(a, b)); } },
+            { RHI::DrawListSortType::KeyThenReverseDepth, [&](const auto& a, const auto& b) { return keyLess(a, b) || (!keyLess(b, a) && depthGreater(a, b)); } },
+            { RHI::DrawListSortType::DepthThenKey, [&](const auto& a, const auto& b) { return depthLess(a, b) || (!depthLess(b, a) && keyLess(a, b)); } },
+            { RHI::DrawListSortType::ReverseDepthThenKey, [&](const auto& a, const auto& b) { return depthGreater(a, b) || (!depthGreater(b, a) && keyLess(a, b)); } },
+        };
+
+        for (const auto& [sortType, less] : sortTypes)
+        {
+            RHI::DrawList drawList = unsortedList;
+            RHI::SortDrawList(drawList, sortType);
+
+            RHI::DrawList expectedList = unsortedList;
+            AZStd::sort(expectedList.begin(), expectedList.end(), less);
+
+            ASSERT_EQ(drawList.size(), expectedList.size());
+            for (size_t i = 0; i < drawList.size(); ++i)
+            {
+                EXPECT_EQ(drawList[i].m_sortKey, expectedList[i].m_sortKey);
+                EXPECT_EQ(drawList[i].m_depth, expectedList[i].m_depth);
+            }
+
+            // Every item is still in the list exactly once.
+            AZStd::vector<bool> itemFound(itemCount, false);
+            for (const RHI::DrawItemProperties& drawItemProperties : drawList)
+            {
+                ASSERT_LT(drawItemProperties.m_drawFilterMask, itemCount);
+                EXPECT_FALSE(itemFound[drawItemProperties.m_drawFilterMask]);
+                itemFound[drawItemProperties.m_drawFilterMask] = true;
+            }
+        }
+    }
 }
 
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -437,6 +437,66 @@ namespace UnitTest
             }
         }
 
+        void TestCompiledGraphCache()
+        {
+            RHI::FrameGraph frameGraph;
+
+            RHI::ImageScopeAttachmentDescriptor imageBindingDesc;
+            imageBindingDesc.m_attachmentId = m_state->m_imageAttachments[0].m_id;
+            imageBindingDesc.m_imageViewDescriptor = RHI::ImageViewDescriptor();
+            imageBindingDesc.m_loadStoreAction.m_loadAction = RHI::AttachmentLoadAction::Load;
+
+            for (uint32_t frameIdx = 0; frameIdx < FrameIterationCount; ++frameIdx)
+            {
+                // The structure of the graph changes on the first frame and half way through. Three quarters of the way
+                // through only the access of an attachment changes, which must not be mistaken for the previous structure.
+                const bool useThirdScope = frameIdx >= FrameIterationCount / 2;
+                const bool isAttachmentWritten = frameIdx >= FrameIterationCount * 3 / 4;
+                const bool isStructureChanged = frameIdx == 0 || frameIdx == FrameIterationCount / 2 || frameIdx == FrameIterationCount * 3 / 4;
+
+                frameGraph.Begin();
+                frameGraph.GetAttachmentDatabase().ImportImage(m_state->m_imageAttachments[0].m_id, m_state->m_imageAttachments[0].m_image);
+
+                frameGraph.BeginScope(*m_state->m_scopes[0]);
+                frameGraph.SetHardwareQueueClass(RHI::HardwareQueueClass::Graphics);
+                frameGraph.EndScope();
+
+                frameGraph.BeginScope(*m_state->m_scopes[1]);
+                frameGraph.SetHardwareQueueClass(RHI::HardwareQueueClass::Compute);
+                frameGraph.ExecuteAfter(m_state->m_scopes[0]->GetId());
+                frameGraph.EndScope();
+
+                if (useThirdScope)
+                {
+                    frameGraph.BeginScope(*m_state->m_scopes[2]);
+                    frameGraph.SetHardwareQueueClass(RHI::HardwareQueueClass::Graphics);
+                    frameGraph.ExecuteAfter(m_state->m_scopes[1]->GetId());
+                    frameGraph.UseShaderAttachment(imageBindingDesc,
+                        isAttachmentWritten ? RHI::ScopeAttachmentAccess::ReadWrite : RHI::ScopeAttachmentAccess::Read);
+                    frameGraph.EndScope();
+                }
+
+                frameGraph.End();
+
+                {
+                    RHI::FrameGraphCompileRequest request;
+                    request.m_frameGraph = &frameGraph;
+                    m_state->m_frameGraphCompiler->Compile(request);
+                }
+
+                EXPECT_EQ(m_state->m_frameGraphCompiler->IsCompiledGraphCacheHit(), !isStructureChanged);
+
+                // The cross-queue edges must be the same whether they were compiled or reused.
+                EXPECT_EQ(m_state->m_scopes[0]->GetConsumerByQueue(RHI::HardwareQueueClass::Compute), m_state->m_scopes[1].get());
+                EXPECT_EQ(m_state->m_scopes[1]->GetProducerByQueue(RHI::HardwareQueueClass::Graphics), m_state->m_scopes[0].get());
+                if (useThirdScope)
+                {
+                    EXPECT_EQ(m_state->m_scopes[1]->GetConsumerByQueue(RHI::HardwareQueueClass::Graphics), m_state->m_scopes[2].get());
+                    EXPECT_EQ(m_state->m_scopes[0]->GetConsumerOnSameQueue(), m_state->m_scopes[2].get());
+                }
+            }
+        }
+
     private:
         static const uint32_t FrameIterationCount = 32;
         static const uint32_t ImageCount = 256;
@@ -493,4 +553,9 @@ namespace UnitTest
     {
         TestScopeGraph();
     }
+
+    TEST_F(FrameGraphTests, TestCompiledGraphCache)
+    {
+        TestCompiledGraphCache();
+    }
 }
@@ -293,6 +293,34 @@ namespace UnitTest
         EXPECT_EQ(pipelineStatesMerged.size(), 1);
     }
 
+    TEST_F(PipelineStateTests, PipelineStateCache_Metrics_CountsReadOnlyCacheMisses)
+    {
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::Ptr<RHI::PipelineStateCache> pipelineStateCache = RHI::PipelineStateCache::Create(*device);
+
+        RHI::PipelineStateDescriptorForDraw descriptor = CreatePipelineStateDescriptor(0);
+        RHI::PipelineLibraryHandle libraryHandle = pipelineStateCache->CreateLibrary(nullptr);
+
+        // The first request compiles the pipeline state, the next ones find it in the thread-local cache.
+        const RHI::PipelineState* pipelineState = pipelineStateCache->AcquirePipelineState(libraryHandle, descriptor);
+        EXPECT_EQ(pipelineStateCache->AcquirePipelineState(libraryHandle, descriptor), pipelineState);
+        EXPECT_EQ(pipelineStateCache->AcquirePipelineState(libraryHandle, descriptor), pipelineState);
+        pipelineStateCache->Compact();
+
+        EXPECT_EQ(pipelineStateCache->GetMetrics().m_compileCount, 1);
+        EXPECT_EQ(pipelineStateCache->GetMetrics().m_threadLocalCacheHitCount, 2);
+        EXPECT_EQ(pipelineStateCache->GetMetrics().m_pendingCacheHitCount, 0);
+
+        // Once compacted, the pipeline state is found in the read-only cache.
+        EXPECT_EQ(pipelineStateCache->AcquirePipelineState(libraryHandle, descriptor), pipelineState);
+        pipelineStateCache->Compact();
+
+        EXPECT_EQ(pipelineStateCache->GetMetrics().m_compileCount, 0);
+        EXPECT_EQ(pipelineStateCache->GetMetrics().m_threadLocalCacheHitCount, 0);
+        EXPECT_EQ(pipelineStateCache->GetMetrics().m_pendingCacheHitCount, 0);
+        ValidateCacheIntegrity(pipelineStateCache);
+    }
+
     TEST_F(PipelineStateTests, PipelineStateCache_PipelineStateThreading_Fuzz_Test)
     {
         RHI::Ptr<RHI::Device> device = MakeTestDevice();
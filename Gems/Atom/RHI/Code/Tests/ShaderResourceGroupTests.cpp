@@ -11,6 +11,7 @@
 #include <Tests/Factory.h>
 #include <Tests/Device.h>
 #include <Atom/RHI/Factory.h>
+#include <Atom/RHI.Reflect/Limits.h>
 #include <Atom/RHI.Reflect/ReflectSystemComponent.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Serialization/ObjectStream.h>
@@ -763,4 +764,60 @@ namespace UnitTest
             EXPECT_NE(otherLayout->GetHash(), layout->GetHash());
         }
     }
+
+    TEST_F(ShaderResourceGroupTests, QueueForCompile_SameContentsAfterCompilesSettled_CompileSkipped)
+    {
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::ConstPtr<RHI::ShaderResourceGroupLayout> srgLayout = CreateLayout();
+
+        RHI::Ptr<RHI::ShaderResourceGroupPool> srgPool = RHI::Factory::Get().CreateShaderResourceGroupPool();
+        RHI::ShaderResourceGroupPoolDescriptor descriptor;
+        descriptor.m_layout = srgLayout.get();
+        srgPool->Init(*device, descriptor);
+
+        RHI::Ptr<RHI::ShaderResourceGroup> srg = RHI::Factory::Get().CreateShaderResourceGroup();
+        srgPool->InitGroup(*srg);
+
+        const RHI::ShaderInputConstantIndex floatValueIndex = srgLayout->FindShaderInputConstantIndex(Name("m_floatValue"));
+        RHI::ShaderResourceGroupData srgData(srgLayout);
+        srgData.SetConstant(floatValueIndex, 1.0f);
+
+        // Queues the group the same way the RPI does and compiles the pool, returning the number of skipped compiles.
+        const auto compileFrame = [&srgPool, &srg, &srgData]()
+        {
+            srg->Compile(srgData);
+            srgData.DisableCompilationForAllResourceTypes();
+
+            srgPool->CompileGroupsBegin();
+            const uint32_t skippedCompileCount = srgPool->GetSkippedCompileCount();
+            srgPool->CompileGroupsForInterval(RHI::Interval(0, srgPool->GetGroupsToCompileCount()));
+            srgPool->CompileGroupsEnd();
+            return skippedCompileCount;
+        };
+
+        // Compiles are never skipped while the update mask keeps the constants flagged for every frame in flight,
+        // nor on the compile that clears the mask of the compiled data.
+        for (uint32_t i = 0; i < RHI::Limits::Device::FrameCountMax + 2; ++i)
+        {
+            EXPECT_EQ(compileFrame(), 0u);
+        }
+
+        // Nothing changed since the copies of the compiled data settled.
+        EXPECT_EQ(compileFrame(), 1u);
+
+        // Setting the same value flags the constants again, but the contents didn't change.
+        srgData.SetConstant(floatValueIndex, 1.0f);
+        EXPECT_EQ(compileFrame(), 1u);
+
+        srgData.SetConstant(floatValueIndex, 2.0f);
+        srg->Compile(srgData);
+        EXPECT_TRUE(srg->IsQueuedForCompile());
+
+        srgPool->CompileGroupsBegin();
+        EXPECT_EQ(srgPool->GetSkippedCompileCount(), 0u);
+        EXPECT_EQ(srgPool->GetGroupsToCompileCount(), 1u);
+        srgPool->CompileGroupsForInterval(RHI::Interval(0, srgPool->GetGroupsToCompileCount()));
+        srgPool->CompileGroupsEnd();
+        EXPECT_FALSE(srg->IsQueuedForCompile());
+    }
 }
@@ -11,6 +11,7 @@ set(FILES
     Tests/AllocatorTests.cpp
     Tests/BufferTests.cpp
     Tests/DrawPacketTests.cpp
+    Tests/DrawListBenchmarks.cpp
     Tests/FrameGraphTests.cpp
     Tests/FrameSchedulerTests.cpp
     Tests/HashingTests.cpp
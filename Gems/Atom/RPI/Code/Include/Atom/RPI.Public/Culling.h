@@ -115,6 +115,10 @@ namespace AZ
             //! something that shouldn't be rendered, regardless of its actual position relative to the camera
             bool m_isHidden = false;
 
+            //! Changed by CullingScene::RegisterOrUpdateCullable every time the cull data is updated.
+            //! Used to find out if the frustum test result of a previous frame is still valid for this object.
+            uint32_t m_cullDataVersion = 0;
+
             void SetDebugName([[maybe_unused]] const AZ::Name& debugName)
             {
 #ifdef AZ_CULL_DEBUG_ENABLED
@@ -144,6 +148,8 @@ namespace AZ
             // UI Options
             bool m_enableStats = false;
             bool m_enableFrustumCulling = true;
+            //! Off by default: the savings of caching frustum test results haven't been measured against the cost of the cache lookups.
+            bool m_enableIncrementalCulling = false;
             bool m_parallelOctreeTraversal = true;
             bool m_freezeFrustums = false;
             bool m_debugDraw = false;
@@ -176,6 +182,8 @@ namespace AZ
                     m_numJobs = 0;
                     m_numVisibleCullables = 0;
                     m_numVisibleDrawPackets = 0;
+                    m_numTestedCullables = 0;
+                    m_numSkippedCullables = 0;
                 }
 
                 AZ::Name m_name;
@@ -183,6 +191,10 @@ namespace AZ
                 AZStd::atomic_uint32_t m_numJobs = 0;
                 AZStd::atomic_uint32_t m_numVisibleCullables = 0;
                 AZStd::atomic_uint32_t m_numVisibleDrawPackets = 0;
+                //! Number of cullables tested against the view frustum.
+                AZStd::atomic_uint32_t m_numTestedCullables = 0;
+                //! Number of cullables that reused the frustum test result of a previous frame.
+                AZStd::atomic_uint32_t m_numSkippedCullables = 0;
             };
 
             CullingDebugContext() = default;
@@ -279,14 +291,80 @@ namespace AZ
             static const size_t WorkListCapacity = 5;
             using WorkListType = AZStd::fixed_vector<AzFramework::IVisibilityScene::NodeData, WorkListCapacity>;
 
+            //! Frustum test results of the cullables in one octree node for one view.
+            //! The results stay valid while the cullables of the node don't change and every frustum plane that moved
+            //! since the results were computed leaves the node on the same side, i.e. the node doesn't intersect the
+            //! region between the previous and the current frustum.
+            struct NodeCullCache
+            {
+                enum class FrustumTestResult : uint8_t
+                {
+                    Unknown,
+                    Inside,
+                    Outside
+                };
+
+                struct Entry
+                {
+                    const AzFramework::VisibilityEntry* m_visibilityEntry = nullptr;
+                    uint32_t m_cullDataVersion = 0;
+                    FrustumTestResult m_result = FrustumTestResult::Unknown;
+                };
+
+                //! Returns true if the results computed with the cached frustum are still valid for the given frustum.
+                bool IsValidForFrustum(const Frustum& frustum) const;
+
+                //! Returns true if the cached entries match the current entries of the node.
+                bool MatchesEntries(const AZStd::vector<AzFramework::VisibilityEntry*>& entries) const;
+
+                //! Discards the cached results and starts caching the given entries for the given frustum.
+                void Reset(const AZStd::vector<AzFramework::VisibilityEntry*>& entries, const Frustum& frustum);
+
+                //! Discards the cached results but keeps the entries and their bounds, for when only the frustum changed.
+                void ResetResults(const Frustum& frustum);
+
+                AZStd::vector<Entry> m_entries;
+                //! Bounds enclosing the bounding volumes of all the cullables in the node.
+                Aabb m_bounds = Aabb::CreateNull();
+                //! Frustum the cached results were computed with.
+                Frustum m_frustum;
+                uint32_t m_lastFrameUsed = 0;
+            };
+
+            //! Caches of the nodes in a work list, in the same order as the work list.
+            using NodeCacheListType = AZStd::fixed_vector<NodeCullCache*, WorkListCapacity>;
+
+            //! Cached frustum test results of each octree node for one view.
+            struct ViewCullCache
+            {
+                //! Returns the cache of a node, keyed by the address of the node's entry list.
+                //! Only called while enumerating the octree for the view, which is done by a single job, so the culling jobs
+                //! receive the node caches with their work list and don't need to lock.
+                NodeCullCache& GetNodeCache(const AZStd::vector<AzFramework::VisibilityEntry*>& nodeEntries, uint32_t frameNumber);
+
+                AZStd::unordered_map<const void*, NodeCullCache> m_nodeCaches;
+            };
+
         protected:
             size_t CountObjectsInScene();
 
+            //! Returns the culling cache of a view, creating it on first use.
+            ViewCullCache& GetViewCullCache(const View* view);
+
+            //! Releases the cache of views that are not culled anymore and of nodes that were not visited for a while.
+            void PruneCullCaches(const AZStd::vector<ViewPtr>& views);
+
             const Scene* m_parentScene = nullptr;
             AzFramework::IVisibilityScene* m_visScene = nullptr;
             CullingDebugContext m_debugCtx;
             AZStd::concurrency_checker m_cullDataConcurrencyCheck;
             OcclusionPlaneVector m_occlusionPlanes;
+
+            AZStd::mutex m_viewCullCachesMutex;
+            AZStd::unordered_map<const View*, AZStd::unique_ptr<ViewCullCache>> m_viewCullCaches;
+            uint32_t m_frameNumber = 0;
+            //! Source of Cullable::m_cullDataVersion, shared by all cullables so a recycled cullable never repeats a version.
+            AZStd::atomic_uint32_t m_cullDataVersionCounter = 0;
         };
         
 
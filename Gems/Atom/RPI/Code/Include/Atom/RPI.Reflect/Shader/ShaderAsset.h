@@ -7,8 +7,10 @@
  */
 #pragma once
 
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/optional.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/EBus/Event.h>
 
 #include <Atom/RPI.Public/AssetInitBus.h>
@@ -50,6 +52,16 @@ namespace AZ
                             //!< with dxc, or spirv-cross, etc.
         };
 
+        //! Counts the calls to ShaderAsset::FindVariantStableId that were resolved by its search cache.
+        struct ShaderVariantSearchCacheStats
+        {
+            //! Searches found in the cache.
+            uint32_t m_hitCount = 0;
+
+            //! Searches that walked the ShaderVariantTreeAsset.
+            uint32_t m_missCount = 0;
+        };
+
         class ShaderAsset final
             : public Data::AssetData
             , public ShaderVariantFinderNotificationBus::Handler
@@ -121,9 +133,12 @@ namespace AZ
             //! This function first loads and caches the ShaderVariantTreeAsset (if not done before).
             //! If the ShaderVariantTreeAsset is not found (either the AssetProcessor has not generated it yet, or it simply doesn't exist), then
             //! it returns a search result that identifies the root variant.
+            //! The results found in the ShaderVariantTreeAsset are cached, so each ShaderVariantId only searches the tree once.
             //! This function is thread safe.
             ShaderVariantSearchResult FindVariantStableId(const ShaderVariantId& shaderVariantId);
 
+            ShaderVariantSearchCacheStats GetVariantSearchCacheStats() const;
+
             //! Returns the variant asset associated with the provided StableId.
             //! The user should call FindVariantStableId() first to get a ShaderVariantStableId from a ShaderVariantId,
             //! Or better yet, call GetVariant(ShaderVariantId) for maximum convenience.
@@ -316,6 +331,15 @@ namespace AZ
             mutable AZStd::shared_mutex m_variantTreeMutex;
 
             bool m_shaderVariantTreeLoadWasRequested = false;
+
+            //! Results of FindVariantStableId() in m_shaderVariantTree, guarded by m_variantTreeMutex.
+            //! The cache is cleared when it reaches MaxVariantSearchCacheSize, so shaders that see many different option
+            //! combinations over time only keep the ones that are currently in use.
+            static constexpr size_t MaxVariantSearchCacheSize = 1024;
+            AZStd::unordered_map<ShaderVariantId, ShaderVariantSearchResult, ShaderVariantIdHash> m_variantSearchCache;
+
+            AZStd::atomic<uint32_t> m_variantSearchCacheHitCount = {0};
+            AZStd::atomic<uint32_t> m_variantSearchCacheMissCount = {0};
         };
 
         class ShaderAssetHandler final
@@ -118,5 +118,13 @@ namespace AZ
             static int Compare(const ShaderVariantId& lhs, const ShaderVariantId& rhs);
             bool operator () (const ShaderVariantId& lhs, const ShaderVariantId& rhs) const;
         };
+
+        //! Hashes the bits compared by ShaderVariantIdComparator, so ids that compare equal have the same hash.
+        //! Used to key hash containers with a ShaderVariantId.
+        struct ShaderVariantIdHash
+        {
+        public:
+            size_t operator () (const ShaderVariantId& shaderVariantId) const;
+        };
     } // namespace RPI
 } // namespace AZ
@@ -0,0 +1,374 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Model/MeshSimplifier.h>
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/sort.h>
+
+#include <SceneAPI/SceneCore/Utilities/HashHelper.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        namespace
+        {
+            //! Symmetric 4x4 matrix accumulating squared distances to a set of planes, stored as its upper triangle.
+            struct Quadric
+            {
+                double m_a00 = 0.0, m_a01 = 0.0, m_a02 = 0.0, m_a03 = 0.0;
+                double m_a11 = 0.0, m_a12 = 0.0, m_a13 = 0.0;
+                double m_a22 = 0.0, m_a23 = 0.0;
+                double m_a33 = 0.0;
+                double m_weight = 0.0;
+
+                void AddPlane(double a, double b, double c, double d, double weight)
+                {
+                    m_a00 += weight * a * a;
+                    m_a01 += weight * a * b;
+                    m_a02 += weight * a * c;
+                    m_a03 += weight * a * d;
+                    m_a11 += weight * b * b;
+                    m_a12 += weight * b * c;
+                    m_a13 += weight * b * d;
+                    m_a22 += weight * c * c;
+                    m_a23 += weight * c * d;
+                    m_a33 += weight * d * d;
+                    m_weight += weight;
+                }
+
+                void Add(const Quadric& other)
+                {
+                    m_a00 += other.m_a00;
+                    m_a01 += other.m_a01;
+                    m_a02 += other.m_a02;
+                    m_a03 += other.m_a03;
+                    m_a11 += other.m_a11;
+                    m_a12 += other.m_a12;
+                    m_a13 += other.m_a13;
+                    m_a22 += other.m_a22;
+                    m_a23 += other.m_a23;
+                    m_a33 += other.m_a33;
+                    m_weight += other.m_weight;
+                }
+
+                //! Returns the weighted mean squared distance of the point to the accumulated planes.
+                double Evaluate(const Vector3& point) const
+                {
+                    const double x = point.GetX();
+                    const double y = point.GetY();
+                    const double z = point.GetZ();
+                    const double error =
+                        m_a00 * x * x + 2.0 * m_a01 * x * y + 2.0 * m_a02 * x * z + 2.0 * m_a03 * x +
+                        m_a11 * y * y + 2.0 * m_a12 * y * z + 2.0 * m_a13 * y +
+                        m_a22 * z * z + 2.0 * m_a23 * z +
+                        m_a33;
+                    return m_weight > 0.0 ? AZStd::max(error, 0.0) / m_weight : 0.0;
+                }
+            };
+
+            struct Collapse
+            {
+                uint32_t m_fromGroup = 0;
+                uint32_t m_toVertex = 0;
+                double m_error = AZStd::numeric_limits<double>::max();
+            };
+
+            uint64_t MakeEdgeKey(uint32_t a, uint32_t b)
+            {
+                return a < b ? (static_cast<uint64_t>(a) << 32) | b : (static_cast<uint64_t>(b) << 32) | a;
+            }
+        } // namespace
+
+        MeshSimplifier::Result MeshSimplifier::Simplify(
+            const AZStd::vector<float>& positions,
+            const AZStd::vector<uint32_t>& indices,
+            size_t targetIndexCount,
+            float maxError)
+        {
+            Result result;
+            result.m_indices = indices;
+
+            const size_t vertexCount = positions.size() / 3;
+            if (vertexCount == 0 || indices.size() <= targetIndexCount)
+            {
+                return result;
+            }
+
+            // Weld the vertices by position. Each position group is a vertex of the welded topology.
+            AZStd::vector<uint32_t> vertexToGroup(vertexCount);
+            AZStd::vector<uint32_t> groupVertexCount;
+            AZStd::vector<Vector3> groupPositions;
+            Aabb bounds = Aabb::CreateNull();
+            {
+                AZStd::unordered_map<Vector3, uint32_t> positionToGroup;
+                positionToGroup.reserve(vertexCount);
+                for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+                {
+                    const Vector3 position(positions[vertex * 3 + 0], positions[vertex * 3 + 1], positions[vertex * 3 + 2]);
+                    const auto [iter, inserted] = positionToGroup.emplace(position, static_cast<uint32_t>(groupPositions.size()));
+                    if (inserted)
+                    {
+                        groupPositions.push_back(position);
+                        groupVertexCount.push_back(0);
+                        bounds.AddPoint(position);
+                    }
+                    vertexToGroup[vertex] = iter->second;
+                    ++groupVertexCount[iter->second];
+                }
+            }
+            const size_t groupCount = groupPositions.size();
+
+            const float meshSize = bounds.IsValid() ? bounds.GetExtents().GetLength() : 0.0f;
+            if (meshSize <= 0.0f)
+            {
+                return result;
+            }
+            const double maxErrorSq = maxError > 0.0f
+                ? static_cast<double>(maxError) * maxError * meshSize * meshSize
+                : AZStd::numeric_limits<double>::max();
+
+            // Accumulate the planes of the triangles around each position, weighted by triangle area.
+            AZStd::vector<Quadric> quadrics(groupCount);
+            for (size_t index = 0; index + 2 < indices.size(); index += 3)
+            {
+                const uint32_t g0 = vertexToGroup[indices[index + 0]];
+                const uint32_t g1 = vertexToGroup[indices[index + 1]];
+                const uint32_t g2 = vertexToGroup[indices[index + 2]];
+                const Vector3 normal = (groupPositions[g1] - groupPositions[g0]).Cross(groupPositions[g2] - groupPositions[g0]);
+                const float doubleArea = normal.GetLength();
+                if (doubleArea <= 0.0f)
+                {
+                    continue;
+                }
+                const Vector3 unitNormal = normal / doubleArea;
+                const double d = -unitNormal.Dot(groupPositions[g0]);
+                for (uint32_t group : { g0, g1, g2 })
+                {
+                    quadrics[group].AddPlane(unitNormal.GetX(), unitNormal.GetY(), unitNormal.GetZ(), d, doubleArea * 0.5);
+                }
+            }
+
+            AZStd::vector<uint32_t>& current = result.m_indices;
+            AZStd::vector<uint32_t> remap(vertexCount);
+            AZStd::vector<uint8_t> locked(groupCount);
+            AZStd::vector<uint8_t> touched(groupCount);
+            AZStd::vector<uint32_t> adjacencyOffsets(groupCount + 1);
+            AZStd::vector<uint32_t> adjacency;
+            AZStd::vector<uint64_t> edges;
+            AZStd::vector<Collapse> bestCollapses(groupCount);
+            AZStd::vector<Collapse> candidates;
+            double largestErrorSq = 0.0;
+
+            while (current.size() > targetIndexCount)
+            {
+                const size_t triangleCount = current.size() / 3;
+
+                // Positions shared by several vertices are seams. Edges that are not shared by exactly
+                // two triangles are open borders or non-manifold. Neither is allowed to move.
+                for (size_t group = 0; group < groupCount; ++group)
+                {
+                    locked[group] = groupVertexCount[group] > 1 ? 1 : 0;
+                }
+                edges.clear();
+                edges.reserve(current.size());
+                for (size_t index = 0; index < current.size(); index += 3)
+                {
+                    const uint32_t g0 = vertexToGroup[current[index + 0]];
+                    const uint32_t g1 = vertexToGroup[current[index + 1]];
+                    const uint32_t g2 = vertexToGroup[current[index + 2]];
+                    edges.push_back(MakeEdgeKey(g0, g1));
+                    edges.push_back(MakeEdgeKey(g1, g2));
+                    edges.push_back(MakeEdgeKey(g2, g0));
+                }
+                AZStd::sort(edges.begin(), edges.end());
+                for (size_t edge = 0; edge < edges.size();)
+                {
+                    size_t edgeEnd = edge + 1;
+                    while (edgeEnd < edges.size() && edges[edgeEnd] == edges[edge])
+                    {
+                        ++edgeEnd;
+                    }
+                    if (edgeEnd - edge != 2)
+                    {
+                        locked[static_cast<uint32_t>(edges[edge] >> 32)] = 1;
+                        locked[static_cast<uint32_t>(edges[edge] & 0xFFFFFFFF)] = 1;
+                    }
+                    edge = edgeEnd;
+                }
+
+                // Build the list of triangles around each position.
+                AZStd::fill(adjacencyOffsets.begin(), adjacencyOffsets.end(), 0u);
+                for (uint32_t vertex : current)
+                {
+                    ++adjacencyOffsets[vertexToGroup[vertex] + 1];
+                }
+                for (size_t group = 0; group < groupCount; ++group)
+                {
+                    adjacencyOffsets[group + 1] += adjacencyOffsets[group];
+                }
+                adjacency.resize(current.size());
+                {
+                    AZStd::vector<uint32_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+                    for (size_t index = 0; index < current.size(); ++index)
+                    {
+                        adjacency[fill[vertexToGroup[current[index]]]++] = static_cast<uint32_t>(index / 3);
+                    }
+                }
+
+                // Find the cheapest neighbor to collapse each free position onto.
+                AZStd::fill(bestCollapses.begin(), bestCollapses.end(), Collapse{});
+                for (size_t index = 0; index < current.size(); index += 3)
+                {
+                    for (size_t corner = 0; corner < 3; ++corner)
+                    {
+                        const uint32_t fromGroup = vertexToGroup[current[index + corner]];
+                        if (locked[fromGroup])
+                        {
+                            continue;
+                        }
+                        for (size_t otherCorner = 1; otherCorner < 3; ++otherCorner)
+                        {
+                            const uint32_t toVertex = current[index + (corner + otherCorner) % 3];
+                            const uint32_t toGroup = vertexToGroup[toVertex];
+                            if (toGroup == fromGroup)
+                            {
+                                continue;
+                            }
+                            Quadric combined = quadrics[fromGroup];
+                            combined.Add(quadrics[toGroup]);
+                            const double error = combined.Evaluate(groupPositions[toGroup]);
+                            if (error < bestCollapses[fromGroup].m_error)
+                            {
+                                bestCollapses[fromGroup] = Collapse{ fromGroup, toVertex, error };
+                            }
+                        }
+                    }
+                }
+
+                candidates.clear();
+                for (const Collapse& collapse : bestCollapses)
+                {
+                    if (collapse.m_error < AZStd::numeric_limits<double>::max() && collapse.m_error <= maxErrorSq)
+                    {
+                        candidates.push_back(collapse);
+                    }
+                }
+                AZStd::sort(candidates.begin(), candidates.end(),
+                    [](const Collapse& lhs, const Collapse& rhs) { return lhs.m_error < rhs.m_error; });
+
+                // Perform the cheapest collapses that don't interfere with each other in this pass.
+                for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+                {
+                    remap[vertex] = static_cast<uint32_t>(vertex);
+                }
+                AZStd::fill(touched.begin(), touched.end(), uint8_t(0));
+                const size_t trianglesToRemove = triangleCount - targetIndexCount / 3;
+                size_t trianglesRemoved = 0;
+                size_t collapseCount = 0;
+                for (const Collapse& collapse : candidates)
+                {
+                    if (trianglesRemoved >= trianglesToRemove)
+                    {
+                        break;
+                    }
+
+                    const uint32_t fromGroup = collapse.m_fromGroup;
+                    const uint32_t toGroup = vertexToGroup[collapse.m_toVertex];
+                    if (touched[fromGroup] || touched[toGroup])
+                    {
+                        continue;
+                    }
+
+                    // Reject collapses that would flip any of the remaining triangles.
+                    bool flips = false;
+                    size_t collapsedTriangles = 0;
+                    const Vector3& newPosition = groupPositions[toGroup];
+                    for (uint32_t adjacent = adjacencyOffsets[fromGroup]; adjacent < adjacencyOffsets[fromGroup + 1] && !flips; ++adjacent)
+                    {
+                        const uint32_t* triangle = &current[adjacency[adjacent] * 3];
+                        const uint32_t groups[3] = { vertexToGroup[triangle[0]], vertexToGroup[triangle[1]], vertexToGroup[triangle[2]] };
+                        if (groups[0] == toGroup || groups[1] == toGroup || groups[2] == toGroup)
+                        {
+                            ++collapsedTriangles;
+                            continue;
+                        }
+
+                        Vector3 moved[3] = { groupPositions[groups[0]], groupPositions[groups[1]], groupPositions[groups[2]] };
+                        const Vector3 normalBefore = (moved[1] - moved[0]).Cross(moved[2] - moved[0]);
+                        for (size_t corner = 0; corner < 3; ++corner)
+                        {
+                            if (groups[corner] == fromGroup)
+                            {
+                                moved[corner] = newPosition;
+                            }
+                        }
+                        const Vector3 normalAfter = (moved[1] - moved[0]).Cross(moved[2] - moved[0]);
+                        flips = normalBefore.Dot(normalAfter) <= 0.0f;
+                    }
+                    if (flips)
+                    {
+                        continue;
+                    }
+
+                    // Free positions only have a single vertex, so remapping it moves the whole position.
+                    for (uint32_t adjacent = adjacencyOffsets[fromGroup]; adjacent < adjacencyOffsets[fromGroup + 1]; ++adjacent)
+                    {
+                        const uint32_t* triangle = &current[adjacency[adjacent] * 3];
+                        for (size_t corner = 0; corner < 3; ++corner)
+                        {
+                            if (vertexToGroup[triangle[corner]] == fromGroup)
+                            {
+                                remap[triangle[corner]] = collapse.m_toVertex;
+                            }
+                            touched[vertexToGroup[triangle[corner]]] = 1;
+                        }
+                    }
+                    quadrics[toGroup].Add(quadrics[fromGroup]);
+                    largestErrorSq = AZStd::max(largestErrorSq, collapse.m_error);
+                    trianglesRemoved += collapsedTriangles;
+                    ++collapseCount;
+                }
+
+                if (collapseCount == 0)
+                {
+                    break;
+                }
+
+                // Apply the collapses and drop the triangles that became degenerate.
+                size_t writeIndex = 0;
+                for (size_t index = 0; index < current.size(); index += 3)
+                {
+                    const uint32_t v0 = remap[current[index + 0]];
+                    const uint32_t v1 = remap[current[index + 1]];
+                    const uint32_t v2 = remap[current[index + 2]];
+                    const uint32_t g0 = vertexToGroup[v0];
+                    const uint32_t g1 = vertexToGroup[v1];
+                    const uint32_t g2 = vertexToGroup[v2];
+                    if (g0 == g1 || g1 == g2 || g2 == g0)
+                    {
+                        continue;
+                    }
+                    current[writeIndex++] = v0;
+                    current[writeIndex++] = v1;
+                    current[writeIndex++] = v2;
+                }
+                current.resize(writeIndex);
+            }
+
+            result.m_error = static_cast<float>(AZStd::sqrt(largestErrorSq)) / meshSize;
+            return result;
+        }
+    } // namespace RPI
+} // namespace AZ
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! Quadric error metric simplifier used to generate LODs in the model builder.
+        //!
+        //! The simplifier only ever collapses a vertex onto one of its neighbors, so the resulting
+        //! index buffer references a subset of the original vertices. This keeps every other vertex
+        //! stream (normals, UVs, skin influences, ...) valid without having to interpolate it.
+        //!
+        //! Vertices are welded by position to find the topology of the mesh. A position that is shared
+        //! by several vertices (a UV, normal or material seam) or that lies on an open border is never
+        //! moved, which keeps seams and silhouettes intact.
+        class MeshSimplifier
+        {
+        public:
+            struct Result
+            {
+                //! Three indices per triangle, referencing the vertices of the input mesh.
+                AZStd::vector<uint32_t> m_indices;
+                //! Largest error of the collapses that were performed, relative to the size of the mesh.
+                float m_error = 0.0f;
+            };
+
+            //! Simplifies an indexed triangle list.
+            //! @param positions Three floats per vertex.
+            //! @param indices Three indices per triangle.
+            //! @param targetIndexCount Simplification stops once the index count reaches this value.
+            //! @param maxError Largest allowed error relative to the size of the mesh. Values <= 0 disable the limit.
+            static Result Simplify(
+                const AZStd::vector<float>& positions,
+                const AZStd::vector<uint32_t>& indices,
+                size_t targetIndexCount,
+                float maxError);
+        };
+    } // namespace RPI
+} // namespace AZ
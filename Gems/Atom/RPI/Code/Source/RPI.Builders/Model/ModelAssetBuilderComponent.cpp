@@ -9,9 +9,12 @@
 #include <Model/ModelAssetBuilderComponent.h>
 #include <Model/MaterialAssetBuilderComponent.h>
 #include <Model/MorphTargetExporter.h>
+#include <Model/MeshSimplifier.h>
 #include <Atom/RPI.Edit/Common/AssetUtils.h>
 
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -103,7 +106,7 @@ namespace AZ
             if (auto* serialize = azrtti_cast<SerializeContext*>(context))
             {
                 serialize->Class<ModelAssetBuilderComponent, SceneAPI::SceneCore::ExportingComponent>()
-                    ->Version(30);  // (updated to separate material slot ID from default material asset)
+                    ->Version(31);  // (added generated LODs)
             }
         }
 
@@ -351,7 +354,7 @@ namespace AZ
             // Then in each Lod we need to group all faces by material id.
             // All sub meshes with the same material id get merged
             AZStd::vector<Data::Asset<ModelLodAsset>> lodAssets;
-            lodAssets.resize(sourceMeshContentListsByLod.size());
+            lodAssets.reserve(sourceMeshContentListsByLod.size());
 
             // Joint name to joint index map used for the skinning influences.
             AZStd::unordered_map<AZStd::string, uint16_t> jointNameToIndexMap;
@@ -365,107 +368,81 @@ namespace AZ
             ModelAssetCreator modelAssetCreator;
             modelAssetCreator.Begin(modelAssetId);
 
+            // LODs are only generated from LOD0 when the artist didn't assign any LOD meshes.
+            const bool generateLods = lodRule && lodRule->GetGeneratedLodCount() > 0 && sourceMeshContentListsByLod.size() == 1;
+            AZ_Warning(s_builderName, !lodRule || lodRule->GetGeneratedLodCount() == 0 || generateLods,
+                "Mesh group '%s' contains LOD meshes, the generated LOD settings will be ignored.", m_modelName.c_str());
+            ProductMeshContentList lodMeshesToSimplify;
+
             uint32_t lodIndex = 0;
             for (const SourceMeshContentList& sourceMeshContentList : sourceMeshContentListsByLod)
             {
-                ModelLodAssetCreator lodAssetCreator;
-                m_lodName = AZStd::string::format("lod%d", lodIndex);
-                AZStd::string lodAssetName = GetAssetFullName(ModelLodAsset::TYPEINFO_Uuid());
-                lodAssetCreator.Begin(CreateAssetId(lodAssetName));
-
-                {
-                    ProductMeshContentList lodMeshes = SourceMeshListToProductMeshList(context, sourceMeshContentList, jointNameToIndexMap, morphTargetMetaCreator);
-
-                    PadVerticesForSkinning(lodMeshes);
-
-                    // By default, we merge meshes that share the same material
-                    bool canMergeMeshes = true;
-
-                    AZStd::shared_ptr<const SceneAPI::SceneData::StaticMeshAdvancedRule> staticMeshAdvancedRule = context.m_group.GetRuleContainerConst().FindFirstByType<SceneAPI::SceneData::StaticMeshAdvancedRule>();
-                    if (staticMeshAdvancedRule && !staticMeshAdvancedRule->MergeMeshes())
-                    {
-                        // If the merge meshes option is disabled in the advanced mesh rule, don't merge meshes
-                        canMergeMeshes = false;
-                    }
-                    else
-                    {
-                        for (const SourceMeshContent& sourceMesh : sourceMeshContentList)
-                        {
-                            if (sourceMesh.m_isMorphed)
-                            {
-                                // Merging meshes shuffles around the order of the vertices, but morph targets rely on having an index that tell them which vertices to morph
-                                // We do not merge morphed meshes so that this index is preserved and correct.
-                                // If we keep track of the ordering changes in MergeMeshesByMaterialUid and then re-mapped the MORPHTARGET_VERTEXINDICES buffer
-                                // we could potentially enable merging meshes that are morphed. But for now, disable merging.
-                                canMergeMeshes = false;
-                                break;
-                            }
-                        }
-                    }
-
-                    if (canMergeMeshes)
-                    {
-                        lodMeshes = MergeMeshesByMaterialUid(lodMeshes);
-                    }
-
-#if defined(AZ_RPI_MESHES_SHARE_COMMON_BUFFERS)
-                    // We shouldn't need a mesh name for the buffer names since meshed are sharing common buffers
-                    m_meshName = "";
-                    ProductMeshViewList lodMeshViews;
+                ProductMeshContentList lodMeshes = SourceMeshListToProductMeshList(context, sourceMeshContentList, jointNameToIndexMap, morphTargetMetaCreator);
 
-                    ProductMeshContent mergedMesh;
-                    MergeMeshesToCommonBuffers(lodMeshes, mergedMesh, lodMeshViews);
+                PadVerticesForSkinning(lodMeshes);
 
-                    BufferAssetView indexBuffer;
-                    AZStd::vector<ModelLodAsset::Mesh::StreamBufferInfo> streamBuffers;
+                // By default, we merge meshes that share the same material
+                bool canMergeMeshes = true;
 
-                    if (!CreateModelLodBuffers(mergedMesh, indexBuffer, streamBuffers, lodAssetCreator))
-                    {
-                        return AZ::SceneAPI::Events::ProcessingResult::Failure;
-                    }
-
-                    for (const ProductMeshView& meshView : lodMeshViews)
+                AZStd::shared_ptr<const SceneAPI::SceneData::StaticMeshAdvancedRule> staticMeshAdvancedRule = context.m_group.GetRuleContainerConst().FindFirstByType<SceneAPI::SceneData::StaticMeshAdvancedRule>();
+                if (staticMeshAdvancedRule && !staticMeshAdvancedRule->MergeMeshes())
+                {
+                    // If the merge meshes option is disabled in the advanced mesh rule, don't merge meshes
+                    canMergeMeshes = false;
+                }
+                else
+                {
+                    for (const SourceMeshContent& sourceMesh : sourceMeshContentList)
                     {
-                        if (!CreateMesh(meshView, indexBuffer, streamBuffers, modelAssetCreator, lodAssetCreator, context.m_materialsByUid))
+                        if (sourceMesh.m_isMorphed)
                         {
-                            return AZ::SceneAPI::Events::ProcessingResult::Failure;
+                            // Merging meshes shuffles around the order of the vertices, but morph targets rely on having an index that tell them which vertices to morph
+                            // We do not merge morphed meshes so that this index is preserved and correct.
+                            // If we keep track of the ordering changes in MergeMeshesByMaterialUid and then re-mapped the MORPHTARGET_VERTEXINDICES buffer
+                            // we could potentially enable merging meshes that are morphed. But for now, disable merging.
+                            canMergeMeshes = false;
+                            break;
                         }
                     }
-#else
-                    uint32_t meshIndex = 0;
-                    for (const ProductMeshContent& mesh : lodMeshes)
-                    {
-                        const ProductMeshView meshView = CreateViewToEntireMesh(mesh);
-
-                        BufferAssetView indexBuffer;
-                        AZStd::vector<ModelLodAsset::Mesh::StreamBufferInfo> streamBuffers;
-
-                        // Mesh name in ProductMeshContent could be duplicated so generate unique mesh name using index 
-                        m_meshName = AZStd::string::format("mesh%d", meshIndex++);
+                }
 
-                        if (!CreateModelLodBuffers(mesh, indexBuffer, streamBuffers, lodAssetCreator))
-                        {
-                            return AZ::SceneAPI::Events::ProcessingResult::Failure;
-                        }
+                if (canMergeMeshes)
+                {
+                    lodMeshes = MergeMeshesByMaterialUid(lodMeshes);
+                }
 
-                        if (!CreateMesh(meshView, indexBuffer, streamBuffers, lodAssetCreator, context.m_materialsByUid))
-                        {
-                            return AZ::SceneAPI::Events::ProcessingResult::Failure;
-                        }
-                    }
-#endif
+                if (generateLods)
+                {
+                    lodMeshesToSimplify = lodMeshes;
                 }
 
-                if (!lodAssetCreator.End(lodAssets[lodIndex]))
+                lodAssets.emplace_back();
+                if (!CreateLodAsset(lodIndex, lodMeshes, modelAssetCreator, context.m_materialsByUid, lodAssets.back()))
                 {
                     return AZ::SceneAPI::Events::ProcessingResult::Failure;
                 }
-                lodAssets[lodIndex].SetHint(lodAssetName); // name will be used for file name when export asset
 
                 lodIndex++;
             }
             sourceMeshContentListsByLod.clear();
 
+            if (generateLods)
+            {
+                AZStd::vector<ProductMeshContentList> generatedLods = GenerateLodMeshes(*lodRule, lodMeshesToSimplify);
+                lodMeshesToSimplify.clear();
+
+                for (const ProductMeshContentList& lodMeshes : generatedLods)
+                {
+                    lodAssets.emplace_back();
+                    if (!CreateLodAsset(lodIndex, lodMeshes, modelAssetCreator, context.m_materialsByUid, lodAssets.back()))
+                    {
+                        return AZ::SceneAPI::Events::ProcessingResult::Failure;
+                    }
+
+                    lodIndex++;
+                }
+            }
+
             // Finalize all LOD assets
             for (auto& lodAsset : lodAssets)
             {
@@ -505,6 +482,200 @@ namespace AZ
             return AZ::SceneAPI::Events::ProcessingResult::Success;
         }
 
+        bool ModelAssetBuilderComponent::CreateLodAsset(
+            uint32_t lodIndex,
+            const ProductMeshContentList& lodMeshes,
+            ModelAssetCreator& modelAssetCreator,
+            const MaterialAssetsByUid& materialAssetsByUid,
+            Data::Asset<ModelLodAsset>& outLodAsset)
+        {
+            ModelLodAssetCreator lodAssetCreator;
+            m_lodName = AZStd::string::format("lod%d", lodIndex);
+            AZStd::string lodAssetName = GetAssetFullName(ModelLodAsset::TYPEINFO_Uuid());
+            lodAssetCreator.Begin(CreateAssetId(lodAssetName));
+
+#if defined(AZ_RPI_MESHES_SHARE_COMMON_BUFFERS)
+            // We shouldn't need a mesh name for the buffer names since meshed are sharing common buffers
+            m_meshName = "";
+            ProductMeshViewList lodMeshViews;
+
+            ProductMeshContent mergedMesh;
+            MergeMeshesToCommonBuffers(lodMeshes, mergedMesh, lodMeshViews);
+
+            BufferAssetView indexBuffer;
+            AZStd::vector<ModelLodAsset::Mesh::StreamBufferInfo> streamBuffers;
+
+            if (!CreateModelLodBuffers(mergedMesh, indexBuffer, streamBuffers, lodAssetCreator))
+            {
+                return false;
+            }
+
+            for (const ProductMeshView& meshView : lodMeshViews)
+            {
+                if (!CreateMesh(meshView, indexBuffer, streamBuffers, modelAssetCreator, lodAssetCreator, materialAssetsByUid))
+                {
+                    return false;
+                }
+            }
+#else
+            uint32_t meshIndex = 0;
+            for (const ProductMeshContent& mesh : lodMeshes)
+            {
+                const ProductMeshView meshView = CreateViewToEntireMesh(mesh);
+
+                BufferAssetView indexBuffer;
+                AZStd::vector<ModelLodAsset::Mesh::StreamBufferInfo> streamBuffers;
+
+                // Mesh name in ProductMeshContent could be duplicated so generate unique mesh name using index 
+                m_meshName = AZStd::string::format("mesh%d", meshIndex++);
+
+                if (!CreateModelLodBuffers(mesh, indexBuffer, streamBuffers, lodAssetCreator))
+                {
+                    return false;
+                }
+
+                if (!CreateMesh(meshView, indexBuffer, streamBuffers, lodAssetCreator, materialAssetsByUid))
+                {
+                    return false;
+                }
+            }
+#endif
+
+            if (!lodAssetCreator.End(outLodAsset))
+            {
+                return false;
+            }
+            outLodAsset.SetHint(lodAssetName); // name will be used for file name when export asset
+            return true;
+        }
+
+        AZStd::vector<ModelAssetBuilderComponent::ProductMeshContentList> ModelAssetBuilderComponent::GenerateLodMeshes(
+            const SceneAPI::DataTypes::ILodRule& lodRule,
+            const ProductMeshContentList& lodMeshes) const
+        {
+            const size_t generatedLodCount = lodRule.GetGeneratedLodCount();
+            AZStd::vector<ProductMeshContentList> generatedLods(generatedLodCount);
+            for (ProductMeshContentList& generatedLod : generatedLods)
+            {
+                generatedLod.resize(lodMeshes.size());
+            }
+
+            // Every LOD is simplified from the same source meshes, so all LODs and meshes can be processed at once.
+            AZ::JobCompletion jobCompletion;
+            for (size_t generatedLodIndex = 0; generatedLodIndex < generatedLodCount; ++generatedLodIndex)
+            {
+                const float triangleRatio = AZ::GetClamp(lodRule.GetGeneratedLodTriangleRatio(generatedLodIndex), 0.0f, 1.0f);
+                const float maxError = lodRule.GetGeneratedLodMaxError(generatedLodIndex);
+                for (size_t meshIndex = 0; meshIndex < lodMeshes.size(); ++meshIndex)
+                {
+                    const auto simplifyLambda = [&generatedLods, &lodMeshes, generatedLodIndex, meshIndex, triangleRatio, maxError]()
+                    {
+                        generatedLods[generatedLodIndex][meshIndex] = SimplifyMesh(lodMeshes[meshIndex], triangleRatio, maxError);
+                    };
+                    AZ::Job* simplifyJob = AZ::CreateJobFunction(simplifyLambda, true, nullptr); //auto-deletes
+                    simplifyJob->SetDependent(&jobCompletion);
+                    simplifyJob->Start();
+                }
+            }
+            jobCompletion.StartAndWaitForCompletion();
+
+            // Drop LODs that could not be simplified any further than the previous one, e.g. because everything left is a seam.
+            size_t previousIndexCount = 0;
+            for (const ProductMeshContent& mesh : lodMeshes)
+            {
+                previousIndexCount += mesh.m_indices.size();
+            }
+            for (size_t generatedLodIndex = 0; generatedLodIndex < generatedLods.size(); ++generatedLodIndex)
+            {
+                size_t indexCount = 0;
+                for (const ProductMeshContent& mesh : generatedLods[generatedLodIndex])
+                {
+                    indexCount += mesh.m_indices.size();
+                }
+
+                if (indexCount == 0 || indexCount >= previousIndexCount)
+                {
+                    AZ_Warning(s_builderName, false, "Mesh group '%s' could not be simplified past %zu triangles, only %zu LODs were generated.",
+                        m_modelName.c_str(), previousIndexCount / 3, generatedLodIndex);
+                    generatedLods.resize(generatedLodIndex);
+                    break;
+                }
+
+                AZ_TracePrintf(AZ::SceneAPI::Utilities::LogWindow, "Generated LOD %zu with %zu triangles.\n", generatedLodIndex + 1, indexCount / 3);
+                previousIndexCount = indexCount;
+            }
+
+            return generatedLods;
+        }
+
+        ModelAssetBuilderComponent::ProductMeshContent ModelAssetBuilderComponent::SimplifyMesh(
+            const ProductMeshContent& mesh,
+            float triangleRatio,
+            float maxError)
+        {
+            const size_t targetIndexCount = static_cast<size_t>(mesh.m_indices.size() / 3 * triangleRatio) * 3;
+            MeshSimplifier::Result simplified = MeshSimplifier::Simplify(mesh.m_positions, mesh.m_indices, targetIndexCount, maxError);
+
+            // The simplified indices reference a subset of the original vertices, so every stream
+            // is compacted the same way and keeps its UV, normal and skin influence data untouched.
+            const size_t vertexCount = mesh.m_positions.size() / PositionFloatsPerVert;
+            AZStd::vector<uint32_t> vertexRemap(vertexCount, AZStd::numeric_limits<uint32_t>::max());
+            AZStd::vector<uint32_t> keptVertices;
+            for (uint32_t& index : simplified.m_indices)
+            {
+                if (vertexRemap[index] == AZStd::numeric_limits<uint32_t>::max())
+                {
+                    vertexRemap[index] = aznumeric_cast<uint32_t>(keptVertices.size());
+                    keptVertices.push_back(index);
+                }
+                index = vertexRemap[index];
+            }
+
+            const auto compactStream = [&keptVertices, vertexCount](const auto& source, auto& destination)
+            {
+                if (source.empty())
+                {
+                    return;
+                }
+                const size_t elementsPerVertex = source.size() / vertexCount;
+                destination.reserve(keptVertices.size() * elementsPerVertex);
+                for (uint32_t vertex : keptVertices)
+                {
+                    const auto vertexBegin = source.begin() + vertex * elementsPerVertex;
+                    destination.insert(destination.end(), vertexBegin, vertexBegin + elementsPerVertex);
+                }
+            };
+
+            ProductMeshContent lodMesh;
+            lodMesh.m_name = mesh.m_name;
+            lodMesh.m_materialUid = mesh.m_materialUid;
+            lodMesh.m_indices = AZStd::move(simplified.m_indices);
+            compactStream(mesh.m_positions, lodMesh.m_positions);
+            compactStream(mesh.m_normals, lodMesh.m_normals);
+            compactStream(mesh.m_tangents, lodMesh.m_tangents);
+            compactStream(mesh.m_bitangents, lodMesh.m_bitangents);
+
+            lodMesh.m_uvCustomNames = mesh.m_uvCustomNames;
+            lodMesh.m_uvSets.resize(mesh.m_uvSets.size());
+            for (size_t uvSetIndex = 0; uvSetIndex < mesh.m_uvSets.size(); ++uvSetIndex)
+            {
+                compactStream(mesh.m_uvSets[uvSetIndex], lodMesh.m_uvSets[uvSetIndex]);
+            }
+
+            lodMesh.m_colorCustomNames = mesh.m_colorCustomNames;
+            lodMesh.m_colorSets.resize(mesh.m_colorSets.size());
+            for (size_t colorSetIndex = 0; colorSetIndex < mesh.m_colorSets.size(); ++colorSetIndex)
+            {
+                compactStream(mesh.m_colorSets[colorSetIndex], lodMesh.m_colorSets[colorSetIndex]);
+            }
+
+            compactStream(mesh.m_skinJointIndices, lodMesh.m_skinJointIndices);
+            compactStream(mesh.m_skinWeights, lodMesh.m_skinWeights);
+
+            // Cloth data only applies to LOD0 and morph targets are not carried over to generated LODs.
+            return lodMesh;
+        }
+
         void ModelAssetBuilderComponent::AddToMeshContent(
             const AZStd::shared_ptr<const AZ::SceneAPI::DataTypes::IGraphObject>& data,
             SourceMeshContent& content)
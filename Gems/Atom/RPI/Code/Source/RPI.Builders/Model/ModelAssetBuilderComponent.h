@@ -21,6 +21,7 @@
 #include <SceneAPI/SceneCore/DataTypes/GraphData/IMeshVertexTangentData.h>
 #include <SceneAPI/SceneCore/DataTypes/GraphData/IMeshVertexBitangentData.h>
 #include <SceneAPI/SceneCore/DataTypes/GraphData/ISkinWeightData.h>
+#include <SceneAPI/SceneCore/DataTypes/Rules/ILodRule.h>
 #include <SceneAPI/SceneCore/DataTypes/Rules/ISkinRule.h>
 #include <SceneAPI/SceneCore/Containers/SceneGraph.h>
 
@@ -233,6 +234,30 @@ namespace AZ
                 const ProductMeshContentList& productMeshList,
                 IndicesOperation indicesOp);
 
+            //! Creates the ModelLodAsset for the given LOD index from its product meshes.
+            //! 
+            //! Returns false if an error occurs
+            bool CreateLodAsset(
+                uint32_t lodIndex,
+                const ProductMeshContentList& lodMeshes,
+                ModelAssetCreator& modelAssetCreator,
+                const MaterialAssetsByUid& materialAssetsByUid,
+                Data::Asset<ModelLodAsset>& outLodAsset);
+
+            //! Generates the LODs requested by the LodRule by simplifying the given LOD0 meshes.
+            //! All LODs and meshes are simplified in parallel. LODs that can't be reduced further than
+            //! the previous LOD are dropped.
+            AZStd::vector<ProductMeshContentList> GenerateLodMeshes(
+                const SceneAPI::DataTypes::ILodRule& lodRule,
+                const ProductMeshContentList& lodMeshes) const;
+
+            //! Reduces the triangle count of a mesh to the given ratio, or until the simplification error
+            //! would exceed maxError. The vertex streams of the remaining vertices are kept as they are.
+            static ProductMeshContent SimplifyMesh(
+                const ProductMeshContent& mesh,
+                float triangleRatio,
+                float maxError);
+
             //! Create stream buffer asset with a structured view descriptor from the given data and add it to the out stream buffers
             template<typename T>
             bool BuildStructuredStreamBuffer(
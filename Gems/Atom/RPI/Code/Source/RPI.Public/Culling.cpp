@@ -43,6 +43,9 @@ namespace AZ
         AZ_CVAR(bool, r_CullInParallel, true, nullptr, ConsoleFunctorFlags::Null, "");
         AZ_CVAR(uint32_t, r_CullWorkPerBatch, 500, nullptr, ConsoleFunctorFlags::Null, "");
 
+        //! Number of frames between releases of the node culling caches that were not used in the meantime.
+        static constexpr uint32_t CullCachePruneInterval = 60;
+
         void DebugDrawWorldCoordinateAxes(AuxGeomDraw* auxGeom)
         {
             auxGeom->DrawCylinder(Vector3(.5, .0, .0), Vector3(1, 0, 0), 0.02f, 1.0f, Colors::Red, AuxGeomDraw::DrawStyle::Solid, AuxGeomDraw::DepthTest::Off);
@@ -236,6 +239,167 @@ namespace AZ
             }
         }
 
+        //! Classifies bounds against a plane the same way ShapeIntersection classifies spheres and oriented boxes.
+        static IntersectResult ClassifyBounds(const Plane& plane, const Aabb& bounds)
+        {
+            const float distance = plane.GetPointDist(bounds.GetCenter());
+            const float radius = (0.5f * bounds.GetExtents()).Dot(plane.GetNormal().GetAbs());
+            if (distance < -radius)
+            {
+                return IntersectResult::Exterior;
+            }
+            else if (distance > radius)
+            {
+                return IntersectResult::Interior;
+            }
+            return IntersectResult::Overlaps;
+        }
+
+        bool CullingScene::NodeCullCache::IsValidForFrustum(const Frustum& frustum) const
+        {
+            if (!m_bounds.IsValid())
+            {
+                return true;
+            }
+
+            // The frustum tests of the cullables are done plane by plane, so a result can only change if a plane that moved
+            // crosses the bounds of the cullables, either before or after moving.
+            for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+            {
+                const Plane cachedPlane = m_frustum.GetPlane(planeId);
+                const Plane plane = frustum.GetPlane(planeId);
+                if (cachedPlane == plane)
+                {
+                    continue;
+                }
+
+                const IntersectResult cachedResult = ClassifyBounds(cachedPlane, m_bounds);
+                if (cachedResult == IntersectResult::Overlaps || cachedResult != ClassifyBounds(plane, m_bounds))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool CullingScene::NodeCullCache::MatchesEntries(const AZStd::vector<AzFramework::VisibilityEntry*>& entries) const
+        {
+            if (m_entries.size() != entries.size())
+            {
+                return false;
+            }
+
+            for (size_t entryIndex = 0; entryIndex < entries.size(); ++entryIndex)
+            {
+                const AzFramework::VisibilityEntry* visibilityEntry = entries[entryIndex];
+                const Entry& cachedEntry = m_entries[entryIndex];
+                if (cachedEntry.m_visibilityEntry != visibilityEntry)
+                {
+                    return false;
+                }
+
+                if (visibilityEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
+                {
+                    const Cullable* c = static_cast<const Cullable*>(visibilityEntry->m_userData);
+                    if (cachedEntry.m_cullDataVersion != c->m_cullDataVersion)
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        void CullingScene::NodeCullCache::Reset(const AZStd::vector<AzFramework::VisibilityEntry*>& entries, const Frustum& frustum)
+        {
+            m_entries.resize(entries.size());
+            m_bounds = Aabb::CreateNull();
+            m_frustum = frustum;
+
+            for (size_t entryIndex = 0; entryIndex < entries.size(); ++entryIndex)
+            {
+                const AzFramework::VisibilityEntry* visibilityEntry = entries[entryIndex];
+                Entry& cachedEntry = m_entries[entryIndex];
+                cachedEntry.m_visibilityEntry = visibilityEntry;
+                cachedEntry.m_cullDataVersion = 0;
+                cachedEntry.m_result = FrustumTestResult::Unknown;
+
+                if (visibilityEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
+                {
+                    const Cullable* c = static_cast<const Cullable*>(visibilityEntry->m_userData);
+                    cachedEntry.m_cullDataVersion = c->m_cullDataVersion;
+                    m_bounds.AddAabb(Aabb::CreateCenterRadius(c->m_cullData.m_boundingSphere.GetCenter(), c->m_cullData.m_boundingSphere.GetRadius()));
+                    m_bounds.AddAabb(Aabb::CreateFromObb(c->m_cullData.m_boundingObb));
+                }
+            }
+        }
+
+        void CullingScene::NodeCullCache::ResetResults(const Frustum& frustum)
+        {
+            m_frustum = frustum;
+            for (Entry& cachedEntry : m_entries)
+            {
+                cachedEntry.m_result = FrustumTestResult::Unknown;
+            }
+        }
+
+        CullingScene::NodeCullCache& CullingScene::ViewCullCache::GetNodeCache(
+            const AZStd::vector<AzFramework::VisibilityEntry*>& nodeEntries, uint32_t frameNumber)
+        {
+            NodeCullCache& nodeCache = m_nodeCaches[&nodeEntries];
+            nodeCache.m_lastFrameUsed = frameNumber;
+            return nodeCache;
+        }
+
+        CullingScene::ViewCullCache& CullingScene::GetViewCullCache(const View* view)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_viewCullCachesMutex);
+            AZStd::unique_ptr<ViewCullCache>& viewCullCache = m_viewCullCaches[view];
+            if (!viewCullCache)
+            {
+                viewCullCache = AZStd::make_unique<ViewCullCache>();
+            }
+            return *viewCullCache;
+        }
+
+        void CullingScene::PruneCullCaches(const AZStd::vector<ViewPtr>& views)
+        {
+            AZ_PROFILE_SCOPE(RPI, "CullingScene: PruneCullCaches");
+
+            ++m_frameNumber;
+            const bool pruneNodeCaches = (m_frameNumber % CullCachePruneInterval) == 0;
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_viewCullCachesMutex);
+            for (auto viewIter = m_viewCullCaches.begin(); viewIter != m_viewCullCaches.end();)
+            {
+                const View* view = viewIter->first;
+                const bool isViewActive = AZStd::find_if(views.begin(), views.end(),
+                    [view](const ViewPtr& viewPtr) { return viewPtr.get() == view; }) != views.end();
+                if (!isViewActive)
+                {
+                    viewIter = m_viewCullCaches.erase(viewIter);
+                    continue;
+                }
+
+                if (pruneNodeCaches)
+                {
+                    auto& nodeCaches = viewIter->second->m_nodeCaches;
+                    for (auto nodeIter = nodeCaches.begin(); nodeIter != nodeCaches.end();)
+                    {
+                        if (m_frameNumber - nodeIter->second.m_lastFrameUsed >= CullCachePruneInterval)
+                        {
+                            nodeIter = nodeCaches.erase(nodeIter);
+                        }
+                        else
+                        {
+                            ++nodeIter;
+                        }
+                    }
+                }
+                ++viewIter;
+            }
+        }
+
         void CullingScene::RegisterOrUpdateCullable(Cullable& cullable)
         {
             // Multiple threads can call RegisterOrUpdateCullable at the same time
@@ -244,6 +408,7 @@ namespace AZ
             // results depending on a race condition if you happen to update before or after
             // the culling system starts Enumerating, so use soft_lock_shared here
             m_cullDataConcurrencyCheck.soft_lock_shared();
+            cullable.m_cullDataVersion = ++m_cullDataVersionCounter;
             m_visScene->InsertOrUpdateEntry(cullable.m_cullData.m_visibilityEntry);
             m_cullDataConcurrencyCheck.soft_unlock_shared();
         }
@@ -277,6 +442,7 @@ namespace AZ
                 const Scene* m_scene = nullptr;
                 View* m_view = nullptr;
                 Frustum m_frustum;
+                uint32_t m_frameNumber = 0;
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
                 MaskedOcclusionCulling* m_maskedOcclusionCulling = nullptr;
 #endif
@@ -285,12 +451,15 @@ namespace AZ
         private:
             const AZStd::shared_ptr<JobData> m_jobData;
             CullingScene::WorkListType m_worklist;
+            CullingScene::NodeCacheListType m_nodeCaches;
 
         public:
-            AddObjectsToViewJob(const AZStd::shared_ptr<AddObjectsToViewJob::JobData>& jobData, CullingScene::WorkListType& worklist)
+            AddObjectsToViewJob(const AZStd::shared_ptr<AddObjectsToViewJob::JobData>& jobData, CullingScene::WorkListType& worklist,
+                CullingScene::NodeCacheListType& nodeCaches)
                 : Job(true, nullptr)        //auto-deletes, no JobContext
                 , m_jobData(jobData)
                 , m_worklist(worklist)
+                , m_nodeCaches(nodeCaches)
             {
             }
 
@@ -303,9 +472,13 @@ namespace AZ
                 const RHI::DrawListMask drawListMask = m_jobData->m_view->GetDrawListMask();
                 uint32_t numDrawPackets = 0;
                 uint32_t numVisibleCullables = 0;
+                uint32_t numTestedCullables = 0;
+                uint32_t numSkippedCullables = 0;
 
-                for (const AzFramework::IVisibilityScene::NodeData& nodeData : m_worklist)
+                for (size_t nodeIndex = 0; nodeIndex < m_worklist.size(); ++nodeIndex)
                 {
+                    const AzFramework::IVisibilityScene::NodeData& nodeData = m_worklist[nodeIndex];
+
                     //If a node is entirely contained within the frustum, then we can skip the fine grained culling.
                     bool nodeIsContainedInFrustum = ShapeIntersection::Contains(m_jobData->m_frustum, nodeData.m_bounds);
 
@@ -346,9 +519,24 @@ namespace AZ
                     }
                     else
                     {
+                        //Reuse the frustum test results of a previous frame when the node and the frustum planes crossing it didn't change
+                        CullingScene::NodeCullCache* nodeCache = m_nodeCaches.empty() ? nullptr : m_nodeCaches[nodeIndex];
+                        if (nodeCache)
+                        {
+                            if (!nodeCache->MatchesEntries(nodeData.m_entries))
+                            {
+                                nodeCache->Reset(nodeData.m_entries, m_jobData->m_frustum);
+                            }
+                            else if (!nodeCache->IsValidForFrustum(m_jobData->m_frustum))
+                            {
+                                nodeCache->ResetResults(m_jobData->m_frustum);
+                            }
+                        }
+
                         //Do fine-grained culling before adding objects to the view
-                        for (AzFramework::VisibilityEntry* visibleEntry : nodeData.m_entries)
+                        for (size_t entryIndex = 0; entryIndex < nodeData.m_entries.size(); ++entryIndex)
                         {
+                            AzFramework::VisibilityEntry* visibleEntry = nodeData.m_entries[entryIndex];
                             if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
                             {
                                 Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
@@ -361,12 +549,27 @@ namespace AZ
                                     continue;
                                 }
 
-                                IntersectResult res = ShapeIntersection::Classify(m_jobData->m_frustum, c->m_cullData.m_boundingSphere);
-                                if (res == IntersectResult::Exterior)
+                                using FrustumTestResult = CullingScene::NodeCullCache::FrustumTestResult;
+                                FrustumTestResult* cachedResult = nodeCache ? &nodeCache->m_entries[entryIndex].m_result : nullptr;
+                                bool isInFrustum = false;
+                                if (cachedResult && *cachedResult != FrustumTestResult::Unknown)
                                 {
-                                    continue;
+                                    isInFrustum = *cachedResult == FrustumTestResult::Inside;
+                                    ++numSkippedCullables;
+                                }
+                                else
+                                {
+                                    IntersectResult res = ShapeIntersection::Classify(m_jobData->m_frustum, c->m_cullData.m_boundingSphere);
+                                    isInFrustum = res == IntersectResult::Interior ||
+                                        (res != IntersectResult::Exterior && ShapeIntersection::Overlaps(m_jobData->m_frustum, c->m_cullData.m_boundingObb));
+                                    ++numTestedCullables;
+                                    if (cachedResult)
+                                    {
+                                        *cachedResult = isInFrustum ? FrustumTestResult::Inside : FrustumTestResult::Outside;
+                                    }
                                 }
-                                else if (res == IntersectResult::Interior || ShapeIntersection::Overlaps(m_jobData->m_frustum, c->m_cullData.m_boundingObb))
+
+                                if (isInFrustum)
                                 {
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
                                     if (TestOcclusionCulling(visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
@@ -441,6 +644,8 @@ namespace AZ
                     //no need for mutex here since these are all atomics
                     cullStats.m_numVisibleDrawPackets += numDrawPackets;
                     cullStats.m_numVisibleCullables += numVisibleCullables;
+                    cullStats.m_numTestedCullables += numTestedCullables;
+                    cullStats.m_numSkippedCullables += numSkippedCullables;
                     ++cullStats.m_numJobs;
                 }
             }
@@ -584,17 +789,21 @@ namespace AZ
 #endif
 
             WorkListType worklist;
+            NodeCacheListType nodeCaches;
+
+            ViewCullCache* viewCullCache = m_debugCtx.m_enableIncrementalCulling ? &GetViewCullCache(&view) : nullptr;
 
             AZStd::shared_ptr<AddObjectsToViewJob::JobData> jobData = AZStd::make_shared<AddObjectsToViewJob::JobData>();
             jobData->m_debugCtx = &m_debugCtx;
             jobData->m_scene = &scene;
             jobData->m_view = &view;
             jobData->m_frustum = frustum;
+            jobData->m_frameNumber = m_frameNumber;
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
             jobData->m_maskedOcclusionCulling = maskedOcclusionCulling;
 #endif
 
-            auto nodeVisitorLambda = [jobData, &parentJob, &worklist](const AzFramework::IVisibilityScene::NodeData& nodeData) -> void
+            auto nodeVisitorLambda = [jobData, viewCullCache, &parentJob, &worklist, &nodeCaches](const AzFramework::IVisibilityScene::NodeData& nodeData) -> void
             {
                 AZ_PROFILE_SCOPE(RPI, "nodeVisitorLambda()");
                 AZ_Assert(nodeData.m_entries.size() > 0, "should not get called with 0 entries");
@@ -604,11 +813,18 @@ namespace AZ
                 //This reduces the number of jobs in flight, reducing job-system overhead.
                 worklist.emplace_back(AZStd::move(nodeData));
 
+                //The octree of a view is enumerated by one job, so the node caches are looked up here instead of locking in the worker jobs
+                if (viewCullCache)
+                {
+                    nodeCaches.push_back(&viewCullCache->GetNodeCache(worklist.back().m_entries, jobData->m_frameNumber));
+                }
+
                 if (worklist.size() == worklist.capacity())
                 {
                     //Kick off a job to process the (full) worklist
-                    AddObjectsToViewJob* job = aznew AddObjectsToViewJob(jobData, worklist); //pool allocated (cheap), auto-deletes when job finishes
+                    AddObjectsToViewJob* job = aznew AddObjectsToViewJob(jobData, worklist, nodeCaches); //pool allocated (cheap), auto-deletes when job finishes
                     worklist.clear();
+                    nodeCaches.clear();
                     parentJob.SetContinuation(job);
                     job->Start();
                 }
@@ -630,11 +846,12 @@ namespace AZ
                 remainingJobData->m_scene = &scene;
                 remainingJobData->m_view = &view;
                 remainingJobData->m_frustum = frustum;
+                remainingJobData->m_frameNumber = m_frameNumber;
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
                 remainingJobData->m_maskedOcclusionCulling = maskedOcclusionCulling;
 #endif
                 //Kick off a job to process any remaining workitems
-                AddObjectsToViewJob* job = aznew AddObjectsToViewJob(remainingJobData, worklist); //pool allocated (cheap), auto-deletes when job finishes
+                AddObjectsToViewJob* job = aznew AddObjectsToViewJob(remainingJobData, worklist, nodeCaches); //pool allocated (cheap), auto-deletes when job finishes
                 parentJob.SetContinuation(job);
                 job->Start();
             }
@@ -717,6 +934,9 @@ namespace AZ
                 AZ::Interface<AzFramework::IVisibilitySystem>::Get()->DestroyVisibilityScene(m_visScene);
                 m_visScene = nullptr;
             }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_viewCullCachesMutex);
+            m_viewCullCaches.clear();
         }
 
         void CullingScene::BeginCulling(const AZStd::vector<ViewPtr>& views)
@@ -726,6 +946,8 @@ namespace AZ
 
             m_debugCtx.ResetCullStats();
             m_debugCtx.m_numCullablesInScene = GetNumCullables();
+
+            PruneCullCaches(views);
             AZ::JobCompletion beginCullingCompletion;
 
             for (auto& view : views)
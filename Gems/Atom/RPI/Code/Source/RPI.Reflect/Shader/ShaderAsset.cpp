@@ -199,31 +199,70 @@ namespace AZ
             auto variantFinder = AZ::Interface<IShaderVariantFinder>::Get();
             AZ_Assert(variantFinder, "The IShaderVariantFinder doesn't exist");
 
+            // The tree is only read while searching, so threads search it in parallel under the shared lock.
+            // The unique lock is only taken to load the tree or to add the result to the cache.
+            Data::Asset<ShaderVariantTreeAsset> searchedTree;
             {
                 AZStd::shared_lock<decltype(m_variantTreeMutex)> lock(m_variantTreeMutex);
                 if (m_shaderVariantTree)
                 {
-                    return m_shaderVariantTree->FindVariantStableId(GetShaderOptionGroupLayout(), shaderVariantId);
+                    auto cacheIt = m_variantSearchCache.find(shaderVariantId);
+                    if (cacheIt != m_variantSearchCache.end())
+                    {
+                        m_variantSearchCacheHitCount.fetch_add(1, AZStd::memory_order_relaxed);
+                        return cacheIt->second;
+                    }
+
+                    searchedTree = m_shaderVariantTree;
+                    variantSearchResult = m_shaderVariantTree->FindVariantStableId(GetShaderOptionGroupLayout(), shaderVariantId);
                 }
             }
 
-            AZStd::unique_lock<decltype(m_variantTreeMutex)> lock(m_variantTreeMutex);
-            if (!m_shaderVariantTree)
+            if (!searchedTree)
             {
-                m_shaderVariantTree = variantFinder->GetShaderVariantTreeAsset(GetId());
+                AZStd::unique_lock<decltype(m_variantTreeMutex)> lock(m_variantTreeMutex);
                 if (!m_shaderVariantTree)
                 {
-                    if (!m_shaderVariantTreeLoadWasRequested)
+                    m_shaderVariantTree = variantFinder->GetShaderVariantTreeAsset(GetId());
+                    if (!m_shaderVariantTree)
                     {
-                        variantFinder->QueueLoadShaderVariantTreeAsset(GetId());
-                        m_shaderVariantTreeLoadWasRequested = true;
+                        if (!m_shaderVariantTreeLoadWasRequested)
+                        {
+                            variantFinder->QueueLoadShaderVariantTreeAsset(GetId());
+                            m_shaderVariantTreeLoadWasRequested = true;
+                        }
+
+                        // The variant tree could be under construction or simply doesn't exist at all.
+                        return variantSearchResult;
                     }
+                }
+
+                // This is the first search in the tree, which is rare enough to keep the lock.
+                searchedTree = m_shaderVariantTree;
+                variantSearchResult = m_shaderVariantTree->FindVariantStableId(GetShaderOptionGroupLayout(), shaderVariantId);
+            }
+            m_variantSearchCacheMissCount.fetch_add(1, AZStd::memory_order_relaxed);
 
-                    // The variant tree could be under construction or simply doesn't exist at all.
-                    return variantSearchResult;
+            AZStd::unique_lock<decltype(m_variantTreeMutex)> lock(m_variantTreeMutex);
+
+            // The tree may have been reloaded after the search, in which case the result is returned but not cached.
+            if (m_shaderVariantTree.Get() == searchedTree.Get())
+            {
+                if (m_variantSearchCache.size() >= MaxVariantSearchCacheSize)
+                {
+                    m_variantSearchCache.clear();
                 }
+                m_variantSearchCache.emplace(shaderVariantId, variantSearchResult);
             }
-            return m_shaderVariantTree->FindVariantStableId(GetShaderOptionGroupLayout(), shaderVariantId);
+            return variantSearchResult;
+        }
+
+        ShaderVariantSearchCacheStats ShaderAsset::GetVariantSearchCacheStats() const
+        {
+            ShaderVariantSearchCacheStats stats;
+            stats.m_hitCount = m_variantSearchCacheHitCount.load(AZStd::memory_order_relaxed);
+            stats.m_missCount = m_variantSearchCacheMissCount.load(AZStd::memory_order_relaxed);
+            return stats;
         }
 
         Data::Asset<ShaderVariantAsset> ShaderAsset::GetVariant(
@@ -587,6 +626,9 @@ namespace AZ
             ShaderReloadDebugTracker::ScopedSection reloadSection("{%p}->ShaderAsset::OnShaderVariantTreeAssetReady %s", this, shaderVariantTreeAsset.GetHint().c_str());
 
             AZStd::unique_lock<decltype(m_variantTreeMutex)> lock(m_variantTreeMutex);
+
+            // The cached search results belong to the previous tree.
+            m_variantSearchCache.clear();
             if (isError)
             {
                 m_shaderVariantTree = {}; //This will force to attempt to reload later.
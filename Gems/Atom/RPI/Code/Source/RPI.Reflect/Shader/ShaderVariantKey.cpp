@@ -8,6 +8,8 @@
 
 #include <Atom/RPI.Reflect/Shader/ShaderVariantKey.h>
 
+#include <AzCore/std/hash.h>
+
 namespace AZ
 {
     namespace RPI
@@ -157,5 +159,15 @@ namespace AZ
         {
             return ShaderVariantIdComparator::Compare(lhs, rhs) < 0;
         }
+        size_t ShaderVariantIdHash::operator () (const ShaderVariantId& shaderVariantId) const
+        {
+            const ShaderVariantKey maskedKey = shaderVariantId.m_key & shaderVariantId.m_mask;
+            size_t seed = 0;
+            for (size_t i = 0; i < maskedKey.num_words(); ++i)
+            {
+                AZStd::hash_combine(seed, shaderVariantId.m_mask.data()[i], maskedKey.data()[i]);
+            }
+            return seed;
+        }
     } // namespace RPI
 } // namespace AZ
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/math.h>
+
+#include <Model/MeshSimplifier.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    class MeshSimplifierTests
+        : public AllocatorsTestFixture
+    {
+    protected:
+        static constexpr uint32_t GridSize = 32;
+
+        static uint32_t GridVertex(uint32_t x, uint32_t y)
+        {
+            return y * (GridSize + 1) + x;
+        }
+
+        //! Builds a GridSize x GridSize quad grid in the XY plane, displaced along Z by the given height function.
+        template<typename HeightFunction>
+        void BuildGrid(HeightFunction heightFunction)
+        {
+            m_positions.clear();
+            m_indices.clear();
+            for (uint32_t y = 0; y <= GridSize; ++y)
+            {
+                for (uint32_t x = 0; x <= GridSize; ++x)
+                {
+                    m_positions.push_back(static_cast<float>(x));
+                    m_positions.push_back(static_cast<float>(y));
+                    m_positions.push_back(heightFunction(static_cast<float>(x), static_cast<float>(y)));
+                }
+            }
+            for (uint32_t y = 0; y < GridSize; ++y)
+            {
+                for (uint32_t x = 0; x < GridSize; ++x)
+                {
+                    m_indices.insert(m_indices.end(), { GridVertex(x, y), GridVertex(x + 1, y), GridVertex(x + 1, y + 1) });
+                    m_indices.insert(m_indices.end(), { GridVertex(x, y), GridVertex(x + 1, y + 1), GridVertex(x, y + 1) });
+                }
+            }
+        }
+
+        void TearDown() override
+        {
+            m_positions = {};
+            m_indices = {};
+            AllocatorsTestFixture::TearDown();
+        }
+
+        AZStd::vector<float> m_positions;
+        AZStd::vector<uint32_t> m_indices;
+    };
+
+    TEST_F(MeshSimplifierTests, Simplify_FlatGrid_ReachesTargetWithoutError)
+    {
+        BuildGrid([](float, float) { return 0.0f; });
+
+        const size_t targetIndexCount = m_indices.size() / 4;
+        RPI::MeshSimplifier::Result result = RPI::MeshSimplifier::Simplify(m_positions, m_indices, targetIndexCount, 0.0f);
+
+        EXPECT_LE(result.m_indices.size(), targetIndexCount);
+        EXPECT_GT(result.m_indices.size(), 0);
+        EXPECT_EQ(result.m_indices.size() % 3, 0);
+        EXPECT_NEAR(result.m_error, 0.0f, 1e-5f);
+        for (uint32_t index : result.m_indices)
+        {
+            EXPECT_LT(index, m_positions.size() / 3);
+        }
+    }
+
+    TEST_F(MeshSimplifierTests, Simplify_OpenBorder_BorderVerticesArePreserved)
+    {
+        BuildGrid([](float, float) { return 0.0f; });
+
+        RPI::MeshSimplifier::Result result = RPI::MeshSimplifier::Simplify(m_positions, m_indices, 0, 0.0f);
+
+        const AZStd::unordered_set<uint32_t> usedVertices(result.m_indices.begin(), result.m_indices.end());
+        for (uint32_t i = 0; i <= GridSize; ++i)
+        {
+            EXPECT_TRUE(usedVertices.contains(GridVertex(i, 0)));
+            EXPECT_TRUE(usedVertices.contains(GridVertex(i, GridSize)));
+            EXPECT_TRUE(usedVertices.contains(GridVertex(0, i)));
+            EXPECT_TRUE(usedVertices.contains(GridVertex(GridSize, i)));
+        }
+    }
+
+    TEST_F(MeshSimplifierTests, Simplify_UvSeam_SeamVerticesArePreserved)
+    {
+        BuildGrid([](float, float) { return 0.0f; });
+
+        // Split the grid down the middle column as a UV seam would, giving the right half its own copy of the seam vertices.
+        const uint32_t seamColumn = GridSize / 2;
+        AZStd::vector<uint32_t> seamCopies;
+        for (uint32_t y = 0; y <= GridSize; ++y)
+        {
+            const uint32_t vertex = GridVertex(seamColumn, y);
+            seamCopies.push_back(aznumeric_cast<uint32_t>(m_positions.size() / 3));
+            m_positions.insert(m_positions.end(), { m_positions[vertex * 3 + 0], m_positions[vertex * 3 + 1], m_positions[vertex * 3 + 2] });
+        }
+        for (size_t index = 0; index < m_indices.size(); index += 3)
+        {
+            const bool isRightHalf =
+                m_indices[index + 0] % (GridSize + 1) >= seamColumn &&
+                m_indices[index + 1] % (GridSize + 1) >= seamColumn &&
+                m_indices[index + 2] % (GridSize + 1) >= seamColumn;
+            for (size_t corner = 0; isRightHalf && corner < 3; ++corner)
+            {
+                if (m_indices[index + corner] % (GridSize + 1) == seamColumn)
+                {
+                    m_indices[index + corner] = seamCopies[m_indices[index + corner] / (GridSize + 1)];
+                }
+            }
+        }
+
+        RPI::MeshSimplifier::Result result = RPI::MeshSimplifier::Simplify(m_positions, m_indices, m_indices.size() / 10, 0.0f);
+
+        EXPECT_LT(result.m_indices.size(), m_indices.size() / 2);
+        const AZStd::unordered_set<uint32_t> usedVertices(result.m_indices.begin(), result.m_indices.end());
+        for (uint32_t y = 0; y <= GridSize; ++y)
+        {
+            EXPECT_TRUE(usedVertices.contains(GridVertex(seamColumn, y)));
+            EXPECT_TRUE(usedVertices.contains(seamCopies[y]));
+        }
+    }
+
+    TEST_F(MeshSimplifierTests, Simplify_MaxError_LimitsSimplification)
+    {
+        BuildGrid([](float x, float y) { return AZStd::sin(x * 0.7f) * AZStd::cos(y * 0.5f) * 3.0f; });
+
+        const size_t targetIndexCount = m_indices.size() / 4;
+        const float maxError = 0.001f;
+        RPI::MeshSimplifier::Result limited = RPI::MeshSimplifier::Simplify(m_positions, m_indices, targetIndexCount, maxError);
+        RPI::MeshSimplifier::Result unlimited = RPI::MeshSimplifier::Simplify(m_positions, m_indices, targetIndexCount, 0.0f);
+
+        EXPECT_LE(limited.m_error, maxError);
+        EXPECT_GT(limited.m_indices.size(), targetIndexCount);
+        EXPECT_LE(unlimited.m_indices.size(), targetIndexCount);
+        EXPECT_GT(unlimited.m_error, limited.m_error);
+    }
+
+    TEST_F(MeshSimplifierTests, Simplify_TargetAboveIndexCount_ReturnsInput)
+    {
+        BuildGrid([](float, float) { return 0.0f; });
+
+        RPI::MeshSimplifier::Result result = RPI::MeshSimplifier::Simplify(m_positions, m_indices, m_indices.size(), 0.0f);
+
+        EXPECT_EQ(result.m_indices, m_indices);
+        EXPECT_EQ(result.m_error, 0.0f);
+    }
+} // namespace UnitTest
@@ -1801,6 +1801,27 @@ namespace UnitTest
     }
 
 
+    TEST_F(ShaderTests, ShaderVariantIdHash_IgnoresKeyBitsOutsideMask)
+    {
+        using namespace AZ;
+
+        RPI::ShaderVariantId shaderVariantId;
+        shaderVariantId.m_key = RPI::ShaderVariantKey{0b0101};
+        shaderVariantId.m_mask = RPI::ShaderVariantKey{0b0111};
+
+        RPI::ShaderVariantId sameShaderVariantId = shaderVariantId;
+        sameShaderVariantId.m_key.set(3);
+
+        RPI::ShaderVariantId otherShaderVariantId = shaderVariantId;
+        otherShaderVariantId.m_key.set(1);
+
+        const RPI::ShaderVariantIdHash hash;
+        EXPECT_EQ(shaderVariantId, sameShaderVariantId);
+        EXPECT_EQ(hash(shaderVariantId), hash(sameShaderVariantId));
+        EXPECT_NE(shaderVariantId, otherShaderVariantId);
+        EXPECT_NE(hash(shaderVariantId), hash(otherShaderVariantId));
+    }
+
     TEST_F(ShaderTests, ShaderVariantAsset_IsFullyBaked)
     {
         using namespace AZ;
@@ -15,6 +15,8 @@ set(FILES
     Source/RPI.Builders/Material/MaterialBuilder.h
     Source/RPI.Builders/Model/MaterialAssetBuilderComponent.cpp
     Source/RPI.Builders/Model/MaterialAssetBuilderComponent.h
+    Source/RPI.Builders/Model/MeshSimplifier.cpp
+    Source/RPI.Builders/Model/MeshSimplifier.h
     Source/RPI.Builders/Model/ModelAssetBuilderComponent.cpp
     Source/RPI.Builders/Model/ModelAssetBuilderComponent.h
     Source/RPI.Builders/Model/ModelExporterComponent.cpp
@@ -41,6 +41,7 @@ namespace AZ
                 ImGui::Separator();
 
                 ImGui::Checkbox("Enable Frustum Culling", &debugCtx.m_enableFrustumCulling);
+                ImGui::Checkbox("Enable Incremental Culling", &debugCtx.m_enableIncrementalCulling);
                 ImGui::Checkbox("Enable Parallel Octree Traversal",  &debugCtx.m_parallelOctreeTraversal);
                 ImGui::Checkbox("Freeze Frustums", &debugCtx.m_freezeFrustums);
                 ImGui::Checkbox("Debug Draw", &debugCtx.m_debugDraw);
@@ -60,6 +61,8 @@ namespace AZ
                 uint32_t totalVisibleCullables = 0;
                 uint32_t totalVisibleDrawPackets = 0;
                 uint32_t totalCullJobs = 0;
+                uint32_t totalTestedCullables = 0;
+                uint32_t totalSkippedCullables = 0;
                 size_t numViews = 0;
 
                 auto& perViewCullStats = debugCtx.LockAndGetAllCullStats();
@@ -83,10 +86,12 @@ namespace AZ
                 for (CullStatsType* cullStats : cullStatsSorted)
                 {
                     // create formatted display strings
-                    itemStrings.push_back(AZStd::string::format("%s - %d/%d CullPackets visible, %d drawPackets visible, %d cull jobs",
+                    itemStrings.push_back(AZStd::string::format("%s - %d/%d CullPackets visible, %d tested, %d skipped, %d drawPackets visible, %d cull jobs",
                         cullStats->m_name.GetCStr(),
                         static_cast<uint32_t>(cullStats->m_numVisibleCullables),
                         static_cast<uint32_t>(debugCtx.m_numCullablesInScene),
+                        static_cast<uint32_t>(cullStats->m_numTestedCullables),
+                        static_cast<uint32_t>(cullStats->m_numSkippedCullables),
                         static_cast<uint32_t>(cullStats->m_numVisibleDrawPackets),
                         static_cast<uint32_t>(cullStats->m_numJobs)
                     ));
@@ -96,9 +101,11 @@ namespace AZ
                     totalVisibleCullables += cullStats->m_numVisibleCullables;
                     totalVisibleDrawPackets += cullStats->m_numVisibleDrawPackets;
                     totalCullJobs += cullStats->m_numJobs;
+                    totalTestedCullables += cullStats->m_numTestedCullables;
+                    totalSkippedCullables += cullStats->m_numSkippedCullables;
                 }
 
-                if (ImGui::BeginChild("Totals", ImVec2(0, 120.0f), true, ImGuiWindowFlags_None))
+                if (ImGui::BeginChild("Totals", ImVec2(0, 150.0f), true, ImGuiWindowFlags_None))
                 {
                     ImGui::Text("Totals:");
                     ImGui::Separator();
@@ -106,6 +113,8 @@ namespace AZ
                     ImGui::Text("   %u Cull Jobs", totalCullJobs);
                     ImGui::Text("   %d/%d Visible Cullables", totalVisibleCullables, totalCullables);
                     ImGui::Text("   %d Submitted DrawPackets", totalVisibleDrawPackets);
+                    ImGui::Text("   %u Frustum Tested Cullables", totalTestedCullables);
+                    ImGui::Text("   %u Frustum Test Skipped Cullables", totalSkippedCullables);
                 }                
                 ImGui::EndChild();
 
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Debug/Trace.h>
+#include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #define AUDIO_MEMORY_ALIGNMENT  AZCORE_GLOBAL_NEW_ALIGNMENT
 
@@ -38,6 +39,25 @@ namespace Audio
     using AudioSystemStdAllocator = AZ::AZStdAlloc<AZ::SystemAllocator>;
 
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Thread safe pool for the internal request data, a request is allocated for every request pushed to the
+    // audio system and released on whichever thread drops the last reference to it.
+    class AudioRequestDataAllocator final
+        : public AZ::ThreadPoolBase<AudioRequestDataAllocator>
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(AudioRequestDataAllocator, AZ::SystemAllocator, 0);
+        AZ_TYPE_INFO(AudioRequestDataAllocator, "{8E0F8E0B-3A6B-4A7E-9F2E-6F1C7C6B5D41}");
+
+        using Base = AZ::ThreadPoolBase<AudioRequestDataAllocator>;
+
+        AudioRequestDataAllocator()
+            : Base("AudioRequestDataAllocator", "Pool allocator for the request data of the Audio System module")
+        {
+        }
+    };
+
+
     ///////////////////////////////////////////////////////////////////////////////////////////////
     class AudioImplAllocator final
         : public AZ::SystemAllocator
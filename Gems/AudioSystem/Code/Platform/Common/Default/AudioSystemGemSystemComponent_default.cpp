@@ -35,6 +35,12 @@ namespace Audio::Platform
             AZ::AllocatorInstance<AudioSystemAllocator>::Create(allocDesc);
         }
 
+        // Create the request data pool...
+        if (!AZ::AllocatorInstance<AudioRequestDataAllocator>::IsReady())
+        {
+            AZ::AllocatorInstance<AudioRequestDataAllocator>::Create();
+        }
+
         // Create the Bank allocator...
         if (!AZ::AllocatorInstance<AudioBankAllocator>::IsReady())
         {
@@ -42,12 +48,18 @@ namespace Audio::Platform
 
             AudioBankAllocator::Descriptor allocDesc;
             allocDesc.m_allocationRecords = true;
-            allocDesc.m_heap.m_numFixedMemoryBlocks = 1;
-            allocDesc.m_heap.m_fixedMemoryBlocksByteSize[0] = heapSize;
-            allocDesc.m_heap.m_fixedMemoryBlocks[0] = AZ::AllocatorInstance<AZ::OSAllocator>::Get().Allocate(
-                allocDesc.m_heap.m_fixedMemoryBlocksByteSize[0],
-                allocDesc.m_heap.m_memoryBlockAlignment
-            );
+
+            // In streaming mode the bank memory comes from the system as banks get loaded and goes back when they're unloaded,
+            // instead of reserving the whole File Cache Manager budget up front.  The budget is enforced by the File Cache Manager.
+            if (!Audio::CVars::s_FileCacheManagerStreamingMode)
+            {
+                allocDesc.m_heap.m_numFixedMemoryBlocks = 1;
+                allocDesc.m_heap.m_fixedMemoryBlocksByteSize[0] = heapSize;
+                allocDesc.m_heap.m_fixedMemoryBlocks[0] = AZ::AllocatorInstance<AZ::OSAllocator>::Get().Allocate(
+                    allocDesc.m_heap.m_fixedMemoryBlocksByteSize[0],
+                    allocDesc.m_heap.m_memoryBlockAlignment
+                );
+            }
 
             AZ::AllocatorInstance<AudioBankAllocator>::Create(allocDesc);
         }
@@ -60,6 +72,11 @@ namespace Audio::Platform
             AZ::AllocatorInstance<Audio::AudioBankAllocator>::Destroy();
         }
 
+        if (AZ::AllocatorInstance<Audio::AudioRequestDataAllocator>::IsReady())
+        {
+            AZ::AllocatorInstance<Audio::AudioRequestDataAllocator>::Destroy();
+        }
+
         if (AZ::AllocatorInstance<Audio::AudioSystemAllocator>::IsReady())
         {
             AZ::AllocatorInstance<Audio::AudioSystemAllocator>::Destroy();
@@ -58,6 +58,11 @@ namespace Audio
 
         bool CanProcessRequests() const { return (m_nFlags & eAIS_AUDIO_MIDDLEWARE_SHUTTING_DOWN) == 0; }
 
+        size_t GetNumAudibleAudioObjects() const { return m_oAudioObjectMgr.GetNumAudibleAudioObjects(); }
+        size_t GetNumVirtualAudioObjects() const { return m_oAudioObjectMgr.GetNumVirtualAudioObjects(); }
+        size_t GetFileCacheResidentBytes() const { return m_oFileCacheMgr.GetResidentByteTotal(); }
+        size_t GetFileCachePeakBytes() const { return m_oFileCacheMgr.GetPeakByteTotal(); }
+
         EAudioRequestStatus ParseControlsData(const char* const pFolderPath, const EATLDataScope eDataScope);
         EAudioRequestStatus ClearControlsData(const EATLDataScope eDataScope);
         EAudioRequestStatus ParsePreloadsData(const char* const pFolderPath, const EATLDataScope eDataScope);
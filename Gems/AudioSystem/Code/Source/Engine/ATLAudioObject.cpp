@@ -342,6 +342,8 @@ namespace Audio
     {
         CATLAudioObjectBase::Clear();
         m_oPosition = SATLWorldPosition();
+        m_fTimeSinceLastUpdateMS = 0.0f;
+        m_eUpdateTier = eAOUT_UNASSIGNED;
         m_raycastProcessor.Reset();
     }
 
@@ -350,7 +352,8 @@ namespace Audio
     {
         CATLAudioObjectBase::Update(fUpdateIntervalMS, rListenerPosition);
 
-        if (CanRunRaycasts())
+        // Virtual objects are too far away to be heard, so their obstruction/occlusion doesn't matter.
+        if (m_eUpdateTier != eAOUT_VIRTUAL && CanRunRaycasts())
         {
             m_raycastProcessor.Update(fUpdateIntervalMS);
             m_raycastProcessor.Run(rListenerPosition);
@@ -399,6 +402,46 @@ namespace Audio
     }
 
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    bool CATLAudioObject::UpdateTier(const float fElapsedMS, const SATLWorldPosition& rListenerPosition, float& fUpdateIntervalMS)
+    {
+        m_fTimeSinceLastUpdateMS += fElapsedMS;
+
+        EATLObjectUpdateTier eNewTier = eAOUT_NEAR;
+        float fTierIntervalMS = 0.0f;
+
+        if (Audio::CVars::s_EnableObjectVirtualization)
+        {
+            const float fDistanceSq = m_oPosition.GetPositionVec().GetDistanceSq(rListenerPosition.GetPositionVec());
+            const float fVirtualDistance = Audio::CVars::s_ObjectVirtualDistance;
+            const float fFarDistance = Audio::CVars::s_ObjectFarDistance;
+
+            if (fDistanceSq >= fVirtualDistance * fVirtualDistance)
+            {
+                eNewTier = eAOUT_VIRTUAL;
+                fTierIntervalMS = Audio::CVars::s_ObjectVirtualUpdateIntervalMs;
+            }
+            else if (fDistanceSq >= fFarDistance * fFarDistance)
+            {
+                eNewTier = eAOUT_FAR;
+                fTierIntervalMS = Audio::CVars::s_ObjectFarUpdateIntervalMs;
+            }
+        }
+
+        // Moving into a closer tier updates right away, an object coming into range shouldn't wait out the longer interval.
+        const bool bPromoted = (eNewTier < m_eUpdateTier);
+        m_eUpdateTier = eNewTier;
+
+        if (!bPromoted && m_fTimeSinceLastUpdateMS < fTierIntervalMS)
+        {
+            return false;
+        }
+
+        fUpdateIntervalMS = m_fTimeSinceLastUpdateMS;
+        m_fTimeSinceLastUpdateMS = 0.0f;
+        return true;
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     void CATLAudioObject::SetRaycastCalcType(const EAudioObjectObstructionCalcType calcType)
     {
@@ -363,6 +363,8 @@ namespace Audio
             : CATLAudioObjectBase(nID, eADS_NONE, pImplData)
             , m_nFlags(eAOF_NONE)
             , m_fPreviousVelocity(0.0f)
+            , m_fTimeSinceLastUpdateMS(0.0f)
+            , m_eUpdateTier(eAOUT_UNASSIGNED)
             , m_raycastProcessor(nID, m_oPosition)
         {
         }
@@ -401,9 +403,19 @@ namespace Audio
         }
         void UpdateVelocity(const float fUpdateIntervalMS);
 
+        // Buckets the object by its distance to the listener and accumulates the elapsed time.  Returns true when the
+        // object is due for an update in its tier, in which case fUpdateIntervalMS receives the time since its last update.
+        bool UpdateTier(const float fElapsedMS, const SATLWorldPosition& rListenerPosition, float& fUpdateIntervalMS);
+        EATLObjectUpdateTier GetUpdateTier() const
+        {
+            return m_eUpdateTier;
+        }
+
     private:
         TATLEnumFlagsType m_nFlags;
         float m_fPreviousVelocity;
+        float m_fTimeSinceLastUpdateMS;
+        EATLObjectUpdateTier m_eUpdateTier;
         SATLWorldPosition m_oPosition;
         SATLWorldPosition m_oPreviousPosition;
 
@@ -287,6 +287,8 @@ namespace Audio
     CAudioObjectManager::CAudioObjectManager([[maybe_unused]] CAudioEventManager& refAudioEventManager)
         : m_cObjectPool(Audio::CVars::s_AudioObjectPoolSize, AudioObjectIDFactory::s_minValidAudioObjectID)
         , m_fTimeSinceLastVelocityUpdateMS(0.0f)
+        , m_numAudibleObjects(0)
+        , m_numVirtualObjects(0)
     #if !defined(AUDIO_RELEASE)
         , m_pDebugNameStore(nullptr)
     #endif // !AUDIO_RELEASE
@@ -311,6 +313,9 @@ namespace Audio
 
         m_raycastManager.ProcessRaycastResults(fUpdateIntervalMS);
 
+        size_t numAudibleObjects = 0;
+        size_t numVirtualObjects = 0;
+
         for (auto& audioObjectPair : m_cAudioObjects)
         {
             CATLAudioObject* const pObject = audioObjectPair.second;
@@ -319,28 +324,45 @@ namespace Audio
             {
                 AZ_PROFILE_SCOPE(Audio, "Inner Per-Object CAudioObjectManager::Update");
 
-                pObject->Update(fUpdateIntervalMS, rListenerPosition);
-
-                if (pObject->CanRunRaycasts())
+                float fObjectUpdateIntervalMS = 0.0f;
+                if (pObject->UpdateTier(fUpdateIntervalMS, rListenerPosition, fObjectUpdateIntervalMS))
                 {
-                    SATLSoundPropagationData propData;
-                    pObject->GetObstOccData(propData);
+                    pObject->Update(fObjectUpdateIntervalMS, rListenerPosition);
+
+                    if (pObject->GetUpdateTier() != eAOUT_VIRTUAL && pObject->CanRunRaycasts())
+                    {
+                        SATLSoundPropagationData propData;
+                        pObject->GetObstOccData(propData);
 
-                    AudioSystemImplementationRequestBus::Broadcast(&AudioSystemImplementationRequestBus::Events::SetObstructionOcclusion,
-                        pObject->GetImplDataPtr(),
-                        propData.fObstruction,
-                        propData.fOcclusion);
+                        AudioSystemImplementationRequestBus::Broadcast(&AudioSystemImplementationRequestBus::Events::SetObstructionOcclusion,
+                            pObject->GetImplDataPtr(),
+                            propData.fObstruction,
+                            propData.fOcclusion);
+                    }
+
+                    AudioSystemImplementationRequestBus::Broadcast(&AudioSystemImplementationRequestBus::Events::UpdateAudioObject, pObject->GetImplDataPtr());
                 }
 
+                // Velocity is tracked regardless of the update tier, the speed is measured against the position at the last velocity update.
                 if (bUpdateVelocity && pObject->GetVelocityTracking())
                 {
                     pObject->UpdateVelocity(m_fTimeSinceLastVelocityUpdateMS);
                 }
 
-                AudioSystemImplementationRequestBus::Broadcast(&AudioSystemImplementationRequestBus::Events::UpdateAudioObject, pObject->GetImplDataPtr());
+                if (pObject->GetUpdateTier() == eAOUT_VIRTUAL)
+                {
+                    ++numVirtualObjects;
+                }
+                else
+                {
+                    ++numAudibleObjects;
+                }
             }
         }
 
+        m_numAudibleObjects = numAudibleObjects;
+        m_numVirtualObjects = numVirtualObjects;
+
         if (bUpdateVelocity)
         {
             m_fTimeSinceLastVelocityUpdateMS = 0.0f;
@@ -1911,6 +1933,7 @@ namespace Audio
         static const float fOverloadColor[4] = { 1.0f, 0.3f, 0.3f, 0.9f };
 
         size_t activeObjects = 0;
+        size_t virtualObjects = 0;
         size_t aliveObjects = m_cAudioObjects.size();
         size_t remainingObjects = (m_cObjectPool.m_nReserveSize > aliveObjects ? m_cObjectPool.m_nReserveSize - aliveObjects : 0);
         const float fHeaderPosY = fPosY;
@@ -1956,10 +1979,15 @@ namespace Audio
             if (hasActiveEvents)
             {
                 ++activeObjects;
+
+                if (audioObject->GetUpdateTier() == eAOUT_VIRTUAL)
+                {
+                    ++virtualObjects;
+                }
             }
         }
 
-        static const char* headerFormat = "Audio Objects [Active : %3zu | Alive: %3zu | Pool: %3zu | Remaining: %3zu]";
+        static const char* headerFormat = "Audio Objects [Active : %3zu | Virtual: %3zu | Alive: %3zu | Pool: %3zu | Remaining: %3zu]";
         const bool overloaded = (m_cAudioObjects.size() > m_cObjectPool.m_nReserveSize);
 
         rAuxGeom.Draw2dLabel(
@@ -1970,6 +1998,7 @@ namespace Audio
             false,
             headerFormat,
             activeObjects,
+            virtualObjects,
             aliveObjects,
             m_cObjectPool.m_nReserveSize,
             remainingObjects);
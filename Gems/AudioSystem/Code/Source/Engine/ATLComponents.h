@@ -130,6 +130,16 @@ namespace Audio
         void ReportStartedEvent(const CATLEvent* const pEvent);
         void ReportFinishedEvent(const CATLEvent* const pEvent, const bool bSuccess);
 
+        // Audio objects with active events during the last update, split by whether they were audible or virtual.
+        size_t GetNumAudibleAudioObjects() const
+        {
+            return m_numAudibleObjects;
+        }
+        size_t GetNumVirtualAudioObjects() const
+        {
+            return m_numVirtualObjects;
+        }
+
 
         using TActiveObjectMap = ATLMapLookupType<TAudioObjectID, CATLAudioObject*>;
 
@@ -159,6 +169,8 @@ namespace Audio
         TActiveObjectMap m_cAudioObjects;
         CInstanceManager<CATLAudioObject, TAudioObjectID> m_cObjectPool;
         float m_fTimeSinceLastVelocityUpdateMS;
+        size_t m_numAudibleObjects;
+        size_t m_numVirtualObjects;
 
         AudioRaycastManager m_raycastManager;
     };
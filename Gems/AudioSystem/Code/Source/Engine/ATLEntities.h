@@ -53,6 +53,16 @@ namespace Audio
         eAOF_TRACK_VELOCITY = AUDIO_BIT(0),
     };
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    // How often an audio object with active events is updated, based on its distance to the listener.
+    enum EATLObjectUpdateTier : TATLEnumFlagsType
+    {
+        eAOUT_NEAR = 0,         // Updated every tick.
+        eAOUT_FAR,              // Updated at a reduced rate.
+        eAOUT_VIRTUAL,          // Too far away to be heard, no raycasts and only rare implementation updates.
+        eAOUT_UNASSIGNED,       // Not bucketed yet, the first update always goes through.
+    };
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     enum EATLSubsystem : TATLEnumFlagsType
     {
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+
+#include <AudioRequestQueue.h>
+
+#include <AzCore/std/parallel/lock.h>
+
+namespace Audio
+{
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    // CAudioRequestQueue
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    CAudioRequestQueue::CAudioRequestQueue()
+    {
+        for (size_t i = 0; i < Capacity; ++i)
+        {
+            m_slots[i].m_sequence.store(i, AZStd::memory_order_relaxed);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void CAudioRequestQueue::Push(const CAudioRequestInternal& request)
+    {
+        // Once a request has spilled into the overflow queue, everything after it has to follow it there until the
+        // consumer catches up, otherwise newer requests could be processed ahead of older ones.
+        if (!m_overflowActive.load(AZStd::memory_order_acquire) && TryPushRing(request))
+        {
+            return;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_overflowMutex);
+        m_overflowRequests.push_back(request);
+        m_overflowActive.store(true, AZStd::memory_order_release);
+        m_overflowCount.fetch_add(1, AZStd::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    bool CAudioRequestQueue::TryPushRing(const CAudioRequestInternal& request)
+    {
+        size_t position = m_enqueuePosition.load(AZStd::memory_order_relaxed);
+        SSlot* slot = nullptr;
+
+        for (;;)
+        {
+            slot = &m_slots[position & IndexMask];
+            const size_t sequence = slot->m_sequence.load(AZStd::memory_order_acquire);
+            const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+            if (difference == 0)
+            {
+                // The slot is free, try to claim it.
+                if (m_enqueuePosition.compare_exchange_weak(position, position + 1, AZStd::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                // The consumer hasn't released this slot yet, the ring is full.
+                return false;
+            }
+            else
+            {
+                // Another producer claimed the slot first.
+                position = m_enqueuePosition.load(AZStd::memory_order_relaxed);
+            }
+        }
+
+        slot->m_request = request;
+        slot->m_sequence.store(position + 1, AZStd::memory_order_release);
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void CAudioRequestQueue::Drain(TAudioRequestBatch& batch)
+    {
+        for (;;)
+        {
+            SSlot& slot = m_slots[m_dequeuePosition & IndexMask];
+            const size_t sequence = slot.m_sequence.load(AZStd::memory_order_acquire);
+
+            if (sequence != m_dequeuePosition + 1)
+            {
+                // Either empty, or the producer that claimed this slot hasn't finished writing it yet.
+                break;
+            }
+
+            batch.push_back(slot.m_request);
+            slot.m_request.pData.reset();
+
+            slot.m_sequence.store(m_dequeuePosition + Capacity, AZStd::memory_order_release);
+            ++m_dequeuePosition;
+        }
+
+        if (m_overflowActive.load(AZStd::memory_order_acquire))
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_overflowMutex);
+
+            // Only hand out the overflow once the ring is fully drained, requests in the ring are older.
+            const size_t sequence = m_slots[m_dequeuePosition & IndexMask].m_sequence.load(AZStd::memory_order_acquire);
+            const bool ringEmpty = (sequence == m_dequeuePosition) && (m_enqueuePosition.load(AZStd::memory_order_acquire) == m_dequeuePosition);
+
+            if (ringEmpty)
+            {
+                batch.insert(batch.end(), m_overflowRequests.begin(), m_overflowRequests.end());
+                m_overflowRequests.clear();
+                m_overflowActive.store(false, AZStd::memory_order_release);
+            }
+        }
+    }
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    // CAudioRequestCoalescer
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t CAudioRequestCoalescer::Coalesce(TAudioRequestBatch& batch)
+    {
+        m_objectEpochs.clear();
+        m_pendingObjectPositions.clear();
+        m_pendingListenerPositions.clear();
+        m_pendingRtpcs.clear();
+
+        size_t coalescedCount = 0;
+
+        // Walk backwards so the newest update for each object is seen first, every older one is redundant until
+        // some other request for the same object is found in between.
+        for (auto iter = batch.rbegin(); iter != batch.rend(); ++iter)
+        {
+            CAudioRequestInternal& request = *iter;
+
+            if (request.eStatus != eARS_NONE || !request.pData)
+            {
+                continue;
+            }
+
+            bool superseded = false;
+
+            switch (request.pData->eRequestType)
+            {
+                case eART_AUDIO_OBJECT_REQUEST:
+                {
+                    auto const requestDataBase = static_cast<const SAudioObjectRequestDataInternalBase*>(request.pData.get());
+
+                    switch (requestDataBase->eType)
+                    {
+                        case eAORT_SET_POSITION:
+                        {
+                            superseded = IsSuperseded(request.nAudioObjectID, m_pendingObjectPositions);
+                            break;
+                        }
+                        case eAORT_SET_RTPC_VALUE:
+                        {
+                            auto const requestData = static_cast<const SAudioObjectRequestDataInternal<eAORT_SET_RTPC_VALUE>*>(requestDataBase);
+                            superseded = IsSuperseded(SRtpcKey{ request.nAudioObjectID, requestData->nControlID });
+                            break;
+                        }
+                        default:
+                        {
+                            ++m_objectEpochs[request.nAudioObjectID];
+                            break;
+                        }
+                    }
+                    break;
+                }
+                case eART_AUDIO_LISTENER_REQUEST:
+                {
+                    auto const requestDataBase = static_cast<const SAudioListenerRequestDataInternalBase*>(request.pData.get());
+
+                    if (requestDataBase->eType == eALRT_SET_POSITION)
+                    {
+                        superseded = IsSuperseded(request.nAudioObjectID, m_pendingListenerPositions);
+                    }
+                    break;
+                }
+                default:
+                {
+                    // Manager requests can affect any object, nothing older may be folded into anything newer.
+                    m_objectEpochs.clear();
+                    m_pendingObjectPositions.clear();
+                    m_pendingListenerPositions.clear();
+                    m_pendingRtpcs.clear();
+                    break;
+                }
+            }
+
+            if (superseded)
+            {
+                request.eStatus = eARS_SUCCESS;
+                ++coalescedCount;
+            }
+        }
+
+        return coalescedCount;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    bool CAudioRequestCoalescer::IsSuperseded(TAudioObjectID objectId, TEpochMap<TAudioObjectID>& pendingUpdates)
+    {
+        const AZ::u32 epoch = GetObjectEpoch(objectId);
+        auto insertResult = pendingUpdates.insert(AZStd::make_pair(objectId, epoch));
+
+        if (!insertResult.second && insertResult.first->second != epoch)
+        {
+            // The newer update was separated from this one by another request, this one becomes the newest in this epoch.
+            insertResult.first->second = epoch;
+            return false;
+        }
+
+        return !insertResult.second;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    bool CAudioRequestCoalescer::IsSuperseded(const SRtpcKey& key)
+    {
+        const AZ::u32 epoch = GetObjectEpoch(key.m_objectId);
+        auto insertResult = m_pendingRtpcs.insert(AZStd::make_pair(key, epoch));
+
+        if (!insertResult.second && insertResult.first->second != epoch)
+        {
+            insertResult.first->second = epoch;
+            return false;
+        }
+
+        return !insertResult.second;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    AZ::u32 CAudioRequestCoalescer::GetObjectEpoch(TAudioObjectID objectId) const
+    {
+        auto iter = m_objectEpochs.find(objectId);
+        return (iter != m_objectEpochs.end()) ? iter->second : 0;
+    }
+
+} // namespace Audio
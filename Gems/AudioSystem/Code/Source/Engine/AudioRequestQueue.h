@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+
+#pragma once
+
+#include <AudioAllocators.h>
+#include <AudioInternalInterfaces.h>
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace Audio
+{
+    using TAudioRequestBatch = AZStd::vector<CAudioRequestInternal, Audio::AudioSystemStdAllocator>;
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    // Multiple producer, single consumer queue of audio requests.
+    // Requests are copied into a fixed ring of preallocated slots, so pushing a request takes no locks and
+    // allocates nothing.  If the ring fills up, requests spill into a mutex protected overflow queue instead
+    // of being dropped, and keep going there until the consumer has drained it so that the requests pushed
+    // from any one thread are always consumed in the order they were pushed.
+    class CAudioRequestQueue
+    {
+    public:
+        AUDIO_SYSTEM_CLASS_ALLOCATOR(Audio::CAudioRequestQueue)
+
+        static constexpr size_t Capacity = 4096;
+
+        CAudioRequestQueue();
+        ~CAudioRequestQueue() = default;
+
+        CAudioRequestQueue(const CAudioRequestQueue&) = delete;
+        CAudioRequestQueue& operator=(const CAudioRequestQueue&) = delete;
+
+        // Can be called from any thread.
+        void Push(const CAudioRequestInternal& request);
+
+        // Moves every queued request onto the end of the batch, oldest first.  Must only be called from the consumer thread.
+        void Drain(TAudioRequestBatch& batch);
+
+        // Number of requests that had to go through the overflow queue since the queue was created.
+        size_t GetOverflowCount() const
+        {
+            return m_overflowCount.load(AZStd::memory_order_relaxed);
+        }
+
+    private:
+        bool TryPushRing(const CAudioRequestInternal& request);
+
+        static constexpr size_t IndexMask = Capacity - 1;
+        static_assert((Capacity & IndexMask) == 0, "CAudioRequestQueue capacity must be a power of two!");
+
+        struct SSlot
+        {
+            // Equals the ring position when the slot is free to be written, and position + 1 once it holds a request.
+            AZStd::atomic<size_t> m_sequence;
+            CAudioRequestInternal m_request;
+        };
+
+        SSlot m_slots[Capacity];
+
+        // Producers and the consumer live on separate cache lines.
+        alignas(64) AZStd::atomic<size_t> m_enqueuePosition{ 0 };
+        alignas(64) size_t m_dequeuePosition = 0;
+
+        AZStd::mutex m_overflowMutex;
+        AZStd::atomic_bool m_overflowActive{ false };
+        AZStd::atomic<size_t> m_overflowCount{ 0 };
+        TAudioRequestBatch m_overflowRequests;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    // Finds position and RTPC updates in a batch of requests that are overwritten by a later update to the same
+    // audio object (or listener) before anything else touches that object, and completes them without sending them to the ATL.
+    // Coalesced requests are marked as successful, so listeners are still notified about them as usual.
+    class CAudioRequestCoalescer
+    {
+    public:
+        AUDIO_SYSTEM_CLASS_ALLOCATOR(Audio::CAudioRequestCoalescer)
+
+        // Returns the number of requests that were coalesced.
+        size_t Coalesce(TAudioRequestBatch& batch);
+
+    private:
+        struct SRtpcKey
+        {
+            TAudioObjectID m_objectId;
+            TAudioControlID m_rtpcId;
+
+            bool operator==(const SRtpcKey& other) const
+            {
+                return m_objectId == other.m_objectId && m_rtpcId == other.m_rtpcId;
+            }
+        };
+
+        struct SRtpcKeyHash
+        {
+            size_t operator()(const SRtpcKey& key) const
+            {
+                return static_cast<size_t>(key.m_objectId * 31 + key.m_rtpcId);
+            }
+        };
+
+        template<typename TKey, typename THash = AZStd::hash<TKey>>
+        using TEpochMap = AZStd::unordered_map<TKey, AZ::u32, THash, AZStd::equal_to<TKey>, Audio::AudioSystemStdAllocator>;
+
+        bool IsSuperseded(TAudioObjectID objectId, TEpochMap<TAudioObjectID>& pendingUpdates);
+        bool IsSuperseded(const SRtpcKey& key);
+        AZ::u32 GetObjectEpoch(TAudioObjectID objectId) const;
+
+        // Any request for an object, other than the ones being coalesced, bumps the object's epoch.  An update is only
+        // superseded by a later one that was recorded in the same epoch.
+        TEpochMap<TAudioObjectID> m_objectEpochs;
+        TEpochMap<TAudioObjectID> m_pendingObjectPositions;
+        TEpochMap<TAudioObjectID> m_pendingListenerPositions;
+        TEpochMap<SRtpcKey, SRtpcKeyHash> m_pendingRtpcs;
+    };
+
+} // namespace Audio
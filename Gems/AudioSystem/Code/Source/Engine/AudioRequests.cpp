@@ -14,7 +14,8 @@
 #define REQUEST_CASE_BLOCK(CLASS, ENUM, P_SOURCE, P_RESULT)                                        \
 case ENUM:                                                                                         \
 {                                                                                                  \
-    (P_RESULT) = azcreate(CLASS##Internal<ENUM>, (static_cast<const CLASS<ENUM>* const>(P_SOURCE)), Audio::AudioSystemAllocator);   \
+    static_assert(sizeof(CLASS##Internal<ENUM>) <= MaxPooledRequestDataSize, "Request data is too large for the request data pool!");   \
+    (P_RESULT) = azcreate(CLASS##Internal<ENUM>, (static_cast<const CLASS<ENUM>* const>(P_SOURCE)), Audio::AudioRequestDataAllocator);   \
     break;                                                                                         \
 }
 
@@ -28,6 +29,9 @@ namespace Audio
 {
     extern CAudioLogger g_audioLogger;
 
+    // Largest allocation served by the request data pool with the default pool descriptor
+    static constexpr size_t MaxPooledRequestDataSize = 512;
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     SAudioRequestDataInternal* ConvertToInternal(const SAudioRequestDataBase* const pExternalData)
     {
@@ -158,7 +162,7 @@ namespace Audio
 
         if (nCount == 0)
         {
-            azdestroy(this, Audio::AudioSystemAllocator);
+            azdestroy(this, Audio::AudioRequestDataAllocator);
         }
         else if (nCount < 0)
         {
@@ -14,6 +14,7 @@
 
 #include <AzCore/PlatformDef.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/bind/bind.h>
 #include <AzCore/StringFunc/StringFunc.h>
 
@@ -87,7 +88,6 @@ namespace Audio
 
         AudioSystemRequestBus::Handler::BusConnect();
         AudioSystemThreadSafeRequestBus::Handler::BusConnect();
-        AudioSystemInternalRequestBus::Handler::BusConnect();
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -95,7 +95,6 @@ namespace Audio
     {
         AudioSystemRequestBus::Handler::BusDisconnect();
         AudioSystemThreadSafeRequestBus::Handler::BusDisconnect();
-        AudioSystemInternalRequestBus::Handler::BusDisconnect();
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -107,7 +106,7 @@ namespace Audio
         AZ_Assert(0 == (request.nFlags & eARF_THREAD_SAFE_PUSH), "AudioSystem::PushRequest - called with flag THREAD_SAFE_PUSH!");
         AZ_Assert(0 == (request.nFlags & eARF_EXECUTE_BLOCKING), "AudioSystem::PushRequest - called with flag EXECUTE_BLOCKING!");
 
-        AudioSystemInternalRequestBus::QueueBroadcast(&AudioSystemInternalRequestBus::Events::ProcessRequestByPriority, request);
+        m_requestQueue.Push(request);
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -133,7 +132,7 @@ namespace Audio
         AZ_Assert(0 != (request.nFlags & eARF_THREAD_SAFE_PUSH), "AudioSystem::PushRequestThreadSafe - called without THREAD_SAFE_PUSH flag!");
         AZ_Assert(0 == (request.nFlags & eARF_EXECUTE_BLOCKING), "AudioSystem::PushRequestThreadSafe - called with flag EXECUTE_BLOCKING!");
 
-        AudioSystemThreadSafeRequestBus::QueueFunction(AZStd::bind(&CAudioSystem::ProcessRequestThreadSafe, this, request));
+        m_threadSafeRequestQueue.Push(request);
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -210,17 +209,28 @@ namespace Audio
             handledBlockingRequests = ProcessRequests(m_blockingRequestsQueue);
         }
 
+        m_requestsThisUpdate = 0;
+        m_coalescedRequestsThisUpdate = 0;
+
         if (!handledBlockingRequests)
         {
-            // Call the ProcessRequestByPriority events queued up...
-            AudioSystemInternalRequestBus::ExecuteQueuedEvents();
+            // Process the requests pushed from the main thread...
+            ProcessQueuedRequests(m_requestQueue, m_pendingCallbacksQueue, m_pendingCallbacksMutex);
         }
 
-        // Call the ProcessRequestThreadSafe events queued up...
-        AudioSystemThreadSafeRequestBus::ExecuteQueuedEvents();
+        // Process the requests pushed from any thread...
+        ProcessQueuedRequests(m_threadSafeRequestQueue, m_threadSafeCallbacksQueue, m_threadSafeCallbacksMutex);
+
+        m_requestsLastUpdate.store(m_requestsThisUpdate, AZStd::memory_order_relaxed);
+        m_coalescedRequestsLastUpdate.store(m_coalescedRequestsThisUpdate, AZStd::memory_order_relaxed);
 
         m_oATL.Update();
 
+        m_audibleObjectsLastUpdate.store(static_cast<AZ::u32>(m_oATL.GetNumAudibleAudioObjects()), AZStd::memory_order_relaxed);
+        m_virtualObjectsLastUpdate.store(static_cast<AZ::u32>(m_oATL.GetNumVirtualAudioObjects()), AZStd::memory_order_relaxed);
+        m_fileCacheResidentBytes.store(static_cast<AZ::u64>(m_oATL.GetFileCacheResidentBytes()), AZStd::memory_order_relaxed);
+        m_fileCachePeakBytes.store(static_cast<AZ::u64>(m_oATL.GetFileCachePeakBytes()), AZStd::memory_order_relaxed);
+
     #if !defined(AUDIO_RELEASE)
         #if defined(PROVIDE_GETNAME_SUPPORT)
         {
@@ -353,9 +363,14 @@ namespace Audio
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
-    void CAudioSystem::GetInfo([[maybe_unused]] SAudioSystemInfo& rAudioSystemInfo)
+    void CAudioSystem::GetInfo(SAudioSystemInfo& rAudioSystemInfo)
     {
-        //TODO: 
+        rAudioSystemInfo.nCountRequestsLastUpdate = m_requestsLastUpdate.load(AZStd::memory_order_relaxed);
+        rAudioSystemInfo.nCountCoalescedRequestsLastUpdate = m_coalescedRequestsLastUpdate.load(AZStd::memory_order_relaxed);
+        rAudioSystemInfo.nCountAudibleAudioObjects = m_audibleObjectsLastUpdate.load(AZStd::memory_order_relaxed);
+        rAudioSystemInfo.nCountVirtualAudioObjects = m_virtualObjectsLastUpdate.load(AZStd::memory_order_relaxed);
+        rAudioSystemInfo.nFileCacheResidentBytes = static_cast<AZStd::size_t>(m_fileCacheResidentBytes.load(AZStd::memory_order_relaxed));
+        rAudioSystemInfo.nFileCachePeakBytes = static_cast<AZStd::size_t>(m_fileCachePeakBytes.load(AZStd::memory_order_relaxed));
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -544,6 +559,19 @@ namespace Audio
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     void CAudioSystem::ExtractCompletedRequests(TAudioRequests& requestQueue, TAudioRequests& extractedCallbacks)
     {
+        // The callbacks queues only ever receive processed requests, take them all at once without erasing one by one.
+        const bool allComplete = AZStd::all_of(requestQueue.begin(), requestQueue.end(),
+            [](const CAudioRequestInternal& request)
+            {
+                return request.IsComplete();
+            });
+
+        if (allComplete)
+        {
+            extractedCallbacks.swap(requestQueue);
+            return;
+        }
+
         auto iter(requestQueue.begin());
         auto iterEnd(requestQueue.end());
 
@@ -593,72 +621,69 @@ namespace Audio
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
-    void CAudioSystem::ProcessRequestBlocking(CAudioRequestInternal& request)
+    void CAudioSystem::ProcessQueuedRequests(CAudioRequestQueue& requestQueue, TAudioRequests& callbacksQueue, AZStd::mutex& callbacksQueueMutex)
     {
+        // Audio Thread!
         AZ_PROFILE_FUNCTION(Audio);
 
-        if (m_oATL.CanProcessRequests())
-        {
-            {
-                AZStd::lock_guard<AZStd::mutex> lock(m_blockingRequestsMutex);
-                m_blockingRequestsQueue.push_back(request);
-            }
-
-            m_processingEvent.release();
-            m_mainEvent.acquire();
+        m_requestBatch.clear();
+        requestQueue.Drain(m_requestBatch);
 
-            ExecuteRequestCompletionCallbacks(m_blockingRequestsQueue, m_blockingRequestsMutex);
+        if (m_requestBatch.empty())
+        {
+            return;
         }
-    }
 
-    ///////////////////////////////////////////////////////////////////////////////////////////////////
-    void CAudioSystem::ProcessRequestThreadSafe(CAudioRequestInternal request)
-    {
-        // Audio Thread!
-        AZ_PROFILE_SCOPE(Audio, "Process Thread-Safe Request");
+        m_requestsThisUpdate += static_cast<AZ::u32>(m_requestBatch.size());
 
         if (m_oATL.CanProcessRequests())
         {
-            if (request.eStatus == eARS_NONE)
+            // Position and RTPC updates that are overwritten later in the batch are completed here without reaching the ATL.
+            m_coalescedRequestsThisUpdate += static_cast<AZ::u32>(m_requestCoalescer.Coalesce(m_requestBatch));
+
+            for (auto& request : m_requestBatch)
             {
-                request.eStatus = eARS_PENDING;
-                m_oATL.ProcessRequest(request);
+                if (request.eStatus == eARS_NONE)
+                {
+                    request.eStatus = eARS_PENDING;
+                    m_oATL.ProcessRequest(request);
+                }
+
+                AZ_Assert(request.eStatus != eARS_PENDING, "AudioSystem::ProcessQueuedRequests - ATL finished processing request, but request is still in pending state!");
+                if (request.eStatus != eARS_PENDING)
+                {
+                    m_completedRequests.push_back(request);
+                }
             }
 
-            AZ_Assert(request.eStatus != eARS_PENDING, "AudioSystem::ProcessRequestThreadSafe - ATL finished processing request, but request is still in pending state!");
-            if (request.eStatus != eARS_PENDING)
+            // Hand the whole batch to the main thread for callback processing with a single lock...
             {
-                // push the request onto a callbacks queue for main thread to process later...
-                AZStd::lock_guard<AZStd::mutex> lock(m_threadSafeCallbacksMutex);
-                m_threadSafeCallbacksQueue.push_back(request);
+                AZStd::lock_guard<AZStd::mutex> lock(callbacksQueueMutex);
+                callbacksQueue.insert(callbacksQueue.end(), m_completedRequests.begin(), m_completedRequests.end());
             }
+
+            m_completedRequests.clear();
         }
+
+        m_requestBatch.clear();
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
-    void CAudioSystem::ProcessRequestByPriority(CAudioRequestInternal request)
+    void CAudioSystem::ProcessRequestBlocking(CAudioRequestInternal& request)
     {
-        // Todo: This should handle request priority, use request priority as bus Address and process in priority order.
-
-        AZ_PROFILE_SCOPE(Audio, "Process Normal Request");
-
-        AZ_Assert(g_mainThreadId != AZStd::this_thread::get_id(), "AudioSystem::ProcessRequestByPriority - called from Main thread!");
+        AZ_PROFILE_FUNCTION(Audio);
 
         if (m_oATL.CanProcessRequests())
         {
-            if (request.eStatus == eARS_NONE)
             {
-                request.eStatus = eARS_PENDING;
-                m_oATL.ProcessRequest(request);
+                AZStd::lock_guard<AZStd::mutex> lock(m_blockingRequestsMutex);
+                m_blockingRequestsQueue.push_back(request);
             }
 
-            AZ_Assert(request.eStatus != eARS_PENDING, "AudioSystem::ProcessRequestByPriority - ATL finished processing request, but request is still in pending state!");
-            if (request.eStatus != eARS_PENDING)
-            {
-                // push the request onto a callbacks queue for main thread to process later...
-                AZStd::lock_guard<AZStd::mutex> lock(m_pendingCallbacksMutex);
-                m_pendingCallbacksQueue.push_back(request);
-            }
+            m_processingEvent.release();
+            m_mainEvent.acquire();
+
+            ExecuteRequestCompletionCallbacks(m_blockingRequestsQueue, m_blockingRequestsMutex);
         }
     }
 
@@ -12,6 +12,7 @@
 #include <ATL.h>
 #include <AudioAllocators.h>
 #include <AudioInternalInterfaces.h>
+#include <AudioRequestQueue.h>
 
 #include <AzCore/Debug/Budget.h>
 #include <AzCore/std/containers/deque.h>
@@ -51,30 +52,9 @@ namespace Audio
     };
 
 
-    ///////////////////////////////////////////////////////////////////////////////////////////////////
-    class AudioSystemInternalRequests
-        : public AZ::EBusTraits
-    {
-    public:
-        virtual ~AudioSystemInternalRequests() = default;
-
-        ///////////////////////////////////////////////////////////////////////////////////////////////
-        // EBusTraits - Single Bus Address, Single Handler, Mutex, Queued
-        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
-        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
-        static const bool EnableEventQueue = true;
-        using MutexType = AZStd::recursive_mutex;
-        ///////////////////////////////////////////////////////////////////////////////////////////////
-
-        virtual void ProcessRequestByPriority(CAudioRequestInternal audioRequestData) = 0;
-    };
-
-    using AudioSystemInternalRequestBus = AZ::EBus<AudioSystemInternalRequests>;
-
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     class CAudioSystem
         : public IAudioSystem
-        , public AudioSystemInternalRequestBus::Handler
     {
         friend class CAudioThread;
 
@@ -93,7 +73,6 @@ namespace Audio
         void PushRequest(const SAudioRequest& audioRequestData) override;
         void PushRequestBlocking(const SAudioRequest& audioRequestData) override;
         void PushRequestThreadSafe(const SAudioRequest& audioRequestData) override;
-        void ProcessRequestByPriority(CAudioRequestInternal audioRequestInternalData) override;
 
         void ExternalUpdate() override;
 
@@ -126,9 +105,6 @@ namespace Audio
         const char* GetAudioControlName(const EAudioControlType controlType, const TATLIDType atlID) const override;
         const char* GetAudioSwitchStateName(const TAudioControlID switchID, const TAudioSwitchStateID stateID) const override;
 
-    protected:
-        void ProcessRequestThreadSafe(CAudioRequestInternal audioRequestInternalData);
-
     private:
         using TAudioRequests = AZStd::deque<CAudioRequestInternal, Audio::AudioSystemStdAllocator>;
         using TAudioProxies = AZStd::vector<CAudioProxy*, Audio::AudioSystemStdAllocator>;
@@ -137,6 +113,8 @@ namespace Audio
         bool ProcessRequests(TAudioRequests& rRequestQueue);
         void ProcessRequestBlocking(CAudioRequestInternal& audioRequestInternalData);
 
+        void ProcessQueuedRequests(CAudioRequestQueue& requestQueue, TAudioRequests& callbacksQueue, AZStd::mutex& callbacksQueueMutex);
+
         void ExecuteRequestCompletionCallbacks(TAudioRequests& requestQueue, AZStd::mutex& requestQueueMutex, bool bTryLock = false);
         void ExtractCompletedRequests(TAudioRequests& rRequestQueue, TAudioRequests& rSyncCallbacksQueue);
 
@@ -149,6 +127,24 @@ namespace Audio
         CAudioThread m_audioSystemThread;
 
 
+        CAudioRequestQueue m_requestQueue;              // requests from the main thread go here, lock-free
+        CAudioRequestQueue m_threadSafeRequestQueue;    // requests from any thread go here, lock-free
+
+        TAudioRequestBatch m_requestBatch;              // audio thread, requests drained from one of the request queues
+        TAudioRequestBatch m_completedRequests;         // audio thread, processed requests waiting to be handed to a callbacks queue
+        CAudioRequestCoalescer m_requestCoalescer;
+
+        AZStd::atomic<AZ::u32> m_requestsLastUpdate{ 0 };
+        AZStd::atomic<AZ::u32> m_coalescedRequestsLastUpdate{ 0 };
+        AZ::u32 m_requestsThisUpdate = 0;
+        AZ::u32 m_coalescedRequestsThisUpdate = 0;
+
+        AZStd::atomic<AZ::u32> m_audibleObjectsLastUpdate{ 0 };
+        AZStd::atomic<AZ::u32> m_virtualObjectsLastUpdate{ 0 };
+
+        AZStd::atomic<AZ::u64> m_fileCacheResidentBytes{ 0 };
+        AZStd::atomic<AZ::u64> m_fileCachePeakBytes{ 0 };
+
         TAudioRequests m_blockingRequestsQueue;     // blocking requests go here, main thread will wait for audio thread to process
         TAudioRequests m_threadSafeCallbacksQueue;  // requests coming from any thread go here.
         TAudioRequests m_pendingCallbacksQueue;     // this queue holds pending callbacks, agreggated from processed requests
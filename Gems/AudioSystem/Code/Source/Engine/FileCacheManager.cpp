@@ -34,6 +34,7 @@ namespace Audio
         : m_preloadRequests(preloadRequests)
         , m_currentByteTotal(0)
         , m_maxByteTotal(0)
+        , m_peakByteTotal(0)
     {
     }
 
@@ -377,7 +378,9 @@ namespace Audio
             float darkish[4] = { 0.3f, 0.3f, 0.3f, originalAlpha };
 
             auxGeom.Draw2dLabel(posX, positionY, 1.6f, orange, false,
-                "FileCacheManager (%zu of %zu KiB) [Entries: %zu]", m_currentByteTotal >> 10, m_maxByteTotal >> 10, m_audioFileEntries.size());
+                "FileCacheManager%s (%zu of %zu KiB, Peak: %zu KiB) [Entries: %zu]",
+                CVars::s_FileCacheManagerStreamingMode ? " [Streaming]" : "",
+                m_currentByteTotal >> 10, m_maxByteTotal >> 10, m_peakByteTotal >> 10, m_audioFileEntries.size());
             positionY += 15.0f;
 
             const bool displayAll = CVars::s_fcmDrawOptions.GetRawFlags() == 0;
@@ -505,6 +508,28 @@ namespace Audio
         return success;
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    void CFileCacheManager::AddToByteTotal(const size_t size)
+    {
+        m_currentByteTotal += size;
+        m_peakByteTotal = AZStd::max(m_peakByteTotal, m_currentByteTotal);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    AZ::IO::IStreamerTypes::Priority CFileCacheManager::GetStreamPriority(const CATLAudioFileEntry& audioFileEntry)
+    {
+        if (!CVars::s_FileCacheManagerStreamingMode || audioFileEntry.m_dataScope == eADS_GLOBAL)
+        {
+            return AZ::IO::IStreamerTypes::s_priorityHigh;
+        }
+
+        // Level banks are loaded along with the level.  Manually preloaded banks get requested during gameplay,
+        // ahead of being used, and shouldn't hold up the reads that are needed right away.
+        return audioFileEntry.m_flags.AreAnyFlagsActive(eAFF_USE_COUNTED)
+            ? AZ::IO::IStreamerTypes::s_priorityLow
+            : AZ::IO::IStreamerTypes::s_priorityMedium;
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////
     void CFileCacheManager::FinishAsyncStreamRequest(AZ::IO::FileRequestHandle request)
     {
@@ -720,6 +745,7 @@ namespace Audio
             audioFileEntry->m_fileSize,
             audioFileEntry->m_memoryBlockAlignment
         );
+        audioFileEntry->m_memoryBlock = nullptr;
         audioFileEntry->m_flags.ClearFlags(eAFF_CACHED | eAFF_REMOVABLE);
         m_currentByteTotal -= audioFileEntry->m_fileSize;
         AZ_Warning("FileCacheManager", audioFileEntry->m_useCount == 0, "Use-count of file '%s' is non-zero while uncaching it! Use Count: %d", audioFileEntry->m_filePath.c_str(), audioFileEntry->m_useCount);
@@ -824,7 +850,7 @@ namespace Audio
                     AZ::IO::IStreamerTypes::RequestStatus status = streamer->GetRequestStatus(request);
                     if (FinishCachingFileInternal(audioFileEntry, audioFileEntry->m_fileSize, status))
                     {
-                        m_currentByteTotal += audioFileEntry->m_fileSize;
+                        AddToByteTotal(audioFileEntry->m_fileSize);
                         success = true;
                     }
                 }
@@ -837,7 +863,7 @@ namespace Audio
                         audioFileEntry->m_fileSize,
                         audioFileEntry->m_fileSize,
                         AZ::IO::IStreamerTypes::s_noDeadline,
-                        AZ::IO::IStreamerTypes::s_priorityHigh);
+                        GetStreamPriority(*audioFileEntry));
 
                     streamer->SetRequestCompleteCallback(
                         audioFileEntry->m_asyncStreamRequest,
@@ -852,7 +878,7 @@ namespace Audio
                     streamer->QueueRequest(audioFileEntry->m_asyncStreamRequest);
 
                     // Increase total size even though async request is processing...
-                    m_currentByteTotal += audioFileEntry->m_fileSize;
+                    AddToByteTotal(audioFileEntry->m_fileSize);
                     success = true;
                 }
             }
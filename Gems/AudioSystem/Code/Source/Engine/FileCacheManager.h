@@ -67,6 +67,20 @@ namespace Audio
         EAudioRequestStatus TryUnloadRequest(const TAudioPreloadRequestID preloadRequestID);
         EAudioRequestStatus UnloadDataByScope(const EATLDataScope dataScope);
 
+        // Bytes of bank memory held by cached and loading files, and the most that was held at once.
+        size_t GetResidentByteTotal() const
+        {
+            return m_currentByteTotal;
+        }
+
+        size_t GetPeakByteTotal() const
+        {
+            return m_peakByteTotal;
+        }
+
+        // Priority the file is read through AZ::IO::Streamer with when it's loaded asynchronously.
+        static AZ::IO::IStreamerTypes::Priority GetStreamPriority(const CATLAudioFileEntry& audioFileEntry);
+
     #if !defined(AUDIO_RELEASE)
         void DrawDebugInfo(IRenderAuxGeom& auxGeom, const float posX, const float posY);
     #endif // !AUDIO_RELEASE
@@ -79,6 +93,7 @@ namespace Audio
         void AllocateHeap(const size_t size, const char* const usage);
         bool UncacheFileCacheEntryInternal(CATLAudioFileEntry* const audioFileEntry, const bool now, const bool ignoreUsedCount = false);
         bool DoesRequestFitInternal(const size_t requestSize);
+        void AddToByteTotal(const size_t size);
         void UpdatePreloadRequestsStatus();
         bool FinishCachingFileInternal(CATLAudioFileEntry* const audioFileEntry, AZ::IO::SizeType sizeBytes,
             AZ::IO::IStreamerTypes::RequestStatus requestState);
@@ -100,5 +115,6 @@ namespace Audio
 
         size_t m_currentByteTotal;
         size_t m_maxByteTotal;
+        size_t m_peakByteTotal;
     };
 } // namespace Audio
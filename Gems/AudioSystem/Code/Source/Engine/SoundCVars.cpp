@@ -104,6 +104,48 @@ namespace Audio::CVars
         "How slowly the smoothing of obstruction/occlusion values should smooth to target: delta / (smoothFactor^2 + 1).  "
         "Low values will smooth faster, high values will smooth slower.");
 
+    // CVar: s_EnableObjectVirtualization
+    // Usage: s_EnableObjectVirtualization=true (false)
+    AZ_CVAR(bool, s_EnableObjectVirtualization, false,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "Set to true/false to enable/disable updating audio objects at reduced rates based on their distance to the listener.");
+
+    // CVar: s_ObjectFarDistance
+    // Usage: s_ObjectFarDistance=50.0
+    AZ_CVAR(float, s_ObjectFarDistance, 50.f,
+        [](const float& farDist) -> void
+        {
+            s_ObjectFarDistance = AZ::GetMax(farDist, 0.f);
+        },
+        AZ::ConsoleFunctorFlags::Null,
+        "Audio objects farther than this distance from the listener are updated every s_ObjectFarUpdateIntervalMs instead of every tick.");
+
+    // CVar: s_ObjectVirtualDistance
+    // Usage: s_ObjectVirtualDistance=150.0
+    AZ_CVAR(float, s_ObjectVirtualDistance, 150.f,
+        [](const float& virtualDist) -> void
+        {
+            s_ObjectVirtualDistance = AZ::GetMax(virtualDist, 0.f);
+        },
+        AZ::ConsoleFunctorFlags::Null,
+        "Audio objects farther than this distance from the listener become virtual: they stop running obstruction/occlusion raycasts "
+        "and are updated every s_ObjectVirtualUpdateIntervalMs.");
+
+    // CVar: s_ObjectFarUpdateIntervalMs
+    // Usage: s_ObjectFarUpdateIntervalMs=100.0
+    AZ_CVAR(float, s_ObjectFarUpdateIntervalMs, 100.f,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "How often, in milliseconds, audio objects beyond s_ObjectFarDistance are updated.");
+
+    // CVar: s_ObjectVirtualUpdateIntervalMs
+    // Usage: s_ObjectVirtualUpdateIntervalMs=500.0
+    AZ_CVAR(float, s_ObjectVirtualUpdateIntervalMs, 500.f,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "How often, in milliseconds, virtual audio objects beyond s_ObjectVirtualDistance are updated.");
+
     AZ_CVAR(AZ::u64, s_ATLMemorySize, AZ_TRAIT_AUDIOSYSTEM_ATL_POOL_SIZE,
         nullptr, AZ::ConsoleFunctorFlags::Null,
         "The size in KiB of memory to be used by the ATL/Audio System.\n"
@@ -114,6 +156,13 @@ namespace Audio::CVars
         "The size in KiB the File Cache Manager will use for banks.\n"
         "Usage: s_FileCacheManagerMemorySize=" AZ_TRAIT_AUDIOSYSTEM_FILE_CACHE_MANAGER_SIZE_DEFAULT_TEXT "\n");
 
+    AZ_CVAR(bool, s_FileCacheManagerStreamingMode, false,
+        nullptr, AZ::ConsoleFunctorFlags::Null,
+        "When enabled, the File Cache Manager doesn't reserve s_FileCacheManagerMemorySize up front, bank memory is only taken from\n"
+        "the system while a bank is loaded, so that only referenced banks are resident.  Banks are streamed in with a priority\n"
+        "based on their scope, global banks first.  s_FileCacheManagerMemorySize remains the limit.  Takes effect on startup.\n"
+        "Usage: s_FileCacheManagerStreamingMode=true (false)\n");
+
     AZ_CVAR(AZ::u64, s_AudioEventPoolSize, AZ_TRAIT_AUDIOSYSTEM_AUDIO_EVENT_POOL_SIZE,
         nullptr, AZ::ConsoleFunctorFlags::Null,
         "The number of audio events to preallocate in a pool.\n"
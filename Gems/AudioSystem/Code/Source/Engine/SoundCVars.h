@@ -16,6 +16,7 @@ namespace Audio::CVars
 {
     AZ_CVAR_EXTERNED(AZ::u64, s_ATLMemorySize);
     AZ_CVAR_EXTERNED(AZ::u64, s_FileCacheManagerMemorySize);
+    AZ_CVAR_EXTERNED(bool, s_FileCacheManagerStreamingMode);
     AZ_CVAR_EXTERNED(AZ::u64, s_AudioObjectPoolSize);
     AZ_CVAR_EXTERNED(AZ::u64, s_AudioEventPoolSize);
 
@@ -25,6 +26,12 @@ namespace Audio::CVars
     AZ_CVAR_EXTERNED(float, s_RaycastCacheTimeMs);
     AZ_CVAR_EXTERNED(float, s_RaycastSmoothFactor);
 
+    AZ_CVAR_EXTERNED(bool, s_EnableObjectVirtualization);
+    AZ_CVAR_EXTERNED(float, s_ObjectFarDistance);
+    AZ_CVAR_EXTERNED(float, s_ObjectVirtualDistance);
+    AZ_CVAR_EXTERNED(float, s_ObjectFarUpdateIntervalMs);
+    AZ_CVAR_EXTERNED(float, s_ObjectVirtualUpdateIntervalMs);
+
     AZ_CVAR_EXTERNED(float, s_PositionUpdateThreshold);
     AZ_CVAR_EXTERNED(float, s_VelocityTrackingThreshold);
     AZ_CVAR_EXTERNED(AZ::u32, s_AudioProxiesInitType);
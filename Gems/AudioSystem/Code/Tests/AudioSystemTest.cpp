@@ -8,16 +8,22 @@
 
 #include <AzTest/AzTest.h>
 #include <AzTest/Utils.h>
+#include <AzCore/IO/Streamer/Streamer.h>
+#include <AzCore/IO/Streamer/StreamerComponent.h>
+#include <AzCore/IO/SystemFile.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/std/containers/map.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/StringFunc/StringFunc.h>
 #include <AzFramework/IO/LocalFileIO.h>
 
 #include <AudioAllocators.h>
+#include <AudioRequestQueue.h>
 #include <ATLComponents.h>
 #include <ATLUtils.h>
 #include <ATL.h>
+#include <SoundCVars.h>
 
 #include <Mocks/ATLEntitiesMock.h>
 #include <Mocks/IAudioSystemImplementationMock.h>
@@ -47,10 +53,20 @@ void CreateAudioAllocators()
         allocDesc.m_heap.m_fixedMemoryBlocksByteSize[0] = 0;
         AZ::AllocatorInstance<Audio::AudioSystemAllocator>::Create(allocDesc);
     }
+
+    if (!AZ::AllocatorInstance<Audio::AudioRequestDataAllocator>::IsReady())
+    {
+        AZ::AllocatorInstance<Audio::AudioRequestDataAllocator>::Create();
+    }
 }
 
 void DestroyAudioAllocators()
 {
+    if (AZ::AllocatorInstance<Audio::AudioRequestDataAllocator>::IsReady())
+    {
+        AZ::AllocatorInstance<Audio::AudioRequestDataAllocator>::Destroy();
+    }
+
     if (AZ::AllocatorInstance<Audio::AudioSystemAllocator>::IsReady())
     {
         AZ::AllocatorInstance<Audio::AudioSystemAllocator>::Destroy();
@@ -324,6 +340,120 @@ TEST_F(ATLAudioObjectTest, OnAudioRaycastResults_MultiRaycastHit_NonZeroOcclusio
 }
 
 
+// Object virtualization is off by default, these tests turn it on.
+class ATLAudioObjectUpdateTierTest : public ATLAudioObjectTest
+{
+protected:
+    void SetUp() override
+    {
+        m_virtualizationEnabled = Audio::CVars::s_EnableObjectVirtualization;
+        Audio::CVars::s_EnableObjectVirtualization = true;
+    }
+
+    void TearDown() override
+    {
+        Audio::CVars::s_EnableObjectVirtualization = m_virtualizationEnabled;
+    }
+
+private:
+    bool m_virtualizationEnabled = false;
+};
+
+TEST_F(ATLAudioObjectUpdateTierTest, UpdateTier_DistanceToListener_BucketsObject)
+{
+    CATLAudioObject audioObject(testAudioObjectId, nullptr);
+    const SATLWorldPosition listenerPosition(AZ::Vector3::CreateZero());
+    const float farDistance = Audio::CVars::s_ObjectFarDistance;
+    const float virtualDistance = Audio::CVars::s_ObjectVirtualDistance;
+    float updateIntervalMs = 0.f;
+
+    EXPECT_EQ(audioObject.GetUpdateTier(), eAOUT_UNASSIGNED);
+
+    audioObject.SetPosition(SATLWorldPosition(AZ::Vector3(farDistance * 0.5f, 0.f, 0.f)));
+    EXPECT_TRUE(audioObject.UpdateTier(17.f, listenerPosition, updateIntervalMs));
+    EXPECT_EQ(audioObject.GetUpdateTier(), eAOUT_NEAR);
+
+    audioObject.SetPosition(SATLWorldPosition(AZ::Vector3(0.f, (farDistance + virtualDistance) * 0.5f, 0.f)));
+    audioObject.UpdateTier(17.f, listenerPosition, updateIntervalMs);
+    EXPECT_EQ(audioObject.GetUpdateTier(), eAOUT_FAR);
+
+    audioObject.SetPosition(SATLWorldPosition(AZ::Vector3(0.f, 0.f, virtualDistance * 2.f)));
+    audioObject.UpdateTier(17.f, listenerPosition, updateIntervalMs);
+    EXPECT_EQ(audioObject.GetUpdateTier(), eAOUT_VIRTUAL);
+}
+
+
+TEST_F(ATLAudioObjectUpdateTierTest, UpdateTier_FarObject_UpdatesAtReducedRate)
+{
+    CATLAudioObject audioObject(testAudioObjectId, nullptr);
+    const SATLWorldPosition listenerPosition(AZ::Vector3::CreateZero());
+    const float farDistance = Audio::CVars::s_ObjectFarDistance;
+    const float virtualDistance = Audio::CVars::s_ObjectVirtualDistance;
+    const float farUpdateIntervalMs = Audio::CVars::s_ObjectFarUpdateIntervalMs;
+    float updateIntervalMs = 0.f;
+
+    audioObject.SetPosition(SATLWorldPosition(AZ::Vector3((farDistance + virtualDistance) * 0.5f, 0.f, 0.f)));
+
+    // The first update always goes through, after that the object waits out its tier's interval.
+    EXPECT_TRUE(audioObject.UpdateTier(10.f, listenerPosition, updateIntervalMs));
+    EXPECT_EQ(updateIntervalMs, 10.f);
+
+    EXPECT_FALSE(audioObject.UpdateTier(farUpdateIntervalMs * 0.5f, listenerPosition, updateIntervalMs));
+    EXPECT_TRUE(audioObject.UpdateTier(farUpdateIntervalMs * 0.5f, listenerPosition, updateIntervalMs));
+    EXPECT_EQ(updateIntervalMs, farUpdateIntervalMs);
+}
+
+
+TEST_F(ATLAudioObjectUpdateTierTest, UpdateTier_VirtualObjectMovesCloser_UpdatesImmediately)
+{
+    CATLAudioObject audioObject(testAudioObjectId, nullptr);
+    const SATLWorldPosition listenerPosition(AZ::Vector3::CreateZero());
+    float updateIntervalMs = 0.f;
+
+    audioObject.SetPosition(SATLWorldPosition(AZ::Vector3(Audio::CVars::s_ObjectVirtualDistance * 2.f, 0.f, 0.f)));
+    EXPECT_TRUE(audioObject.UpdateTier(10.f, listenerPosition, updateIntervalMs));
+    EXPECT_FALSE(audioObject.UpdateTier(10.f, listenerPosition, updateIntervalMs));
+    EXPECT_EQ(audioObject.GetUpdateTier(), eAOUT_VIRTUAL);
+
+    audioObject.SetPosition(SATLWorldPosition(AZ::Vector3(1.f, 0.f, 0.f)));
+    EXPECT_TRUE(audioObject.UpdateTier(10.f, listenerPosition, updateIntervalMs));
+    EXPECT_EQ(audioObject.GetUpdateTier(), eAOUT_NEAR);
+    EXPECT_EQ(updateIntervalMs, 20.f);
+}
+
+
+// Turns object virtualization off, whatever it was set to before the test.
+class ATLAudioObjectVirtualizationDisabledTest : public ATLAudioObjectTest
+{
+protected:
+    void SetUp() override
+    {
+        m_virtualizationEnabled = Audio::CVars::s_EnableObjectVirtualization;
+        Audio::CVars::s_EnableObjectVirtualization = false;
+    }
+
+    void TearDown() override
+    {
+        Audio::CVars::s_EnableObjectVirtualization = m_virtualizationEnabled;
+    }
+
+private:
+    bool m_virtualizationEnabled = false;
+};
+
+TEST_F(ATLAudioObjectVirtualizationDisabledTest, UpdateTier_VirtualizationDisabled_AlwaysNear)
+{
+    CATLAudioObject audioObject(testAudioObjectId, nullptr);
+    const SATLWorldPosition listenerPosition(AZ::Vector3::CreateZero());
+    float updateIntervalMs = 0.f;
+
+    audioObject.SetPosition(SATLWorldPosition(AZ::Vector3(Audio::CVars::s_ObjectVirtualDistance * 2.f, 0.f, 0.f)));
+    EXPECT_TRUE(audioObject.UpdateTier(10.f, listenerPosition, updateIntervalMs));
+    EXPECT_TRUE(audioObject.UpdateTier(10.f, listenerPosition, updateIntervalMs));
+    EXPECT_EQ(audioObject.GetUpdateTier(), eAOUT_NEAR);
+}
+
+
 class AudioRaycastManager_Test
     : public AudioRaycastManager
 {
@@ -645,6 +775,422 @@ TEST(AudioFlagsTest, AudioFlags_SetAndClearAll_FlagsAreCorrect)
 
 
 
+//-------------------------//
+// Test CAudioRequestQueue //
+//-------------------------//
+
+namespace AudioRequestTestUtils
+{
+    CAudioRequestInternal MakeSetPositionRequest(TAudioObjectID objectId, float x)
+    {
+        SAudioObjectRequestData<eAORT_SET_POSITION> requestData(SATLWorldPosition(AZ::Vector3(x, 0.f, 0.f)));
+        SAudioRequest request;
+        request.nAudioObjectID = objectId;
+        request.nFlags = eARF_PRIORITY_NORMAL;
+        request.pData = &requestData;
+        return CAudioRequestInternal(request);
+    }
+
+    CAudioRequestInternal MakeSetRtpcRequest(TAudioObjectID objectId, TAudioControlID rtpcId, float value)
+    {
+        SAudioObjectRequestData<eAORT_SET_RTPC_VALUE> requestData(rtpcId, value);
+        SAudioRequest request;
+        request.nAudioObjectID = objectId;
+        request.nFlags = eARF_PRIORITY_NORMAL;
+        request.pData = &requestData;
+        return CAudioRequestInternal(request);
+    }
+
+    CAudioRequestInternal MakeExecuteTriggerRequest(TAudioObjectID objectId, TAudioControlID triggerId)
+    {
+        SAudioObjectRequestData<eAORT_EXECUTE_TRIGGER> requestData(triggerId, 0.f);
+        SAudioRequest request;
+        request.nAudioObjectID = objectId;
+        request.nFlags = eARF_PRIORITY_NORMAL;
+        request.pData = &requestData;
+        return CAudioRequestInternal(request);
+    }
+
+    CAudioRequestInternal MakeStopAllSoundsRequest()
+    {
+        SAudioManagerRequestData<eAMRT_STOP_ALL_SOUNDS> requestData;
+        SAudioRequest request;
+        request.nFlags = eARF_PRIORITY_NORMAL;
+        request.pData = &requestData;
+        return CAudioRequestInternal(request);
+    }
+
+    float GetPositionX(const CAudioRequestInternal& request)
+    {
+        auto const requestData = static_cast<const SAudioObjectRequestDataInternal<eAORT_SET_POSITION>*>(request.pData.get());
+        return requestData->oPosition.GetPositionVec().GetX();
+    }
+} // namespace AudioRequestTestUtils
+
+TEST(AudioRequestQueueTest, AudioRequestQueue_PushPastCapacity_DrainsAllInOrder)
+{
+    using namespace AudioRequestTestUtils;
+
+    auto requestQueue = AZStd::make_unique<CAudioRequestQueue>();
+    const size_t requestCount = CAudioRequestQueue::Capacity + 100;
+
+    for (size_t i = 0; i < requestCount; ++i)
+    {
+        requestQueue->Push(MakeSetPositionRequest(i, 0.f));
+    }
+
+    EXPECT_EQ(requestQueue->GetOverflowCount(), 100);
+
+    TAudioRequestBatch batch;
+    requestQueue->Drain(batch);
+
+    ASSERT_EQ(batch.size(), requestCount);
+    for (size_t i = 0; i < requestCount; ++i)
+    {
+        EXPECT_EQ(batch[i].nAudioObjectID, i);
+    }
+
+    // The ring is reusable after being drained.
+    batch.clear();
+    requestQueue->Push(MakeSetPositionRequest(1, 0.f));
+    requestQueue->Drain(batch);
+
+    EXPECT_EQ(batch.size(), 1);
+    EXPECT_EQ(requestQueue->GetOverflowCount(), 100);
+}
+
+TEST(AudioRequestQueueTest, AudioRequestQueue_MultipleProducers_DrainsEveryRequestInProducerOrder)
+{
+    using namespace AudioRequestTestUtils;
+
+    constexpr size_t producerCount = 4;
+    constexpr size_t requestsPerProducer = 20000;
+
+    auto requestQueue = AZStd::make_unique<CAudioRequestQueue>();
+
+    AZStd::vector<AZStd::thread> producers;
+    for (size_t producer = 0; producer < producerCount; ++producer)
+    {
+        producers.emplace_back([&requestQueue, producer]()
+        {
+            for (size_t i = 0; i < requestsPerProducer; ++i)
+            {
+                requestQueue->Push(MakeSetPositionRequest(producer, static_cast<float>(i)));
+            }
+        });
+    }
+
+    AZStd::vector<float> lastPositions(producerCount, -1.f);
+    size_t drainedCount = 0;
+    TAudioRequestBatch batch;
+
+    while (drainedCount < producerCount * requestsPerProducer)
+    {
+        batch.clear();
+        requestQueue->Drain(batch);
+
+        for (const auto& request : batch)
+        {
+            ASSERT_LT(request.nAudioObjectID, producerCount);
+
+            const float position = GetPositionX(request);
+            EXPECT_GT(position, lastPositions[request.nAudioObjectID]);
+            lastPositions[request.nAudioObjectID] = position;
+        }
+
+        drainedCount += batch.size();
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    EXPECT_EQ(drainedCount, producerCount * requestsPerProducer);
+}
+
+//-----------------------------//
+// Test CAudioRequestCoalescer //
+//-----------------------------//
+
+TEST(AudioRequestCoalescerTest, AudioRequestCoalescer_RepeatedPositions_KeepsNewestPerObject)
+{
+    using namespace AudioRequestTestUtils;
+
+    TAudioRequestBatch batch;
+    batch.push_back(MakeSetPositionRequest(1, 1.f));
+    batch.push_back(MakeSetPositionRequest(2, 1.f));
+    batch.push_back(MakeSetPositionRequest(1, 2.f));
+    batch.push_back(MakeSetPositionRequest(1, 3.f));
+
+    CAudioRequestCoalescer coalescer;
+    EXPECT_EQ(coalescer.Coalesce(batch), 2);
+
+    EXPECT_EQ(batch[0].eStatus, eARS_SUCCESS);
+    EXPECT_EQ(batch[1].eStatus, eARS_NONE);
+    EXPECT_EQ(batch[2].eStatus, eARS_SUCCESS);
+    EXPECT_EQ(batch[3].eStatus, eARS_NONE);
+}
+
+TEST(AudioRequestCoalescerTest, AudioRequestCoalescer_RtpcValues_CoalescedPerRtpc)
+{
+    using namespace AudioRequestTestUtils;
+
+    TAudioRequestBatch batch;
+    batch.push_back(MakeSetRtpcRequest(1, 10, 0.1f));
+    batch.push_back(MakeSetRtpcRequest(1, 11, 0.1f));
+    batch.push_back(MakeSetPositionRequest(1, 1.f));
+    batch.push_back(MakeSetRtpcRequest(1, 10, 0.2f));
+    batch.push_back(MakeSetRtpcRequest(2, 10, 0.2f));
+
+    CAudioRequestCoalescer coalescer;
+    EXPECT_EQ(coalescer.Coalesce(batch), 1);
+
+    EXPECT_EQ(batch[0].eStatus, eARS_SUCCESS);
+    EXPECT_EQ(batch[1].eStatus, eARS_NONE);
+    EXPECT_EQ(batch[2].eStatus, eARS_NONE);
+    EXPECT_EQ(batch[3].eStatus, eARS_NONE);
+    EXPECT_EQ(batch[4].eStatus, eARS_NONE);
+}
+
+TEST(AudioRequestCoalescerTest, AudioRequestCoalescer_OtherObjectRequestInBetween_NotCoalesced)
+{
+    using namespace AudioRequestTestUtils;
+
+    // The trigger has to start at the first position, so that update can't be dropped.
+    TAudioRequestBatch batch;
+    batch.push_back(MakeSetPositionRequest(1, 1.f));
+    batch.push_back(MakeSetPositionRequest(1, 2.f));
+    batch.push_back(MakeExecuteTriggerRequest(1, 100));
+    batch.push_back(MakeSetPositionRequest(1, 3.f));
+    batch.push_back(MakeExecuteTriggerRequest(2, 100));
+    batch.push_back(MakeSetPositionRequest(1, 4.f));
+
+    CAudioRequestCoalescer coalescer;
+    EXPECT_EQ(coalescer.Coalesce(batch), 2);
+
+    EXPECT_EQ(batch[0].eStatus, eARS_SUCCESS);
+    EXPECT_EQ(batch[1].eStatus, eARS_NONE);
+    EXPECT_EQ(batch[2].eStatus, eARS_NONE);
+    EXPECT_EQ(batch[3].eStatus, eARS_SUCCESS);
+    EXPECT_EQ(batch[4].eStatus, eARS_NONE);
+    EXPECT_EQ(batch[5].eStatus, eARS_NONE);
+}
+
+TEST(AudioRequestCoalescerTest, AudioRequestCoalescer_ManagerRequestInBetween_NotCoalesced)
+{
+    using namespace AudioRequestTestUtils;
+
+    TAudioRequestBatch batch;
+    batch.push_back(MakeSetPositionRequest(1, 1.f));
+    batch.push_back(MakeStopAllSoundsRequest());
+    batch.push_back(MakeSetPositionRequest(1, 2.f));
+
+    CAudioRequestCoalescer coalescer;
+    EXPECT_EQ(coalescer.Coalesce(batch), 0);
+
+    EXPECT_EQ(batch[0].eStatus, eARS_NONE);
+    EXPECT_EQ(batch[2].eStatus, eARS_NONE);
+}
+
+//------------------------//
+// Test CFileCacheManager //
+//------------------------//
+
+TEST(FileCacheManagerTest, FileCacheManager_NothingCached_ZeroResidentAndPeakBytes)
+{
+    TATLPreloadRequestLookup preloadRequests;
+    CFileCacheManager fileCacheManager(preloadRequests);
+
+    EXPECT_EQ(fileCacheManager.GetResidentByteTotal(), 0);
+    EXPECT_EQ(fileCacheManager.GetPeakByteTotal(), 0);
+}
+
+// Loads a manual preload of one bank through AZ::IO::Streamer, the way the ATL does, with streaming mode enabled.
+class FileCacheManagerStreamingTestFixture
+    : public ::testing::Test
+{
+public:
+    AZ_TEST_CLASS_ALLOCATOR(FileCacheManagerStreamingTestFixture)
+
+    FileCacheManagerStreamingTestFixture()
+        : m_fileCacheManager(m_preloads)
+    {
+    }
+
+    void SetUp() override
+    {
+        using ::testing::_;
+        using ::testing::Invoke;
+        using ::testing::Return;
+
+        m_streamingMode = Audio::CVars::s_FileCacheManagerStreamingMode;
+        Audio::CVars::s_FileCacheManagerStreamingMode = true;
+
+        // Streaming mode doesn't reserve the bank memory up front, see InitializeAudioAllocators.
+        if (!AZ::AllocatorInstance<Audio::AudioBankAllocator>::IsReady())
+        {
+            Audio::AudioBankAllocator::Descriptor allocDesc;
+            allocDesc.m_allocationRecords = false;
+            allocDesc.m_heap.m_fixedMemoryBlocksByteSize[0] = 0;
+            AZ::AllocatorInstance<Audio::AudioBankAllocator>::Create(allocDesc);
+        }
+
+        m_prevFileIO = AZ::IO::FileIOBase::GetInstance();
+        if (m_prevFileIO)
+        {
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+        }
+
+        // The file cache manager lower-cases the file paths, so the bank goes through an alias to the temp folder.
+        m_fileIO = AZStd::make_unique<AZ::IO::LocalFileIO>();
+        AZ::IO::FileIOBase::SetInstance(m_fileIO.get());
+        m_fileIO->SetAlias(m_audioTestAlias, m_tempDirectory.GetDirectory());
+
+        AZ::IO::SystemFile bankFile;
+        ASSERT_TRUE(bankFile.Open(m_tempDirectory.Resolve(m_bankFileName).c_str(), AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY));
+        const AZStd::vector<AZ::u8> bankData(BankSize, 0xAB);
+        ASSERT_EQ(bankFile.Write(bankData.data(), bankData.size()), BankSize);
+        bankFile.Close();
+
+        m_streamer = AZStd::make_unique<AZ::IO::Streamer>(AZStd::thread_desc{}, AZ::StreamerComponent::CreateStreamerStack());
+        AZ::Interface<AZ::IO::IStreamer>::Register(m_streamer.get());
+
+        ON_CALL(m_audioSystemImpl, ParseAudioFileEntry(_, _))
+            .WillByDefault(Invoke([this](const AZ::rapidxml::xml_node<char>*, SATLAudioFileEntryInfo* fileEntryInfo)
+            {
+                fileEntryInfo->sFileName = m_bankFileName;
+                return eARS_SUCCESS;
+            }));
+        ON_CALL(m_audioSystemImpl, GetAudioFileLocation(_))
+            .WillByDefault(Return(m_audioTestAlias));
+        ON_CALL(m_audioSystemImpl, UnregisterInMemoryFile(_))
+            .WillByDefault(Return(eARS_SUCCESS));
+        m_audioSystemImpl.AudioSystemImplementationRequestBus::Handler::BusConnect();
+
+        m_fileCacheManager.Initialize();
+
+        // The implementation parses the file entry, so there's no need for an xml node.
+        m_fileEntryId = m_fileCacheManager.TryAddFileCacheEntry(nullptr, eADS_LEVEL_SPECIFIC, false);
+        ASSERT_NE(m_fileEntryId, INVALID_AUDIO_FILE_ENTRY_ID);
+
+        const CATLPreloadRequest::TFileEntryIDs fileEntryIds{ m_fileEntryId };
+        m_preloadRequest = azcreate(CATLPreloadRequest, (PreloadRequestId, eADS_LEVEL_SPECIFIC, false, fileEntryIds), Audio::AudioSystemAllocator);
+        m_preloads[PreloadRequestId] = m_preloadRequest;
+    }
+
+    void TearDown() override
+    {
+        m_fileCacheManager.TryRemoveFileCacheEntry(m_fileEntryId, eADS_LEVEL_SPECIFIC);
+        m_fileCacheManager.Release();
+
+        m_preloads.clear();
+        if (m_preloadRequest)
+        {
+            azdestroy(m_preloadRequest, Audio::AudioSystemAllocator);
+            m_preloadRequest = nullptr;
+        }
+
+        m_audioSystemImpl.AudioSystemImplementationRequestBus::Handler::BusDisconnect();
+
+        if (m_streamer)
+        {
+            AZ::Interface<AZ::IO::IStreamer>::Unregister(m_streamer.get());
+            m_streamer.reset();
+        }
+
+        m_fileIO->ClearAlias(m_audioTestAlias);
+        m_fileIO.reset();
+
+        AZ::IO::FileIOBase::SetInstance(nullptr);
+        if (m_prevFileIO)
+        {
+            AZ::IO::FileIOBase::SetInstance(m_prevFileIO);
+            m_prevFileIO = nullptr;
+        }
+
+        if (AZ::AllocatorInstance<Audio::AudioBankAllocator>::IsReady())
+        {
+            AZ::AllocatorInstance<Audio::AudioBankAllocator>::Destroy();
+        }
+
+        Audio::CVars::s_FileCacheManagerStreamingMode = m_streamingMode;
+    }
+
+protected:
+    static constexpr size_t BankSize = 4096;
+    static constexpr TAudioPreloadRequestID PreloadRequestId = 1;
+
+    TATLPreloadRequestLookup m_preloads;
+    CFileCacheManager m_fileCacheManager;
+
+private:
+    NiceMock<AudioSystemImplementationMock> m_audioSystemImpl;
+    CATLPreloadRequest* m_preloadRequest = nullptr;
+    TAudioFileEntryID m_fileEntryId = INVALID_AUDIO_FILE_ENTRY_ID;
+
+    AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+    const char* m_audioTestAlias { "@audiotestroot@" };
+    const char* m_bankFileName { "streaming.bnk" };
+    AZ::IO::FileIOBase* m_prevFileIO { nullptr };
+    AZStd::unique_ptr<AZ::IO::LocalFileIO> m_fileIO;
+    AZStd::unique_ptr<AZ::IO::Streamer> m_streamer;
+    bool m_streamingMode = false;
+};
+
+TEST_F(FileCacheManagerStreamingTestFixture, FileCacheManager_GetStreamPriority_DefaultMode_AlwaysHigh)
+{
+    // The fixture enables streaming mode, and restores the previous mode in TearDown.
+    Audio::CVars::s_FileCacheManagerStreamingMode = false;
+
+    CATLAudioFileEntry levelFileEntry("level.bnk");
+    levelFileEntry.m_dataScope = eADS_LEVEL_SPECIFIC;
+    levelFileEntry.m_flags.AddFlags(eAFF_USE_COUNTED);
+
+    EXPECT_EQ(CFileCacheManager::GetStreamPriority(levelFileEntry), AZ::IO::IStreamerTypes::s_priorityHigh);
+}
+
+TEST_F(FileCacheManagerStreamingTestFixture, FileCacheManager_GetStreamPriority_StreamingMode_GlobalFirst)
+{
+    CATLAudioFileEntry globalFileEntry("global.bnk");
+    globalFileEntry.m_dataScope = eADS_GLOBAL;
+
+    CATLAudioFileEntry levelFileEntry("level.bnk");
+    levelFileEntry.m_dataScope = eADS_LEVEL_SPECIFIC;
+
+    CATLAudioFileEntry manualFileEntry("manual.bnk");
+    manualFileEntry.m_dataScope = eADS_LEVEL_SPECIFIC;
+    manualFileEntry.m_flags.AddFlags(eAFF_USE_COUNTED);
+
+    const AZ::IO::IStreamerTypes::Priority globalPriority = CFileCacheManager::GetStreamPriority(globalFileEntry);
+    const AZ::IO::IStreamerTypes::Priority levelPriority = CFileCacheManager::GetStreamPriority(levelFileEntry);
+    const AZ::IO::IStreamerTypes::Priority manualPriority = CFileCacheManager::GetStreamPriority(manualFileEntry);
+
+    EXPECT_EQ(globalPriority, AZ::IO::IStreamerTypes::s_priorityHigh);
+    EXPECT_GT(globalPriority, levelPriority);
+    EXPECT_GT(levelPriority, manualPriority);
+}
+
+TEST_F(FileCacheManagerStreamingTestFixture, FileCacheManager_StreamingModeLoadAndUnload_TracksResidentAndPeakBytes)
+{
+    EXPECT_EQ(m_fileCacheManager.TryLoadRequest(PreloadRequestId, true, false), eARS_SUCCESS);
+    EXPECT_EQ(m_fileCacheManager.GetResidentByteTotal(), BankSize);
+    EXPECT_EQ(m_fileCacheManager.GetPeakByteTotal(), BankSize);
+
+    // Unloading frees the bank memory straight away, the peak keeps the high-water mark.
+    EXPECT_EQ(m_fileCacheManager.TryUnloadRequest(PreloadRequestId), eARS_SUCCESS);
+    EXPECT_EQ(m_fileCacheManager.GetResidentByteTotal(), 0);
+    EXPECT_EQ(m_fileCacheManager.GetPeakByteTotal(), BankSize);
+
+    // Loading the bank again doesn't raise the peak.
+    EXPECT_EQ(m_fileCacheManager.TryLoadRequest(PreloadRequestId, true, false), eARS_SUCCESS);
+    EXPECT_EQ(m_fileCacheManager.GetResidentByteTotal(), BankSize);
+    EXPECT_EQ(m_fileCacheManager.GetPeakByteTotal(), BankSize);
+
+    EXPECT_EQ(m_fileCacheManager.TryUnloadRequest(PreloadRequestId), eARS_SUCCESS);
+    EXPECT_EQ(m_fileCacheManager.GetResidentByteTotal(), 0);
+}
+
 //-------------------------//
 // Test CATLDebugNameStore //
 //-------------------------//
@@ -28,13 +28,13 @@ namespace Audio
 
         MOCK_METHOD0(OnAudioSystemRefresh, void());
 
-        MOCK_METHOD0(OnLoseFocus, EAudioRequestStatus());
+        MOCK_METHOD0(OnAudioSystemLoseFocus, void());
 
-        MOCK_METHOD0(OnGetFocus, EAudioRequestStatus());
+        MOCK_METHOD0(OnAudioSystemGetFocus, void());
 
-        MOCK_METHOD0(MuteAll, EAudioRequestStatus());
+        MOCK_METHOD0(OnAudioSystemMuteAll, void());
 
-        MOCK_METHOD0(UnmuteAll, EAudioRequestStatus());
+        MOCK_METHOD0(OnAudioSystemUnmuteAll, void());
 
         MOCK_METHOD0(StopAllSounds, EAudioRequestStatus());
 
@@ -68,6 +68,8 @@ namespace Audio
 
         MOCK_METHOD3(SetRtpc, EAudioRequestStatus(IATLAudioObjectData*, const IATLRtpcImplData*, float));
 
+        MOCK_METHOD2(ResetRtpc, EAudioRequestStatus(IATLAudioObjectData*, const IATLRtpcImplData*));
+
         MOCK_METHOD2(SetSwitchState, EAudioRequestStatus(IATLAudioObjectData*, const IATLSwitchStateImplData*));
 
         MOCK_METHOD3(SetObstructionOcclusion, EAudioRequestStatus(IATLAudioObjectData*, float, float));
@@ -128,9 +130,13 @@ namespace Audio
 
         MOCK_CONST_METHOD1(GetMemoryInfo, void(SAudioImplMemoryInfo&));
 
+        MOCK_METHOD0(GetMemoryPoolInfo, AZStd::vector<AudioImplMemoryPoolInfo>());
+
         MOCK_METHOD1(CreateAudioSource, bool(const SAudioInputConfig&));
 
         MOCK_METHOD1(DestroyAudioSource, void(TAudioSourceId));
+
+        MOCK_METHOD1(SetPanningMode, void(PanningMode));
     };
 
 } // namespace Audio
@@ -21,6 +21,7 @@ set(FILES
     Source/Engine/ATLUtils.h
     Source/Engine/AudioInternalInterfaces.h
     Source/Engine/AudioProxy.h
+    Source/Engine/AudioRequestQueue.h
     Source/Engine/AudioSystem.h
     Source/Engine/FileCacheManager.h
     Source/Engine/SoundCVars.h
@@ -30,6 +31,7 @@ set(FILES
     Source/Engine/ATLEntities.cpp
     Source/Engine/ATLUtils.cpp
     Source/Engine/AudioProxy.cpp
+    Source/Engine/AudioRequestQueue.cpp
     Source/Engine/AudioRequests.cpp
     Source/Engine/AudioSystem.cpp
     Source/Engine/FileCacheManager.cpp
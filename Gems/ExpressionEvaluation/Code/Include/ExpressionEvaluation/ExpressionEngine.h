@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include <ExpressionEvaluation/ExpressionEngine/CompiledExpression.h>
 #include <ExpressionEvaluation/ExpressionEngine/ExpressionTree.h>
 #include <ExpressionEvaluation/ExpressionEngine/ExpressionTypes.h>
 #include <ExpressionEvaluation/ExpressionEvaluationBus.h>
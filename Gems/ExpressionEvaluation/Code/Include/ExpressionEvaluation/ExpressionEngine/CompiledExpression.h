@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace ExpressionEvaluation
+{
+    // A numeric ExpressionTree lowered into a flat list of typed instructions that operate on a register file of doubles.
+    //
+    // Variables are bound by index, in the order they were reported by ExpressionTree::GetVariables() when the expression was
+    // compiled, instead of being looked up in the tree. Evaluation does not touch any shared state, so a single compiled
+    // expression can be evaluated against any number of variable bindings from any thread.
+    class CompiledExpression
+    {
+        // Friend class for compilation
+        friend class ExpressionEvaluationSystemComponent;
+
+    public:
+        AZ_TYPE_INFO(CompiledExpression, "{2B7C6A0E-8D51-4F3B-9E64-5C1D0A7F83B2}");
+        AZ_CLASS_ALLOCATOR(CompiledExpression, AZ::SystemAllocator, 0);
+
+        enum class OpCode : AZ::u8
+        {
+            Add,
+            Subtract,
+            Multiply,
+            Divide,
+            Modulo
+        };
+
+        // Reads the left and right registers and writes the result into the target register.
+        //
+        // The register file is laid out as [variables][constants][temporaries].
+        struct Instruction
+        {
+            OpCode m_opCode = OpCode::Add;
+            AZ::u32 m_target = 0;
+            AZ::u32 m_left = 0;
+            AZ::u32 m_right = 0;
+        };
+
+        CompiledExpression() = default;
+
+        const AZStd::vector<AZStd::string>& GetVariables() const
+        {
+            return m_variables;
+        }
+
+        const AZStd::vector<Instruction>& GetInstructions() const
+        {
+            return m_instructions;
+        }
+
+        size_t GetRegisterCount() const
+        {
+            return m_registerCount;
+        }
+
+        //! Evaluates the expression for a single set of variable values.
+        //! /param variableValues
+        //!    One value per variable, in GetVariables() order. May be null if the expression has no variables.
+        //! /return Returns the result, or Failure if the expression divided by zero.
+        AZ::Outcome<double, void> Evaluate(const double* variableValues) const;
+
+        //! Evaluates the expression once for each of the supplied variable bindings.
+        //! /param variableValues
+        //!    bindingCount rows of GetVariables().size() values each, in GetVariables() order.
+        //! /param bindingCount
+        //!    The number of bindings to evaluate.
+        //! /param results
+        //!    Receives bindingCount results. Bindings that divided by zero receive 0.
+        //! /param resultsValid
+        //!    Optional, receives bindingCount flags signifying whether the matching result is valid.
+        void EvaluateBatch(const double* variableValues, size_t bindingCount, double* results, bool* resultsValid = nullptr) const;
+
+    private:
+
+        void ExecuteInstructions(double* registers, size_t laneStride, size_t laneCount, bool* lanesValid) const;
+
+        AZStd::vector<AZStd::string> m_variables;
+        AZStd::vector<double> m_constants;
+        AZStd::vector<Instruction> m_instructions;
+
+        AZ::u32 m_registerCount = 0;
+        AZ::u32 m_resultRegister = 0;
+    };
+}
@@ -11,6 +11,7 @@
 #include <AzCore/Outcome/Outcome.h>
 #include <AzCore/std/string/string_view.h>
 
+#include <ExpressionEvaluation/ExpressionEngine/CompiledExpression.h>
 #include <ExpressionEvaluation/ExpressionEngine/ExpressionTypes.h>
 #include <ExpressionEvaluation/ExpressionEngine/ExpressionTree.h>
 
@@ -21,6 +22,8 @@ namespace ExpressionEvaluation
 
     using EvaluateStringOutcome = AZ::Outcome<ExpressionResult, ParsingError>;
 
+    using CompileOutcome = AZ::Outcome<CompiledExpression, AZStd::string>;
+
     class ExpressionEvaluationRequests
         : public AZ::EBusTraits
     {
@@ -74,6 +77,13 @@ namespace ExpressionEvaluation
         //!    The ExpressionTree to be evaluated
         //! /return Returns the result of the expression evaluation.
         virtual ExpressionResult Evaluate(const ExpressionTree& expressionTree) const = 0;
+
+        //! Lowers the specified ExpressionTree into a CompiledExpression that can be evaluated repeatedly without the bus.
+        //! Only trees made up of numeric primitives, variables and math operators can be compiled.
+        //! /param expressionTree
+        //!    The ExpressionTree to be compiled
+        //! /return Returns the CompiledExpression, or the reason the tree could not be compiled.
+        virtual CompileOutcome CompileExpression(const ExpressionTree& expressionTree) const = 0;
     };
     
     using ExpressionEvaluationRequestBus = AZ::EBus<ExpressionEvaluationRequests>;
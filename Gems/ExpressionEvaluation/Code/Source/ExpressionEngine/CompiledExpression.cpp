@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+
+#include <ExpressionEvaluation/ExpressionEngine/CompiledExpression.h>
+
+namespace ExpressionEvaluation
+{
+    namespace CompiledExpressionInternal
+    {
+        // Number of bindings that are run through each instruction at once when evaluating a batch.
+        static const size_t BatchLaneCount = 64;
+
+        // Register files up to this many doubles live on the stack.
+        static const size_t LocalRegisterCapacity = 1024;
+
+        // Matches the tolerance the MathOperators interface uses to reject divisions.
+        bool IsZeroDivisor(double value)
+        {
+            return AZ::IsClose(value, 0.0, std::numeric_limits<double>::epsilon());
+        }
+    }
+
+    AZ::Outcome<double, void> CompiledExpression::Evaluate(const double* variableValues) const
+    {
+        double result = 0.0;
+        bool resultValid = false;
+
+        EvaluateBatch(variableValues, 1, &result, &resultValid);
+
+        if (resultValid)
+        {
+            return AZ::Success(result);
+        }
+
+        return AZ::Failure();
+    }
+
+    void CompiledExpression::EvaluateBatch(const double* variableValues, size_t bindingCount, double* results, bool* resultsValid) const
+    {
+        using namespace CompiledExpressionInternal;
+
+        if (bindingCount == 0 || m_registerCount == 0)
+        {
+            return;
+        }
+
+        // Registers are stored lane-major, so every instruction runs as a tight loop over the lanes in flight.
+        const size_t laneStride = AZStd::min(bindingCount, BatchLaneCount);
+        const size_t registerFileSize = m_registerCount * laneStride;
+
+        double localRegisters[LocalRegisterCapacity];
+        AZStd::vector<double> heapRegisters;
+
+        double* registers = localRegisters;
+
+        if (registerFileSize > LocalRegisterCapacity)
+        {
+            heapRegisters.resize(registerFileSize);
+            registers = heapRegisters.data();
+        }
+
+        const size_t variableCount = m_variables.size();
+
+        // Constants are never written to, so they only need to be splatted across the lanes once.
+        for (size_t constantIndex = 0; constantIndex < m_constants.size(); ++constantIndex)
+        {
+            double* constantRegister = registers + (variableCount + constantIndex) * laneStride;
+            AZStd::fill(constantRegister, constantRegister + laneStride, m_constants[constantIndex]);
+        }
+
+        bool lanesValid[BatchLaneCount];
+
+        for (size_t batchStart = 0; batchStart < bindingCount; batchStart += laneStride)
+        {
+            const size_t laneCount = AZStd::min(laneStride, bindingCount - batchStart);
+
+            for (size_t lane = 0; lane < laneCount; ++lane)
+            {
+                const double* binding = variableValues + (batchStart + lane) * variableCount;
+
+                for (size_t variableIndex = 0; variableIndex < variableCount; ++variableIndex)
+                {
+                    registers[variableIndex * laneStride + lane] = binding[variableIndex];
+                }
+            }
+
+            AZStd::fill(lanesValid, lanesValid + laneCount, true);
+
+            ExecuteInstructions(registers, laneStride, laneCount, lanesValid);
+
+            const double* resultRegister = registers + m_resultRegister * laneStride;
+
+            for (size_t lane = 0; lane < laneCount; ++lane)
+            {
+                results[batchStart + lane] = lanesValid[lane] ? resultRegister[lane] : 0.0;
+            }
+
+            if (resultsValid)
+            {
+                AZStd::copy(lanesValid, lanesValid + laneCount, resultsValid + batchStart);
+            }
+        }
+    }
+
+    void CompiledExpression::ExecuteInstructions(double* registers, size_t laneStride, size_t laneCount, bool* lanesValid) const
+    {
+        using namespace CompiledExpressionInternal;
+
+        for (const Instruction& instruction : m_instructions)
+        {
+            double* target = registers + instruction.m_target * laneStride;
+            const double* left = registers + instruction.m_left * laneStride;
+            const double* right = registers + instruction.m_right * laneStride;
+
+            switch (instruction.m_opCode)
+            {
+            case OpCode::Add:
+                for (size_t lane = 0; lane < laneCount; ++lane)
+                {
+                    target[lane] = left[lane] + right[lane];
+                }
+                break;
+            case OpCode::Subtract:
+                for (size_t lane = 0; lane < laneCount; ++lane)
+                {
+                    target[lane] = left[lane] - right[lane];
+                }
+                break;
+            case OpCode::Multiply:
+                for (size_t lane = 0; lane < laneCount; ++lane)
+                {
+                    target[lane] = left[lane] * right[lane];
+                }
+                break;
+            case OpCode::Divide:
+                for (size_t lane = 0; lane < laneCount; ++lane)
+                {
+                    const bool validDivisor = !IsZeroDivisor(right[lane]);
+                    lanesValid[lane] = lanesValid[lane] && validDivisor;
+                    target[lane] = validDivisor ? left[lane] / right[lane] : 0.0;
+                }
+                break;
+            case OpCode::Modulo:
+                for (size_t lane = 0; lane < laneCount; ++lane)
+                {
+                    // Divisors in (-1, 1) truncate to zero as well, so they are rejected along with the near zero ones.
+                    const int divisor = IsZeroDivisor(right[lane]) ? 0 : aznumeric_cast<int>(right[lane]);
+                    lanesValid[lane] = lanesValid[lane] && divisor != 0;
+                    target[lane] = divisor != 0 ? aznumeric_cast<double>(aznumeric_cast<int>(left[lane]) % divisor) : 0.0;
+                }
+                break;
+            default:
+                break;
+            }
+        }
+    }
+}
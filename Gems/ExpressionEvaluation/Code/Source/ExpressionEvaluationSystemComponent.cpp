@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
@@ -560,6 +561,167 @@ namespace ExpressionEvaluation
         return resultStack.PopAndReturn();
     }
 
+    CompileOutcome ExpressionEvaluationSystemComponent::CompileExpression(const ExpressionTree& expressionTree) const
+    {
+        AZ_PROFILE_FUNCTION(ExpressionEvaluation);
+
+        // Operands are tracked by kind while walking the tree, since the registers for constants and temporaries
+        // aren't known until every constant has been seen.
+        enum class OperandKind
+        {
+            Variable,
+            Constant,
+            Temporary
+        };
+
+        struct Operand
+        {
+            OperandKind m_kind;
+            AZ::u32 m_index;
+        };
+
+        struct PendingInstruction
+        {
+            CompiledExpression::OpCode m_opCode;
+            Operand m_target;
+            Operand m_left;
+            Operand m_right;
+        };
+
+        CompiledExpression compiledExpression;
+        compiledExpression.m_variables = expressionTree.GetVariables();
+
+        AZStd::unordered_map<AZ::Crc32, AZ::u32> variableIndices;
+
+        for (AZ::u32 variableIndex = 0; variableIndex < compiledExpression.m_variables.size(); ++variableIndex)
+        {
+            variableIndices[AZ::Crc32(compiledExpression.m_variables[variableIndex])] = variableIndex;
+        }
+
+        AZStd::vector<Operand> operandStack;
+        AZStd::vector<PendingInstruction> pendingInstructions;
+        AZ::u32 temporaryCount = 0;
+
+        for (const ExpressionToken& expressionToken : expressionTree.GetTokens())
+        {
+            if (expressionToken.m_parserId == InternalTypes::Interfaces::InternalParser)
+            {
+                if (expressionToken.m_information.m_id == InternalTypes::Variable)
+                {
+                    VariableDescriptor variableDescriptor = Utils::GetAnyValue<VariableDescriptor>(expressionToken.m_information.m_extraStore);
+
+                    auto variableIter = variableIndices.find(variableDescriptor.m_nameHash);
+
+                    if (variableIter == variableIndices.end())
+                    {
+                        return AZ::Failure(AZStd::string::format("Variable '%s' is not registered with the Expression Tree.", variableDescriptor.m_displayName.c_str()));
+                    }
+
+                    operandStack.push_back({ OperandKind::Variable, variableIter->second });
+                }
+            }
+            else if (expressionToken.m_parserId == Interfaces::NumericPrimitives)
+            {
+                if (!expressionToken.m_information.m_extraStore.is<double>())
+                {
+                    return AZ::Failure(AZStd::string("Numeric Primitive does not contain a numeric value."));
+                }
+
+                operandStack.push_back({ OperandKind::Constant, aznumeric_cast<AZ::u32>(compiledExpression.m_constants.size()) });
+                compiledExpression.m_constants.push_back(AZStd::any_cast<double>(expressionToken.m_information.m_extraStore));
+            }
+            else if (expressionToken.m_parserId == Interfaces::MathOperators)
+            {
+                CompiledExpression::OpCode opCode;
+
+                switch (expressionToken.m_information.m_id)
+                {
+                case MathExpressionOperators::Add:
+                    opCode = CompiledExpression::OpCode::Add;
+                    break;
+                case MathExpressionOperators::Subtract:
+                    opCode = CompiledExpression::OpCode::Subtract;
+                    break;
+                case MathExpressionOperators::Multiply:
+                    opCode = CompiledExpression::OpCode::Multiply;
+                    break;
+                case MathExpressionOperators::Divide:
+                    opCode = CompiledExpression::OpCode::Divide;
+                    break;
+                case MathExpressionOperators::Modulo:
+                    opCode = CompiledExpression::OpCode::Modulo;
+                    break;
+                default:
+                    return AZ::Failure(AZStd::string::format("Unknown Math Operator %i.", expressionToken.m_information.m_id));
+                }
+
+                if (operandStack.size() < 2)
+                {
+                    return AZ::Failure(AZStd::string("Math Operator is missing an operand."));
+                }
+
+                PendingInstruction instruction;
+                instruction.m_opCode = opCode;
+
+                instruction.m_right = operandStack.back();
+                operandStack.pop_back();
+
+                instruction.m_left = operandStack.back();
+                operandStack.pop_back();
+
+                // Temporaries mirror the interpreter's result stack, the result is written to the slot of the depth it is pushed at.
+                instruction.m_target = { OperandKind::Temporary, aznumeric_cast<AZ::u32>(operandStack.size()) };
+                temporaryCount = AZStd::max(temporaryCount, instruction.m_target.m_index + 1);
+
+                operandStack.push_back(instruction.m_target);
+                pendingInstructions.push_back(instruction);
+            }
+            else
+            {
+                return AZ::Failure(AZStd::string::format("Expression elements from parser %u cannot be compiled.", expressionToken.m_parserId));
+            }
+        }
+
+        if (operandStack.size() != 1)
+        {
+            return AZ::Failure(AZStd::string::format("Expression Tree should compile down to a single result. %zu results found.", operandStack.size()));
+        }
+
+        const AZ::u32 constantBase = aznumeric_cast<AZ::u32>(compiledExpression.m_variables.size());
+        const AZ::u32 temporaryBase = constantBase + aznumeric_cast<AZ::u32>(compiledExpression.m_constants.size());
+
+        auto resolveRegister = [constantBase, temporaryBase](const Operand& operand) -> AZ::u32
+        {
+            switch (operand.m_kind)
+            {
+            case OperandKind::Constant:
+                return constantBase + operand.m_index;
+            case OperandKind::Temporary:
+                return temporaryBase + operand.m_index;
+            default:
+                return operand.m_index;
+            }
+        };
+
+        compiledExpression.m_instructions.reserve(pendingInstructions.size());
+
+        for (const PendingInstruction& pendingInstruction : pendingInstructions)
+        {
+            CompiledExpression::Instruction instruction;
+            instruction.m_opCode = pendingInstruction.m_opCode;
+            instruction.m_target = resolveRegister(pendingInstruction.m_target);
+            instruction.m_left = resolveRegister(pendingInstruction.m_left);
+            instruction.m_right = resolveRegister(pendingInstruction.m_right);
+
+            compiledExpression.m_instructions.push_back(instruction);
+        }
+
+        compiledExpression.m_registerCount = temporaryBase + temporaryCount;
+        compiledExpression.m_resultRegister = resolveRegister(operandStack.back());
+
+        return AZ::Success(AZStd::move(compiledExpression));
+    }
+
     AZ::Outcome<void, ParsingError> ExpressionEvaluationSystemComponent::ReportMissingValue(size_t offset) const
     {
         ParsingError parsingError;
@@ -50,6 +50,7 @@ namespace ExpressionEvaluation
 
         EvaluateStringOutcome EvaluateExpression(AZStd::string_view expression) const override;
         ExpressionResult Evaluate(const ExpressionTree& expressionTree) const override;
+        CompileOutcome CompileExpression(const ExpressionTree& expressionTree) const override;
         ////
         
     private:
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <gtest/gtest-param-test.h>
+
+#include <ExpressionEvaluation/ExpressionEngine.h>
+#include <Tests/ExpressionEngineTestFixture.h>
+
+#include <ExpressionEngine/MathOperators/MathExpressionOperators.h>
+
+namespace ExpressionEvaluation
+{
+    using namespace UnitTest;
+
+    TEST_F(ExpressionEngineTestFixture, ExpressionEngine_CompiledTest_ConstantTree)
+    {
+        ExpressionTree tree;
+        PushPrimitive(tree, 2.0);
+        PushPrimitive(tree, 2.0);
+        PushOperator(tree, Interfaces::MathOperators, MathExpressionOperators::AddOperator());
+        PushPrimitive(tree, 4.0);
+        PushPrimitive(tree, 3.0);
+        PushOperator(tree, Interfaces::MathOperators, MathExpressionOperators::SubtractOperator());
+        PushOperator(tree, Interfaces::MathOperators, MathExpressionOperators::MultiplyOperator());
+        PushPrimitive(tree, 2.0);
+        PushOperator(tree, Interfaces::MathOperators, MathExpressionOperators::DivideOperator());
+
+        CompileOutcome compileOutcome = ExpressionEvaluationRequests()->CompileExpression(tree);
+        ASSERT_TRUE(compileOutcome.IsSuccess());
+
+        const CompiledExpression& compiledExpression = compileOutcome.GetValue();
+
+        EXPECT_TRUE(compiledExpression.GetVariables().empty());
+        EXPECT_EQ(compiledExpression.GetInstructions().size(), 4);
+
+        AZ::Outcome<double, void> result = compiledExpression.Evaluate(nullptr);
+        ASSERT_TRUE(result.IsSuccess());
+        EXPECT_EQ(result.GetValue(), ((2.0 + 2.0) * (4.0 - 3.0)) / 2.0);
+    }
+
+    TEST_F(ExpressionEngineTestFixture, ExpressionEngine_CompiledTest_MatchesInterpreter)
+    {
+        const char* expressions[] = {
+            "{A}",
+            "{A}+{B}+{A}",
+            "({A} - 1.5) * ({B} + {C}) / 4",
+            "{C} % 3 + {A} * {A} - {B}",
+            "((({A} * 2) - {B}) / ({C} + 0.5)) * ({A} - ({B} - {C}))"
+        };
+
+        for (const char* expression : expressions)
+        {
+            ParseOutcome parseOutcome = ExpressionEvaluationRequests()->ParseExpression(expression);
+            ASSERT_TRUE(parseOutcome.IsSuccess());
+
+            ExpressionTree& tree = parseOutcome.GetValue();
+
+            CompileOutcome compileOutcome = ExpressionEvaluationRequests()->CompileExpression(tree);
+            ASSERT_TRUE(compileOutcome.IsSuccess());
+
+            const CompiledExpression& compiledExpression = compileOutcome.GetValue();
+            const AZStd::vector<AZStd::string>& variables = compiledExpression.GetVariables();
+
+            EXPECT_EQ(variables, tree.GetVariables());
+
+            // Enough bindings to cover more than one full batch, plus a partial one.
+            const size_t bindingCount = 150;
+
+            AZStd::vector<double> bindings(bindingCount * variables.size());
+            AZStd::vector<double> results(bindingCount);
+            AZStd::vector<bool> resultsValid(bindingCount);
+
+            for (size_t bindingIndex = 0; bindingIndex < bindingCount; ++bindingIndex)
+            {
+                for (size_t variableIndex = 0; variableIndex < variables.size(); ++variableIndex)
+                {
+                    bindings[bindingIndex * variables.size() + variableIndex] = aznumeric_cast<double>(bindingIndex) * 0.25 * aznumeric_cast<double>(variableIndex + 1) + 1.0;
+                }
+            }
+
+            compiledExpression.EvaluateBatch(bindings.data(), bindingCount, results.data(), resultsValid.data());
+
+            for (size_t bindingIndex = 0; bindingIndex < bindingCount; ++bindingIndex)
+            {
+                const double* binding = bindings.data() + bindingIndex * variables.size();
+
+                for (size_t variableIndex = 0; variableIndex < variables.size(); ++variableIndex)
+                {
+                    tree.SetVariable(variables[variableIndex], binding[variableIndex]);
+                }
+
+                ExpressionResult interpretedResult = ExpressionEvaluationRequests()->Evaluate(tree);
+                ConfirmResult<double>(interpretedResult, results[bindingIndex]);
+                EXPECT_TRUE(resultsValid[bindingIndex]);
+
+                AZ::Outcome<double, void> compiledResult = compiledExpression.Evaluate(binding);
+                ASSERT_TRUE(compiledResult.IsSuccess());
+                EXPECT_EQ(compiledResult.GetValue(), results[bindingIndex]);
+            }
+        }
+    }
+
+    TEST_F(ExpressionEngineTestFixture, ExpressionEngine_CompiledTest_DivideByZero)
+    {
+        ParseOutcome parseOutcome = ExpressionEvaluationRequests()->ParseExpression("{A} / {B} + {A} % {B}");
+        ASSERT_TRUE(parseOutcome.IsSuccess());
+
+        CompileOutcome compileOutcome = ExpressionEvaluationRequests()->CompileExpression(parseOutcome.GetValue());
+        ASSERT_TRUE(compileOutcome.IsSuccess());
+
+        const CompiledExpression& compiledExpression = compileOutcome.GetValue();
+
+        const double bindings[] = {
+            7.0, 2.0,
+            7.0, 0.0,
+            7.0, 0.5,
+            -7.0, -2.0
+        };
+
+        double results[4];
+        bool resultsValid[4];
+
+        compiledExpression.EvaluateBatch(bindings, 4, results, resultsValid);
+
+        EXPECT_TRUE(resultsValid[0]);
+        EXPECT_EQ(results[0], 7.0 / 2.0 + 7 % 2);
+
+        EXPECT_FALSE(resultsValid[1]);
+        EXPECT_EQ(results[1], 0.0);
+
+        // The divide is fine, but the modulo divisor truncates to zero.
+        EXPECT_FALSE(resultsValid[2]);
+        EXPECT_EQ(results[2], 0.0);
+
+        EXPECT_TRUE(resultsValid[3]);
+        EXPECT_EQ(results[3], -7.0 / -2.0 + -7 % -2);
+
+        EXPECT_FALSE(compiledExpression.Evaluate(&bindings[2]).IsSuccess());
+    }
+
+    TEST_F(ExpressionEngineTestFixture, ExpressionEngine_CompiledTest_BooleanFail)
+    {
+        ParseOutcome parseOutcome = ExpressionEvaluationRequests()->ParseExpression("true");
+        ASSERT_TRUE(parseOutcome.IsSuccess());
+
+        CompileOutcome compileOutcome = ExpressionEvaluationRequests()->CompileExpression(parseOutcome.GetValue());
+        EXPECT_FALSE(compileOutcome.IsSuccess());
+    }
+
+    TEST_F(ExpressionEngineTestFixture, ExpressionEngine_CompiledTest_EmptyTreeFail)
+    {
+        ExpressionTree tree;
+
+        CompileOutcome compileOutcome = ExpressionEvaluationRequests()->CompileExpression(tree);
+        EXPECT_FALSE(compileOutcome.IsSuccess());
+    }
+}
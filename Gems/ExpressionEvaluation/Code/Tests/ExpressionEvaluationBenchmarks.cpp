@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <ExpressionEvaluation/ExpressionEngine.h>
+#include <ExpressionEvaluationSystemComponent.h>
+#include <ExpressionEngine/Utils.h>
+
+namespace ExpressionEvaluation
+{
+    namespace ExpressionEvaluationBenchmarkSettings
+    {
+        //! Number of variable bindings the expression is evaluated for on every iteration.
+        static const size_t BindingCount = 16 * 1024;
+
+        //! Expression that exercises every math operator on three variables.
+        static const char* Expression = "((({A} * 2) - {B}) / ({C} + 0.5)) * ({A} - {B}) + {C} % 3";
+    } // namespace ExpressionEvaluationBenchmarkSettings
+
+    //! Parses and compiles the benchmark expression and generates random variable bindings to evaluate it with.
+    class ExpressionEvaluationBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+        void internalSetUp()
+        {
+            m_systemComponent = aznew ExpressionEvaluationSystemComponent();
+            m_systemComponent->Init();
+            m_systemComponent->Activate();
+
+            m_tree = m_systemComponent->ParseExpression(ExpressionEvaluationBenchmarkSettings::Expression).TakeValue();
+            m_compiledExpression = m_systemComponent->CompileExpression(m_tree).TakeValue();
+
+            const size_t variableCount = m_tree.GetVariables().size();
+
+            AZ::SimpleLcgRandom random(1234);
+            m_bindings.resize(ExpressionEvaluationBenchmarkSettings::BindingCount * variableCount);
+            for (double& value : m_bindings)
+            {
+                value = 1.0 + random.GetRandomFloat() * 100.0;
+            }
+
+            m_results.resize(ExpressionEvaluationBenchmarkSettings::BindingCount);
+        }
+
+        void internalTearDown()
+        {
+            m_tree = {};
+            m_compiledExpression = {};
+            m_bindings = {};
+            m_results = {};
+
+            m_systemComponent->Deactivate();
+            delete m_systemComponent;
+            m_systemComponent = nullptr;
+        }
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        ExpressionEvaluationSystemComponent* m_systemComponent = nullptr;
+        ExpressionTree m_tree;
+        CompiledExpression m_compiledExpression;
+        AZStd::vector<double> m_bindings;
+        AZStd::vector<double> m_results;
+    };
+
+    //! Binds the variables on the tree and runs the interpreter once per binding.
+    BENCHMARK_DEFINE_F(ExpressionEvaluationBenchmarkFixture, BM_InterpretedEvaluate)(benchmark::State& state)
+    {
+        const AZStd::vector<AZStd::string> variables = m_tree.GetVariables();
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t bindingIndex = 0; bindingIndex < ExpressionEvaluationBenchmarkSettings::BindingCount; ++bindingIndex)
+            {
+                const double* binding = m_bindings.data() + bindingIndex * variables.size();
+
+                for (size_t variableIndex = 0; variableIndex < variables.size(); ++variableIndex)
+                {
+                    m_tree.SetVariable(variables[variableIndex], binding[variableIndex]);
+                }
+
+                m_results[bindingIndex] = Utils::GetAnyValue<double>(m_systemComponent->Evaluate(m_tree));
+            }
+            benchmark::DoNotOptimize(m_results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * ExpressionEvaluationBenchmarkSettings::BindingCount);
+    }
+
+    //! Runs the compiled expression once per binding.
+    BENCHMARK_DEFINE_F(ExpressionEvaluationBenchmarkFixture, BM_CompiledEvaluate)(benchmark::State& state)
+    {
+        const size_t variableCount = m_compiledExpression.GetVariables().size();
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t bindingIndex = 0; bindingIndex < ExpressionEvaluationBenchmarkSettings::BindingCount; ++bindingIndex)
+            {
+                m_results[bindingIndex] = m_compiledExpression.Evaluate(m_bindings.data() + bindingIndex * variableCount).GetValueOr(0.0);
+            }
+            benchmark::DoNotOptimize(m_results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * ExpressionEvaluationBenchmarkSettings::BindingCount);
+    }
+
+    //! Runs the compiled expression over all the bindings with a single batched call.
+    BENCHMARK_DEFINE_F(ExpressionEvaluationBenchmarkFixture, BM_CompiledEvaluateBatch)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_compiledExpression.EvaluateBatch(m_bindings.data(), ExpressionEvaluationBenchmarkSettings::BindingCount, m_results.data());
+            benchmark::DoNotOptimize(m_results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * ExpressionEvaluationBenchmarkSettings::BindingCount);
+    }
+
+    BENCHMARK_REGISTER_F(ExpressionEvaluationBenchmarkFixture, BM_InterpretedEvaluate)
+        ->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(ExpressionEvaluationBenchmarkFixture, BM_CompiledEvaluate)
+        ->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(ExpressionEvaluationBenchmarkFixture, BM_CompiledEvaluateBatch)
+        ->Unit(benchmark::kMillisecond);
+} // namespace ExpressionEvaluation
+#endif // HAVE_BENCHMARK
@@ -9,12 +9,14 @@
 set(FILES
     Include/ExpressionEvaluation/ExpressionEvaluationBus.h
     Include/ExpressionEvaluation/ExpressionEngine.h
+    Include/ExpressionEvaluation/ExpressionEngine/CompiledExpression.h
     Include/ExpressionEvaluation/ExpressionEngine/ExpressionTree.h
     Include/ExpressionEvaluation/ExpressionEngine/ExpressionTypes.h
     Source/ExpressionEvaluationSystemComponent.cpp
     Source/ExpressionEvaluationSystemComponent.h
     Source/ExpressionPrimitivesSerializers.inl
     Source/ElementInformationSerializer.inl
+    Source/ExpressionEngine/CompiledExpression.cpp
     Source/ExpressionEngine/ExpressionElementParser.h
     Source/ExpressionEngine/ExpressionPrimitive.cpp
     Source/ExpressionEngine/ExpressionPrimitive.h
@@ -7,8 +7,10 @@
 #
 
 set(FILES
+    Tests/CompiledExpressionTests.cpp
     Tests/ExpressionEngineTestFixture.h
     Tests/ExpressionEngineTests.cpp
+    Tests/ExpressionEvaluationBenchmarks.cpp
     Tests/ExpressionEvaluationGemTest.cpp
     Tests/MathExpressionTests.cpp
 )
@@ -33,6 +33,8 @@
 #include <math.h>
 #include <assert.h>
 
+#include <AzCore/Math/SimdMath.h>
+
 #include <algorithm>
 #include <random>
 
@@ -2258,3 +2260,719 @@ void FastNoise::SingleGradientPerturb(unsigned char offset, FN_DECIMAL warpAmp,
     x += Lerp(lx0x, lx1x, ys) * warpAmp;
     y += Lerp(ly0x, ly1x, ys) * warpAmp;
 }
+
+// Batched Noise
+#ifndef FN_USE_DOUBLES
+namespace FastNoiseLanes
+{
+    using AZ::Simd::Vec4;
+    using FloatType = Vec4::FloatType;
+    using FloatArgType = Vec4::FloatArgType;
+    using Int32Type = Vec4::Int32Type;
+    using Int32ArgType = Vec4::Int32ArgType;
+
+    static const int LaneCount = static_cast<int>(Vec4::ElementCount);
+
+    // Integer lattice coordinates of every lane, masked to the permutation table range
+    struct LaneCoords
+    {
+        alignas(16) int32_t m_values[LaneCount];
+
+        AZ_FORCE_INLINE void Store(Int32ArgType coords)
+        {
+            Vec4::StoreAligned(m_values, Vec4::And(coords, Vec4::Splat(static_cast<int32_t>(0xff))));
+        }
+    };
+
+    // Matches FastFloor(), including negative whole numbers flooring to the integer below them
+    AZ_FORCE_INLINE static Int32Type FloorLanes(FloatArgType f)
+    {
+        const FloatType negative = Vec4::CmpLt(f, Vec4::ZeroFloat());
+        return Vec4::Add(Vec4::ConvertToInt(f), Vec4::CastToInt(negative));
+    }
+
+    AZ_FORCE_INLINE static FloatType LerpLanes(FloatArgType a, FloatArgType b, FloatArgType t)
+    {
+        return Vec4::Add(a, Vec4::Mul(t, Vec4::Sub(b, a)));
+    }
+
+    AZ_FORCE_INLINE static FloatType InterpLanes(FastNoise::Interp interp, FloatArgType t)
+    {
+        switch (interp)
+        {
+        case FastNoise::Hermite:
+            return Vec4::Mul(Vec4::Mul(t, t), Vec4::Sub(Vec4::Splat(3.0f), Vec4::Mul(Vec4::Splat(2.0f), t)));
+        case FastNoise::Quintic:
+        {
+            const FloatType inner = Vec4::Add(Vec4::Mul(t, Vec4::Sub(Vec4::Mul(t, Vec4::Splat(6.0f)), Vec4::Splat(15.0f))), Vec4::Splat(10.0f));
+            return Vec4::Mul(Vec4::Mul(Vec4::Mul(t, t), t), inner);
+        }
+        default:
+            return t;
+        }
+    }
+
+    AZ_FORCE_INLINE static FloatType CubicLerpLanes(FloatArgType a, FloatArgType b, FloatArgType c, FloatArgType d, FloatArgType t)
+    {
+        const FloatType aMinusB = Vec4::Sub(a, b);
+        const FloatType p = Vec4::Sub(Vec4::Sub(d, c), aMinusB);
+        const FloatType tt = Vec4::Mul(t, t);
+        FloatType result = Vec4::Mul(Vec4::Mul(tt, t), p);
+        result = Vec4::Add(result, Vec4::Mul(tt, Vec4::Sub(aMinusB, p)));
+        result = Vec4::Add(result, Vec4::Mul(t, Vec4::Sub(c, a)));
+        return Vec4::Add(result, b);
+    }
+
+    // The permutation table lookups have no portable gather instruction, so they are resolved one lane at a time
+    // and everything around them stays in SIMD registers.
+    // RowHashLanes() resolves perm[y + perm[z + offset]] once per lattice row so the x corners of that row only pay for the last lookup
+    AZ_FORCE_INLINE static LaneCoords RowHashLanes(const unsigned char* perm, unsigned char offset, const LaneCoords& y, const LaneCoords& z)
+    {
+        LaneCoords row;
+        for (int lane = 0; lane < LaneCount; ++lane)
+        {
+            row.m_values[lane] = perm[y.m_values[lane] + perm[z.m_values[lane] + offset]];
+        }
+        return row;
+    }
+
+    AZ_FORCE_INLINE static FloatType ValCoordLanes(const unsigned char* perm, const LaneCoords& x, const LaneCoords& row)
+    {
+        alignas(16) float values[LaneCount];
+        for (int lane = 0; lane < LaneCount; ++lane)
+        {
+            values[lane] = VAL_LUT[perm[x.m_values[lane] + row.m_values[lane]]];
+        }
+        return Vec4::LoadAligned(values);
+    }
+
+    AZ_FORCE_INLINE static FloatType GradCoordLanes(const unsigned char* perm12, const LaneCoords& x, const LaneCoords& row, FloatArgType xd, FloatArgType yd, FloatArgType zd)
+    {
+        alignas(16) float gradX[LaneCount];
+        alignas(16) float gradY[LaneCount];
+        alignas(16) float gradZ[LaneCount];
+        for (int lane = 0; lane < LaneCount; ++lane)
+        {
+            const unsigned char lutPos = perm12[x.m_values[lane] + row.m_values[lane]];
+            gradX[lane] = GRAD_X[lutPos];
+            gradY[lane] = GRAD_Y[lutPos];
+            gradZ[lane] = GRAD_Z[lutPos];
+        }
+        const FloatType dotXY = Vec4::Add(Vec4::Mul(xd, Vec4::LoadAligned(gradX)), Vec4::Mul(yd, Vec4::LoadAligned(gradY)));
+        return Vec4::Add(dotXY, Vec4::Mul(zd, Vec4::LoadAligned(gradZ)));
+    }
+
+    AZ_FORCE_INLINE static FloatType SingleValueLanes(const unsigned char* perm, FastNoise::Interp interp, unsigned char offset, FloatArgType x, FloatArgType y, FloatArgType z)
+    {
+        const Int32Type one = Vec4::Splat(static_cast<int32_t>(1));
+        const Int32Type x0 = FloorLanes(x);
+        const Int32Type y0 = FloorLanes(y);
+        const Int32Type z0 = FloorLanes(z);
+
+        LaneCoords cx0, cy0, cz0, cx1, cy1, cz1;
+        cx0.Store(x0);
+        cy0.Store(y0);
+        cz0.Store(z0);
+        cx1.Store(Vec4::Add(x0, one));
+        cy1.Store(Vec4::Add(y0, one));
+        cz1.Store(Vec4::Add(z0, one));
+
+        const FloatType xs = InterpLanes(interp, Vec4::Sub(x, Vec4::ConvertToFloat(x0)));
+        const FloatType ys = InterpLanes(interp, Vec4::Sub(y, Vec4::ConvertToFloat(y0)));
+        const FloatType zs = InterpLanes(interp, Vec4::Sub(z, Vec4::ConvertToFloat(z0)));
+
+        const LaneCoords row00 = RowHashLanes(perm, offset, cy0, cz0);
+        const LaneCoords row10 = RowHashLanes(perm, offset, cy1, cz0);
+        const LaneCoords row01 = RowHashLanes(perm, offset, cy0, cz1);
+        const LaneCoords row11 = RowHashLanes(perm, offset, cy1, cz1);
+
+        const FloatType xf00 = LerpLanes(ValCoordLanes(perm, cx0, row00), ValCoordLanes(perm, cx1, row00), xs);
+        const FloatType xf10 = LerpLanes(ValCoordLanes(perm, cx0, row10), ValCoordLanes(perm, cx1, row10), xs);
+        const FloatType xf01 = LerpLanes(ValCoordLanes(perm, cx0, row01), ValCoordLanes(perm, cx1, row01), xs);
+        const FloatType xf11 = LerpLanes(ValCoordLanes(perm, cx0, row11), ValCoordLanes(perm, cx1, row11), xs);
+
+        const FloatType yf0 = LerpLanes(xf00, xf10, ys);
+        const FloatType yf1 = LerpLanes(xf01, xf11, ys);
+
+        return LerpLanes(yf0, yf1, zs);
+    }
+
+    AZ_FORCE_INLINE static FloatType SinglePerlinLanes(
+        const unsigned char* perm, const unsigned char* perm12, FastNoise::Interp interp, unsigned char offset, FloatArgType x, FloatArgType y, FloatArgType z)
+    {
+        const Int32Type one = Vec4::Splat(static_cast<int32_t>(1));
+        const Int32Type x0 = FloorLanes(x);
+        const Int32Type y0 = FloorLanes(y);
+        const Int32Type z0 = FloorLanes(z);
+
+        LaneCoords cx0, cy0, cz0, cx1, cy1, cz1;
+        cx0.Store(x0);
+        cy0.Store(y0);
+        cz0.Store(z0);
+        cx1.Store(Vec4::Add(x0, one));
+        cy1.Store(Vec4::Add(y0, one));
+        cz1.Store(Vec4::Add(z0, one));
+
+        const FloatType xd0 = Vec4::Sub(x, Vec4::ConvertToFloat(x0));
+        const FloatType yd0 = Vec4::Sub(y, Vec4::ConvertToFloat(y0));
+        const FloatType zd0 = Vec4::Sub(z, Vec4::ConvertToFloat(z0));
+        const FloatType xd1 = Vec4::Sub(xd0, Vec4::Splat(1.0f));
+        const FloatType yd1 = Vec4::Sub(yd0, Vec4::Splat(1.0f));
+        const FloatType zd1 = Vec4::Sub(zd0, Vec4::Splat(1.0f));
+
+        const FloatType xs = InterpLanes(interp, xd0);
+        const FloatType ys = InterpLanes(interp, yd0);
+        const FloatType zs = InterpLanes(interp, zd0);
+
+        const LaneCoords row00 = RowHashLanes(perm, offset, cy0, cz0);
+        const LaneCoords row10 = RowHashLanes(perm, offset, cy1, cz0);
+        const LaneCoords row01 = RowHashLanes(perm, offset, cy0, cz1);
+        const LaneCoords row11 = RowHashLanes(perm, offset, cy1, cz1);
+
+        const FloatType xf00 = LerpLanes(GradCoordLanes(perm12, cx0, row00, xd0, yd0, zd0), GradCoordLanes(perm12, cx1, row00, xd1, yd0, zd0), xs);
+        const FloatType xf10 = LerpLanes(GradCoordLanes(perm12, cx0, row10, xd0, yd1, zd0), GradCoordLanes(perm12, cx1, row10, xd1, yd1, zd0), xs);
+        const FloatType xf01 = LerpLanes(GradCoordLanes(perm12, cx0, row01, xd0, yd0, zd1), GradCoordLanes(perm12, cx1, row01, xd1, yd0, zd1), xs);
+        const FloatType xf11 = LerpLanes(GradCoordLanes(perm12, cx0, row11, xd0, yd1, zd1), GradCoordLanes(perm12, cx1, row11, xd1, yd1, zd1), xs);
+
+        const FloatType yf0 = LerpLanes(xf00, xf10, ys);
+        const FloatType yf1 = LerpLanes(xf01, xf11, ys);
+
+        return LerpLanes(yf0, yf1, zs);
+    }
+
+    // Contribution of one simplex corner, zero where the corner is out of range for a lane
+    AZ_FORCE_INLINE static FloatType SimplexCornerLanes(
+        const unsigned char* perm, const unsigned char* perm12, unsigned char offset,
+        Int32ArgType i, Int32ArgType j, Int32ArgType k, FloatArgType x, FloatArgType y, FloatArgType z)
+    {
+        FloatType t = Vec4::Sub(Vec4::Splat(0.6f), Vec4::Mul(x, x));
+        t = Vec4::Sub(t, Vec4::Mul(y, y));
+        t = Vec4::Sub(t, Vec4::Mul(z, z));
+
+        const FloatType outOfRange = Vec4::CmpLt(t, Vec4::ZeroFloat());
+        if (Vec4::CmpAllLt(t, Vec4::ZeroFloat()))
+        {
+            return Vec4::ZeroFloat();
+        }
+
+        LaneCoords ci, cj, ck;
+        ci.Store(i);
+        cj.Store(j);
+        ck.Store(k);
+
+        const FloatType tt = Vec4::Mul(t, t);
+        const FloatType n = Vec4::Mul(Vec4::Mul(tt, tt), GradCoordLanes(perm12, ci, RowHashLanes(perm, offset, cj, ck), x, y, z));
+        return Vec4::Select(Vec4::ZeroFloat(), n, outOfRange);
+    }
+
+    AZ_FORCE_INLINE static FloatType SingleSimplexLanes(const unsigned char* perm, const unsigned char* perm12, unsigned char offset, FloatArgType x, FloatArgType y, FloatArgType z)
+    {
+        const FloatType one = Vec4::Splat(1.0f);
+        const Int32Type oneInt = Vec4::Splat(static_cast<int32_t>(1));
+
+        FloatType t = Vec4::Mul(Vec4::Add(Vec4::Add(x, y), z), Vec4::Splat(F3));
+        const Int32Type i = FloorLanes(Vec4::Add(x, t));
+        const Int32Type j = FloorLanes(Vec4::Add(y, t));
+        const Int32Type k = FloorLanes(Vec4::Add(z, t));
+
+        t = Vec4::Mul(Vec4::ConvertToFloat(Vec4::Add(Vec4::Add(i, j), k)), Vec4::Splat(G3));
+        const FloatType x0 = Vec4::Sub(x, Vec4::Sub(Vec4::ConvertToFloat(i), t));
+        const FloatType y0 = Vec4::Sub(y, Vec4::Sub(Vec4::ConvertToFloat(j), t));
+        const FloatType z0 = Vec4::Sub(z, Vec4::Sub(Vec4::ConvertToFloat(k), t));
+
+        // Branchless form of the simplex corner ordering in SingleSimplex()
+        const FloatType xGeY = Vec4::CmpGtEq(x0, y0);
+        const FloatType yGeZ = Vec4::CmpGtEq(y0, z0);
+        const FloatType xGeZ = Vec4::CmpGtEq(x0, z0);
+
+        const FloatType i1 = Vec4::And(Vec4::And(xGeY, Vec4::Or(yGeZ, xGeZ)), one);
+        const FloatType j1 = Vec4::And(Vec4::AndNot(xGeY, yGeZ), one);
+        const FloatType k1 = Vec4::AndNot(Vec4::Or(yGeZ, Vec4::And(xGeY, xGeZ)), one);
+        const FloatType i2 = Vec4::And(Vec4::Or(xGeY, xGeZ), one);
+        const FloatType j2 = Vec4::AndNot(Vec4::AndNot(yGeZ, xGeY), one);
+        const FloatType k2 = Vec4::AndNot(Vec4::And(yGeZ, Vec4::Or(xGeY, xGeZ)), one);
+
+        const FloatType g1 = Vec4::Splat(G3);
+        const FloatType g2 = Vec4::Splat(2 * G3);
+        const FloatType g3 = Vec4::Splat(3 * G3);
+
+        const FloatType x1 = Vec4::Add(Vec4::Sub(x0, i1), g1);
+        const FloatType y1 = Vec4::Add(Vec4::Sub(y0, j1), g1);
+        const FloatType z1 = Vec4::Add(Vec4::Sub(z0, k1), g1);
+        const FloatType x2 = Vec4::Add(Vec4::Sub(x0, i2), g2);
+        const FloatType y2 = Vec4::Add(Vec4::Sub(y0, j2), g2);
+        const FloatType z2 = Vec4::Add(Vec4::Sub(z0, k2), g2);
+        const FloatType x3 = Vec4::Add(Vec4::Sub(x0, one), g3);
+        const FloatType y3 = Vec4::Add(Vec4::Sub(y0, one), g3);
+        const FloatType z3 = Vec4::Add(Vec4::Sub(z0, one), g3);
+
+        const FloatType n0 = SimplexCornerLanes(perm, perm12, offset, i, j, k, x0, y0, z0);
+        const FloatType n1 = SimplexCornerLanes(perm, perm12, offset,
+            Vec4::Add(i, Vec4::ConvertToInt(i1)), Vec4::Add(j, Vec4::ConvertToInt(j1)), Vec4::Add(k, Vec4::ConvertToInt(k1)), x1, y1, z1);
+        const FloatType n2 = SimplexCornerLanes(perm, perm12, offset,
+            Vec4::Add(i, Vec4::ConvertToInt(i2)), Vec4::Add(j, Vec4::ConvertToInt(j2)), Vec4::Add(k, Vec4::ConvertToInt(k2)), x2, y2, z2);
+        const FloatType n3 = SimplexCornerLanes(perm, perm12, offset,
+            Vec4::Add(i, oneInt), Vec4::Add(j, oneInt), Vec4::Add(k, oneInt), x3, y3, z3);
+
+        return Vec4::Mul(Vec4::Splat(32.0f), Vec4::Add(Vec4::Add(Vec4::Add(n0, n1), n2), n3));
+    }
+
+    AZ_FORCE_INLINE static FloatType SingleCubicLanes(const unsigned char* perm, unsigned char offset, FloatArgType x, FloatArgType y, FloatArgType z)
+    {
+        const Int32Type x1 = FloorLanes(x);
+        const Int32Type y1 = FloorLanes(y);
+        const Int32Type z1 = FloorLanes(z);
+
+        LaneCoords cx[4], cy[4], cz[4];
+        for (int32_t corner = 0; corner < 4; ++corner)
+        {
+            const Int32Type cornerOffset = Vec4::Splat(corner - 1);
+            cx[corner].Store(Vec4::Add(x1, cornerOffset));
+            cy[corner].Store(Vec4::Add(y1, cornerOffset));
+            cz[corner].Store(Vec4::Add(z1, cornerOffset));
+        }
+
+        const FloatType xs = Vec4::Sub(x, Vec4::ConvertToFloat(x1));
+        const FloatType ys = Vec4::Sub(y, Vec4::ConvertToFloat(y1));
+        const FloatType zs = Vec4::Sub(z, Vec4::ConvertToFloat(z1));
+
+        FloatType zValues[4];
+        for (int zi = 0; zi < 4; ++zi)
+        {
+            FloatType yValues[4];
+            for (int yi = 0; yi < 4; ++yi)
+            {
+                const LaneCoords row = RowHashLanes(perm, offset, cy[yi], cz[zi]);
+                yValues[yi] = CubicLerpLanes(
+                    ValCoordLanes(perm, cx[0], row), ValCoordLanes(perm, cx[1], row), ValCoordLanes(perm, cx[2], row), ValCoordLanes(perm, cx[3], row), xs);
+            }
+            zValues[zi] = CubicLerpLanes(yValues[0], yValues[1], yValues[2], yValues[3], ys);
+        }
+
+        return Vec4::Mul(CubicLerpLanes(zValues[0], zValues[1], zValues[2], zValues[3], zs), Vec4::Splat(CUBIC_3D_BOUNDING));
+    }
+
+    // Matches FastRound(), halfway cases round away from zero
+    AZ_FORCE_INLINE static Int32Type RoundLanes(FloatArgType f)
+    {
+        const FloatType half = Vec4::Select(Vec4::Splat(-0.5f), Vec4::Splat(0.5f), Vec4::CmpLt(f, Vec4::ZeroFloat()));
+        return Vec4::ConvertToInt(Vec4::Add(f, half));
+    }
+
+    // Lane version of ValCoord3D(), the hash wraps around the same way in 32 bit integer lanes
+    AZ_FORCE_INLINE static FloatType ValCoord3DLanes(int seed, Int32ArgType x, Int32ArgType y, Int32ArgType z)
+    {
+        Int32Type n = Vec4::Splat(static_cast<int32_t>(seed));
+        n = Vec4::Xor(n, Vec4::Mul(Vec4::Splat(static_cast<int32_t>(X_PRIME)), x));
+        n = Vec4::Xor(n, Vec4::Mul(Vec4::Splat(static_cast<int32_t>(Y_PRIME)), y));
+        n = Vec4::Xor(n, Vec4::Mul(Vec4::Splat(static_cast<int32_t>(Z_PRIME)), z));
+
+        const Int32Type hash = Vec4::Mul(Vec4::Mul(Vec4::Mul(n, n), n), Vec4::Splat(static_cast<int32_t>(60493)));
+        return Vec4::Mul(Vec4::ConvertToFloat(hash), Vec4::Splat(1.0f / 2147483648.0f));
+    }
+
+    // The 3x3x3 cells around the closest cell of every lane, see SingleCellular().
+    // The row hashes only depend on the y and z offsets so they are resolved once for the 9 rows instead of once per cell
+    struct CellNeighbourhoodLanes
+    {
+        AZ_FORCE_INLINE CellNeighbourhoodLanes(const unsigned char* perm, FloatArgType x, FloatArgType y, FloatArgType z)
+        {
+            const Int32Type xr = RoundLanes(x);
+            const Int32Type yr = RoundLanes(y);
+            const Int32Type zr = RoundLanes(z);
+
+            LaneCoords cy[3], cz[3];
+            for (int32_t offset = 0; offset < 3; ++offset)
+            {
+                const Int32Type offsetLanes = Vec4::Splat(offset - 1);
+                m_cellX[offset] = Vec4::Add(xr, offsetLanes);
+                m_cellY[offset] = Vec4::Add(yr, offsetLanes);
+                m_cellZ[offset] = Vec4::Add(zr, offsetLanes);
+
+                m_coordsX[offset].Store(m_cellX[offset]);
+                cy[offset].Store(m_cellY[offset]);
+                cz[offset].Store(m_cellZ[offset]);
+
+                m_deltaX[offset] = Vec4::Sub(Vec4::ConvertToFloat(m_cellX[offset]), x);
+                m_deltaY[offset] = Vec4::Sub(Vec4::ConvertToFloat(m_cellY[offset]), y);
+                m_deltaZ[offset] = Vec4::Sub(Vec4::ConvertToFloat(m_cellZ[offset]), z);
+            }
+
+            for (int yi = 0; yi < 3; ++yi)
+            {
+                for (int zi = 0; zi < 3; ++zi)
+                {
+                    m_rows[yi][zi] = RowHashLanes(perm, 0, cy[yi], cz[zi]);
+                }
+            }
+        }
+
+        // Jittered position of the cell at xi, yi, zi in [0, 3) relative to the sample point
+        AZ_FORCE_INLINE void GetCellVector(
+            const unsigned char* perm, FloatArgType jitter, int xi, int yi, int zi, FloatType& vecX, FloatType& vecY, FloatType& vecZ) const
+        {
+            const LaneCoords& cx = m_coordsX[xi];
+            const LaneCoords& row = m_rows[yi][zi];
+
+            // Built from registers rather than reloaded from a lane array, the cell vector is needed straight away
+            static_assert(LaneCount == 4, "The cell vector lookup assumes 4 lanes");
+            const unsigned char lutPos0 = perm[cx.m_values[0] + row.m_values[0]];
+            const unsigned char lutPos1 = perm[cx.m_values[1] + row.m_values[1]];
+            const unsigned char lutPos2 = perm[cx.m_values[2] + row.m_values[2]];
+            const unsigned char lutPos3 = perm[cx.m_values[3] + row.m_values[3]];
+            const FloatType cellX = Vec4::LoadImmediate(CELL_3D_X[lutPos0], CELL_3D_X[lutPos1], CELL_3D_X[lutPos2], CELL_3D_X[lutPos3]);
+            const FloatType cellY = Vec4::LoadImmediate(CELL_3D_Y[lutPos0], CELL_3D_Y[lutPos1], CELL_3D_Y[lutPos2], CELL_3D_Y[lutPos3]);
+            const FloatType cellZ = Vec4::LoadImmediate(CELL_3D_Z[lutPos0], CELL_3D_Z[lutPos1], CELL_3D_Z[lutPos2], CELL_3D_Z[lutPos3]);
+
+            vecX = Vec4::Add(m_deltaX[xi], Vec4::Mul(cellX, jitter));
+            vecY = Vec4::Add(m_deltaY[yi], Vec4::Mul(cellY, jitter));
+            vecZ = Vec4::Add(m_deltaZ[zi], Vec4::Mul(cellZ, jitter));
+        }
+
+        Int32Type m_cellX[3], m_cellY[3], m_cellZ[3];
+        FloatType m_deltaX[3], m_deltaY[3], m_deltaZ[3];
+        LaneCoords m_coordsX[3];
+        LaneCoords m_rows[3][3];
+    };
+
+    template<FastNoise::CellularDistanceFunction DistanceFunction>
+    AZ_FORCE_INLINE static FloatType CellDistanceLanes(FloatArgType vecX, FloatArgType vecY, FloatArgType vecZ)
+    {
+        const FloatType manhattan = Vec4::Add(Vec4::Add(Vec4::Abs(vecX), Vec4::Abs(vecY)), Vec4::Abs(vecZ));
+        const FloatType euclidean = Vec4::Add(Vec4::Add(Vec4::Mul(vecX, vecX), Vec4::Mul(vecY, vecY)), Vec4::Mul(vecZ, vecZ));
+        switch (DistanceFunction)
+        {
+        case FastNoise::Euclidean:
+            return euclidean;
+        case FastNoise::Manhattan:
+            return manhattan;
+        default:
+            return Vec4::Add(manhattan, euclidean);
+        }
+    }
+
+    struct CellularParams
+    {
+        const unsigned char* m_perm;
+        int m_seed;
+        float m_jitter;
+        FastNoise::CellularReturnType m_returnType;
+        int m_distanceIndex0;
+        int m_distanceIndex1;
+    };
+
+    // Lane version of SingleCellular() for the CellValue and Distance return types
+    template<FastNoise::CellularDistanceFunction DistanceFunction>
+    AZ_FORCE_INLINE static FloatType SingleCellularLanes(const CellularParams& params, FloatArgType x, FloatArgType y, FloatArgType z)
+    {
+        const CellNeighbourhoodLanes cells(params.m_perm, x, y, z);
+        const FloatType jitter = Vec4::Splat(params.m_jitter);
+
+        FloatType distance = Vec4::Splat(999999.0f);
+        Int32Type xc = Vec4::ZeroInt();
+        Int32Type yc = Vec4::ZeroInt();
+        Int32Type zc = Vec4::ZeroInt();
+
+        // Same cell order as the scalar search, so a tie keeps the same closest cell
+        for (int xi = 0; xi < 3; ++xi)
+        {
+            for (int yi = 0; yi < 3; ++yi)
+            {
+                for (int zi = 0; zi < 3; ++zi)
+                {
+                    FloatType vecX, vecY, vecZ;
+                    cells.GetCellVector(params.m_perm, jitter, xi, yi, zi, vecX, vecY, vecZ);
+                    const FloatType newDistance = CellDistanceLanes<DistanceFunction>(vecX, vecY, vecZ);
+
+                    const FloatType closer = Vec4::CmpLt(newDistance, distance);
+                    const Int32Type closerInt = Vec4::CastToInt(closer);
+                    distance = Vec4::Select(newDistance, distance, closer);
+                    xc = Vec4::Select(cells.m_cellX[xi], xc, closerInt);
+                    yc = Vec4::Select(cells.m_cellY[yi], yc, closerInt);
+                    zc = Vec4::Select(cells.m_cellZ[zi], zc, closerInt);
+                }
+            }
+        }
+
+        switch (params.m_returnType)
+        {
+        case FastNoise::CellValue:
+            return ValCoord3DLanes(params.m_seed, xc, yc, zc);
+        case FastNoise::Distance:
+            return distance;
+        default:
+            return Vec4::ZeroFloat();
+        }
+    }
+
+    // Lane version of SingleCellular2Edge()
+    template<FastNoise::CellularDistanceFunction DistanceFunction>
+    AZ_FORCE_INLINE static FloatType SingleCellular2EdgeLanes(const CellularParams& params, FloatArgType x, FloatArgType y, FloatArgType z)
+    {
+        const CellNeighbourhoodLanes cells(params.m_perm, x, y, z);
+        const FloatType jitter = Vec4::Splat(params.m_jitter);
+
+        FloatType distance[FN_CELLULAR_INDEX_MAX + 1];
+        for (FloatType& distanceLanes : distance)
+        {
+            distanceLanes = Vec4::Splat(999999.0f);
+        }
+
+        for (int xi = 0; xi < 3; ++xi)
+        {
+            for (int yi = 0; yi < 3; ++yi)
+            {
+                for (int zi = 0; zi < 3; ++zi)
+                {
+                    FloatType vecX, vecY, vecZ;
+                    cells.GetCellVector(params.m_perm, jitter, xi, yi, zi, vecX, vecY, vecZ);
+                    const FloatType newDistance = CellDistanceLanes<DistanceFunction>(vecX, vecY, vecZ);
+
+                    for (int i = params.m_distanceIndex1; i > 0; i--)
+                    {
+                        distance[i] = Vec4::Max(Vec4::Min(distance[i], newDistance), distance[i - 1]);
+                    }
+                    distance[0] = Vec4::Min(distance[0], newDistance);
+                }
+            }
+        }
+
+        const FloatType distance0 = distance[params.m_distanceIndex0];
+        const FloatType distance1 = distance[params.m_distanceIndex1];
+        switch (params.m_returnType)
+        {
+        case FastNoise::Distance2:
+            return distance1;
+        case FastNoise::Distance2Add:
+            return Vec4::Add(distance1, distance0);
+        case FastNoise::Distance2Sub:
+            return Vec4::Sub(distance1, distance0);
+        case FastNoise::Distance2Mul:
+            return Vec4::Mul(distance1, distance0);
+        case FastNoise::Distance2Div:
+            return Vec4::Div(distance0, distance1);
+        default:
+            return Vec4::ZeroFloat();
+        }
+    }
+
+    // Lane version of GetWhiteNoise(), the coordinates are hashed from their bits.
+    // Vec4 has no integer shift, so only the bits ^ (bits >> 16) step is done one lane at a time
+    AZ_FORCE_INLINE static Int32Type WhiteNoiseBitsLanes(FloatArgType f)
+    {
+        alignas(16) int32_t bits[LaneCount];
+        Vec4::StoreAligned(bits, Vec4::CastToInt(f));
+        for (int lane = 0; lane < LaneCount; ++lane)
+        {
+            bits[lane] ^= bits[lane] >> 16;
+        }
+        return Vec4::LoadAligned(bits);
+    }
+
+    AZ_FORCE_INLINE static FloatType WhiteNoiseLanes(int seed, FloatArgType x, FloatArgType y, FloatArgType z)
+    {
+        return ValCoord3DLanes(seed, WhiteNoiseBitsLanes(x), WhiteNoiseBitsLanes(y), WhiteNoiseBitsLanes(z));
+    }
+
+    struct FractalParams
+    {
+        const unsigned char* m_perm;
+        FastNoise::FractalType m_type;
+        int m_octaves;
+        float m_lacunarity;
+        float m_gain;
+        float m_bounding;
+    };
+
+    // Lane version of the Single*Fractal{FBM,Billow,RigidMulti} drivers, singleLanes(offset, x, y, z) evaluates one octave
+    template<typename SingleLanes>
+    AZ_FORCE_INLINE static FloatType FractalLanes(const FractalParams& params, FloatType x, FloatType y, FloatType z, const SingleLanes& singleLanes)
+    {
+        const FloatType one = Vec4::Splat(1.0f);
+        const FloatType two = Vec4::Splat(2.0f);
+        const FloatType lacunarity = Vec4::Splat(params.m_lacunarity);
+        float amp = 1;
+
+        switch (params.m_type)
+        {
+        case FastNoise::FBM:
+        {
+            FloatType sum = singleLanes(params.m_perm[0], x, y, z);
+            for (int i = 1; i < params.m_octaves; ++i)
+            {
+                x = Vec4::Mul(x, lacunarity);
+                y = Vec4::Mul(y, lacunarity);
+                z = Vec4::Mul(z, lacunarity);
+
+                amp *= params.m_gain;
+                sum = Vec4::Add(sum, Vec4::Mul(singleLanes(params.m_perm[i], x, y, z), Vec4::Splat(amp)));
+            }
+            return Vec4::Mul(sum, Vec4::Splat(params.m_bounding));
+        }
+        case FastNoise::Billow:
+        {
+            FloatType sum = Vec4::Sub(Vec4::Mul(Vec4::Abs(singleLanes(params.m_perm[0], x, y, z)), two), one);
+            for (int i = 1; i < params.m_octaves; ++i)
+            {
+                x = Vec4::Mul(x, lacunarity);
+                y = Vec4::Mul(y, lacunarity);
+                z = Vec4::Mul(z, lacunarity);
+
+                amp *= params.m_gain;
+                const FloatType octave = Vec4::Sub(Vec4::Mul(Vec4::Abs(singleLanes(params.m_perm[i], x, y, z)), two), one);
+                sum = Vec4::Add(sum, Vec4::Mul(octave, Vec4::Splat(amp)));
+            }
+            return Vec4::Mul(sum, Vec4::Splat(params.m_bounding));
+        }
+        case FastNoise::RigidMulti:
+        {
+            FloatType sum = Vec4::Sub(one, Vec4::Abs(singleLanes(params.m_perm[0], x, y, z)));
+            for (int i = 1; i < params.m_octaves; ++i)
+            {
+                x = Vec4::Mul(x, lacunarity);
+                y = Vec4::Mul(y, lacunarity);
+                z = Vec4::Mul(z, lacunarity);
+
+                amp *= params.m_gain;
+                const FloatType octave = Vec4::Sub(one, Vec4::Abs(singleLanes(params.m_perm[i], x, y, z)));
+                sum = Vec4::Sub(sum, Vec4::Mul(octave, Vec4::Splat(amp)));
+            }
+            return sum;
+        }
+        default:
+            return Vec4::ZeroFloat();
+        }
+    }
+
+    // Runs noiseLanes(x, y, z) over every full group of lanes and returns how many points were written
+    template<typename NoiseLanes>
+    static int ForEachLaneGroup(const float* x, const float* y, const float* z, float* out, int count, float frequency, const NoiseLanes& noiseLanes)
+    {
+        const FloatType frequencyLanes = Vec4::Splat(frequency);
+        int i = 0;
+        for (; i + LaneCount <= count; i += LaneCount)
+        {
+            const FloatType xLanes = Vec4::Mul(Vec4::LoadUnaligned(x + i), frequencyLanes);
+            const FloatType yLanes = Vec4::Mul(Vec4::LoadUnaligned(y + i), frequencyLanes);
+            const FloatType zLanes = Vec4::Mul(Vec4::LoadUnaligned(z + i), frequencyLanes);
+            Vec4::StoreUnaligned(out + i, noiseLanes(xLanes, yLanes, zLanes));
+        }
+        return i;
+    }
+
+    // Runs the cellular lane kernel for the return type over every full group of lanes and returns how many points were written
+    template<FastNoise::CellularDistanceFunction DistanceFunction>
+    static int CellularLaneGroups(const CellularParams& params, const float* x, const float* y, const float* z, float* out, int count, float frequency)
+    {
+        switch (params.m_returnType)
+        {
+        case FastNoise::CellValue:
+        case FastNoise::Distance:
+            return ForEachLaneGroup(x, y, z, out, count, frequency,
+                [&params](FloatArgType xl, FloatArgType yl, FloatArgType zl) { return SingleCellularLanes<DistanceFunction>(params, xl, yl, zl); });
+        case FastNoise::NoiseLookup:
+            // Samples the lookup FastNoise instance, which can be of any noise type, at the closest cell of every point
+            return 0;
+        default:
+            return ForEachLaneGroup(x, y, z, out, count, frequency,
+                [&params](FloatArgType xl, FloatArgType yl, FloatArgType zl) { return SingleCellular2EdgeLanes<DistanceFunction>(params, xl, yl, zl); });
+        }
+    }
+} // namespace FastNoiseLanes
+#endif
+
+void FastNoise::GetNoiseSet(const FN_DECIMAL* x, const FN_DECIMAL* y, const FN_DECIMAL* z, FN_DECIMAL* out, int count) const
+{
+    int done = 0;
+
+#ifndef FN_USE_DOUBLES
+    using namespace FastNoiseLanes;
+
+    const unsigned char* perm = m_perm;
+    const unsigned char* perm12 = m_perm12;
+    const Interp interp = m_interp;
+    const FractalParams fractal = { m_perm, m_fractalType, m_octaves, m_lacunarity, m_gain, m_fractalBounding };
+    const CellularParams cellular = { m_perm, m_seed, m_cellularJitter, m_cellularReturnType, m_cellularDistanceIndex0, m_cellularDistanceIndex1 };
+
+    auto valueLanes = [perm, interp](unsigned char offset, FloatArgType xl, FloatArgType yl, FloatArgType zl)
+    {
+        return SingleValueLanes(perm, interp, offset, xl, yl, zl);
+    };
+    auto perlinLanes = [perm, perm12, interp](unsigned char offset, FloatArgType xl, FloatArgType yl, FloatArgType zl)
+    {
+        return SinglePerlinLanes(perm, perm12, interp, offset, xl, yl, zl);
+    };
+    auto simplexLanes = [perm, perm12](unsigned char offset, FloatArgType xl, FloatArgType yl, FloatArgType zl)
+    {
+        return SingleSimplexLanes(perm, perm12, offset, xl, yl, zl);
+    };
+    auto cubicLanes = [perm](unsigned char offset, FloatArgType xl, FloatArgType yl, FloatArgType zl)
+    {
+        return SingleCubicLanes(perm, offset, xl, yl, zl);
+    };
+
+    // Pick the lane kernel once for the whole set instead of once per point
+    switch (m_noiseType)
+    {
+    case Value:
+        done = ForEachLaneGroup(x, y, z, out, count, m_frequency,
+            [&](FloatArgType xl, FloatArgType yl, FloatArgType zl) { return valueLanes(0, xl, yl, zl); });
+        break;
+    case ValueFractal:
+        done = ForEachLaneGroup(x, y, z, out, count, m_frequency,
+            [&](FloatArgType xl, FloatArgType yl, FloatArgType zl) { return FractalLanes(fractal, xl, yl, zl, valueLanes); });
+        break;
+    case Perlin:
+        done = ForEachLaneGroup(x, y, z, out, count, m_frequency,
+            [&](FloatArgType xl, FloatArgType yl, FloatArgType zl) { return perlinLanes(0, xl, yl, zl); });
+        break;
+    case PerlinFractal:
+        done = ForEachLaneGroup(x, y, z, out, count, m_frequency,
+            [&](FloatArgType xl, FloatArgType yl, FloatArgType zl) { return FractalLanes(fractal, xl, yl, zl, perlinLanes); });
+        break;
+    case Simplex:
+        done = ForEachLaneGroup(x, y, z, out, count, m_frequency,
+            [&](FloatArgType xl, FloatArgType yl, FloatArgType zl) { return simplexLanes(0, xl, yl, zl); });
+        break;
+    case SimplexFractal:
+        done = ForEachLaneGroup(x, y, z, out, count, m_frequency,
+            [&](FloatArgType xl, FloatArgType yl, FloatArgType zl) { return FractalLanes(fractal, xl, yl, zl, simplexLanes); });
+        break;
+    case Cubic:
+        done = ForEachLaneGroup(x, y, z, out, count, m_frequency,
+            [&](FloatArgType xl, FloatArgType yl, FloatArgType zl) { return cubicLanes(0, xl, yl, zl); });
+        break;
+    case CubicFractal:
+        done = ForEachLaneGroup(x, y, z, out, count, m_frequency,
+            [&](FloatArgType xl, FloatArgType yl, FloatArgType zl) { return FractalLanes(fractal, xl, yl, zl, cubicLanes); });
+        break;
+    case Cellular:
+        switch (m_cellularDistanceFunction)
+        {
+        case Euclidean:
+            done = CellularLaneGroups<Euclidean>(cellular, x, y, z, out, count, m_frequency);
+            break;
+        case Manhattan:
+            done = CellularLaneGroups<Manhattan>(cellular, x, y, z, out, count, m_frequency);
+            break;
+        case Natural:
+            done = CellularLaneGroups<Natural>(cellular, x, y, z, out, count, m_frequency);
+            break;
+        default:
+            break;
+        }
+        break;
+    case WhiteNoise:
+        done = ForEachLaneGroup(x, y, z, out, count, m_frequency,
+            [&](FloatArgType xl, FloatArgType yl, FloatArgType zl) { return WhiteNoiseLanes(m_seed, xl, yl, zl); });
+        break;
+    default:
+        break;
+    }
+#endif
+
+    for (int i = done; i < count; i++)
+    {
+        out[i] = GetNoise(x[i], y[i], z[i]);
+    }
+}
@@ -204,6 +204,11 @@ public:
 
 	FN_DECIMAL GetNoise(FN_DECIMAL x, FN_DECIMAL y, FN_DECIMAL z) const;
 
+	// Writes GetNoise(x[i], y[i], z[i]) to out[i] for every i in [0, count)
+	// Every noise type is evaluated several points at a time in SIMD lanes, except Cellular with the NoiseLookup return type
+	// which samples m_cellularNoiseLookup one point at a time
+	void GetNoiseSet(const FN_DECIMAL* x, const FN_DECIMAL* y, const FN_DECIMAL* z, FN_DECIMAL* out, int count) const;
+
 	void GradientPerturb(FN_DECIMAL& x, FN_DECIMAL& y, FN_DECIMAL& z) const;
 	void GradientPerturbFractal(FN_DECIMAL& x, FN_DECIMAL& y, FN_DECIMAL& z) const;
 
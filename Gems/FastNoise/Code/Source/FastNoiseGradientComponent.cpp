@@ -7,10 +7,12 @@
  */
 
 #include "FastNoiseGradientComponent.h"
+#include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/std/containers/vector.h>
 #include <External/FastNoise/FastNoise.h>
 #include <LmbrCentral/Dependency/DependencyNotificationBus.h>
 #include <GradientSignal/Ebuses/GradientTransformRequestBus.h>
@@ -312,6 +314,48 @@ namespace FastNoiseGem
         return 0.0f;
     }
 
+    void FastNoiseGradientComponent::GetValues(const AZ::Vector3* positions, float* outValues, size_t positionCount) const
+    {
+        // Gather the transformed positions into separate coordinate arrays so the generator can evaluate them in SIMD lanes
+        AZStd::vector<float> uvwX(positionCount);
+        AZStd::vector<float> uvwY(positionCount);
+        AZStd::vector<float> uvwZ(positionCount);
+        AZStd::vector<bool> wasPointRejected(positionCount, false);
+        for (size_t i = 0; i < positionCount; ++i)
+        {
+            uvwX[i] = positions[i].GetX();
+            uvwY[i] = positions[i].GetY();
+            uvwZ[i] = positions[i].GetZ();
+        }
+
+        // Look up the transform handler once for the whole list instead of once per position
+        const bool shouldNormalizeOutput = false;
+        GradientSignal::GradientTransformRequestBus::EnumerateHandlersId(GetEntityId(),
+            [&](GradientSignal::GradientTransformRequests* transformRequests)
+            {
+                for (size_t i = 0; i < positionCount; ++i)
+                {
+                    AZ::Vector3 uvw = positions[i];
+                    bool rejected = false;
+                    transformRequests->TransformPositionToUVW(positions[i], uvw, shouldNormalizeOutput, rejected);
+
+                    uvwX[i] = uvw.GetX();
+                    uvwY[i] = uvw.GetY();
+                    uvwZ[i] = uvw.GetZ();
+                    wasPointRejected[i] = rejected;
+                }
+                return false;
+            });
+
+        m_generator.GetNoiseSet(uvwX.data(), uvwY.data(), uvwZ.data(), outValues, aznumeric_cast<int>(positionCount));
+
+        for (size_t i = 0; i < positionCount; ++i)
+        {
+            // Generator returns a range between [-1, 1], map that to [0, 1]
+            outValues[i] = wasPointRejected[i] ? 0.0f : AZ::GetClamp((outValues[i] + 1.0f) / 2.0f, 0.0f, 1.0f);
+        }
+    }
+
     template <typename TValueType, TValueType FastNoiseGradientConfig::*TConfigMember, void (FastNoise::*TMethod)(TValueType)>
     void FastNoiseGradientComponent::SetConfigValue(TValueType value)
     {
@@ -90,6 +90,7 @@ namespace FastNoiseGem
         //////////////////////////////////////////////////////////////////////////
         // GradientRequestBus
         float GetValue(const GradientSignal::GradientSampleParams& sampleParams) const override;
+        void GetValues(const AZ::Vector3* positions, float* outValues, size_t positionCount) const override;
 
     protected:
         FastNoiseGradientConfig m_configuration;
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <External/FastNoise/FastNoise.h>
+
+namespace UnitTest
+{
+    namespace FastNoiseBenchmarkSettings
+    {
+        //! Number of points sampled on every iteration.
+        static const int PointCount = 256 * 1024;
+
+        //! Size of the world space region the points are scattered in.
+        static const float RegionSize = 1024.0f;
+    } // namespace FastNoiseBenchmarkSettings
+
+    //! Creates a generator using the noise type selected by the benchmark and random points to sample it at.
+    class FastNoiseBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+        void internalSetUp(const benchmark::State& state)
+        {
+            m_generator.SetNoiseType(static_cast<FastNoise::NoiseType>(state.range(0)));
+
+            AZ::SimpleLcgRandom random(1234);
+            m_x.resize(FastNoiseBenchmarkSettings::PointCount);
+            m_y.resize(FastNoiseBenchmarkSettings::PointCount);
+            m_z.resize(FastNoiseBenchmarkSettings::PointCount);
+            m_results.resize(FastNoiseBenchmarkSettings::PointCount);
+            for (int i = 0; i < FastNoiseBenchmarkSettings::PointCount; ++i)
+            {
+                m_x[i] = random.GetRandomFloat() * FastNoiseBenchmarkSettings::RegionSize;
+                m_y[i] = random.GetRandomFloat() * FastNoiseBenchmarkSettings::RegionSize;
+                m_z[i] = random.GetRandomFloat() * FastNoiseBenchmarkSettings::RegionSize;
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_x = {};
+            m_y = {};
+            m_z = {};
+            m_results = {};
+        }
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        FastNoise m_generator;
+        AZStd::vector<float> m_x;
+        AZStd::vector<float> m_y;
+        AZStd::vector<float> m_z;
+        AZStd::vector<float> m_results;
+    };
+
+    //! Samples the points one at a time.
+    BENCHMARK_DEFINE_F(FastNoiseBenchmarkFixture, BM_GetNoise)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (int i = 0; i < FastNoiseBenchmarkSettings::PointCount; ++i)
+            {
+                m_results[i] = m_generator.GetNoise(m_x[i], m_y[i], m_z[i]);
+            }
+            benchmark::DoNotOptimize(m_results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * FastNoiseBenchmarkSettings::PointCount);
+    }
+
+    //! Samples all the points with a single batched call.
+    BENCHMARK_DEFINE_F(FastNoiseBenchmarkFixture, BM_GetNoiseSet)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_generator.GetNoiseSet(m_x.data(), m_y.data(), m_z.data(), m_results.data(), FastNoiseBenchmarkSettings::PointCount);
+            benchmark::DoNotOptimize(m_results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * FastNoiseBenchmarkSettings::PointCount);
+    }
+
+    BENCHMARK_REGISTER_F(FastNoiseBenchmarkFixture, BM_GetNoise)
+        ->DenseRange(FastNoise::Value, FastNoise::CubicFractal)
+        ->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(FastNoiseBenchmarkFixture, BM_GetNoiseSet)
+        ->DenseRange(FastNoise::Value, FastNoise::CubicFractal)
+        ->Unit(benchmark::kMillisecond);
+} // namespace UnitTest
+#endif // HAVE_BENCHMARK
@@ -12,6 +12,7 @@
 #include <Mocks/IConsoleMock.h>
 #include <Mocks/ISystemMock.h>
 
+#include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Math/Random.h>
@@ -262,6 +263,148 @@ TEST_F(FastNoiseTestApp, FastNoise_ComponentMatchesConfiguration)
     reinterpret_cast<FastNoiseGradientComponentTester*>(noiseComp)->AssertTrue(cfg);
 }
 
+TEST_F(FastNoiseTestApp, FastNoise_GetNoiseSetMatchesGetNoise)
+{
+    // Use a count that isn't a multiple of the SIMD lane count so the scalar tail gets exercised too
+    constexpr int pointCount = 1027;
+    AZ::SimpleLcgRandom rand(1234);
+
+    AZStd::vector<float> x(pointCount);
+    AZStd::vector<float> y(pointCount);
+    AZStd::vector<float> z(pointCount);
+    for (int i = 0; i < pointCount; ++i)
+    {
+        x[i] = (rand.GetRandomFloat() - 0.5f) * 2000.0f;
+        y[i] = (rand.GetRandomFloat() - 0.5f) * 2000.0f;
+        z[i] = (rand.GetRandomFloat() - 0.5f) * 2000.0f;
+    }
+
+    // Whole numbers, including negative ones, hit the edge cases of the lattice flooring
+    x[0] = -1.0f;
+    y[0] = -100.0f;
+    z[0] = 0.0f;
+
+    const FastNoise::NoiseType noiseTypes[] = {
+        FastNoise::Value, FastNoise::ValueFractal, FastNoise::Perlin, FastNoise::PerlinFractal, FastNoise::Simplex,
+        FastNoise::SimplexFractal, FastNoise::Cellular, FastNoise::WhiteNoise, FastNoise::Cubic, FastNoise::CubicFractal };
+    const FastNoise::FractalType fractalTypes[] = { FastNoise::FBM, FastNoise::Billow, FastNoise::RigidMulti };
+    const FastNoise::Interp interps[] = { FastNoise::Linear, FastNoise::Hermite, FastNoise::Quintic };
+
+    AZStd::vector<float> results(pointCount);
+    for (FastNoise::NoiseType noiseType : noiseTypes)
+    {
+        for (FastNoise::FractalType fractalType : fractalTypes)
+        {
+            for (FastNoise::Interp interp : interps)
+            {
+                FastNoise generator(aznumeric_cast<int>(rand.GetRandom() & 0xffff));
+                generator.SetNoiseType(noiseType);
+                generator.SetFractalType(fractalType);
+                generator.SetInterp(interp);
+                generator.SetFrequency(0.05f);
+                generator.SetFractalOctaves(4);
+
+                generator.GetNoiseSet(x.data(), y.data(), z.data(), results.data(), pointCount);
+
+                for (int i = 0; i < pointCount; ++i)
+                {
+                    EXPECT_NEAR(results[i], generator.GetNoise(x[i], y[i], z[i]), 1.0e-5f)
+                        << "noise type " << noiseType << ", fractal type " << fractalType << ", interp " << interp;
+                }
+            }
+        }
+    }
+}
+
+TEST_F(FastNoiseTestApp, FastNoise_GetNoiseSetMatchesGetNoise_Cellular)
+{
+    constexpr int pointCount = 1027;
+    AZ::SimpleLcgRandom rand(5678);
+
+    AZStd::vector<float> x(pointCount);
+    AZStd::vector<float> y(pointCount);
+    AZStd::vector<float> z(pointCount);
+    for (int i = 0; i < pointCount; ++i)
+    {
+        x[i] = (rand.GetRandomFloat() - 0.5f) * 2000.0f;
+        y[i] = (rand.GetRandomFloat() - 0.5f) * 2000.0f;
+        z[i] = (rand.GetRandomFloat() - 0.5f) * 2000.0f;
+    }
+
+    // Halfway points, including negative ones, hit the edge cases of the cell rounding once scaled by the frequency
+    x[0] = -10.0f;
+    y[0] = 10.0f;
+    z[0] = -30.0f;
+
+    const FastNoise::CellularDistanceFunction distanceFunctions[] = { FastNoise::Euclidean, FastNoise::Manhattan, FastNoise::Natural };
+    const FastNoise::CellularReturnType returnTypes[] = {
+        FastNoise::CellValue, FastNoise::NoiseLookup, FastNoise::Distance, FastNoise::Distance2, FastNoise::Distance2Add,
+        FastNoise::Distance2Sub, FastNoise::Distance2Mul, FastNoise::Distance2Div };
+
+    FastNoise lookup(1337);
+    lookup.SetNoiseType(FastNoise::Simplex);
+
+    AZStd::vector<float> results(pointCount);
+    for (FastNoise::CellularDistanceFunction distanceFunction : distanceFunctions)
+    {
+        for (FastNoise::CellularReturnType returnType : returnTypes)
+        {
+            FastNoise generator(aznumeric_cast<int>(rand.GetRandom() & 0xffff));
+            generator.SetNoiseType(FastNoise::Cellular);
+            generator.SetCellularDistanceFunction(distanceFunction);
+            generator.SetCellularReturnType(returnType);
+            generator.SetCellularNoiseLookup(&lookup);
+            generator.SetCellularDistance2Indices(1, 2);
+            generator.SetFrequency(0.05f);
+
+            generator.GetNoiseSet(x.data(), y.data(), z.data(), results.data(), pointCount);
+
+            for (int i = 0; i < pointCount; ++i)
+            {
+                EXPECT_NEAR(results[i], generator.GetNoise(x[i], y[i], z[i]), 1.0e-5f)
+                    << "distance function " << distanceFunction << ", return type " << returnType;
+            }
+        }
+    }
+}
+
+TEST_F(FastNoiseTestApp, FastNoise_GetValuesMatchesGetValue)
+{
+    AZ::Entity* noiseEntity = aznew AZ::Entity("noise_entity");
+    ASSERT_TRUE(noiseEntity != nullptr);
+
+    FastNoiseGem::FastNoiseGradientConfig cfg;
+    cfg.m_noiseType = FastNoise::NoiseType::PerlinFractal;
+    noiseEntity->CreateComponent<FastNoiseGem::FastNoiseGradientComponent>(cfg);
+    noiseEntity->CreateComponent<MockGradientTransformComponent>();
+
+    noiseEntity->Init();
+    noiseEntity->Activate();
+
+    AZStd::vector<AZ::Vector3> positions;
+    for (float x = -10.0f; x < 10.0f; x += 0.7f)
+    {
+        for (float y = -10.0f; y < 10.0f; y += 0.7f)
+        {
+            positions.emplace_back(x, y, 0.0f);
+        }
+    }
+
+    AZStd::vector<float> values(positions.size(), -1.0f);
+    GradientSignal::GradientRequestBus::Event(
+        noiseEntity->GetId(), &GradientSignal::GradientRequestBus::Events::GetValues, positions.data(), values.data(), positions.size());
+
+    for (size_t i = 0; i < positions.size(); ++i)
+    {
+        float sample = -1.0f;
+        GradientSignal::GradientRequestBus::EventResult(
+            sample, noiseEntity->GetId(), &GradientSignal::GradientRequestBus::Events::GetValue, GradientSignal::GradientSampleParams(positions[i]));
+        EXPECT_NEAR(values[i], sample, 1.0e-5f);
+    }
+
+    delete noiseEntity;
+}
+
 #if FASTNOISE_EDITOR
 #include <EditorFastNoiseGradientComponent.h>
 
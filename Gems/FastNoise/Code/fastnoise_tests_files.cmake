@@ -8,6 +8,7 @@
 
 set(FILES
     Tests/FastNoiseTest.cpp
+    Tests/FastNoiseBenchmarks.cpp
     Source/FastNoiseModule.h
     Source/FastNoiseModule.cpp
 )
@@ -49,6 +49,21 @@ namespace GradientSignal
         */
         virtual float GetValue(const GradientSampleParams& sampleParams) const = 0;
 
+        /**
+        * Given a list of positions, generate a value for each of them.  The same thread-safety rules as GetValue apply.
+        * Gradients that can evaluate many positions at once more cheaply than one at a time override this.
+        * @param positions Array of positionCount positions to sample
+        * @param outValues Array of positionCount floats that receives the value generated for each position
+        * @param positionCount Number of positions to sample
+        */
+        virtual void GetValues(const AZ::Vector3* positions, float* outValues, size_t positionCount) const
+        {
+            for (size_t i = 0; i < positionCount; ++i)
+            {
+                outValues[i] = GetValue(GradientSampleParams(positions[i]));
+            }
+        }
+
         /**
         * Call to check the hierarchy to see if a given entityId exists in the gradient signal chain
         */
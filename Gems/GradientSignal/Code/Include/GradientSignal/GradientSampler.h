@@ -116,8 +116,9 @@ namespace GradientSignal
             // that create false detection of cyclic dependencies when multiple requests occur on different threads simultaneously.
             // (One case where this was previously able to occur was in rapid updating of the Preview widget on the GradientSurfaceDataComponent
             // in the Editor when moving the threshold sliders back and forth rapidly)
+            // The surface data bus uses lockless dispatch, so its context mutex is locked explicitly here.
             auto& surfaceDataContext = SurfaceData::SurfaceDataSystemRequestBus::GetOrCreateContext(false);
-            typename SurfaceData::SurfaceDataSystemRequestBus::Context::DispatchLockGuard scopeLock(surfaceDataContext.m_contextMutex);
+            AZStd::lock_guard<decltype(surfaceDataContext.m_contextMutex)> scopeLock(surfaceDataContext.m_contextMutex);
 
             if (m_isRequestInProgress)
             {
@@ -146,6 +146,60 @@ namespace LmbrCentral
         return m_intersectionDataCache.m_obb.GetDistanceSq(point);
     }
 
+    void BoxShape::ArePointsInside(const AZ::Vector3* points, bool* results, size_t pointCount)
+    {
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_boxShapeConfig, m_currentNonUniformScale);
+
+        if (m_intersectionDataCache.m_axisAligned)
+        {
+            const AZ::Aabb& aabb = m_intersectionDataCache.m_aabb;
+            for (size_t i = 0; i < pointCount; ++i)
+            {
+                results[i] = aabb.Contains(points[i]);
+            }
+            return;
+        }
+
+        // same test as Obb::Contains, with the inverse rotation computed once for all the points
+        const AZ::Obb& obb = m_intersectionDataCache.m_obb;
+        const AZ::Quaternion localFromWorldRotation = obb.GetRotation().GetInverseFast();
+        const AZ::Vector3 position = obb.GetPosition();
+        const AZ::Vector3 halfLengths = obb.GetHalfLengths();
+        const AZ::Vector3 negativeHalfLengths = -halfLengths;
+        for (size_t i = 0; i < pointCount; ++i)
+        {
+            const AZ::Vector3 localPoint = localFromWorldRotation.TransformVector(points[i] - position);
+            results[i] = localPoint.IsGreaterEqualThan(negativeHalfLengths) && localPoint.IsLessEqualThan(halfLengths);
+        }
+    }
+
+    void BoxShape::DistanceSquaredFromPoints(const AZ::Vector3* points, float* results, size_t pointCount)
+    {
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_boxShapeConfig, m_currentNonUniformScale);
+
+        if (m_intersectionDataCache.m_axisAligned)
+        {
+            const AZ::Aabb& aabb = m_intersectionDataCache.m_aabb;
+            for (size_t i = 0; i < pointCount; ++i)
+            {
+                results[i] = aabb.GetDistanceSq(points[i]);
+            }
+            return;
+        }
+
+        // same calculation as Obb::GetDistanceSq, with the inverse rotation computed once for all the points
+        const AZ::Obb& obb = m_intersectionDataCache.m_obb;
+        const AZ::Quaternion localFromWorldRotation = obb.GetRotation().GetInverseFast();
+        const AZ::Vector3 position = obb.GetPosition();
+        const AZ::Vector3 halfLengths = obb.GetHalfLengths();
+        const AZ::Vector3 negativeHalfLengths = -halfLengths;
+        for (size_t i = 0; i < pointCount; ++i)
+        {
+            const AZ::Vector3 localPoint = localFromWorldRotation.TransformVector(points[i] - position);
+            results[i] = localPoint.GetDistanceSq(localPoint.GetClamp(negativeHalfLengths, halfLengths));
+        }
+    }
+
     bool BoxShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_boxShapeConfig, m_currentNonUniformScale);
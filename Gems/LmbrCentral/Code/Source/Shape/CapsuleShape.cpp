@@ -175,6 +175,52 @@ namespace LmbrCentral
         return powf(AZStd::max(distance, 0.0f), 2.0f);
     }
 
+    void CapsuleShape::ArePointsInside(const AZ::Vector3* points, bool* results, size_t pointCount)
+    {
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_capsuleShapeConfig);
+
+        const AZ::Vector3 basePlaneCenterPoint = m_intersectionDataCache.m_basePlaneCenterPoint;
+        const AZ::Vector3 topPlaneCenterPoint = m_intersectionDataCache.m_topPlaneCenterPoint;
+        const AZ::Vector3 axisVector = m_intersectionDataCache.m_axisVector;
+        const float radiusSquared = m_intersectionDataCache.m_radius * m_intersectionDataCache.m_radius;
+        const float internalHeightSquared = m_intersectionDataCache.m_internalHeight * m_intersectionDataCache.m_internalHeight;
+
+        if (m_intersectionDataCache.m_isSphere)
+        {
+            for (size_t i = 0; i < pointCount; ++i)
+            {
+                results[i] = AZ::Intersect::PointSphere(basePlaneCenterPoint, radiusSquared, points[i]);
+            }
+            return;
+        }
+
+        // same tests as IsPointInside: bottom sphere, top sphere, then the cylinder between them
+        for (size_t i = 0; i < pointCount; ++i)
+        {
+            const AZ::Vector3& point = points[i];
+            results[i] = AZ::Intersect::PointSphere(basePlaneCenterPoint, radiusSquared, point) ||
+                AZ::Intersect::PointSphere(topPlaneCenterPoint, radiusSquared, point) ||
+                AZ::Intersect::PointCylinder(basePlaneCenterPoint, axisVector, internalHeightSquared, radiusSquared, point);
+        }
+    }
+
+    void CapsuleShape::DistanceSquaredFromPoints(const AZ::Vector3* points, float* results, size_t pointCount)
+    {
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_capsuleShapeConfig);
+
+        const Lineseg lineSeg(
+            AZVec3ToLYVec3(m_intersectionDataCache.m_basePlaneCenterPoint),
+            AZVec3ToLYVec3(m_intersectionDataCache.m_topPlaneCenterPoint));
+        const float radius = m_intersectionDataCache.m_radius;
+
+        for (size_t i = 0; i < pointCount; ++i)
+        {
+            float t = 0.0f;
+            const float distance = AZStd::max(Distance::Point_Lineseg(AZVec3ToLYVec3(points[i]), lineSeg, t) - radius, 0.0f);
+            results[i] = distance * distance;
+        }
+    }
+
     bool CapsuleShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_capsuleShapeConfig);
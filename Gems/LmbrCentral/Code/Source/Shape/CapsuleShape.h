@@ -38,6 +38,8 @@ namespace LmbrCentral
         void GetTransformAndLocalBounds(AZ::Transform& transform, AZ::Aabb& bounds) override;
         bool IsPointInside(const AZ::Vector3& point) override;
         float DistanceSquaredFromPoint(const AZ::Vector3& point) override;
+        void ArePointsInside(const AZ::Vector3* points, bool* results, size_t pointCount) override;
+        void DistanceSquaredFromPoints(const AZ::Vector3* points, float* results, size_t pointCount) override;
         bool IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance) override;
 
         // CapsuleShapeComponentRequestsBus::Handler
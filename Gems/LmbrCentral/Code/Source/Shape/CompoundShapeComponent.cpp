@@ -8,6 +8,8 @@
 
 #include "CompoundShapeComponent.h"
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
 
 
 namespace LmbrCentral
@@ -127,6 +129,40 @@ namespace LmbrCentral
         return smallestDistanceSquared;
     }
 
+    void CompoundShapeComponent::ArePointsInside(const AZ::Vector3* points, bool* results, size_t pointCount)
+    {
+        AZStd::fill(results, results + pointCount, false);
+
+        AZStd::vector<bool> childResults(pointCount);
+        for (AZ::EntityId childEntity : m_configuration.GetChildEntities())
+        {
+            AZStd::fill(childResults.begin(), childResults.end(), false);
+            ShapeComponentRequestsBus::Event(
+                childEntity, &ShapeComponentRequests::ArePointsInside, points, childResults.data(), pointCount);
+            for (size_t i = 0; i < pointCount; ++i)
+            {
+                results[i] = results[i] || childResults[i];
+            }
+        }
+    }
+
+    void CompoundShapeComponent::DistanceSquaredFromPoints(const AZ::Vector3* points, float* results, size_t pointCount)
+    {
+        AZStd::fill(results, results + pointCount, FLT_MAX);
+
+        AZStd::vector<float> childResults(pointCount);
+        for (AZ::EntityId childEntity : m_configuration.GetChildEntities())
+        {
+            AZStd::fill(childResults.begin(), childResults.end(), FLT_MAX);
+            ShapeComponentRequestsBus::Event(
+                childEntity, &ShapeComponentRequests::DistanceSquaredFromPoints, points, childResults.data(), pointCount);
+            for (size_t i = 0; i < pointCount; ++i)
+            {
+                results[i] = AZStd::min(results[i], childResults[i]);
+            }
+        }
+    }
+
     bool CompoundShapeComponent::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         bool intersection = false;
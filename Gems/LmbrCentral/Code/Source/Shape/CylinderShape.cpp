@@ -249,6 +249,55 @@ namespace LmbrCentral
             m_intersectionDataCache.m_radius);
     }
 
+    void CylinderShape::ArePointsInside(const AZ::Vector3* points, bool* results, size_t pointCount)
+    {
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_cylinderShapeConfig);
+
+        const AZ::Vector3 baseCenterPoint = m_intersectionDataCache.m_baseCenterPoint;
+        const AZ::Vector3 axisVector = m_intersectionDataCache.m_axisVector;
+        const float heightSquared = m_intersectionDataCache.m_height * m_intersectionDataCache.m_height;
+        const float radiusSquared = m_intersectionDataCache.m_radius * m_intersectionDataCache.m_radius;
+
+        for (size_t i = 0; i < pointCount; ++i)
+        {
+            results[i] = AZ::Intersect::PointCylinder(baseCenterPoint, axisVector, heightSquared, radiusSquared, points[i]);
+        }
+    }
+
+    void CylinderShape::DistanceSquaredFromPoints(const AZ::Vector3* points, float* results, size_t pointCount)
+    {
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_cylinderShapeConfig);
+
+        const AZ::Vector3 baseCenterPoint = m_intersectionDataCache.m_baseCenterPoint;
+        if (m_cylinderShapeConfig.m_height <= 0.0f || m_cylinderShapeConfig.m_radius <= 0.0f)
+        {
+            for (size_t i = 0; i < pointCount; ++i)
+            {
+                results[i] = baseCenterPoint.GetDistanceSq(points[i]);
+            }
+            return;
+        }
+
+        // same regions as Distance::Point_CylinderSq, with the axis values computed once for all the points
+        const AZ::Vector3 axisVector = m_intersectionDataCache.m_axisVector;
+        const AZ::Vector3 axisCenterPoint = baseCenterPoint + axisVector * 0.5f;
+        const AZ::Vector3 axisUnit = axisVector.GetNormalized();
+        const float halfLength = axisVector.GetLength() * 0.5f;
+        const float radius = m_intersectionDataCache.m_radius;
+        const float radiusSquared = radius * radius;
+
+        for (size_t i = 0; i < pointCount; ++i)
+        {
+            const AZ::Vector3 centerToPoint = points[i] - axisCenterPoint;
+            const float axialDistance = fabsf(centerToPoint.Dot(axisUnit));
+            const float radialDistanceSquared = centerToPoint.GetLengthSq() - axialDistance * axialDistance;
+
+            const float axialExcess = AZStd::max(axialDistance - halfLength, 0.0f);
+            const float radialExcess = radialDistanceSquared > radiusSquared ? sqrtf(radialDistanceSquared) - radius : 0.0f;
+            results[i] = axialExcess * axialExcess + radialExcess * radialExcess;
+        }
+    }
+
     bool CylinderShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_cylinderShapeConfig);
@@ -45,6 +45,8 @@ namespace LmbrCentral
         AZ::Crc32 GetShapeType() override { return AZ_CRC("Cylinder", 0x9b045bea); }
         bool IsPointInside(const AZ::Vector3& point) override;
         float DistanceSquaredFromPoint(const AZ::Vector3& point) override;
+        void ArePointsInside(const AZ::Vector3* points, bool* results, size_t pointCount) override;
+        void DistanceSquaredFromPoints(const AZ::Vector3* points, float* results, size_t pointCount) override;
         AZ::Aabb GetEncompassingAabb() override;
         void GetTransformAndLocalBounds(AZ::Transform& transform, AZ::Aabb& bounds) override;
         AZ::Vector3 GenerateRandomPointInside(AZ::RandomDistributionType randomDistribution) override;
@@ -14,6 +14,7 @@
 #include <AzCore/Math/Obb.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
 #include <LmbrCentral/Shape/DiskShapeComponentBus.h>
 #include <Shape/ShapeDisplay.h>
 
@@ -148,6 +149,34 @@ namespace LmbrCentral
         return closestPoint.GetDistanceSq(point);
     }
 
+    void DiskShape::ArePointsInside([[maybe_unused]] const AZ::Vector3* points, bool* results, size_t pointCount)
+    {
+        AZStd::fill(results, results + pointCount, false); // 2D object cannot have points that are strictly inside in 3d space.
+    }
+
+    void DiskShape::DistanceSquaredFromPoints(const AZ::Vector3* points, float* results, size_t pointCount)
+    {
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_diskShapeConfig);
+
+        const AZ::Vector3 center = m_currentTransform.GetTranslation();
+        const AZ::Plane plane = AZ::Plane::CreateFromNormalAndPoint(m_intersectionDataCache.m_normal, center);
+        const float radius = m_intersectionDataCache.m_radius;
+
+        for (size_t i = 0; i < pointCount; ++i)
+        {
+            // same as DistanceSquaredFromPoint, find the closest point on the plane then clamp it to the disk
+            AZ::Vector3 closestPointToPlane;
+            AZ::Intersect::ClosestPointPlane(points[i], plane, closestPointToPlane);
+
+            AZ::Vector3 centerToClosestPoint = closestPointToPlane - center;
+            if (centerToClosestPoint.GetLengthSq() > radius * radius)
+            {
+                centerToClosestPoint.SetLength(radius);
+            }
+            results[i] = (center + centerToClosestPoint).GetDistanceSq(points[i]);
+        }
+    }
+
     bool DiskShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_diskShapeConfig);
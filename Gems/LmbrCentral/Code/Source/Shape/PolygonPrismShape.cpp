@@ -374,6 +374,82 @@ namespace LmbrCentral
         return PolygonPrismUtil::DistanceSquaredFromPoint(*m_polygonPrism, point, m_currentTransform);;
     }
 
+    void PolygonPrismShape::ArePointsInside(const AZ::Vector3* points, bool* results, size_t pointCount)
+    {
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, *m_polygonPrism, m_currentNonUniformScale);
+
+        const AZ::Aabb& aabb = m_intersectionDataCache.m_aabb;
+        for (size_t i = 0; i < pointCount; ++i)
+        {
+            // initial early aabb rejection test, same as IsPointInside
+            results[i] = aabb.Contains(points[i]) &&
+                PolygonPrismUtil::IsPointInside(
+                    *m_polygonPrism, m_intersectionDataCache.m_edgeBuckets, points[i], m_intersectionDataCache.m_localFromWorld);
+        }
+    }
+
+    void PolygonPrismShape::DistanceSquaredFromPoints(const AZ::Vector3* points, float* results, size_t pointCount)
+    {
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, *m_polygonPrism, m_currentNonUniformScale);
+
+        // same calculation as PolygonPrismUtil::DistanceSquaredFromPoint, with everything that doesn't depend on the point
+        // computed once and the containment test done with the edge buckets
+        AZ::Transform worldFromLocalNoScale = m_currentTransform;
+        const float transformScale = worldFromLocalNoScale.ExtractUniformScale();
+        const AZ::Transform localFromWorldNoScale = worldFromLocalNoScale.GetInverse();
+        const AZ::Vector3 combinedScale = transformScale * m_polygonPrism->GetNonUniformScale();
+        const float scaledHeight = m_polygonPrism->GetHeight() * combinedScale.GetZ();
+        const float bottom = AZ::GetMin(scaledHeight, 0.0f);
+        const float top = AZ::GetMax(scaledHeight, 0.0f);
+
+        const AZStd::vector<AZ::Vector2>& vertices = m_polygonPrism->m_vertexContainer.GetVertices();
+        const size_t vertexCount = vertices.size();
+        AZStd::vector<AZ::Vector3> scaledVertices;
+        scaledVertices.reserve(vertexCount);
+        for (const AZ::Vector2& vertex : vertices)
+        {
+            scaledVertices.push_back(combinedScale * AZ::Vector2ToVector3(vertex));
+        }
+
+        for (size_t pointIndex = 0; pointIndex < pointCount; ++pointIndex)
+        {
+            const AZ::Vector3 localPoint = localFromWorldNoScale.TransformPoint(points[pointIndex]);
+            const AZ::Vector3 localPointFlattened = AZ::Vector3(localPoint.GetX(), localPoint.GetY(), 0.5f * (bottom + top));
+            const AZ::Vector3 worldPointFlattened = worldFromLocalNoScale.TransformPoint(localPointFlattened);
+
+            if (PolygonPrismUtil::IsPointInside(
+                    *m_polygonPrism, m_intersectionDataCache.m_edgeBuckets, worldPointFlattened, m_intersectionDataCache.m_localFromWorld))
+            {
+                // distance to the bottom or the top of the volume, zero if it's fully contained
+                const float distance = AZ::GetMax(AZ::GetMax(bottom - localPoint.GetZ(), localPoint.GetZ() - top), 0.0f);
+                results[pointIndex] = distance * distance;
+                continue;
+            }
+
+            // find closest segment
+            AZ::Vector3 closestPos;
+            float minDistanceSq = std::numeric_limits<float>::max();
+            for (size_t i = 0; i < vertexCount; ++i)
+            {
+                AZ::Vector3 position;
+                float proportion;
+                AZ::Intersect::ClosestPointSegment(
+                    localPointFlattened, scaledVertices[i], scaledVertices[(i + 1) % vertexCount], proportion, position);
+
+                const float distanceSq = (position - localPointFlattened).GetLengthSq();
+                if (distanceSq < minDistanceSq)
+                {
+                    minDistanceSq = distanceSq;
+                    closestPos = position;
+                }
+            }
+
+            // constrain closest pos to [bottom, top] of volume
+            closestPos += AZ::Vector3(0.0f, 0.0f, AZ::GetClamp<float>(localPoint.GetZ(), bottom, top));
+            results[pointIndex] = (closestPos - localPoint).GetLengthSq();
+        }
+    }
+
     bool PolygonPrismShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, *m_polygonPrism, m_currentNonUniformScale);
@@ -389,6 +465,11 @@ namespace LmbrCentral
         GenerateSolidPolygonPrismMesh(
             polygonPrism.m_vertexContainer.GetVertices(),
             polygonPrism.GetHeight(), currentNonUniformScale, m_triangles);
+
+        AZ::Transform worldFromLocalWithUniformScale = currentTransform;
+        worldFromLocalWithUniformScale.SetUniformScale(worldFromLocalWithUniformScale.GetUniformScale());
+        m_localFromWorld = worldFromLocalWithUniformScale.GetInverse();
+        m_edgeBuckets.Build(polygonPrism.m_vertexContainer.GetVertices());
     }
 
     void DrawPolygonPrismShape(
@@ -448,13 +529,48 @@ namespace LmbrCentral
             return aabb;
         }
 
+        /// Squared distance under which the ray cast from a point touches an edge in the crossing test.
+        static const float s_edgeCrossingEpsilon = 0.0001f;
+
+        /// Step of the crossing test, returns if the ray cast along the x axis from a point in the local space
+        /// of the polygon crosses the edge going from segmentStart2d to segmentEnd2d.
+        static bool IsEdgeCrossed(
+            const AZ::Vector2& segmentStart2d, const AZ::Vector2& segmentEnd2d,
+            const AZ::Vector3& localPointFlattened, const AZ::Vector3& point)
+        {
+            const float projectRayLength = 1000.0f;
+
+            const AZ::Vector3 localEndFlattened = localPointFlattened + AZ::Vector3::CreateAxisX() * projectRayLength;
+            const AZ::Vector3 segmentStart = AZ::Vector2ToVector3(segmentStart2d);
+            const AZ::Vector3 segmentEnd = AZ::Vector2ToVector3(segmentEnd2d);
+
+            AZ::Vector3 closestPosRay, closestPosSegment;
+            float rayProportion, segmentProportion;
+            AZ::Intersect::ClosestSegmentSegment(localPointFlattened, localEndFlattened, segmentStart, segmentEnd, rayProportion, segmentProportion, closestPosRay, closestPosSegment);
+            const float delta = (closestPosRay - closestPosSegment).GetLengthSq();
+
+            // have we crossed/touched a line on the polygon
+            if (delta >= s_edgeCrossingEpsilon)
+            {
+                return false;
+            }
+
+            // if at beginning of segment, only count intersection if segment is going up (y-axis)
+            // (prevent counting segments twice when intersecting at vertex)
+            if (AZ::IsClose(segmentProportion, 0.0f, AZ::Constants::FloatEpsilon))
+            {
+                const AZ::Vector3 highestVertex = segmentStart.GetY() > segmentEnd.GetY() ? segmentStart : segmentEnd;
+                const float threshold = (highestVertex - point).Dot(AZ::Vector3::CreateAxisY());
+                return threshold > 0.0f;
+            }
+
+            return true;
+        }
+
         bool IsPointInside(const AZ::PolygonPrism& polygonPrism, const AZ::Vector3& point, const AZ::Transform& worldFromLocal)
         {
             using namespace PolygonPrismUtil;
 
-            const float epsilon = 0.0001f;
-            const float projectRayLength = 1000.0f;
-
             const AZStd::vector<AZ::Vector2>& vertices = polygonPrism.m_vertexContainer.GetVertices();
             const size_t vertexCount = vertices.size();
 
@@ -473,40 +589,55 @@ namespace LmbrCentral
             }
 
             const AZ::Vector3 localPointFlattened = AZ::Vector3(localPoint.GetX(), localPoint.GetY(), 0.0f);
-            const AZ::Vector3 localEndFlattened = localPointFlattened + AZ::Vector3::CreateAxisX() * projectRayLength;
 
             size_t intersections = 0;
             // use 'crossing test' algorithm to decide if the point lies within the volume or not
             // (odd number of intersections - inside, even number of intersections - outside)
             for (size_t i = 0; i < vertexCount; ++i)
             {
-                const AZ::Vector3 segmentStart = AZ::Vector2ToVector3(vertices[i]);
-                const AZ::Vector3 segmentEnd = AZ::Vector2ToVector3(vertices[(i + 1) % vertexCount]);
+                if (IsEdgeCrossed(vertices[i], vertices[(i + 1) % vertexCount], localPointFlattened, point))
+                {
+                    intersections++;
+                }
+            }
 
-                AZ::Vector3 closestPosRay, closestPosSegment;
-                float rayProportion, segmentProportion;
-                AZ::Intersect::ClosestSegmentSegment(localPointFlattened, localEndFlattened, segmentStart, segmentEnd, rayProportion, segmentProportion, closestPosRay, closestPosSegment);
-                const float delta = (closestPosRay - closestPosSegment).GetLengthSq();
+            // odd inside, even outside - bitwise AND to convert to bool
+            return intersections & 1;
+        }
 
-                // have we crossed/touched a line on the polygon
-                if (delta < epsilon)
-                {
-                    const AZ::Vector3 highestVertex = segmentStart.GetY() > segmentEnd.GetY() ? segmentStart : segmentEnd;
+        bool IsPointInside(
+            const AZ::PolygonPrism& polygonPrism, const PolygonPrismEdgeBuckets& edgeBuckets,
+            const AZ::Vector3& point, const AZ::Transform& localFromWorld)
+        {
+            // same as the crossing test above, only visiting the edges in the bucket of the point
+            const AZ::Vector3 localPoint = localFromWorld.TransformPoint(point) / polygonPrism.GetNonUniformScale();
 
-                    const float threshold = (highestVertex - point).Dot(AZ::Vector3::CreateAxisY());
-                    if (AZ::IsClose(segmentProportion, 0.0f, AZ::Constants::FloatEpsilon))
-                    {
-                        // if at beginning of segment, only count intersection if segment is going up (y-axis)
-                        // (prevent counting segments twice when intersecting at vertex)
-                        if (threshold > 0.0f)
-                        {
-                            intersections++;
-                        }
-                    }
-                    else
-                    {
-                        intersections++;
-                    }
+            if (localPoint.GetZ() < 0.0f || localPoint.GetZ() > polygonPrism.GetHeight())
+            {
+                return false;
+            }
+
+            // no edge can be touched by the ray outside of the buckets
+            const float localY = localPoint.GetY();
+            if (edgeBuckets.m_bucketOffsets.size() < 2 || localY < edgeBuckets.m_minY || localY > edgeBuckets.m_maxY)
+            {
+                return false;
+            }
+
+            const size_t lastBucket = edgeBuckets.m_bucketOffsets.size() - 2;
+            const size_t bucket = AZStd::min(static_cast<size_t>((localY - edgeBuckets.m_minY) * edgeBuckets.m_bucketsPerUnit), lastBucket);
+
+            const AZStd::vector<AZ::Vector2>& vertices = polygonPrism.m_vertexContainer.GetVertices();
+            const size_t vertexCount = vertices.size();
+            const AZ::Vector3 localPointFlattened = AZ::Vector3(localPoint.GetX(), localY, 0.0f);
+
+            size_t intersections = 0;
+            for (AZ::u32 edgeIndex = edgeBuckets.m_bucketOffsets[bucket]; edgeIndex < edgeBuckets.m_bucketOffsets[bucket + 1]; ++edgeIndex)
+            {
+                const size_t i = edgeBuckets.m_bucketEdges[edgeIndex];
+                if (IsEdgeCrossed(vertices[i], vertices[(i + 1) % vertexCount], localPointFlattened, point))
+                {
+                    intersections++;
                 }
             }
 
@@ -514,6 +645,72 @@ namespace LmbrCentral
             return intersections & 1;
         }
 
+        void PolygonPrismEdgeBuckets::Build(const AZStd::vector<AZ::Vector2>& vertices)
+        {
+            // one bucket per edge keeps the buckets small without spending too much memory on big polygons
+            const size_t maxBucketCount = 256;
+            // the ray touches the edges that are less than this distance away from it
+            const float tolerance = 2.0f * sqrtf(s_edgeCrossingEpsilon);
+
+            m_bucketOffsets.clear();
+            m_bucketEdges.clear();
+
+            const size_t vertexCount = vertices.size();
+            if (vertexCount == 0)
+            {
+                return;
+            }
+
+            float minY = vertices[0].GetY();
+            float maxY = minY;
+            for (const AZ::Vector2& vertex : vertices)
+            {
+                minY = AZ::GetMin(minY, vertex.GetY());
+                maxY = AZ::GetMax(maxY, vertex.GetY());
+            }
+            m_minY = minY - tolerance;
+            m_maxY = maxY + tolerance;
+
+            const size_t bucketCount = AZ::GetClamp<size_t>(vertexCount, 1, maxBucketCount);
+            m_bucketsPerUnit = static_cast<float>(bucketCount) / (m_maxY - m_minY);
+
+            const auto getBucket = [this, bucketCount](float y)
+            {
+                return AZStd::min(static_cast<size_t>(AZ::GetMax(y - m_minY, 0.0f) * m_bucketsPerUnit), bucketCount - 1);
+            };
+
+            // count the edges of each bucket, then store them contiguously bucket after bucket
+            m_bucketOffsets.resize(bucketCount + 1, 0);
+            for (size_t i = 0; i < vertexCount; ++i)
+            {
+                const float startY = vertices[i].GetY();
+                const float endY = vertices[(i + 1) % vertexCount].GetY();
+                const size_t lastBucket = getBucket(AZ::GetMax(startY, endY) + tolerance);
+                for (size_t bucket = getBucket(AZ::GetMin(startY, endY) - tolerance); bucket <= lastBucket; ++bucket)
+                {
+                    ++m_bucketOffsets[bucket + 1];
+                }
+            }
+
+            for (size_t bucket = 0; bucket < bucketCount; ++bucket)
+            {
+                m_bucketOffsets[bucket + 1] += m_bucketOffsets[bucket];
+            }
+
+            AZStd::vector<AZ::u32> bucketFill(m_bucketOffsets.begin(), m_bucketOffsets.end() - 1);
+            m_bucketEdges.resize(m_bucketOffsets.back());
+            for (size_t i = 0; i < vertexCount; ++i)
+            {
+                const float startY = vertices[i].GetY();
+                const float endY = vertices[(i + 1) % vertexCount].GetY();
+                const size_t lastBucket = getBucket(AZ::GetMax(startY, endY) + tolerance);
+                for (size_t bucket = getBucket(AZ::GetMin(startY, endY) - tolerance); bucket <= lastBucket; ++bucket)
+                {
+                    m_bucketEdges[bucketFill[bucket]++] = static_cast<AZ::u32>(i);
+                }
+            }
+        }
+
         float DistanceSquaredFromPoint(const AZ::PolygonPrism& polygonPrism, const AZ::Vector3& point, const AZ::Transform& worldFromLocal)
         {
             const float height = polygonPrism.GetHeight();
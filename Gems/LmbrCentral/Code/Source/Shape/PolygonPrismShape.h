@@ -22,6 +22,23 @@ namespace LmbrCentral
 {
     struct ShapeDrawParams;
 
+    namespace PolygonPrismUtil
+    {
+        /// Edges of a polygon sorted in buckets along its local y axis, so the crossing test of a point only
+        /// visits the edges that can be touched by the ray cast along the x axis from that point.
+        struct PolygonPrismEdgeBuckets
+        {
+            /// Sorts the edges formed by the vertices of a polygon in buckets.
+            void Build(const AZStd::vector<AZ::Vector2>& vertices);
+
+            float m_minY = 0.0f; ///< Start of the first bucket, including the crossing test tolerance.
+            float m_maxY = 0.0f; ///< End of the last bucket, including the crossing test tolerance.
+            float m_bucketsPerUnit = 0.0f; ///< Number of buckets per unit along the local y axis.
+            AZStd::vector<AZ::u32> m_bucketOffsets; ///< Start of each bucket in m_bucketEdges, plus the end of the last bucket.
+            AZStd::vector<AZ::u32> m_bucketEdges; ///< Index of the first vertex of each edge overlapping a bucket.
+        };
+    } // namespace PolygonPrismUtil
+
     /// Buffer to store triangles of top and bottom of Polygon Prism.
     struct PolygonPrismMesh
     {
@@ -62,6 +79,8 @@ namespace LmbrCentral
         void GetTransformAndLocalBounds(AZ::Transform& transform, AZ::Aabb& bounds) override;
         bool IsPointInside(const AZ::Vector3& point) override;
         float DistanceSquaredFromPoint(const AZ::Vector3& point) override;
+        void ArePointsInside(const AZ::Vector3* points, bool* results, size_t pointCount) override;
+        void DistanceSquaredFromPoints(const AZ::Vector3* points, float* results, size_t pointCount) override;
         bool IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance) override;
 
         // PolygonShapeShapeComponentRequestBus::Handler
@@ -101,6 +120,8 @@ namespace LmbrCentral
 
             AZ::Aabb m_aabb; ///< Aabb of polygon prism shape.
             AZStd::vector<AZ::Vector3> m_triangles; ///< Triangles comprising the polygon prism shape (for intersection testing).
+            AZ::Transform m_localFromWorld; ///< Inverse of the uniformly scaled world transform (for point containment testing).
+            PolygonPrismUtil::PolygonPrismEdgeBuckets m_edgeBuckets; ///< Polygon edges sorted along the local y axis (for point containment testing).
         };
 
         AZ::PolygonPrismPtr m_polygonPrism; ///< Reference to the underlying polygon prism data.
@@ -129,6 +150,12 @@ namespace LmbrCentral
         /// Return if a point in world space is contained within a polygon prism shape
         bool IsPointInside(const AZ::PolygonPrism& polygonPrism, const AZ::Vector3& point, const AZ::Transform& transform);
 
+        /// Return if a point in world space is contained within a polygon prism shape, using edge buckets built
+        /// from the vertices of the polygon prism and the inverse of its uniformly scaled world transform.
+        bool IsPointInside(
+            const AZ::PolygonPrism& polygonPrism, const PolygonPrismEdgeBuckets& edgeBuckets,
+            const AZ::Vector3& point, const AZ::Transform& localFromWorld);
+
         /// Return distance squared from point in world space from polygon prism shape
         float DistanceSquaredFromPoint(const AZ::PolygonPrism& polygonPrism, const AZ::Vector3& point, const AZ::Transform& transform);
 
@@ -14,6 +14,7 @@
 #include <AzCore/Math/Obb.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
 #include <LmbrCentral/Shape/QuadShapeComponentBus.h>
 #include <Shape/ShapeDisplay.h>
 
@@ -179,6 +180,32 @@ namespace LmbrCentral
         return xDist * xDist + yDist * yDist + zDist * zDist;
     }
 
+    void QuadShape::ArePointsInside([[maybe_unused]] const AZ::Vector3* points, bool* results, size_t pointCount)
+    {
+        AZStd::fill(results, results + pointCount, false); // 2D object cannot have points that are strictly inside in 3d space.
+    }
+
+    void QuadShape::DistanceSquaredFromPoints(const AZ::Vector3* points, float* results, size_t pointCount)
+    {
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_quadShapeConfig, m_currentNonUniformScale);
+
+        const AZ::Quaternion localFromWorldRotation = m_currentTransform.GetRotation().GetInverseFull();
+        const AZ::Vector3 translation = m_currentTransform.GetTranslation();
+        const float halfWidth = m_intersectionDataCache.m_scaledWidth * 0.5f;
+        const float halfHeight = m_intersectionDataCache.m_scaledHeight * 0.5f;
+
+        for (size_t i = 0; i < pointCount; ++i)
+        {
+            const AZ::Vector3 tPoint = localFromWorldRotation.TransformVector(points[i] - translation);
+
+            const float xDist = AZ::GetMax<float>(AZ::GetMax<float>(-halfWidth - tPoint.GetX(), 0.0f), tPoint.GetX() - halfWidth);
+            const float yDist = AZ::GetMax<float>(AZ::GetMax<float>(-halfHeight - tPoint.GetY(), 0.0f), tPoint.GetY() - halfHeight);
+            const float zDist = tPoint.GetZ();
+
+            results[i] = xDist * xDist + yDist * yDist + zDist * zDist;
+        }
+    }
+
     bool QuadShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         auto corners = m_quadShapeConfig.GetCorners();
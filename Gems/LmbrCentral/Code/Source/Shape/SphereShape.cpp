@@ -118,6 +118,31 @@ namespace LmbrCentral
         return powf(AZStd::max(distance, 0.0f), 2.0f);
     }
 
+    void SphereShape::ArePointsInside(const AZ::Vector3* points, bool* results, size_t pointCount)
+    {
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_sphereShapeConfig);
+
+        const AZ::Vector3 center = m_intersectionDataCache.m_position;
+        const float radiusSquared = m_intersectionDataCache.m_radius * m_intersectionDataCache.m_radius;
+        for (size_t i = 0; i < pointCount; ++i)
+        {
+            results[i] = AZ::Intersect::PointSphere(center, radiusSquared, points[i]);
+        }
+    }
+
+    void SphereShape::DistanceSquaredFromPoints(const AZ::Vector3* points, float* results, size_t pointCount)
+    {
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_sphereShapeConfig);
+
+        const AZ::Vector3 center = m_intersectionDataCache.m_position;
+        const float radius = m_intersectionDataCache.m_radius;
+        for (size_t i = 0; i < pointCount; ++i)
+        {
+            const float distance = AZStd::max(points[i].GetDistance(center) - radius, 0.0f);
+            results[i] = distance * distance;
+        }
+    }
+
     bool SphereShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_sphereShapeConfig);
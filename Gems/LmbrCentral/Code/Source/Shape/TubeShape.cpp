@@ -9,6 +9,7 @@
 #include "TubeShape.h"
 
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/algorithm.h>
 #include <Shape/ShapeGeometryUtil.h>
 
 #if LMBR_CENTRAL_EDITOR
@@ -257,6 +258,51 @@ namespace LmbrCentral
         return powf((sqrtf(splineQueryResult.m_distanceSq) - (m_radius + variableRadius)) * uniformScale, 2.0f);
     }
 
+    void TubeShape::ArePointsInside(const AZ::Vector3* points, bool* results, size_t pointCount)
+    {
+        if (m_spline == nullptr)
+        {
+            AZStd::fill(results, results + pointCount, false);
+            return;
+        }
+
+        // the inverse transform is the expensive part of IsPointInside that doesn't depend on the point
+        AZ::Transform worldFromLocalNormalized = m_currentTransform;
+        const float scale = worldFromLocalNormalized.ExtractUniformScale();
+        const AZ::Transform localFromWorldNormalized = worldFromLocalNormalized.GetInverse();
+        const float radiusSq = m_radius * m_radius;
+
+        for (size_t i = 0; i < pointCount; ++i)
+        {
+            const AZ::Vector3 localPoint = localFromWorldNormalized.TransformPoint(points[i]) / scale;
+
+            const auto address = m_spline->GetNearestAddressPosition(localPoint).m_splineAddress;
+            const float variableRadius = m_variableRadius.GetElementInterpolated(address, Lerpf);
+
+            results[i] =
+                (m_spline->GetPosition(address) - localPoint).GetLengthSq() < (radiusSq + variableRadius * variableRadius) * scale;
+        }
+    }
+
+    void TubeShape::DistanceSquaredFromPoints(const AZ::Vector3* points, float* results, size_t pointCount)
+    {
+        AZ::Transform worldFromLocalNormalized = m_currentTransform;
+        const float uniformScale = worldFromLocalNormalized.ExtractUniformScale();
+        const AZ::Transform localFromWorldNormalized = worldFromLocalNormalized.GetInverse();
+
+        for (size_t i = 0; i < pointCount; ++i)
+        {
+            const AZ::Vector3 localPoint = localFromWorldNormalized.TransformPoint(points[i]) / uniformScale;
+
+            const auto splineQueryResult = m_spline->GetNearestAddressPosition(localPoint);
+            const float variableRadius =
+                m_variableRadius.GetElementInterpolated(splineQueryResult.m_splineAddress, Lerpf);
+
+            const float distance = (sqrtf(splineQueryResult.m_distanceSq) - (m_radius + variableRadius)) * uniformScale;
+            results[i] = distance * distance;
+        }
+    }
+
     bool TubeShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         AZ::Transform transformUniformScale = m_currentTransform;
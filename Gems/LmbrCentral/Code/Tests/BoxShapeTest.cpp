@@ -628,6 +628,45 @@ namespace UnitTest
         EXPECT_NEAR(distance, 1.1140f, 1e-3f);
     }
 
+    TEST_F(BoxShapeTest, PointListQueriesMatchSinglePointQueries)
+    {
+        AZ::Entity entity;
+        const AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(
+            AZ::Quaternion(0.26f, 0.74f, 0.22f, 0.58f), AZ::Vector3(12.0f, -16.0f, 3.0f));
+        CreateBoxWithNonUniformScale(transform, AZ::Vector3(0.5f, 2.0f, 3.0f), AZ::Vector3(4.0f, 3.0f, 7.0f), entity);
+
+        AZ::Aabb bounds = AZ::Aabb::CreateNull();
+        LmbrCentral::ShapeComponentRequestsBus::EventResult(
+            bounds, entity.GetId(), &LmbrCentral::ShapeComponentRequests::GetEncompassingAabb);
+        bounds.Expand(AZ::Vector3(1.0f));
+
+        AZ::SimpleLcgRandom random(1234);
+        AZStd::vector<AZ::Vector3> points;
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            const AZ::Vector3 fraction(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat());
+            points.push_back(bounds.GetMin() + bounds.GetExtents() * fraction);
+        }
+
+        AZStd::vector<bool> insideResults(points.size(), false);
+        AZStd::vector<float> distanceResults(points.size(), 0.0f);
+        LmbrCentral::ShapeComponentRequestsBus::Event(
+            entity.GetId(), &LmbrCentral::ShapeComponentRequests::ArePointsInside, points.data(), insideResults.data(), points.size());
+        LmbrCentral::ShapeComponentRequestsBus::Event(
+            entity.GetId(), &LmbrCentral::ShapeComponentRequests::DistanceSquaredFromPoints, points.data(), distanceResults.data(),
+            points.size());
+
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            EXPECT_EQ(insideResults[i], IsPointInside(entity, points[i]));
+
+            float distanceSquared = AZ::Constants::FloatMax;
+            LmbrCentral::ShapeComponentRequestsBus::EventResult(
+                distanceSquared, entity.GetId(), &LmbrCentral::ShapeComponentRequests::DistanceSquaredFromPoint, points[i]);
+            EXPECT_NEAR(distanceResults[i], distanceSquared, 1e-4f);
+        }
+    }
+
     TEST_F(BoxShapeTest, DebugDraw)
     {
         AZ::Entity entity;
@@ -10,6 +10,7 @@
 
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Math/Matrix3x3.h>
+#include <AzCore/Math/Random.h>
 #include <AzCore/Math/VertexContainerInterface.h>
 #include <AzFramework/Components/TransformComponent.h>
 #include <AzFramework/Components/NonUniformScaleComponent.h>
@@ -505,6 +506,61 @@ namespace UnitTest
         }
     }
 
+    TEST_F(PolygonPrismShapeTest, PolygonShapeComponent_PointListQueriesMatchSinglePointQueries)
+    {
+        AZ::Entity entity;
+        AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(
+            AZ::Quaternion::CreateRotationY(AZ::DegToRad(45.0f)), AZ::Vector3(3.0f, 4.0f, 5.0f));
+        transform.MultiplyByUniformScale(1.5f);
+        const float height = 1.2f;
+        const AZ::Vector3 nonUniformScale(2.0f, 1.2f, 0.5f);
+
+        // concave polygon with vertices sharing the same y, to exercise the edge buckets of the point list queries
+        const AZStd::vector<AZ::Vector2> vertices =
+        {
+            AZ::Vector2(-2.0f, -2.0f),
+            AZ::Vector2(2.0f, -2.0f),
+            AZ::Vector2(2.0f, 2.0f),
+            AZ::Vector2(0.0f, 0.0f),
+            AZ::Vector2(-2.0f, 2.0f)
+        };
+
+        CreatePolygonPrismWithNonUniformScale(transform, height, vertices, nonUniformScale, entity);
+
+        AZ::Aabb bounds = AZ::Aabb::CreateNull();
+        LmbrCentral::ShapeComponentRequestsBus::EventResult(bounds, entity.GetId(),
+            &LmbrCentral::ShapeComponentRequests::GetEncompassingAabb);
+        bounds.Expand(AZ::Vector3(1.0f));
+
+        AZ::SimpleLcgRandom random(1234);
+        AZStd::vector<AZ::Vector3> points;
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            const AZ::Vector3 fraction(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat());
+            points.push_back(bounds.GetMin() + bounds.GetExtents() * fraction);
+        }
+
+        AZStd::vector<bool> insideResults(points.size(), false);
+        AZStd::vector<float> distanceResults(points.size(), 0.0f);
+        LmbrCentral::ShapeComponentRequestsBus::Event(entity.GetId(),
+            &LmbrCentral::ShapeComponentRequests::ArePointsInside, points.data(), insideResults.data(), points.size());
+        LmbrCentral::ShapeComponentRequestsBus::Event(entity.GetId(),
+            &LmbrCentral::ShapeComponentRequests::DistanceSquaredFromPoints, points.data(), distanceResults.data(), points.size());
+
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            bool inside = false;
+            LmbrCentral::ShapeComponentRequestsBus::EventResult(inside, entity.GetId(),
+                &LmbrCentral::ShapeComponentRequests::IsPointInside, points[i]);
+            EXPECT_EQ(insideResults[i], inside);
+
+            float distanceSquared = AZ::Constants::FloatMax;
+            LmbrCentral::ShapeComponentRequestsBus::EventResult(distanceSquared, entity.GetId(),
+                &LmbrCentral::ShapeComponentRequests::DistanceSquaredFromPoint, points[i]);
+            EXPECT_NEAR(distanceResults[i], distanceSquared, 1e-4f);
+        }
+    }
+
     // ccw
     TEST_F(PolygonPrismShapeTest, GetRayIntersectPolygonPrismSuccess1)
     {
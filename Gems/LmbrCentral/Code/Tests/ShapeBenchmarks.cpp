@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <Shape/BoxShapeComponent.h>
+#include <Shape/CapsuleShapeComponent.h>
+#include <Shape/CylinderShapeComponent.h>
+#include <Shape/PolygonPrismShapeComponent.h>
+#include <Shape/SphereShapeComponent.h>
+#include <Shape/SplineComponent.h>
+#include <Shape/TubeShapeComponent.h>
+
+namespace UnitTest
+{
+    namespace ShapeBenchmarkSettings
+    {
+        //! Number of points tested against the shape on every iteration.
+        static const size_t PointCount = 1024 * 1024;
+
+        //! Values passed to the benchmark to select the shape the points are tested against.
+        enum ShapeType
+        {
+            Box,
+            Sphere,
+            Capsule,
+            Cylinder,
+            PolygonPrism,
+            Tube,
+            ShapeTypeCount
+        };
+    } // namespace ShapeBenchmarkSettings
+
+    //! Creates a rotated shape of the type selected by the benchmark and random points in a volume a bit larger
+    //! than the shape, so the points are split between inside and outside of the shape.
+    class ShapeBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+        void internalSetUp(const benchmark::State& state)
+        {
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            for (AZ::ComponentDescriptor* descriptor :
+                {
+                    AzFramework::TransformComponent::CreateDescriptor(),
+                    LmbrCentral::BoxShapeComponent::CreateDescriptor(),
+                    LmbrCentral::SphereShapeComponent::CreateDescriptor(),
+                    LmbrCentral::CapsuleShapeComponent::CreateDescriptor(),
+                    LmbrCentral::CylinderShapeComponent::CreateDescriptor(),
+                    LmbrCentral::PolygonPrismShapeComponent::CreateDescriptor(),
+                    LmbrCentral::SplineComponent::CreateDescriptor(),
+                    LmbrCentral::TubeShapeComponent::CreateDescriptor()
+                })
+            {
+                descriptor->Reflect(m_serializeContext.get());
+                m_componentDescriptors.emplace_back(descriptor);
+            }
+
+            m_entity = AZStd::make_unique<AZ::Entity>();
+            CreateShape(static_cast<ShapeBenchmarkSettings::ShapeType>(state.range(0)));
+
+            AZ::Aabb bounds = AZ::Aabb::CreateNull();
+            LmbrCentral::ShapeComponentRequestsBus::EventResult(
+                bounds, m_entity->GetId(), &LmbrCentral::ShapeComponentRequests::GetEncompassingAabb);
+            bounds.Expand(bounds.GetExtents() * 0.25f);
+
+            AZ::SimpleLcgRandom random(1234);
+            m_points.reserve(ShapeBenchmarkSettings::PointCount);
+            for (size_t i = 0; i < ShapeBenchmarkSettings::PointCount; ++i)
+            {
+                const AZ::Vector3 fraction(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat());
+                m_points.push_back(bounds.GetMin() + bounds.GetExtents() * fraction);
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_points = {};
+            m_entity.reset();
+            m_componentDescriptors.clear();
+            m_serializeContext.reset();
+        }
+
+        void CreateShape(ShapeBenchmarkSettings::ShapeType shapeType)
+        {
+            m_entity->CreateComponent<AzFramework::TransformComponent>();
+            switch (shapeType)
+            {
+            case ShapeBenchmarkSettings::Box:
+                m_entity->CreateComponent<LmbrCentral::BoxShapeComponent>();
+                break;
+            case ShapeBenchmarkSettings::Sphere:
+                m_entity->CreateComponent<LmbrCentral::SphereShapeComponent>();
+                break;
+            case ShapeBenchmarkSettings::Capsule:
+                m_entity->CreateComponent<LmbrCentral::CapsuleShapeComponent>();
+                break;
+            case ShapeBenchmarkSettings::Cylinder:
+                m_entity->CreateComponent<LmbrCentral::CylinderShapeComponent>();
+                break;
+            case ShapeBenchmarkSettings::PolygonPrism:
+                m_entity->CreateComponent<LmbrCentral::PolygonPrismShapeComponent>();
+                break;
+            case ShapeBenchmarkSettings::Tube:
+                m_entity->CreateComponent<LmbrCentral::SplineComponent>();
+                m_entity->CreateComponent<LmbrCentral::TubeShapeComponent>();
+                break;
+            default:
+                break;
+            }
+
+            m_entity->Init();
+            m_entity->Activate();
+
+            const AZ::EntityId entityId = m_entity->GetId();
+            const AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(
+                AZ::Quaternion::CreateRotationZ(0.5f) * AZ::Quaternion::CreateRotationX(0.25f), AZ::Vector3(10.0f, 20.0f, 30.0f));
+            AZ::TransformBus::Event(entityId, &AZ::TransformBus::Events::SetWorldTM, transform);
+
+            switch (shapeType)
+            {
+            case ShapeBenchmarkSettings::Box:
+                LmbrCentral::BoxShapeComponentRequestsBus::Event(
+                    entityId, &LmbrCentral::BoxShapeComponentRequests::SetBoxDimensions, AZ::Vector3(4.0f, 6.0f, 8.0f));
+                break;
+            case ShapeBenchmarkSettings::Sphere:
+                LmbrCentral::SphereShapeComponentRequestsBus::Event(entityId, &LmbrCentral::SphereShapeComponentRequests::SetRadius, 4.0f);
+                break;
+            case ShapeBenchmarkSettings::Capsule:
+                LmbrCentral::CapsuleShapeComponentRequestsBus::Event(entityId, &LmbrCentral::CapsuleShapeComponentRequests::SetHeight, 8.0f);
+                LmbrCentral::CapsuleShapeComponentRequestsBus::Event(entityId, &LmbrCentral::CapsuleShapeComponentRequests::SetRadius, 2.0f);
+                break;
+            case ShapeBenchmarkSettings::Cylinder:
+                LmbrCentral::CylinderShapeComponentRequestsBus::Event(entityId, &LmbrCentral::CylinderShapeComponentRequests::SetHeight, 8.0f);
+                LmbrCentral::CylinderShapeComponentRequestsBus::Event(entityId, &LmbrCentral::CylinderShapeComponentRequests::SetRadius, 2.0f);
+                break;
+            case ShapeBenchmarkSettings::PolygonPrism:
+                {
+                    // star shaped polygon, so the crossing test has to visit many edges
+                    const size_t vertexCount = 64;
+                    AZStd::vector<AZ::Vector2> vertices;
+                    for (size_t i = 0; i < vertexCount; ++i)
+                    {
+                        const float angle = AZ::Constants::TwoPi * static_cast<float>(i) / static_cast<float>(vertexCount);
+                        const float radius = (i % 2) ? 2.0f : 5.0f;
+                        vertices.push_back(AZ::Vector2(cosf(angle), sinf(angle)) * radius);
+                    }
+                    LmbrCentral::PolygonPrismShapeComponentRequestBus::Event(
+                        entityId, &LmbrCentral::PolygonPrismShapeComponentRequests::SetHeight, 4.0f);
+                    LmbrCentral::PolygonPrismShapeComponentRequestBus::Event(
+                        entityId, &LmbrCentral::PolygonPrismShapeComponentRequests::SetVertices, vertices);
+                }
+                break;
+            case ShapeBenchmarkSettings::Tube:
+                LmbrCentral::SplineComponentRequestBus::Event(
+                    entityId, &LmbrCentral::SplineComponentRequests::SetVertices,
+                    AZStd::vector<AZ::Vector3>
+                    {
+                        AZ::Vector3(-6.0f, 0.0f, 0.0f), AZ::Vector3(-2.0f, 2.0f, 0.0f),
+                        AZ::Vector3(2.0f, -2.0f, 1.0f), AZ::Vector3(6.0f, 0.0f, 0.0f)
+                    });
+                LmbrCentral::TubeShapeComponentRequestsBus::Event(entityId, &LmbrCentral::TubeShapeComponentRequests::SetRadius, 1.5f);
+                break;
+            default:
+                break;
+            }
+        }
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        AZ::EntityId GetShapeEntityId() const
+        {
+            return m_entity->GetId();
+        }
+
+        AZStd::vector<AZ::Vector3> m_points;
+
+    private:
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::vector<AZStd::unique_ptr<AZ::ComponentDescriptor>> m_componentDescriptors;
+        AZStd::unique_ptr<AZ::Entity> m_entity;
+    };
+
+    //! Tests the points one at a time, the way the callers of the shapes query them point by point.
+    BENCHMARK_DEFINE_F(ShapeBenchmarkFixture, BM_IsPointInside)(benchmark::State& state)
+    {
+        const AZ::EntityId entityId = GetShapeEntityId();
+        AZStd::vector<bool> results(m_points.size(), false);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t i = 0; i < m_points.size(); ++i)
+            {
+                bool inside = false;
+                LmbrCentral::ShapeComponentRequestsBus::EventResult(
+                    inside, entityId, &LmbrCentral::ShapeComponentRequests::IsPointInside, m_points[i]);
+                results[i] = inside;
+            }
+            benchmark::DoNotOptimize(results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_points.size());
+    }
+
+    //! Tests all the points with a single request.
+    BENCHMARK_DEFINE_F(ShapeBenchmarkFixture, BM_ArePointsInside)(benchmark::State& state)
+    {
+        const AZ::EntityId entityId = GetShapeEntityId();
+        AZStd::vector<bool> results(m_points.size(), false);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            LmbrCentral::ShapeComponentRequestsBus::Event(
+                entityId, &LmbrCentral::ShapeComponentRequests::ArePointsInside, m_points.data(), results.data(), m_points.size());
+            benchmark::DoNotOptimize(results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_points.size());
+    }
+
+    BENCHMARK_DEFINE_F(ShapeBenchmarkFixture, BM_DistanceSquaredFromPoint)(benchmark::State& state)
+    {
+        const AZ::EntityId entityId = GetShapeEntityId();
+        AZStd::vector<float> results(m_points.size(), 0.0f);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t i = 0; i < m_points.size(); ++i)
+            {
+                LmbrCentral::ShapeComponentRequestsBus::EventResult(
+                    results[i], entityId, &LmbrCentral::ShapeComponentRequests::DistanceSquaredFromPoint, m_points[i]);
+            }
+            benchmark::DoNotOptimize(results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_points.size());
+    }
+
+    BENCHMARK_DEFINE_F(ShapeBenchmarkFixture, BM_DistanceSquaredFromPoints)(benchmark::State& state)
+    {
+        const AZ::EntityId entityId = GetShapeEntityId();
+        AZStd::vector<float> results(m_points.size(), 0.0f);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            LmbrCentral::ShapeComponentRequestsBus::Event(
+                entityId, &LmbrCentral::ShapeComponentRequests::DistanceSquaredFromPoints, m_points.data(), results.data(), m_points.size());
+            benchmark::DoNotOptimize(results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_points.size());
+    }
+
+    BENCHMARK_REGISTER_F(ShapeBenchmarkFixture, BM_IsPointInside)
+        ->DenseRange(0, ShapeBenchmarkSettings::ShapeTypeCount - 1)
+        ->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(ShapeBenchmarkFixture, BM_ArePointsInside)
+        ->DenseRange(0, ShapeBenchmarkSettings::ShapeTypeCount - 1)
+        ->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(ShapeBenchmarkFixture, BM_DistanceSquaredFromPoint)
+        ->DenseRange(0, ShapeBenchmarkSettings::ShapeTypeCount - 1)
+        ->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(ShapeBenchmarkFixture, BM_DistanceSquaredFromPoints)
+        ->DenseRange(0, ShapeBenchmarkSettings::ShapeTypeCount - 1)
+        ->Unit(benchmark::kMillisecond);
+} // namespace UnitTest
+#endif // HAVE_BENCHMARK
@@ -144,6 +144,32 @@ namespace LmbrCentral
         /// @return float indicating square distance point is from shape
         virtual float DistanceSquaredFromPoint(const AZ::Vector3& point) = 0;
 
+        /// @brief Checks if each point of a list is inside a shape or outside it
+        /// Shapes override this to update their cached data once per call instead of once per point.
+        /// @param points Array of pointCount Vector3 to be tested
+        /// @param results Array of pointCount bool set to whether each point is inside or out
+        /// @param pointCount Number of points to test
+        virtual void ArePointsInside(const AZ::Vector3* points, bool* results, size_t pointCount)
+        {
+            for (size_t i = 0; i < pointCount; ++i)
+            {
+                results[i] = IsPointInside(points[i]);
+            }
+        }
+
+        /// @brief Returns the min squared distance each point of a list is from the shape
+        /// Shapes override this to update their cached data once per call instead of once per point.
+        /// @param points Array of pointCount Vector3 to calculate square distance from
+        /// @param results Array of pointCount float set to the square distance each point is from shape
+        /// @param pointCount Number of points to calculate square distance from
+        virtual void DistanceSquaredFromPoints(const AZ::Vector3* points, float* results, size_t pointCount)
+        {
+            for (size_t i = 0; i < pointCount; ++i)
+            {
+                results[i] = DistanceSquaredFromPoint(points[i]);
+            }
+        }
+
         /// @brief Returns a random position inside the volume.
         /// @param randomDistribution An enum representing the different random distributions to use.
         virtual AZ::Vector3 GenerateRandomPointInside(AZ::RandomDistributionType /*randomDistribution*/)
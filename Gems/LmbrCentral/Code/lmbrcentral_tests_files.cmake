@@ -20,6 +20,7 @@ set(FILES
     Tests/LmbrCentralReflectionTest.h
     Tests/LmbrCentralReflectionTest.cpp
     Tests/LmbrCentralTest.cpp
+    Tests/ShapeBenchmarks.cpp
     Tests/ShapeGeometryUtilTest.cpp
     Tests/SpawnerComponentTest.cpp
     Tests/SplineComponentTests.cpp
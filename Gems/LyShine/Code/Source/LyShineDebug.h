@@ -59,8 +59,11 @@ public: // static member functions
         int m_numNodesDueToMaxVerts;
         int m_numNodesDueToTextures;
         bool m_wasBuiltThisFrame;
+        bool m_wasUpdatedThisFrame;             //!< true if only some elements were re-rendered into the graph this frame
         AZ::u64 m_timeGraphLastBuiltMs;
         bool m_isReusingRenderTargets;
+        int m_numElementsRendered;              //!< elements rendered into the graph this frame
+        int m_numVerticesRendered;              //!< vertices added to the graph this frame
     };
 
     struct DebugInfoTextureUsage
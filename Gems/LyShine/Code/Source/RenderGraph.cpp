@@ -13,6 +13,10 @@
 #include <Atom/RHI/RHISystemInterface.h>
 
 #include <AzCore/Math/MatrixUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+#include <LyShine/Bus/UiRenderBus.h>
 
 #ifndef _RELEASE
 #include <AzCore/Asset/AssetManagerBus.h>
@@ -154,9 +158,12 @@ namespace LyShine
         // [LYSHINE_ATOM_TODO][ATOM-15073] - need to combine into a single DrawIndexed call to take advantage of the draw call
         // optimization done by this RenderGraph. This option will be added to DynamicDrawContext. For
         // now we could combine the vertices ourselves
-        for (const DynUiPrimitive& primitive : m_primitives)
+        for (const DynUiPrimitive* primitive : m_primitives)
         {
-            dynamicDraw->DrawIndexed(primitive.m_vertices, primitive.m_numVertices, primitive.m_indices, primitive.m_numIndices, AZ::RHI::IndexFormat::Uint16, drawSrg);
+            if (primitive)
+            {
+                dynamicDraw->DrawIndexed(primitive->m_vertices, primitive->m_numVertices, primitive->m_indices, primitive->m_numIndices, AZ::RHI::IndexFormat::Uint16, drawSrg);
+            }
         }
 
         uiRenderer->SetBaseState(prevBaseState);
@@ -165,18 +172,31 @@ namespace LyShine
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void PrimitiveListRenderNode::AddPrimitive(DynUiPrimitive* primitive)
     {
-        // always clear the next pointer before adding to list
-        primitive->m_next = nullptr;
-        m_primitives.push_back(*primitive);
+        m_primitives.push_back(primitive);
 
         m_totalNumVertices += primitive->m_numVertices;
         m_totalNumIndices += primitive->m_numIndices;
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
-    DynUiPrimitiveList& PrimitiveListRenderNode::GetPrimitives() const
+    void PrimitiveListRenderNode::ReplacePrimitive(size_t primitiveIndex, DynUiPrimitive* primitive, int prevNumVertices, int prevNumIndices)
     {
-        return const_cast<DynUiPrimitiveList&>(m_primitives);
+        AZ_Assert(primitiveIndex < m_primitives.size(), "Replacing a primitive that was not added to this render node");
+        m_primitives[primitiveIndex] = primitive;
+
+        m_totalNumVertices -= prevNumVertices;
+        m_totalNumIndices -= prevNumIndices;
+        if (primitive)
+        {
+            m_totalNumVertices += primitive->m_numVertices;
+            m_totalNumIndices += primitive->m_numIndices;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    const AZStd::vector<DynUiPrimitive*>& PrimitiveListRenderNode::GetPrimitives() const
+    {
+        return m_primitives;
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -203,6 +223,12 @@ namespace LyShine
         return primitive->m_numVertices + m_totalNumVertices < std::numeric_limits<uint16>::max();
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool PrimitiveListRenderNode::HasSpaceToReplacePrimitive(int prevNumVertices, DynUiPrimitive* primitive) const
+    {
+        return primitive->m_numVertices + m_totalNumVertices - prevNumVertices < std::numeric_limits<uint16>::max();
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     int PrimitiveListRenderNode::FindTexture(const AZ::Data::Instance<AZ::RPI::Image>& texture, bool isClampTextureMode) const
     {
@@ -220,22 +246,21 @@ namespace LyShine
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void PrimitiveListRenderNode::ValidateNode()
     {
-        size_t numPrims = m_primitives.size();
-        size_t primCount = 0;
-        const DynUiPrimitive* lastPrim = nullptr;
         int highestTexUnit = 0;
-        for (const DynUiPrimitive& primitive : m_primitives)
+        int numVertices = 0;
+        for (const DynUiPrimitive* primitive : m_primitives)
         {
-            if (primCount > numPrims)
+            if (!primitive)
             {
-                AZ_Error("UI", false, "There are more primitives in the m_primitives slist than m_primitives.size (%d)", numPrims)
+                // detached by an element that is waiting to be re-rendered
+                continue;
             }
-            primCount++;
-            lastPrim = &primitive;
 
-            if (primitive.m_vertices[0].texIndex > highestTexUnit)
+            numVertices += primitive->m_numVertices;
+
+            if (primitive->m_vertices[0].texIndex > highestTexUnit)
             {
-                highestTexUnit = primitive.m_vertices[0].texIndex;
+                highestTexUnit = primitive->m_vertices[0].texIndex;
             }
         }
 
@@ -244,9 +269,9 @@ namespace LyShine
             AZ_Error("UI", false, "m_numTextures (%d) is not highestTexUnit+1 (%d)", m_numTextures, highestTexUnit+1)
         }
 
-        if (numPrims > 0 && lastPrim != &*m_primitives.last())
+        if (numVertices != m_totalNumVertices)
         {
-            AZ_Error("UI", false, "lastPrim is not the same as last node")
+            AZ_Error("UI", false, "m_totalNumVertices (%d) does not match the vertices in the primitives (%d)", m_totalNumVertices, numVertices)
         }
     }
 #endif
@@ -613,8 +638,12 @@ namespace LyShine
         }
         m_renderNodeListStack.push(&m_renderNodes);
 
+        ClearRetainedElements();
+
         m_isDirty = true;
         m_renderToRenderTargetCount = 0;
+        m_numElementsRendered = 0;
+        m_numVerticesRendered = 0;
 
 #ifndef _RELEASE  
         m_wasBuiltThisFrame = true;
@@ -708,6 +737,23 @@ namespace LyShine
     void RenderGraph::AddPrimitiveAtom(DynUiPrimitive* primitive, const AZ::Data::Instance<AZ::RPI::Image>& texture,
         bool isClampTextureMode, bool isTextureSRGB, bool isTexturePremultipliedAlpha, BlendMode blendMode)
     {
+        RetainedPrimitive retainedPrimitive;
+        const bool isRetaining = m_currentRetainedElement || m_updatingRetainedElement;
+        if (isRetaining)
+        {
+            retainedPrimitive.m_texture = texture;
+            retainedPrimitive.m_isClampTextureMode = isClampTextureMode;
+            retainedPrimitive.m_isTextureSRGB = isTextureSRGB;
+            retainedPrimitive.m_isTexturePremultipliedAlpha = isTexturePremultipliedAlpha;
+            retainedPrimitive.m_blendMode = blendMode;
+
+            if (m_updatingRetainedElement)
+            {
+                UpdateRetainedPrimitive(primitive, retainedPrimitive);
+                return;
+            }
+        }
+
         AZStd::vector<RenderNode*>* renderNodeList = m_renderNodeListStack.top();
 
         int texUnit = -1;
@@ -774,6 +820,14 @@ namespace LyShine
 
             // add this primitive to the render node
             renderNodeToAddTo->AddPrimitive(primitive);
+            m_numVerticesRendered += primitive->m_numVertices;
+
+            if (isRetaining)
+            {
+                retainedPrimitive.m_renderNode = renderNodeToAddTo;
+                retainedPrimitive.m_texUnit = texUnit;
+                RecordRetainedPrimitive(primitive, retainedPrimitive);
+            }
         }
     }
 
@@ -786,6 +840,24 @@ namespace LyShine
         bool isTexturePremultipliedAlpha,
         BlendMode blendMode)
     {
+        RetainedPrimitive retainedPrimitive;
+        const bool isRetaining = m_currentRetainedElement || m_updatingRetainedElement;
+        if (isRetaining)
+        {
+            retainedPrimitive.m_texture = contentAttachmentImage;
+            retainedPrimitive.m_maskTexture = maskAttachmentImage;
+            retainedPrimitive.m_isClampTextureMode = isClampTextureMode;
+            retainedPrimitive.m_isTextureSRGB = isTextureSRGB;
+            retainedPrimitive.m_isTexturePremultipliedAlpha = isTexturePremultipliedAlpha;
+            retainedPrimitive.m_blendMode = blendMode;
+
+            if (m_updatingRetainedElement)
+            {
+                UpdateRetainedPrimitive(primitive, retainedPrimitive);
+                return;
+            }
+        }
+
         AZStd::vector<RenderNode*>* renderNodeList = m_renderNodeListStack.top();
 
         int texUnit0 = -1;
@@ -858,6 +930,15 @@ namespace LyShine
 
             // add this primitive to the render node
             renderNodeToAddTo->AddPrimitive(primitive);
+            m_numVerticesRendered += primitive->m_numVertices;
+
+            if (isRetaining)
+            {
+                retainedPrimitive.m_renderNode = renderNodeToAddTo;
+                retainedPrimitive.m_texUnit = texUnit0;
+                retainedPrimitive.m_maskTexUnit = texUnit1;
+                RecordRetainedPrimitive(primitive, retainedPrimitive);
+            }
         }
     }
 
@@ -872,6 +953,12 @@ namespace LyShine
 
         static uint16 indices[numIndicesInQuad] = { 0, 1, 2, 2, 3, 0 };
 
+        if (m_updatingRetainedElement)
+        {
+            // Dynamic quads live until the graph is reset, so an element that uses them is not re-rendered on its own
+            m_updateFailed = true;
+        }
+
         DynamicQuad* quad = new DynamicQuad;
         for (int i = 0; i < numVertsInQuad; ++i)
         {
@@ -1005,6 +1092,139 @@ namespace LyShine
         return m_isDirty;
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::BeginElement(AZ::EntityId elementId)
+    {
+        AZ_Assert(!m_currentRetainedElement, "Calling BeginElement while already recording an element");
+
+        auto insertResult = m_retainedElementIndices.emplace(elementId, m_retainedElements.size());
+        if (!insertResult.second)
+        {
+            // The element is being rendered more than once, it can only be updated by rebuilding the graph
+            m_retainedElements[insertResult.first->second].m_isRetainable = false;
+            return;
+        }
+
+        RetainedElement& element = m_retainedElements.emplace_back();
+        element.m_alphaFade = GetAlphaFade();
+        element.m_isRenderingToMask = m_isRenderingToMask;
+        element.m_isInRenderTarget = m_renderTargetNestLevel > 0;
+        element.m_firstPrimitive = m_retainedPrimitives.size();
+
+        m_currentRetainedElement = &element;
+        ++m_numElementsRendered;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::EndElement()
+    {
+        m_currentRetainedElement = nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::SetElementDirty(AZ::EntityId elementId)
+    {
+        if (m_isDirty)
+        {
+            // the whole graph is going to be rebuilt anyway
+            return;
+        }
+
+        auto elementIter = m_retainedElementIndices.find(elementId);
+        if (elementIter == m_retainedElementIndices.end() || !m_retainedElements[elementIter->second].m_isRetainable)
+        {
+            // The element did not render through the standard path when the graph was built (it may be rendered by a
+            // render control component, or it may not have been rendered at all) so there is nothing to update in place
+            SetDirtyFlag(true);
+            return;
+        }
+
+        // Detach the element's primitives straight away. The component may free them before the graph is next rendered.
+        const RetainedElement& element = m_retainedElements[elementIter->second];
+        for (size_t i = element.m_firstPrimitive; i < element.m_firstPrimitive + element.m_numPrimitives; ++i)
+        {
+            RetainedPrimitive& retainedPrimitive = m_retainedPrimitives[i];
+            retainedPrimitive.m_renderNode->ReplacePrimitive(retainedPrimitive.m_primitiveIndex, nullptr,
+                retainedPrimitive.m_numVertices, retainedPrimitive.m_numIndices);
+            retainedPrimitive.m_numVertices = 0;
+            retainedPrimitive.m_numIndices = 0;
+        }
+
+        m_dirtyElements.push_back(elementId);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool RenderGraph::UpdateDirtyElements()
+    {
+        if (m_dirtyElements.empty())
+        {
+            return true;
+        }
+
+        AZStd::sort(m_dirtyElements.begin(), m_dirtyElements.end());
+        m_dirtyElements.erase(AZStd::unique(m_dirtyElements.begin(), m_dirtyElements.end()), m_dirtyElements.end());
+
+        m_numElementsRendered = 0;
+        m_numVerticesRendered = 0;
+
+        bool isUpdateNeededInRenderTarget = false;
+        bool isUpdateSuccessful = true;
+        for (AZ::EntityId elementId : m_dirtyElements)
+        {
+            RetainedElement& element = m_retainedElements[m_retainedElementIndices[elementId]];
+
+            UiRenderInterface* renderInterface = UiRenderBus::FindFirstHandler(elementId);
+            if (!renderInterface)
+            {
+                isUpdateSuccessful = false;
+                break;
+            }
+
+            // Re-render the element with the state it was rendered with when the graph was built
+            const bool prevIsRenderingToMask = m_isRenderingToMask;
+            m_isRenderingToMask = element.m_isRenderingToMask;
+            PushOverrideAlphaFade(element.m_alphaFade);
+
+            m_updatingRetainedElement = &element;
+            m_updatingPrimitiveCount = 0;
+            m_updateFailed = false;
+
+            renderInterface->Render(this);
+
+            m_updatingRetainedElement = nullptr;
+            PopAlphaFade();
+            m_isRenderingToMask = prevIsRenderingToMask;
+
+            if (m_updateFailed || m_updatingPrimitiveCount != element.m_numPrimitives)
+            {
+                isUpdateSuccessful = false;
+                break;
+            }
+
+            isUpdateNeededInRenderTarget |= element.m_isInRenderTarget;
+            ++m_numElementsRendered;
+        }
+
+        m_dirtyElements.clear();
+
+        if (!isUpdateSuccessful)
+        {
+            return false;
+        }
+
+        if (isUpdateNeededInRenderTarget)
+        {
+            // render targets are only rendered to for the first few frames after the graph is built
+            m_renderToRenderTargetCount = 0;
+        }
+
+#ifndef _RELEASE
+        m_wasUpdatedThisFrame = true;
+#endif
+
+        return true;
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::FinalizeGraph()
     {
@@ -1070,10 +1290,14 @@ namespace LyShine
         info.m_numNodesDueToMaxVerts = 0;
         info.m_numNodesDueToTextures = 0;
         info.m_wasBuiltThisFrame = m_wasBuiltThisFrame;
+        info.m_wasUpdatedThisFrame = m_wasUpdatedThisFrame;
         info.m_timeGraphLastBuiltMs = m_timeGraphLastBuiltMs;
         info.m_isReusingRenderTargets = m_renderToRenderTargetCount >= 2 && !m_renderTargetRenderNodes.empty();
+        info.m_numElementsRendered = (m_wasBuiltThisFrame || m_wasUpdatedThisFrame) ? m_numElementsRendered : 0;
+        info.m_numVerticesRendered = (m_wasBuiltThisFrame || m_wasUpdatedThisFrame) ? m_numVerticesRendered : 0;
 
         m_wasBuiltThisFrame = false;
+        m_wasUpdatedThisFrame = false;
 
         AZStd::set<AZ::Data::Instance<AZ::RPI::Image>> uniqueTextures;
 
@@ -1154,12 +1378,13 @@ namespace LyShine
 
                 const PrimitiveListRenderNode* primListRenderNode = static_cast<const PrimitiveListRenderNode*>(renderNode);
                 
-                DynUiPrimitiveList& primitives = primListRenderNode->GetPrimitives();
-                info.m_numPrimitives += static_cast<int>(primitives.size());
+                const AZStd::vector<DynUiPrimitive*>& primitives = primListRenderNode->GetPrimitives();
+                for (const DynUiPrimitive* primitive : primitives)
                 {
-                    for (const DynUiPrimitive& primitive : primitives)
+                    if (primitive)
                     {
-                        info.m_numTriangles += primitive.m_numIndices / 3;
+                        ++info.m_numPrimitives;
+                        info.m_numTriangles += primitive->m_numIndices / 3;
                     }
                 }
 
@@ -1178,7 +1403,7 @@ namespace LyShine
                     {
                         ++info.m_numNodesDueToSrgb;
                     }
-                    else if (!prevPrimListNode->HasSpaceToAddPrimitive(&primListRenderNode->GetPrimitives().front()))
+                    else if (primitives.front() && !prevPrimListNode->HasSpaceToAddPrimitive(primitives.front()))
                     {
                         ++info.m_numNodesDueToMaxVerts;
                     }
@@ -1287,7 +1512,8 @@ namespace LyShine
                 {
                     if (prevPrimListNode->GetBlendModeState() == primListRenderNode->GetBlendModeState() &&
                         prevPrimListNode->GetIsTextureSRGB() == primListRenderNode->GetIsTextureSRGB() &&
-                        prevPrimListNode->HasSpaceToAddPrimitive(&primListRenderNode->GetPrimitives().front()) &&
+                        primListRenderNode->GetPrimitives().front() &&
+                        prevPrimListNode->HasSpaceToAddPrimitive(primListRenderNode->GetPrimitives().front()) &&
                         prevPrimListNode->GetNumTextures() == PrimitiveListRenderNode::MaxTextures)
                     {
                         // this node could have been combined with the previous node if less unique textures were used
@@ -1338,12 +1564,15 @@ namespace LyShine
                     previousNodeAlreadyCounted = false;
                 }
 
-                DynUiPrimitiveList& primitives = primListRenderNode->GetPrimitives();
-                int numPrimitives = static_cast<int>(primitives.size());
+                int numPrimitives = 0;
                 int numTriangles = 0;
-                for (const DynUiPrimitive& primitive : primitives)
+                for (const DynUiPrimitive* primitive : primListRenderNode->GetPrimitives())
                 {
-                    numTriangles += primitive.m_numIndices / 3;
+                    if (primitive)
+                    {
+                        ++numPrimitives;
+                        numTriangles += primitive->m_numIndices / 3;
+                    }
                 }
 
                 // Write heading to logfile for this render node
@@ -1504,4 +1733,81 @@ namespace LyShine
             }
         }
     }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::RecordRetainedPrimitive(DynUiPrimitive* primitive, RetainedPrimitive& retainedPrimitive)
+    {
+        if (!m_currentRetainedElement)
+        {
+            return;
+        }
+
+        retainedPrimitive.m_primitiveIndex = retainedPrimitive.m_renderNode->GetPrimitives().size() - 1;
+        retainedPrimitive.m_numVertices = primitive->m_numVertices;
+        retainedPrimitive.m_numIndices = primitive->m_numIndices;
+        m_retainedPrimitives.push_back(AZStd::move(retainedPrimitive));
+        ++m_currentRetainedElement->m_numPrimitives;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::UpdateRetainedPrimitive(DynUiPrimitive* primitive, const RetainedPrimitive& renderState)
+    {
+        if (m_updateFailed || m_updatingPrimitiveCount >= m_updatingRetainedElement->m_numPrimitives)
+        {
+            m_updateFailed = true;
+            return;
+        }
+
+        RetainedPrimitive& retainedPrimitive = m_retainedPrimitives[m_updatingRetainedElement->m_firstPrimitive + m_updatingPrimitiveCount];
+        ++m_updatingPrimitiveCount;
+
+        // The primitive can only go back into the same render node if it is rendered with the same state,
+        // anything else could change how the primitives of the whole graph are batched
+        if (retainedPrimitive.m_texture != renderState.m_texture ||
+            retainedPrimitive.m_maskTexture != renderState.m_maskTexture ||
+            retainedPrimitive.m_isClampTextureMode != renderState.m_isClampTextureMode ||
+            retainedPrimitive.m_isTextureSRGB != renderState.m_isTextureSRGB ||
+            retainedPrimitive.m_isTexturePremultipliedAlpha != renderState.m_isTexturePremultipliedAlpha ||
+            retainedPrimitive.m_blendMode != renderState.m_blendMode ||
+            !retainedPrimitive.m_renderNode->HasSpaceToReplacePrimitive(retainedPrimitive.m_numVertices, primitive))
+        {
+            m_updateFailed = true;
+            return;
+        }
+
+        // The component may have regenerated the vertices, so ensure that they reference the texture units
+        // that were assigned when the graph was built
+        const bool isAlphaMask = retainedPrimitive.m_maskTexture.get() != nullptr;
+        if (primitive->m_numVertices > 0 &&
+            (primitive->m_vertices[0].texIndex != retainedPrimitive.m_texUnit ||
+            (isAlphaMask && primitive->m_vertices[0].texIndex2 != retainedPrimitive.m_maskTexUnit)))
+        {
+            for (int i = 0; i < primitive->m_numVertices; ++i)
+            {
+                primitive->m_vertices[i].texIndex = aznumeric_cast<uint8>(retainedPrimitive.m_texUnit);
+                if (isAlphaMask)
+                {
+                    primitive->m_vertices[i].texIndex2 = aznumeric_cast<uint8>(retainedPrimitive.m_maskTexUnit);
+                }
+            }
+        }
+
+        retainedPrimitive.m_renderNode->ReplacePrimitive(retainedPrimitive.m_primitiveIndex, primitive,
+            retainedPrimitive.m_numVertices, retainedPrimitive.m_numIndices);
+        retainedPrimitive.m_numVertices = primitive->m_numVertices;
+        retainedPrimitive.m_numIndices = primitive->m_numIndices;
+
+        m_numVerticesRendered += primitive->m_numVertices;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::ClearRetainedElements()
+    {
+        m_retainedElementIndices.clear();
+        m_retainedElements.clear();
+        m_retainedPrimitives.clear();
+        m_dirtyElements.clear();
+        m_currentRetainedElement = nullptr;
+        m_updatingRetainedElement = nullptr;
+    }
 }
@@ -13,6 +13,8 @@
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/containers/stack.h>
 #include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/Component/EntityId.h>
 #include <AzCore/Math/Color.h>
 
 #include <Atom/RPI.Public/Image/AttachmentImage.h>
@@ -80,7 +82,12 @@ namespace LyShine
             , AZ::RHI::Ptr<AZ::RPI::DynamicDrawContext> dynamicDraw) override;
 
         void AddPrimitive(DynUiPrimitive* primitive);
-        DynUiPrimitiveList& GetPrimitives() const;
+        const AZStd::vector<DynUiPrimitive*>& GetPrimitives() const;
+
+        //! Replace a primitive that was previously added to this node, used when an element is re-rendered into the graph.
+        //! The previous primitive may already have been freed by its component so only its vertex and index counts are used.
+        //! A null primitive detaches the previous one without drawing anything in its place.
+        void ReplacePrimitive(size_t primitiveIndex, DynUiPrimitive* primitive, int prevNumVertices, int prevNumIndices);
 
         int GetOrAddTexture(const AZ::Data::Instance<AZ::RPI::Image>& texture, bool isClampTextureMode);
         int GetNumTextures() const { return m_numTextures; }
@@ -93,6 +100,7 @@ namespace LyShine
         AlphaMaskType GetAlphaMaskType() const { return m_alphaMaskType; }
 
         bool HasSpaceToAddPrimitive(DynUiPrimitive* primitive) const;
+        bool HasSpaceToReplacePrimitive(int prevNumVertices, DynUiPrimitive* primitive) const;
 
         // Search to see if this texture is already used by this texture unit, returns -1 if not used
         int FindTexture(const AZ::Data::Instance<AZ::RPI::Image>& texture, bool isClampTextureMode) const;
@@ -122,7 +130,10 @@ namespace LyShine
         int             m_totalNumVertices;
         int             m_totalNumIndices;
 
-        DynUiPrimitiveList   m_primitives;
+        // The primitives are owned by the components that render them. They are referenced by pointer rather than
+        // being linked into an intrusive list so that a single element can swap its primitives without the rest of
+        // the graph being rebuilt.
+        AZStd::vector<DynUiPrimitive*> m_primitives;
     };
 
     // A mask render node handles using one set of render nodes to mask another set of render nodes
@@ -306,6 +317,19 @@ namespace LyShine
         //! Get the dirty flag
         bool GetDirtyFlag();
 
+        //! Called by an element before and after its render components render into the graph. While the graph is being
+        //! built this records the primitives each element adds, so that the element can later be re-rendered on its own.
+        void BeginElement(AZ::EntityId elementId);
+        void EndElement();
+
+        //! Mark a single element as needing to be re-rendered. If the element's render components then render a different
+        //! number of primitives, or render them with a different render state, the whole graph is rebuilt instead.
+        void SetElementDirty(AZ::EntityId elementId);
+
+        //! Re-render the dirty elements into the existing graph, keeping the batches of every other element.
+        //! Returns false if an element changed in a way that requires the graph to be rebuilt.
+        bool UpdateDirtyElements();
+
         //! End the building of the graph
         void FinalizeGraph();
 
@@ -337,6 +361,34 @@ namespace LyShine
             DynUiPrimitive   m_primitive;
         };
 
+        //! A primitive added by an element and the render state it was added with
+        struct RetainedPrimitive
+        {
+            PrimitiveListRenderNode*            m_renderNode = nullptr;
+            size_t                              m_primitiveIndex = 0;
+            AZ::Data::Instance<AZ::RPI::Image>  m_texture;
+            AZ::Data::Instance<AZ::RPI::Image>  m_maskTexture;  //!< only set for alpha mask primitives
+            int                                 m_texUnit = 0;
+            int                                 m_maskTexUnit = 0;
+            int                                 m_numVertices = 0;
+            int                                 m_numIndices = 0;
+            bool                                m_isClampTextureMode = false;
+            bool                                m_isTextureSRGB = false;
+            bool                                m_isTexturePremultipliedAlpha = false;
+            BlendMode                           m_blendMode = BlendMode::Normal;
+        };
+
+        //! The state an element was rendered with when the graph was built, and the range of its retained primitives
+        struct RetainedElement
+        {
+            float   m_alphaFade = 1.0f;
+            bool    m_isRenderingToMask = false;
+            bool    m_isInRenderTarget = false;
+            bool    m_isRetainable = true;  //!< false if the element was rendered more than once while building the graph
+            size_t  m_firstPrimitive = 0;
+            size_t  m_numPrimitives = 0;
+        };
+
     protected: // member functions
 
         //! Given a blend mode and whether the shader will be outputing premultiplied alpha, return state flags
@@ -344,6 +396,15 @@ namespace LyShine
 
         void SetRttPassesEnabled(UiRenderer* uiRenderer, bool enabled);
 
+        //! Record a primitive that was just added to the graph for the element currently being built
+        void RecordRetainedPrimitive(DynUiPrimitive* primitive, RetainedPrimitive& retainedPrimitive);
+
+        //! Put a primitive rendered by an element that is being re-rendered in place of the one it rendered when the graph
+        //! was built. Flags the update as failed if the render state does not match.
+        void UpdateRetainedPrimitive(DynUiPrimitive* primitive, const RetainedPrimitive& renderState);
+
+        void ClearRetainedElements();
+
     protected:  // data
 
         AZStd::vector<RenderNode*>  m_renderNodes;
@@ -363,9 +424,24 @@ namespace LyShine
         AZStd::vector<RenderTargetRenderNode*>  m_renderTargetRenderNodes;
         int                         m_renderTargetNestLevel = 0;
 
+        // Per element records used to re-render single elements without rebuilding the graph
+        AZStd::unordered_map<AZ::EntityId, size_t> m_retainedElementIndices;
+        AZStd::vector<RetainedElement>      m_retainedElements;
+        AZStd::vector<RetainedPrimitive>    m_retainedPrimitives;
+        AZStd::vector<AZ::EntityId>         m_dirtyElements;
+
+        RetainedElement*            m_currentRetainedElement = nullptr; //!< the element being recorded while building the graph
+        RetainedElement*            m_updatingRetainedElement = nullptr; //!< the element being re-rendered by UpdateDirtyElements
+        size_t                      m_updatingPrimitiveCount = 0;
+        bool                        m_updateFailed = false;
+
+        int                         m_numElementsRendered = 0;   //!< elements rendered by the last build or update
+        int                         m_numVerticesRendered = 0;   //!< vertices added to the graph by the last build or update
+
 #ifndef _RELEASE
         // A debug-only variable used to track whether the rendergraph was rebuilt this frame
         mutable bool                m_wasBuiltThisFrame = false;
+        mutable bool                m_wasUpdatedThisFrame = false;
         AZ::u64                     m_timeGraphLastBuiltMs = 0;
 #endif
     };
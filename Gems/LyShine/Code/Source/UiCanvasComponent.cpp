@@ -1841,6 +1841,16 @@ void UiCanvasComponent::MarkRenderGraphDirty()
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiCanvasComponent::MarkRenderGraphElementDirty(AZ::EntityId elementId)
+{
+    // Same as MarkRenderGraphDirty, this must not change the render graph while it is being rendered
+    if (!m_isRendering)
+    {
+        m_renderGraph.SetElementDirty(elementId);
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 AZ::RHI::AttachmentId UiCanvasComponent::UseRenderTarget(const AZ::Name& renderTargetName, AZ::RHI::Size size)
 {
@@ -1937,6 +1947,13 @@ void UiCanvasComponent::RenderCanvas(bool isInGame, AZ::Vector2 viewportSize, Ui
 
     m_isRendering = true;
 
+    // If only some elements have changed then re-render just those elements into the existing graph
+    if (!m_renderGraph.GetDirtyFlag() && !m_renderGraph.UpdateDirtyElements())
+    {
+        // an element changed in a way that affects how the graph is batched, so rebuild it
+        m_renderGraph.SetDirtyFlag(true);
+    }
+
     if (m_renderGraph.GetDirtyFlag())
     {
         m_renderGraph.ResetGraph();
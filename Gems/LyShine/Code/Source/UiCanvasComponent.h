@@ -233,6 +233,7 @@ public: // member functions
 
     // UiCanvasComponentImplementationInterface
     void MarkRenderGraphDirty() override;
+    void MarkRenderGraphElementDirty(AZ::EntityId elementId) override;
     // ~UiCanvasComponentImplementationInterface
 
     // RenderToTextureRequests
@@ -1194,8 +1194,8 @@ void UiCanvasManager::DebugDisplayDrawCallData() const
 
     char buffer[200];
 
-    sprintf_s(buffer, "NN: %20s %5s   %5s %5s %5s %5s %5s   %5s %5s %5s %5s %5s %5s",
-        "Canvas name", "nDraw",   "nPrim", "nTris", "nMask", "nRTs", "nUTex",   "XMask", "XRT", "XBlnd", "XSrgb", "XMaxV", "XTex");
+    sprintf_s(buffer, "NN: %20s %5s   %5s %5s %5s %5s %5s   %5s %5s %5s %5s %5s %5s   %5s %6s",
+        "Canvas name", "nDraw",   "nPrim", "nTris", "nMask", "nRTs", "nUTex",   "XMask", "XRT", "XBlnd", "XSrgb", "XMaxV", "XTex",   "nElem", "nVerts");
     WriteLine(buffer, blue);
 
     int totalRenderNodes = 0;
@@ -1209,6 +1209,8 @@ void UiCanvasManager::DebugDisplayDrawCallData() const
     int totalDueToSrgb = 0;
     int totalDueToMaxVerts = 0;
     int totalDueToTextures = 0;
+    int totalElementsRendered = 0;
+    int totalVerticesRendered = 0;
 
     int i = 0;
     for (auto canvas : m_loadedCanvases)
@@ -1234,14 +1236,15 @@ void UiCanvasManager::DebugDisplayDrawCallData() const
         LyShineDebug::DebugInfoRenderGraph info;
         canvas->GetDebugInfoRenderGraph(info);
 
-        sprintf_s(buffer, "%2d: %20s %5d   %5d %5d %5d %5d %5d   %5d %5d %5d %5d %5d %5d",
+        sprintf_s(buffer, "%2d: %20s %5d   %5d %5d %5d %5d %5d   %5d %5d %5d %5d %5d %5d   %5d %6d",
             i, leafName.c_str(),
             info.m_numRenderNodes,
             info.m_numPrimitives, info.m_numTriangles,
             info.m_numMasks, info.m_numRTs, info.m_numUniqueTextures,
             info.m_numNodesDueToMask, info.m_numNodesDueToRT,
             info.m_numNodesDueToBlendMode, info.m_numNodesDueToSrgb,
-            info.m_numNodesDueToMaxVerts, info.m_numNodesDueToTextures);
+            info.m_numNodesDueToMaxVerts, info.m_numNodesDueToTextures,
+            info.m_numElementsRendered, info.m_numVerticesRendered);
 
         AZ::u64 timeSinceBuiltMs = AZStd::GetTimeUTCMilliSecond() - info.m_timeGraphLastBuiltMs;
         if (timeSinceBuiltMs > 1000)
@@ -1257,7 +1260,11 @@ void UiCanvasManager::DebugDisplayDrawCallData() const
         }
         else
         {
-            if (info.m_isReusingRenderTargets)
+            if (info.m_wasUpdatedThisFrame)
+            {
+                color = blue;  // blue used if the render graph was not rebuilt but some elements were re-rendered into it
+            }
+            else if (info.m_isReusingRenderTargets)
             {
                 color = yellow;  // yellow used if the render graph was  not rebuilt and render targets were reused
             }
@@ -1285,14 +1292,17 @@ void UiCanvasManager::DebugDisplayDrawCallData() const
         totalDueToSrgb += info.m_numNodesDueToSrgb;
         totalDueToMaxVerts += info.m_numNodesDueToMaxVerts;
         totalDueToTextures += info.m_numNodesDueToTextures;
+        totalElementsRendered += info.m_numElementsRendered;
+        totalVerticesRendered += info.m_numVerticesRendered;
     }
 
-    sprintf_s(buffer, "Totals:                  %5d   %5d %5d %5d %5d         %5d %5d %5d %5d %5d %5d",
+    sprintf_s(buffer, "Totals:                  %5d   %5d %5d %5d %5d         %5d %5d %5d %5d %5d %5d   %5d %6d",
         totalRenderNodes,
         totalPrimitives, totalTriangles, totalMasks, totalRTs,
         totalDueToMask, totalDueToRT,
         totalDueToBlendMode, totalDueToSrgb,
-        totalDueToMaxVerts, totalDueToTextures);
+        totalDueToMaxVerts, totalDueToTextures,
+        totalElementsRendered, totalVerticesRendered);
 
     WriteLine(buffer, red);
 }
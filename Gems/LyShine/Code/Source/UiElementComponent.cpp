@@ -151,7 +151,11 @@ void UiElementComponent::RenderElement(LyShine::IRenderGraph* renderGraph, bool
         // render any component on this element connected to the UiRenderBus
         if (m_renderInterface)
         {
+            // the render graph records what this element renders so that it can be re-rendered on its own later
+            LyShine::RenderGraph* lyRenderGraph = static_cast<LyShine::RenderGraph*>(renderGraph); // LYSHINE_ATOM_TODO - find a different solution from downcasting - GHI #3570
+            lyRenderGraph->BeginElement(GetEntityId());
             m_renderInterface->Render(renderGraph);
+            lyRenderGraph->EndElement();
         }
 
         // now render child elements
@@ -2343,10 +2343,10 @@ void UiImageComponent::MarkRenderCacheDirty()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiImageComponent::MarkRenderGraphDirty()
 {
-    // tell the canvas to invalidate the render graph (never want to do this while rendering)
+    // tell the canvas to re-render this element into the render graph (never want to do this while rendering)
     AZ::EntityId canvasEntityId;
     EBUS_EVENT_ID_RESULT(canvasEntityId, GetEntityId(), UiElementBus, GetCanvasEntityId);
-    EBUS_EVENT_ID(canvasEntityId, UiCanvasComponentImplementationBus, MarkRenderGraphDirty);
+    EBUS_EVENT_ID(canvasEntityId, UiCanvasComponentImplementationBus, MarkRenderGraphElementDirty, GetEntityId());
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -966,12 +966,9 @@ void UiParticleEmitterComponent::Update(float deltaTime)
         }
     }
 
-    // Currently we mark the render graph dirty whenever a particle emitter is updated and has any
-    // active particles.
-    // A future optimization could be that we only mark it dirty if new particles were emitted or 
-    // particles were removed. At other times we could update the vertices in m_cachedPrimitive
-    // without regenerating the graph. This would require some way to register to get the vertices updated
-    // during the canvas render in the case when the render graph was not being regenerated.
+    // Whenever a particle emitter is updated and has any active particles this element is re-rendered
+    // into the render graph. The rest of the graph is kept since the emitter always renders a single
+    // primitive, only the number of vertices in it changes.
     bool particlesExistAfterUpdate = m_particleContainer.size() > 0;
     if (particlesExistedBeforeUpdate || particlesExistAfterUpdate)
     {
@@ -1800,11 +1797,8 @@ void UiParticleEmitterComponent::SortMultipliersByTime(AZStd::vector<ParticleFlo
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiParticleEmitterComponent::ResetParticleBuffers()
 {
-    // if this cached primitive is in any list in the render graph then mark the render graph as dirty
-    if (m_cachedPrimitive.m_next)
-    {
-        MarkRenderGraphDirty();
-    }
+    // the cached primitive may be referenced by the render graph, so detach it before its buffers are deleted
+    MarkRenderGraphDirty();
 
     if (m_isParticleLifetimeInfinite)
     {
@@ -2099,8 +2093,8 @@ UiParticleEmitterComponent::AZu32ComboBoxVec UiParticleEmitterComponent::Populat
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiParticleEmitterComponent::MarkRenderGraphDirty()
 {
-    // tell the canvas to invalidate the render graph
+    // tell the canvas to re-render this element into the render graph (it rebuilds the whole graph if it needs to)
     AZ::EntityId canvasEntityId;
     EBUS_EVENT_ID_RESULT(canvasEntityId, GetEntityId(), UiElementBus, GetCanvasEntityId);
-    EBUS_EVENT_ID(canvasEntityId, UiCanvasComponentImplementationBus, MarkRenderGraphDirty);
+    EBUS_EVENT_ID(canvasEntityId, UiCanvasComponentImplementationBus, MarkRenderGraphElementDirty, GetEntityId());
 }
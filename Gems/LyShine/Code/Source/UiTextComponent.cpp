@@ -5163,21 +5163,19 @@ void UiTextComponent::MarkRenderCacheDirty()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiTextComponent::MarkRenderGraphDirty()
 {
-    // tell the canvas to invalidate the render graph
+    // tell the canvas to re-render this element into the render graph (it rebuilds the whole graph if it needs to)
     AZ::EntityId canvasEntityId;
     EBUS_EVENT_ID_RESULT(canvasEntityId, GetEntityId(), UiElementBus, GetCanvasEntityId);
-    EBUS_EVENT_ID(canvasEntityId, UiCanvasComponentImplementationBus, MarkRenderGraphDirty);
+    EBUS_EVENT_ID(canvasEntityId, UiCanvasComponentImplementationBus, MarkRenderGraphElementDirty, GetEntityId());
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiTextComponent::ClearRenderCache()
 {
-    // at the moment, any change to the render cache requires the graph is cleared because a render node
-    // in the graph has a list of primitives, if a primitive is removed it breaks the graph.
+    // The render graph references the primitives in the render cache. Marking this element dirty detaches
+    // them from the graph, so this must be done before the image batches are deleted.
     MarkRenderGraphDirty();
 
-    // As mentioned above it is ONLY valid to clear this and delete the image batches when the render graph
-    // has been cleared. Otherwise the graph intrusive lists will have pointers to deleted structures.
     FreeRenderCacheMemory();
 
     m_renderCache.m_isDirty = true;
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <LyShine/Bus/UiRenderBus.h>
+#include "RenderGraph.h"
+
+namespace UnitTest
+{
+    // Exposes the top level render nodes so that tests can check which nodes are reused by an update
+    class TestRenderGraph
+        : public LyShine::RenderGraph
+    {
+    public:
+        const AZStd::vector<LyShine::RenderNode*>& GetRenderNodes() const { return m_renderNodes; }
+    };
+
+    // Stands in for a UI component that renders a single quad, the way UiImageComponent renders its cached primitive
+    class TestRenderElement
+        : public UiRenderBus::Handler
+    {
+    public:
+        TestRenderElement(AZ::EntityId elementId)
+            : m_elementId(elementId)
+        {
+            for (int i = 0; i < NumPrimitives; ++i)
+            {
+                m_primitives[i].m_vertices = m_vertices[i];
+                m_primitives[i].m_numVertices = NumVertices;
+                m_primitives[i].m_indices = m_indices;
+                m_primitives[i].m_numIndices = NumIndices;
+            }
+
+            UiRenderBus::Handler::BusConnect(m_elementId);
+        }
+
+        ~TestRenderElement()
+        {
+            UiRenderBus::Handler::BusDisconnect();
+        }
+
+        // UiRenderInterface
+        void Render(LyShine::IRenderGraph* renderGraph) override
+        {
+            LyShine::RenderGraph* lyRenderGraph = static_cast<LyShine::RenderGraph*>(renderGraph);
+            lyRenderGraph->AddPrimitiveAtom(GetPrimitive(), AZ::Data::Instance<AZ::RPI::Image>(), true, false, false, m_blendMode);
+            ++m_renderCount;
+        }
+        // ~UiRenderInterface
+
+        //! Simulate the component regenerating its vertices, the previous primitive may be freed after this
+        void RegeneratePrimitive()
+        {
+            m_currentPrimitive = (m_currentPrimitive + 1) % NumPrimitives;
+        }
+
+        DynUiPrimitive* GetPrimitive()
+        {
+            return &m_primitives[m_currentPrimitive];
+        }
+
+        // render the element into the graph the way UiElementComponent::RenderElement does
+        void RenderElement(LyShine::RenderGraph& renderGraph)
+        {
+            renderGraph.BeginElement(m_elementId);
+            Render(&renderGraph);
+            renderGraph.EndElement();
+        }
+
+        static const int NumPrimitives = 2;
+        static const int NumVertices = 4;
+        static const int NumIndices = 6;
+
+        AZ::EntityId m_elementId;
+        SVF_P2F_C4B_T2F_F4B m_vertices[NumPrimitives][NumVertices] = {};
+        uint16 m_indices[NumIndices] = { 0, 1, 2, 2, 3, 0 };
+        DynUiPrimitive m_primitives[NumPrimitives];
+        int m_currentPrimitive = 0;
+        LyShine::BlendMode m_blendMode = LyShine::BlendMode::Normal;
+        int m_renderCount = 0;
+    };
+
+    class RenderGraphTest
+        : public ScopedAllocatorSetupFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            // render nodes use the pool allocator
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+        }
+
+        void TearDown() override
+        {
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+        }
+
+        // build the graph the way UiCanvasComponent::RenderCanvas does
+        void BuildGraph(TestRenderGraph& renderGraph, TestRenderElement& element0, TestRenderElement& element1)
+        {
+            renderGraph.ResetGraph();
+            element0.RenderElement(renderGraph);
+            element1.RenderElement(renderGraph);
+            renderGraph.SetDirtyFlag(false);
+            renderGraph.FinalizeGraph();
+        }
+    };
+
+    TEST_F(RenderGraphTest, UpdateDirtyElements_DirtyElementIsRebuilt_CleanElementIsReused)
+    {
+        TestRenderElement element0(AZ::EntityId(1));
+        TestRenderElement element1(AZ::EntityId(2));
+
+        {
+            TestRenderGraph renderGraph;
+            BuildGraph(renderGraph, element0, element1);
+
+            // both elements have the same render state so they are batched into one render node
+            ASSERT_EQ(renderGraph.GetRenderNodes().size(), 1);
+            ASSERT_EQ(renderGraph.GetRenderNodes()[0]->GetType(), LyShine::RenderNodeType::PrimitiveList);
+            const LyShine::PrimitiveListRenderNode* renderNode = static_cast<const LyShine::PrimitiveListRenderNode*>(renderGraph.GetRenderNodes()[0]);
+            ASSERT_EQ(renderNode->GetPrimitives().size(), 2);
+
+            DynUiPrimitive* cleanPrimitive = element1.GetPrimitive();
+            EXPECT_EQ(element0.m_renderCount, 1);
+            EXPECT_EQ(element1.m_renderCount, 1);
+
+            element0.RegeneratePrimitive();
+            renderGraph.SetElementDirty(element0.m_elementId);
+            EXPECT_FALSE(renderGraph.GetDirtyFlag());
+
+            // the primitive of the dirty element is detached straight away since its component may free it
+            EXPECT_EQ(renderNode->GetPrimitives()[0], nullptr);
+
+            EXPECT_TRUE(renderGraph.UpdateDirtyElements());
+
+            // only the dirty element is rendered again
+            EXPECT_EQ(element0.m_renderCount, 2);
+            EXPECT_EQ(element1.m_renderCount, 1);
+
+            // and its new primitive is swapped into the existing render node, alongside the primitive of the clean element
+            ASSERT_EQ(renderGraph.GetRenderNodes().size(), 1);
+            EXPECT_EQ(renderGraph.GetRenderNodes()[0], renderNode);
+            ASSERT_EQ(renderNode->GetPrimitives().size(), 2);
+            EXPECT_EQ(renderNode->GetPrimitives()[0], element0.GetPrimitive());
+            EXPECT_EQ(renderNode->GetPrimitives()[1], cleanPrimitive);
+        }
+    }
+
+    TEST_F(RenderGraphTest, UpdateDirtyElements_DirtyElementsAreRenderedOnce)
+    {
+        TestRenderElement element0(AZ::EntityId(1));
+        TestRenderElement element1(AZ::EntityId(2));
+
+        {
+            TestRenderGraph renderGraph;
+            BuildGraph(renderGraph, element0, element1);
+
+            // an element that is marked dirty several times in a frame is only re-rendered once
+            renderGraph.SetElementDirty(element1.m_elementId);
+            renderGraph.SetElementDirty(element1.m_elementId);
+            EXPECT_TRUE(renderGraph.UpdateDirtyElements());
+            EXPECT_EQ(element0.m_renderCount, 1);
+            EXPECT_EQ(element1.m_renderCount, 2);
+
+            // no dirty elements, nothing is rendered
+            EXPECT_TRUE(renderGraph.UpdateDirtyElements());
+            EXPECT_EQ(element0.m_renderCount, 1);
+            EXPECT_EQ(element1.m_renderCount, 2);
+        }
+    }
+
+    TEST_F(RenderGraphTest, UpdateDirtyElements_RenderStateChange_FailsSoGraphIsRebuilt)
+    {
+        TestRenderElement element0(AZ::EntityId(1));
+        TestRenderElement element1(AZ::EntityId(2));
+
+        {
+            TestRenderGraph renderGraph;
+            BuildGraph(renderGraph, element0, element1);
+
+            // a different blend mode would change how the graph is batched, so the element can't be updated in place
+            element0.m_blendMode = LyShine::BlendMode::Add;
+            renderGraph.SetElementDirty(element0.m_elementId);
+            EXPECT_FALSE(renderGraph.UpdateDirtyElements());
+
+            // the canvas then rebuilds the graph, rendering every element again
+            BuildGraph(renderGraph, element0, element1);
+            EXPECT_EQ(element0.m_renderCount, 3);
+            EXPECT_EQ(element1.m_renderCount, 2);
+            EXPECT_EQ(renderGraph.GetRenderNodes().size(), 2);
+        }
+    }
+
+    TEST_F(RenderGraphTest, SetElementDirty_UnrecordedElement_SetsGraphDirty)
+    {
+        TestRenderElement element0(AZ::EntityId(1));
+        TestRenderElement element1(AZ::EntityId(2));
+
+        {
+            TestRenderGraph renderGraph;
+            BuildGraph(renderGraph, element0, element1);
+
+            // an element that was not rendered when the graph was built can only be added by rebuilding the graph
+            renderGraph.SetElementDirty(AZ::EntityId(3));
+            EXPECT_TRUE(renderGraph.GetDirtyFlag());
+        }
+    }
+} // namespace UnitTest
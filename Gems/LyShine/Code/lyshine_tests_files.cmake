@@ -9,6 +9,7 @@
 set(FILES
     Tests/LyShineTest.h
     Tests/AnimationTest.cpp
+    Tests/RenderGraphTest.cpp
     Tests/SpriteTest.cpp
     Tests/SerializationTest.cpp
     Tests/TextInputComponentTest.cpp
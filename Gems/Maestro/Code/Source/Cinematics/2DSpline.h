@@ -16,6 +16,7 @@
 #pragma once
 
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/vector.h>
 #include <ISplines.h>
 
 namespace spline
@@ -209,55 +210,96 @@ namespace spline
             return (k5 / 6) * u6 + (k4 / 5) * u5 + (k3 / 4) * u4 + (k2 / 3) * u3 + (k1 / 2) * u2 + k0 * u;
         }
 
-        float search_u(float time, ISplineInterpolator::ValueType& value)
+        // Power basis coefficients of the x (time) and y (value) cubics of one segment, p(u) = ((a * u + b) * u + c) * u + d.
+        struct SegmentCoefficients
         {
-            float time_to_check = time;
-            int count = 0;
-            int curr = seek_key(time);
-            int next = (curr < num_keys() - 1) ? curr + 1 : curr;
-            // Clamp the time first.
-            if (time < this->time(0))
+            Vec2 a;
+            Vec2 b;
+            Vec2 c;
+            Vec2 d;
+        };
+
+        // Rebuilds the per segment coefficients if keys or tangents changed since they were last built,
+        // so that evaluating the curve doesn't have to reassemble the Bezier control points every time.
+        void update_segments()
+        {
+            if (!this->is_updated())
             {
-                time = this->time(0);
+                m_segmentsDirty = true;
             }
-            else if (time > this->time(num_keys() - 1))
+            this->update();
+
+            const int numSegments = max(num_keys() - 1, 0);
+            if (!m_segmentsDirty && static_cast<int>(m_segments.size()) == numSegments)
             {
-                time = this->time(num_keys() - 1);
+                return;
             }
-            // It's somewhat tricky here. We should find the 't' where the x element
-            // of the 2D Bezier curve equals to the specified 'time'.
-            // The y component of the curve there is our value.
-            // We use the 'Newton's method' to find the root.
-            float u = 0;
+
+            m_segments.resize(numSegments);
+            for (int i = 0; i < numSegments; ++i)
+            {
+                const Vec2 p0 = this->value(i);
+                const Vec2 p3 = this->value(i + 1);
+                const Vec2 p1 = p0 + this->dd(i);
+                const Vec2 p2 = p3 - this->ds(i + 1);
+
+                SegmentCoefficients& segment = m_segments[i];
+                segment.a = (p3 - p0) + (p1 - p2) * 3.0f;
+                segment.b = (p0 - p1 * 2.0f + p2) * 3.0f;
+                segment.c = (p1 - p0) * 3.0f;
+                segment.d = p0;
+            }
+            m_segmentsDirty = false;
+        }
+
+        float search_u(float time, ISplineInterpolator::ValueType& value)
+        {
+            update_segments();
+
+            int curr = seek_key(time);
+            int next = (curr < num_keys() - 1) ? curr + 1 : curr;
             const float epsilon = 0.00001f;
             float timeDelta = this->time(next) - this->time(curr);
             if (timeDelta == 0)
             {
                 timeDelta = epsilon;
             }
+            float u = (time - this->time(curr)) / timeDelta;
+
+            // Before the first key and after the last one the curve holds the key value.
+            if (time < this->time(0) || curr == next)
+            {
+                ToValueType(this->value(curr), value);
+                return u;
+            }
             // In case of stepping tangents, we don't need this special processing.
             if (GetOutTangentType(curr) == SPLINE_KEY_TANGENT_STEP || GetInTangentType(next) == SPLINE_KEY_TANGENT_STEP)
             {
-                spline::CBaseSplineInterpolator<Vec2, spline::BezierSpline<Vec2, spline::SplineKeyEx<Vec2> > >::Interpolate(time_to_check, value);
-                return (time_to_check - this->time(curr)) / timeDelta;
+                ToValueType(GetOutTangentType(curr) == SPLINE_KEY_TANGENT_STEP ? this->value(next) : this->value(curr), value);
+                return u;
             }
+
+            // It's somewhat tricky here. We should find the 'u' where the x element
+            // of the 2D Bezier curve equals to the specified 'time'.
+            // The y component of the curve there is our value.
+            // We use the 'Newton's method' to find the root.
+            const SegmentCoefficients& segment = m_segments[curr];
+            Vec2 point;
+            int count = 0;
             do
             {
-                spline::CBaseSplineInterpolator<Vec2, spline::BezierSpline<Vec2, spline::SplineKeyEx<Vec2> > >::Interpolate(time_to_check, value);
-
-                u = (time_to_check - this->time(curr)) / timeDelta;
+                point = ((segment.a * u + segment.b) * u + segment.c) * u + segment.d;
 
-                if (fabs(value[0] - time) < epsilon)
+                if (fabs(point.x - time) < epsilon)
                 {
                     // Finally, we got the solution.
                     break;
                 }
                 else
                 {
-                    // Apply the Newton's method to compute the next time value to try.
-                    assert(next != curr);
-                    float dt = comp_time_deriv(curr, next, u);
-                    double dfdt = (double(value[0]) - double(time)) / (double(dt) + epsilon);
+                    // Apply the Newton's method to compute the next u value to try.
+                    float dt = (3.0f * segment.a.x * u + 2.0f * segment.b.x) * u + segment.c.x;
+                    double dfdt = (double(point.x) - double(time)) / (double(dt) + epsilon);
                     u -= float(dfdt);
                     if (u < 0)
                     {
@@ -267,11 +309,12 @@ namespace spline
                     {
                         u = 1;
                     }
-                    time_to_check = u * (this->time(next) - this->time(curr)) + this->time(curr);
                 }
                 ++count;
             }
             while (count < 10);
+
+            ToValueType(point, value);
             return u;
         }
 
@@ -430,6 +473,7 @@ namespace spline
         virtual void comp_deriv()
         {
             spline::BezierSpline<Vec2, spline::SplineKeyEx<Vec2> >::comp_deriv();
+            m_segmentsDirty = true;
 
             // To process the 'zero tangent' case more properly,
             // here we override the tangent behavior for the case of SPLINE_KEY_TANGENT_ZERO.
@@ -582,11 +626,21 @@ namespace spline
             return keyIndex;
         }
 
+        virtual void Restore(ISplineBackup* p)
+        {
+            spline::CBaseSplineInterpolator<Vec2, spline::BezierSpline<Vec2, spline::SplineKeyEx<Vec2> > >::Restore(p);
+            m_segmentsDirty = true;
+        }
+
         inline static void Reflect(AZ::SerializeContext* serializeContext)
         {
             serializeContext->Class<TrackSplineInterpolator<Vec2>,spline::BezierSpline<Vec2, spline::SplineKeyEx<Vec2> > >()
                 ->Version(1);
         }
+
+    private:
+        AZStd::vector<SegmentCoefficients> m_segments;
+        bool m_segmentsDirty = true;
     };
 }; // namespace spline
 
@@ -29,10 +29,16 @@
 #include "ShadowsSetupNode.h"
 #include "SequenceTrack.h"
 #include "AnimNodeGroup.h"
+#include "AnimSplineTrack.h"
+#include "Movie.h"
 #include <Maestro/Types/AnimNodeType.h>
 #include <Maestro/Types/SequenceType.h>
 #include <Maestro/Types/AnimParamType.h>
 
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobEmpty.h>
+#include <AzCore/Jobs/JobFunction.h>
+
 //////////////////////////////////////////////////////////////////////////
 CAnimSequence::CAnimSequence(IMovieSystem* pMovieSystem, uint32 id, SequenceType sequenceType)
     : m_refCount(0)
@@ -665,6 +671,8 @@ void CAnimSequence::Animate(const SAnimContext& ec)
     animContext.sequence = this;
     m_time = animContext.time;
 
+    SampleSplineTracks(animContext);
+
     // Evaluate all animation nodes in sequence.
     // The director first.
     if (m_activeDirector)
@@ -677,27 +685,118 @@ void CAnimSequence::Animate(const SAnimContext& ec)
         // Make sure correct animation block is binded to node.
         IAnimNode* animNode = it->get();
 
-        // All other (inactive) director nodes are skipped.
-        if (animNode->GetType() == AnimNodeType::Director)
+        if (!IsNodeAnimated(animNode))
         {
             continue;
         }
 
-        // If this is a descendant of a director node and that director is currently not active, skip this one.
-        IAnimNode* parentDirector = animNode->HasDirectorAsParent();
-        if (parentDirector && parentDirector != m_activeDirector)
+        // Animate node.
+        animNode->Animate(animContext);
+    }
+
+    ClearSampledSplineTracks();
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CAnimSequence::IsNodeAnimated(IAnimNode* pNode) const
+{
+    // All other (inactive) director nodes are skipped.
+    if (pNode->GetType() == AnimNodeType::Director)
+    {
+        return false;
+    }
+
+    // If this is a descendant of a director node and that director is currently not active, skip this one.
+    IAnimNode* parentDirector = pNode->HasDirectorAsParent();
+    if (parentDirector && parentDirector != m_activeDirector)
+    {
+        return false;
+    }
+
+    return !pNode->AreFlagsSetOnNodeOrAnyParent(eAnimNodeFlags_Disabled);
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CAnimSequence::SampleSplineTracks(const SAnimContext& animContext)
+{
+    m_sampledSplineTracks.clear();
+
+    for (AnimNodes::iterator it = m_nodes.begin(); it != m_nodes.end(); ++it)
+    {
+        IAnimNode* animNode = it->get();
+        if (animNode == m_activeDirector || IsNodeAnimated(animNode))
         {
-            continue;
+            for (int trackIndex = 0; trackIndex < animNode->GetTrackCount(); ++trackIndex)
+            {
+                CollectSplineTracks(animNode->GetTrackByIndex(trackIndex), animContext);
+            }
         }
+    }
+
+    const float time = animContext.time;
+    const size_t trackCount = m_sampledSplineTracks.size();
+    AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+
+    // Evaluating a single spline is cheap, so every job samples a batch of tracks.
+    const size_t tracksPerJob = 32;
 
-        if (animNode->AreFlagsSetOnNodeOrAnyParent(eAnimNodeFlags_Disabled))
+    if (CMovieSystem::m_mov_parallelTrackSampling && jobContext && trackCount > tracksPerJob)
+    {
+        AZ::JobEmpty jobCompletion(false, jobContext);
+        for (size_t firstTrack = 0; firstTrack < trackCount; firstTrack += tracksPerJob)
         {
-            continue;
+            const size_t lastTrack = AZStd::min(firstTrack + tracksPerJob, trackCount);
+            AZ::Job* job = AZ::CreateJobFunction([this, firstTrack, lastTrack, time]()
+                {
+                    for (size_t trackIndex = firstTrack; trackIndex < lastTrack; ++trackIndex)
+                    {
+                        m_sampledSplineTracks[trackIndex]->SampleValue(time);
+                    }
+                }, true, jobContext);
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+    }
+    else
+    {
+        for (C2DSplineTrack* track : m_sampledSplineTracks)
+        {
+            track->SampleValue(time);
         }
+    }
+}
 
-        // Animate node.
-        animNode->Animate(animContext);
+//////////////////////////////////////////////////////////////////////////
+void CAnimSequence::CollectSplineTracks(IAnimTrack* pTrack, const SAnimContext& animContext)
+{
+    if (!pTrack || !pTrack->HasKeys() || (pTrack->GetFlags() & IAnimTrack::eAnimTrackFlags_Disabled) || pTrack->IsMasked(animContext.trackMask))
+    {
+        return;
+    }
+
+    if (pTrack->GetSubTrackCount() > 0)
+    {
+        // Compound tracks evaluate each of their components from a sub track.
+        for (int subTrackIndex = 0; subTrackIndex < pTrack->GetSubTrackCount(); ++subTrackIndex)
+        {
+            CollectSplineTracks(pTrack->GetSubTrack(subTrackIndex), animContext);
+        }
+    }
+    else if (pTrack->GetCurveType() == eAnimCurveType_BezierFloat)
+    {
+        m_sampledSplineTracks.push_back(static_cast<C2DSplineTrack*>(pTrack));
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CAnimSequence::ClearSampledSplineTracks()
+{
+    for (C2DSplineTrack* track : m_sampledSplineTracks)
+    {
+        track->ClearSampledValue();
     }
+    m_sampledSplineTracks.clear();
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -20,6 +20,9 @@
 
 #include <list>
 
+template <class ValueType>
+class TAnimSplineTrack;
+
 class CAnimSequence
     : public IAnimSequence
 {
@@ -166,6 +169,15 @@ private:
     bool AddNodeNeedToRender(IAnimNode* pNode);
     void RemoveNodeNeedToRender(IAnimNode* pNode);
 
+    // Returns false for the nodes Animate() skips: inactive directors, nodes under them and disabled nodes.
+    bool IsNodeAnimated(IAnimNode* pNode) const;
+
+    // Evaluates the float spline tracks of all the nodes about to be animated up front, in parallel on the job system,
+    // so the nodes only pick up the sampled values when they are animated on the main thread.
+    void SampleSplineTracks(const SAnimContext& animContext);
+    void CollectSplineTracks(IAnimTrack* pTrack, const SAnimContext& animContext);
+    void ClearSampledSplineTracks();
+
     void SetId(uint32 newId);
 
     int m_refCount;
@@ -215,6 +227,9 @@ private:
     bool m_expanded;
 
     unsigned int m_nextTrackId = 1;
+
+    // Float spline tracks sampled for the current Animate() call.
+    AZStd::vector<TAnimSplineTrack<Vec2>*> m_sampledSplineTracks;
 };
 
 #endif // CRYINCLUDE_CRYMOVIE_ANIMSEQUENCE_H
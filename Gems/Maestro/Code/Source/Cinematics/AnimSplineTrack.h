@@ -366,6 +366,15 @@ public:
         m_id = id;
     }
 
+    //! Evaluates the spline at the given time ahead of GetValue(), so that it can be done off the main thread.
+    //! GetValue() returns the sampled value for that time until ClearSampledValue() is called.
+    void SampleValue([[maybe_unused]] float time) { assert(0); }
+
+    void ClearSampledValue()
+    {
+        m_hasSampledValue = false;
+    }
+
     static void Reflect([[maybe_unused]] AZ::ReflectContext* context) {}
 
 protected:
@@ -409,6 +418,11 @@ private:
 
     unsigned int m_id = 0;
 
+    //! Value evaluated by SampleValue(), valid for m_sampledTime while m_hasSampledValue is set.
+    float m_sampledTime = 0.0f;
+    float m_sampledValue = 0.0f;
+    bool m_hasSampledValue = false;
+
     static bool VersionConverter(AZ::SerializeContext& context, AZ::SerializeContext::DataElementNode& classElement) {};
 };
 
@@ -53,6 +53,10 @@ inline void TAnimSplineTrack<Vec2>::GetValue(float time, float& value, bool appl
     {
         value = m_defaultValue.y;
     }
+    else if (m_hasSampledValue && m_sampledTime == time)
+    {
+        value = m_sampledValue;
+    }
     else
     {
         Spline::ValueType tmp;
@@ -65,6 +69,18 @@ inline void TAnimSplineTrack<Vec2>::GetValue(float time, float& value, bool appl
     }
 }
 template <>
+inline void TAnimSplineTrack<Vec2>::SampleValue(float time)
+{
+    if (GetNumKeys() > 0)
+    {
+        Spline::ValueType tmp;
+        m_spline->Interpolate(time, tmp);
+        m_sampledValue = tmp[0];
+        m_sampledTime = time;
+        m_hasSampledValue = true;
+    }
+}
+template <>
 inline EAnimCurveType TAnimSplineTrack<Vec2>::GetCurveType() { return eAnimCurveType_BezierFloat; }
 template <>
 inline AnimValueType TAnimSplineTrack<Vec2>::GetValueType() { return kAnimValueDefault; }
@@ -44,6 +44,7 @@
 
 int CMovieSystem::m_mov_NoCutscenes = 0;
 float CMovieSystem::m_mov_cameraPrecacheTime = 1.f;
+int CMovieSystem::m_mov_parallelTrackSampling = 1;
 #if !defined(_RELEASE)
 int CMovieSystem::m_mov_DebugEvents = 0;
 int CMovieSystem::m_mov_debugCamShake = 0;
@@ -241,6 +242,8 @@ CMovieSystem::CMovieSystem(ISystem* pSystem)
 
     REGISTER_CVAR2("mov_NoCutscenes", &m_mov_NoCutscenes, 0, 0, "Disable playing of Cut-Scenes");
     REGISTER_CVAR2("mov_cameraPrecacheTime", &m_mov_cameraPrecacheTime, 1.f, VF_NULL, "");
+    REGISTER_CVAR2("mov_parallelTrackSampling", &m_mov_parallelTrackSampling, 1, VF_NULL,
+        "Evaluate the float spline tracks of a sequence on the job system before its nodes are animated.");
     m_mov_overrideCam = REGISTER_STRING("mov_overrideCam", "", VF_NULL, "Set the camera used for the sequence which overrides the camera track info in the sequence.\nUse the Camera Name for Object Entity Cameras (Legacy) or the Entity ID for Component Entity Cameras.");
 
     DoNodeStaticInitialisation();
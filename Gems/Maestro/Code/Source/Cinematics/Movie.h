@@ -296,6 +296,7 @@ private:
 
 public:
     static float m_mov_cameraPrecacheTime;
+    static int m_mov_parallelTrackSampling;
 #if !defined(_RELEASE)
     static int m_mov_DebugEvents;
     static int m_mov_debugCamShake;
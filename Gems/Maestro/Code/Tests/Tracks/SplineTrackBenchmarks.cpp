@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobEmpty.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <Cinematics/AnimSplineTrack.h>
+
+namespace SplineTrackBenchmark
+{
+    namespace SplineTrackBenchmarkSettings
+    {
+        //! Number of float tracks in the benchmark sequence, about what a cut scene with a hundred animated entities has.
+        static const int TrackCount = 2048;
+        static const int KeysPerTrack = 32;
+
+        //! Length of the sequence in seconds and the number of frames played back per iteration.
+        static const float SequenceLength = 60.0f;
+        static const int FrameCount = 120;
+
+        //! Same batch size CAnimSequence samples its tracks with.
+        static const int TracksPerJob = 32;
+    } // namespace SplineTrackBenchmarkSettings
+
+    //! Builds a sequence worth of float spline tracks with random keys and a job manager using all the hardware threads.
+    class SplineTrackBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+        void internalSetUp()
+        {
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            AZ::JobManagerDesc jobManagerDesc;
+            const AZ::u32 numWorkerThreads = AZStd::thread::hardware_concurrency();
+            for (AZ::u32 i = 0; i < numWorkerThreads; ++i)
+            {
+                jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+
+            AZ::SimpleLcgRandom random(1234);
+            const float keyInterval = SplineTrackBenchmarkSettings::SequenceLength / SplineTrackBenchmarkSettings::KeysPerTrack;
+
+            m_tracks.reserve(SplineTrackBenchmarkSettings::TrackCount);
+            for (int trackIndex = 0; trackIndex < SplineTrackBenchmarkSettings::TrackCount; ++trackIndex)
+            {
+                AZStd::unique_ptr<C2DSplineTrack> track = AZStd::make_unique<C2DSplineTrack>();
+                for (int keyIndex = 0; keyIndex < SplineTrackBenchmarkSettings::KeysPerTrack; ++keyIndex)
+                {
+                    const float time = keyIndex * keyInterval + random.GetRandomFloat() * keyInterval * 0.5f;
+                    track->SetValue(time, random.GetRandomFloat() * 100.0f, false);
+                }
+                m_tracks.push_back(AZStd::move(track));
+            }
+
+            m_values.resize(SplineTrackBenchmarkSettings::TrackCount);
+        }
+
+        void internalTearDown()
+        {
+            m_tracks = {};
+            m_values = {};
+
+            m_jobContext.reset();
+            m_jobManager.reset();
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+        }
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        float GetFrameTime(int frameIndex) const
+        {
+            return SplineTrackBenchmarkSettings::SequenceLength * frameIndex / SplineTrackBenchmarkSettings::FrameCount;
+        }
+
+        //! Reads every track the way the anim nodes do, picking up sampled values where there are any.
+        void ReadValues(float time)
+        {
+            for (size_t trackIndex = 0; trackIndex < m_tracks.size(); ++trackIndex)
+            {
+                m_tracks[trackIndex]->GetValue(time, m_values[trackIndex]);
+                m_tracks[trackIndex]->ClearSampledValue();
+            }
+        }
+
+        AZStd::vector<AZStd::unique_ptr<C2DSplineTrack>> m_tracks;
+        AZStd::vector<float> m_values;
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+    };
+
+    //! Plays the sequence forward, evaluating every track on the calling thread.
+    BENCHMARK_DEFINE_F(SplineTrackBenchmarkFixture, BM_PlaybackSerial)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (int frameIndex = 0; frameIndex < SplineTrackBenchmarkSettings::FrameCount; ++frameIndex)
+            {
+                ReadValues(GetFrameTime(frameIndex));
+            }
+            benchmark::DoNotOptimize(m_values.data());
+        }
+        state.SetItemsProcessed(state.iterations() * SplineTrackBenchmarkSettings::FrameCount * SplineTrackBenchmarkSettings::TrackCount);
+    }
+
+    //! Plays the sequence forward, sampling the tracks in batches on the job system before reading them, like CAnimSequence does.
+    BENCHMARK_DEFINE_F(SplineTrackBenchmarkFixture, BM_PlaybackParallelSampling)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (int frameIndex = 0; frameIndex < SplineTrackBenchmarkSettings::FrameCount; ++frameIndex)
+            {
+                const float time = GetFrameTime(frameIndex);
+
+                AZ::JobEmpty jobCompletion(false, m_jobContext.get());
+                for (size_t firstTrack = 0; firstTrack < m_tracks.size(); firstTrack += SplineTrackBenchmarkSettings::TracksPerJob)
+                {
+                    const size_t lastTrack = AZStd::min(firstTrack + SplineTrackBenchmarkSettings::TracksPerJob, m_tracks.size());
+                    AZ::Job* job = AZ::CreateJobFunction([this, firstTrack, lastTrack, time]()
+                        {
+                            for (size_t trackIndex = firstTrack; trackIndex < lastTrack; ++trackIndex)
+                            {
+                                m_tracks[trackIndex]->SampleValue(time);
+                            }
+                        }, true, m_jobContext.get());
+                    job->SetDependent(&jobCompletion);
+                    job->Start();
+                }
+                jobCompletion.StartAndWaitForCompletion();
+
+                ReadValues(time);
+            }
+            benchmark::DoNotOptimize(m_values.data());
+        }
+        state.SetItemsProcessed(state.iterations() * SplineTrackBenchmarkSettings::FrameCount * SplineTrackBenchmarkSettings::TrackCount);
+    }
+
+    //! Scrubs the sequence backwards, which has every track seek its keys in reverse.
+    BENCHMARK_DEFINE_F(SplineTrackBenchmarkFixture, BM_ScrubBackwards)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (int frameIndex = SplineTrackBenchmarkSettings::FrameCount - 1; frameIndex >= 0; --frameIndex)
+            {
+                ReadValues(GetFrameTime(frameIndex));
+            }
+            benchmark::DoNotOptimize(m_values.data());
+        }
+        state.SetItemsProcessed(state.iterations() * SplineTrackBenchmarkSettings::FrameCount * SplineTrackBenchmarkSettings::TrackCount);
+    }
+
+    BENCHMARK_REGISTER_F(SplineTrackBenchmarkFixture, BM_PlaybackSerial)
+        ->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(SplineTrackBenchmarkFixture, BM_PlaybackParallelSampling)
+        ->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(SplineTrackBenchmarkFixture, BM_ScrubBackwards)
+        ->Unit(benchmark::kMillisecond);
+} // namespace SplineTrackBenchmark
+#endif // HAVE_BENCHMARK
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AnimKey.h>
+#include <Cinematics/AnimSplineTrack.h>
+
+namespace SplineTrackTest
+{
+    const float KeyTimes[] = { 0.0f, 1.0f, 2.5f, 3.0f, 5.0f };
+    const float KeyValues[] = { 0.0f, 10.0f, -4.0f, 2.0f, 7.0f };
+    const int KeyCount = 5;
+
+    const int SampleCount = 64;
+
+    class C2DSplineTrackTest
+        : public ::testing::Test
+    {
+    public:
+        void SetUp() override
+        {
+            for (int keyIndex = 0; keyIndex < KeyCount; ++keyIndex)
+            {
+                m_track.SetValue(KeyTimes[keyIndex], KeyValues[keyIndex], false);
+            }
+        }
+
+        float GetSampleTime(int sampleIndex) const
+        {
+            return KeyTimes[KeyCount - 1] * static_cast<float>(sampleIndex) / static_cast<float>(SampleCount - 1);
+        }
+
+        C2DSplineTrack m_track;
+    };
+
+    TEST_F(C2DSplineTrackTest, GetValue_AtKeyTimes_ExpectKeyValues)
+    {
+        for (int keyIndex = 0; keyIndex < KeyCount; ++keyIndex)
+        {
+            float value = 0.0f;
+            m_track.GetValue(KeyTimes[keyIndex], value);
+            EXPECT_NEAR(value, KeyValues[keyIndex], 0.001f);
+        }
+    }
+
+    TEST_F(C2DSplineTrackTest, GetValue_OutsideKeyRange_ExpectFirstAndLastKeyValues)
+    {
+        float value = 0.0f;
+        m_track.GetValue(KeyTimes[0] - 1.0f, value);
+        EXPECT_FLOAT_EQ(value, KeyValues[0]);
+
+        m_track.GetValue(KeyTimes[KeyCount - 1] + 1.0f, value);
+        EXPECT_FLOAT_EQ(value, KeyValues[KeyCount - 1]);
+    }
+
+    TEST_F(C2DSplineTrackTest, GetValue_SeekBackwards_ExpectSameValuesAsForwards)
+    {
+        float forwardValues[SampleCount];
+        for (int sampleIndex = 0; sampleIndex < SampleCount; ++sampleIndex)
+        {
+            m_track.GetValue(GetSampleTime(sampleIndex), forwardValues[sampleIndex]);
+        }
+
+        for (int sampleIndex = SampleCount - 1; sampleIndex >= 0; --sampleIndex)
+        {
+            float value = 0.0f;
+            m_track.GetValue(GetSampleTime(sampleIndex), value);
+            EXPECT_FLOAT_EQ(value, forwardValues[sampleIndex]);
+        }
+
+        // Jump back and forth across several keys at once.
+        for (int sampleIndex = 0; sampleIndex < SampleCount; ++sampleIndex)
+        {
+            const int jumpedIndex = (sampleIndex * 37) % SampleCount;
+            float value = 0.0f;
+            m_track.GetValue(GetSampleTime(jumpedIndex), value);
+            EXPECT_FLOAT_EQ(value, forwardValues[jumpedIndex]);
+        }
+    }
+
+    TEST_F(C2DSplineTrackTest, SetKey_AfterEvaluation_ExpectUpdatedValues)
+    {
+        float value = 0.0f;
+        m_track.GetValue(KeyTimes[2], value);
+
+        I2DBezierKey key;
+        m_track.GetKey(2, &key);
+        key.value.y = 20.0f;
+        m_track.SetKey(2, &key);
+
+        m_track.GetValue(KeyTimes[2], value);
+        EXPECT_NEAR(value, 20.0f, 0.001f);
+    }
+
+    TEST_F(C2DSplineTrackTest, GetValue_StepOutTangent_ExpectNextKeyValue)
+    {
+        const int stepFlags = (SPLINE_KEY_TANGENT_CUSTOM << SPLINE_KEY_TANGENT_IN_SHIFT) | (SPLINE_KEY_TANGENT_STEP << SPLINE_KEY_TANGENT_OUT_SHIFT);
+        m_track.SetKeyFlags(1, stepFlags);
+
+        float value = 0.0f;
+        m_track.GetValue((KeyTimes[1] + KeyTimes[2]) * 0.5f, value);
+        EXPECT_FLOAT_EQ(value, KeyValues[2]);
+    }
+
+    TEST_F(C2DSplineTrackTest, SampleValue_ExpectGetValueReturnsSample)
+    {
+        const float time = 1.75f;
+
+        float expectedValue = 0.0f;
+        m_track.GetValue(time, expectedValue);
+
+        m_track.SampleValue(time);
+
+        float value = 0.0f;
+        m_track.GetValue(time, value);
+        EXPECT_FLOAT_EQ(value, expectedValue);
+
+        // A different time isn't served from the sample.
+        m_track.GetValue(KeyTimes[3], value);
+        EXPECT_NEAR(value, KeyValues[3], 0.001f);
+
+        m_track.ClearSampledValue();
+        m_track.GetValue(time, value);
+        EXPECT_FLOAT_EQ(value, expectedValue);
+    }
+} // namespace SplineTrackTest
@@ -12,4 +12,6 @@ set(FILES
     Tests/MaestroTest.cpp
     Tests/Tracks/BoolTrackTest.cpp
     Tests/Tracks/AnimTrackTest.cpp
+    Tests/Tracks/SplineTrackTest.cpp
+    Tests/Tracks/SplineTrackBenchmarks.cpp
 )
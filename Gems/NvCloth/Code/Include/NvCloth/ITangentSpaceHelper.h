@@ -10,6 +10,7 @@
 
 #include <AzCore/Debug/Budget.h>
 #include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/array.h>
 
 #include <NvCloth/Types.h>
 
@@ -17,6 +18,50 @@ AZ_DECLARE_BUDGET(Cloth);
 
 namespace NvCloth
 {
+    class TangentSpaceHelper;
+
+    //! Data of a mesh that ITangentSpaceHelper reuses between calculations.
+    //!
+    //! Keep one per mesh whose tangent space is recalculated every frame, so the triangles
+    //! using each vertex are gathered only once and the per triangle buffers are not reallocated.
+    //! The cache is rebuilt when the number of vertices or indices changes, call Invalidate when
+    //! the indices change otherwise.
+    //! @note A cache must not be used by more than one calculation at a time.
+    class TangentSpaceCache
+    {
+    public:
+        void Invalidate()
+        {
+            m_vertexCount = 0;
+            m_indexCount = 0;
+            m_isValid = false;
+        }
+
+    private:
+        friend class TangentSpaceHelper;
+
+        //! Tangent space base of a triangle and the weights used to distribute it to its vertices.
+        struct TriangleTangentSpace
+        {
+            AZ::Vector3 m_normal = AZ::Vector3::CreateZero();
+            AZ::Vector3 m_tangent = AZ::Vector3::CreateZero();
+            AZ::Vector3 m_bitangent = AZ::Vector3::CreateZero();
+            AZStd::array<float, 3> m_vertexWeights = {{ 0.0f, 0.0f, 0.0f }};
+        };
+
+        //! Triangle corners (triangle index * 3 + vertex index in triangle) using each vertex, in triangle order.
+        //! The corners of vertex i are m_vertexCorners[m_vertexCornerOffsets[i]] to m_vertexCorners[m_vertexCornerOffsets[i + 1] - 1].
+        AZStd::vector<AZ::u32> m_vertexCornerOffsets;
+        AZStd::vector<AZ::u32> m_vertexCorners;
+
+        //! Results of the triangle pass, overwritten by every calculation.
+        AZStd::vector<TriangleTangentSpace> m_triangleTangentSpaces;
+
+        size_t m_vertexCount = 0;
+        size_t m_indexCount = 0;
+        bool m_isValid = false;
+    };
+
     //! Interface that provides a set of functions to
     //! calculate tangent space information for cloth's particles.
     //!
@@ -40,6 +85,14 @@ namespace NvCloth
             const AZStd::vector<SimIndexType>& indices,
             AZStd::vector<AZ::Vector3>& outNormals) = 0;
 
+        //! Calculates the normals of a simulation mesh, reusing the data in the cache.
+        //! @see CalculateNormals
+        virtual bool CalculateNormals(
+            const AZStd::vector<SimParticleFormat>& vertices,
+            const AZStd::vector<SimIndexType>& indices,
+            AZStd::vector<AZ::Vector3>& outNormals,
+            TangentSpaceCache& cache) = 0;
+
         //! Calculates the tangents and bitangents of a simulation mesh.
         //!
         //! @param vertices List of particles, which are composed of positions and inverse masses.
@@ -57,6 +110,17 @@ namespace NvCloth
             AZStd::vector<AZ::Vector3>& outTangents,
             AZStd::vector<AZ::Vector3>& outBitangents) = 0;
 
+        //! Calculates the tangents and bitangents of a simulation mesh, reusing the data in the cache.
+        //! @see CalculateTangentsAndBitagents
+        virtual bool CalculateTangentsAndBitagents(
+            const AZStd::vector<SimParticleFormat>& vertices,
+            const AZStd::vector<SimIndexType>& indices,
+            const AZStd::vector<SimUVType>& uvs,
+            const AZStd::vector<AZ::Vector3>& normals,
+            AZStd::vector<AZ::Vector3>& outTangents,
+            AZStd::vector<AZ::Vector3>& outBitangents,
+            TangentSpaceCache& cache) = 0;
+
         //! Calculates the tangents, bitangents and normals of a simulation mesh.
         //!
         //! @param vertices List of particles, which are composed of positions and inverse masses.
@@ -73,5 +137,16 @@ namespace NvCloth
             AZStd::vector<AZ::Vector3>& outTangents,
             AZStd::vector<AZ::Vector3>& outBitangents,
             AZStd::vector<AZ::Vector3>& outNormals) = 0;
+
+        //! Calculates the tangents, bitangents and normals of a simulation mesh, reusing the data in the cache.
+        //! @see CalculateTangentSpace
+        virtual bool CalculateTangentSpace(
+            const AZStd::vector<SimParticleFormat>& vertices,
+            const AZStd::vector<SimIndexType>& indices,
+            const AZStd::vector<SimUVType>& uvs,
+            AZStd::vector<AZ::Vector3>& outTangents,
+            AZStd::vector<AZ::Vector3>& outBitangents,
+            AZStd::vector<AZ::Vector3>& outNormals,
+            TangentSpaceCache& cache) = 0;
     };
 } // namespace NvCloth
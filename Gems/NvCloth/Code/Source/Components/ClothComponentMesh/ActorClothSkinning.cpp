@@ -16,6 +16,7 @@
 
 #include <Components/ClothComponentMesh/ActorClothSkinning.h>
 #include <Utils/AssetHelper.h>
+#include <Utils/ParallelRangeHelper.h>
 
 #include <AzCore/Math/PackedVector3.h>
 
@@ -23,6 +24,9 @@ namespace NvCloth
 {
     namespace Internal
     {
+        // Minimum number of vertices skinned by each job.
+        const size_t MinVerticesPerJob = 1024;
+
         bool ObtainSkinningInfluences(
             AZ::EntityId entityId, 
             const MeshNodeInfo& meshNodeInfo,
@@ -185,22 +189,26 @@ namespace NvCloth
             return transformData->GetSkinningMatrices();
         }
 
-        AZStd::unordered_map<AZ::u16, MCore::DualQuaternion> ObtainSkinningDualQuaternions(
+        // Fills a list indexed by joint index with the dual quaternions of the joints used for skinning.
+        // Joints not used by the skinning influences are left untouched.
+        void ObtainSkinningDualQuaternions(
             AZ::EntityId entityId,
-            const AZStd::vector<AZ::u16>& jointIndices)
+            const AZStd::vector<AZ::u16>& jointIndices,
+            AZStd::vector<MCore::DualQuaternion>& skinningDualQuaternions)
         {
             const AZ::Matrix3x4* skinningMatrices = ObtainSkinningMatrices(entityId);
-            if (!skinningMatrices)
+            if (!skinningMatrices || jointIndices.empty())
             {
-                return {};
+                skinningDualQuaternions.clear();
+                return;
             }
 
-            AZStd::unordered_map<AZ::u16, MCore::DualQuaternion> skinningDualQuaternions;
+            // Joint indices are sorted, the last one is the highest index.
+            skinningDualQuaternions.resize(jointIndices.back() + 1);
             for (AZ::u16 jointIndex : jointIndices)
             {
-                skinningDualQuaternions.emplace(jointIndex, MCore::DualQuaternion(AZ::Transform::CreateFromMatrix3x4(skinningMatrices[jointIndex])));
+                skinningDualQuaternions[jointIndex] = MCore::DualQuaternion(AZ::Transform::CreateFromMatrix3x4(skinningMatrices[jointIndex]));
             }
-            return skinningDualQuaternions;
         }
     }
 
@@ -224,7 +232,7 @@ namespace NvCloth
             ClothComponentMesh::RenderData& renderData) override;
 
     private:
-        AZ::Matrix3x4 ComputeVertexSkinnningTransform(AZ::u32 vertexIndex);
+        AZ::Matrix3x4 ComputeVertexSkinnningTransform(AZ::u32 vertexIndex) const;
 
         const AZ::Matrix3x4* m_skinningMatrices = nullptr;
 
@@ -252,14 +260,17 @@ namespace NvCloth
 
         AZ_PROFILE_FUNCTION(Cloth);
 
-        const size_t vertexCount = m_simulatedVertices.size();
-        for (size_t index = 0; index < vertexCount; ++index)
-        {
-            const AZ::Matrix3x4 vertexSkinningTransform = ComputeVertexSkinnningTransform(m_simulatedVertices[index]);
+        ParallelForRanges(m_simulatedVertices.size(), Internal::MinVerticesPerJob,
+            [this, &originalPositions, &positions](size_t rangeBegin, size_t rangeEnd)
+            {
+                for (size_t index = rangeBegin; index < rangeEnd; ++index)
+                {
+                    const AZ::Matrix3x4 vertexSkinningTransform = ComputeVertexSkinnningTransform(m_simulatedVertices[index]);
 
-            const AZ::Vector3 skinnedPosition = vertexSkinningTransform * originalPositions[index].GetAsVector3();
-            positions[index].Set(skinnedPosition, positions[index].GetW()); // Avoid overwriting the w component
-        }
+                    const AZ::Vector3 skinnedPosition = vertexSkinningTransform * originalPositions[index].GetAsVector3();
+                    positions[index].Set(skinnedPosition, positions[index].GetW()); // Avoid overwriting the w component
+                }
+            });
     }
 
     void ActorClothSkinningLinear::ApplySkinningOnNonSimulatedVertices(
@@ -276,27 +287,32 @@ namespace NvCloth
 
         AZ_PROFILE_FUNCTION(Cloth);
 
-        for (const AZ::u32 index : m_nonSimulatedVertices)
-        {
-            const AZ::Matrix3x4 vertexSkinningTransform = ComputeVertexSkinnningTransform(index);
+        ParallelForRanges(m_nonSimulatedVertices.size(), Internal::MinVerticesPerJob,
+            [this, &originalData, &renderData](size_t rangeBegin, size_t rangeEnd)
+            {
+                for (size_t nonSimulatedIndex = rangeBegin; nonSimulatedIndex < rangeEnd; ++nonSimulatedIndex)
+                {
+                    const AZ::u32 index = m_nonSimulatedVertices[nonSimulatedIndex];
+                    const AZ::Matrix3x4 vertexSkinningTransform = ComputeVertexSkinnningTransform(index);
 
-            const AZ::Vector3 skinnedPosition = vertexSkinningTransform * originalData.m_particles[index].GetAsVector3();
-            renderData.m_particles[index].Set(skinnedPosition, renderData.m_particles[index].GetW()); // Avoid overwriting the w component
+                    const AZ::Vector3 skinnedPosition = vertexSkinningTransform * originalData.m_particles[index].GetAsVector3();
+                    renderData.m_particles[index].Set(skinnedPosition, renderData.m_particles[index].GetW()); // Avoid overwriting the w component
 
-            // Calculate the reciprocal scale version of the matrix to transform the normals.
-            // Note: This operation is not strictly equivalent to the full inverse transpose when the matrix's
-            //       basis vectors are not perpendicular, which is the case blending linearly the matrices.
-            //       This is a fast approximation, which is also done by the GPU skinning shader.
-            const AZ::Matrix3x4 vertexSkinningTransformReciprocalScale = vertexSkinningTransform.GetReciprocalScaled();
+                    // Calculate the reciprocal scale version of the matrix to transform the normals.
+                    // Note: This operation is not strictly equivalent to the full inverse transpose when the matrix's
+                    //       basis vectors are not perpendicular, which is the case blending linearly the matrices.
+                    //       This is a fast approximation, which is also done by the GPU skinning shader.
+                    const AZ::Matrix3x4 vertexSkinningTransformReciprocalScale = vertexSkinningTransform.GetReciprocalScaled();
 
-            renderData.m_normals[index] = vertexSkinningTransformReciprocalScale.TransformVector(originalData.m_normals[index]).GetNormalized();
+                    renderData.m_normals[index] = vertexSkinningTransformReciprocalScale.TransformVector(originalData.m_normals[index]).GetNormalized();
 
-            // Tangents and Bitangents are recalculated immediately after this call
-            // by cloth mesh component, so there is no need to transform them here.
-        }
+                    // Tangents and Bitangents are recalculated immediately after this call
+                    // by cloth mesh component, so there is no need to transform them here.
+                }
+            });
     }
 
-    AZ::Matrix3x4 ActorClothSkinningLinear::ComputeVertexSkinnningTransform(AZ::u32 vertexIndex)
+    AZ::Matrix3x4 ActorClothSkinningLinear::ComputeVertexSkinnningTransform(AZ::u32 vertexIndex) const
     {
         AZ::Matrix3x4 vertexSkinningTransform = s_zeroMatrix3x4;
         for (size_t influenceIndex = 0; influenceIndex < m_numberOfInfluencesPerVertex; ++influenceIndex)
@@ -333,9 +349,10 @@ namespace NvCloth
             ClothComponentMesh::RenderData& renderData) override;
 
     private:
-        MCore::DualQuaternion ComputeVertexSkinnningTransform(AZ::u32 vertexIndex);
+        MCore::DualQuaternion ComputeVertexSkinnningTransform(AZ::u32 vertexIndex) const;
 
-        AZStd::unordered_map<AZ::u16, MCore::DualQuaternion> m_skinningDualQuaternions;
+        // Indexed by joint index, so vertices can look up their joints without hashing.
+        AZStd::vector<MCore::DualQuaternion> m_skinningDualQuaternions;
 
         inline static const MCore::DualQuaternion s_zeroDualQuaternion = MCore::DualQuaternion(AZ::Quaternion::CreateZero(), AZ::Quaternion::CreateZero());
     };
@@ -344,7 +361,7 @@ namespace NvCloth
     {
         AZ_PROFILE_FUNCTION(Cloth);
 
-        m_skinningDualQuaternions = Internal::ObtainSkinningDualQuaternions(m_entityId, m_jointIndices);
+        Internal::ObtainSkinningDualQuaternions(m_entityId, m_jointIndices, m_skinningDualQuaternions);
     }
 
     void ActorClothSkinningDualQuaternion::ApplySkinning(
@@ -361,14 +378,17 @@ namespace NvCloth
 
         AZ_PROFILE_FUNCTION(Cloth);
 
-        const size_t vertexCount = m_simulatedVertices.size();
-        for (size_t index = 0; index < vertexCount; ++index)
-        {
-            const MCore::DualQuaternion vertexSkinningTransform = ComputeVertexSkinnningTransform(m_simulatedVertices[index]);
+        ParallelForRanges(m_simulatedVertices.size(), Internal::MinVerticesPerJob,
+            [this, &originalPositions, &positions](size_t rangeBegin, size_t rangeEnd)
+            {
+                for (size_t index = rangeBegin; index < rangeEnd; ++index)
+                {
+                    const MCore::DualQuaternion vertexSkinningTransform = ComputeVertexSkinnningTransform(m_simulatedVertices[index]);
 
-            const AZ::Vector3 skinnedPosition = vertexSkinningTransform.TransformPoint(originalPositions[index].GetAsVector3());
-            positions[index].Set(skinnedPosition, positions[index].GetW()); // Avoid overwriting the w component
-        }
+                    const AZ::Vector3 skinnedPosition = vertexSkinningTransform.TransformPoint(originalPositions[index].GetAsVector3());
+                    positions[index].Set(skinnedPosition, positions[index].GetW()); // Avoid overwriting the w component
+                }
+            });
     }
 
     void ActorClothSkinningDualQuaternion::ApplySkinningOnNonSimulatedVertices(
@@ -385,25 +405,30 @@ namespace NvCloth
 
         AZ_PROFILE_FUNCTION(Cloth);
 
-        for (const AZ::u32 index : m_nonSimulatedVertices)
-        {
-            const MCore::DualQuaternion vertexSkinningTransform = ComputeVertexSkinnningTransform(index);
+        ParallelForRanges(m_nonSimulatedVertices.size(), Internal::MinVerticesPerJob,
+            [this, &originalData, &renderData](size_t rangeBegin, size_t rangeEnd)
+            {
+                for (size_t nonSimulatedIndex = rangeBegin; nonSimulatedIndex < rangeEnd; ++nonSimulatedIndex)
+                {
+                    const AZ::u32 index = m_nonSimulatedVertices[nonSimulatedIndex];
+                    const MCore::DualQuaternion vertexSkinningTransform = ComputeVertexSkinnningTransform(index);
 
-            const AZ::Vector3 skinnedPosition = vertexSkinningTransform.TransformPoint(originalData.m_particles[index].GetAsVector3());
-            renderData.m_particles[index].Set(skinnedPosition, renderData.m_particles[index].GetW()); // Avoid overwriting the w component
+                    const AZ::Vector3 skinnedPosition = vertexSkinningTransform.TransformPoint(originalData.m_particles[index].GetAsVector3());
+                    renderData.m_particles[index].Set(skinnedPosition, renderData.m_particles[index].GetW()); // Avoid overwriting the w component
 
-            // ComputeVertexSkinnningTransform is normalizing the blended dual quaternion. This means the dual
-            // quaternion will not have any scale and there is no need to compute the reciprocal scale version
-            // for transforming normals.
-            // Note: The GPU skinning shader does the same operation.
-            renderData.m_normals[index] = vertexSkinningTransform.TransformVector(originalData.m_normals[index]).GetNormalized();
+                    // ComputeVertexSkinnningTransform is normalizing the blended dual quaternion. This means the dual
+                    // quaternion will not have any scale and there is no need to compute the reciprocal scale version
+                    // for transforming normals.
+                    // Note: The GPU skinning shader does the same operation.
+                    renderData.m_normals[index] = vertexSkinningTransform.TransformVector(originalData.m_normals[index]).GetNormalized();
 
-            // Tangents and Bitangents are recalculated immediately after this call
-            // by cloth mesh component, so there is no need to transform them here.
-        }
+                    // Tangents and Bitangents are recalculated immediately after this call
+                    // by cloth mesh component, so there is no need to transform them here.
+                }
+            });
     }
 
-    MCore::DualQuaternion ActorClothSkinningDualQuaternion::ComputeVertexSkinnningTransform(AZ::u32 vertexIndex)
+    MCore::DualQuaternion ActorClothSkinningDualQuaternion::ComputeVertexSkinnningTransform(AZ::u32 vertexIndex) const
     {
         MCore::DualQuaternion vertexSkinningTransform = s_zeroDualQuaternion;
         for (size_t influenceIndex = 0; influenceIndex < m_numberOfInfluencesPerVertex; ++influenceIndex)
@@ -413,7 +438,7 @@ namespace NvCloth
             const AZ::u16 jointIndex = m_skinningInfluences[vertexInfluenceIndex].m_jointIndex;
             const float jointWeight = m_skinningInfluences[vertexInfluenceIndex].m_jointWeight;
 
-            const MCore::DualQuaternion& skinningDualQuaternion = m_skinningDualQuaternions.at(jointIndex);
+            const MCore::DualQuaternion& skinningDualQuaternion = m_skinningDualQuaternions[jointIndex];
 
             float flip = AZ::GetSign(vertexSkinningTransform.m_real.Dot(skinningDualQuaternion.m_real));
             vertexSkinningTransform += skinningDualQuaternion * jointWeight * flip;
@@ -241,6 +241,9 @@ namespace NvCloth
         m_meshRemappedVertices.clear();
         m_meshNodeInfo = {};
         m_meshClothInfo = {};
+        m_simulatedNormals.clear();
+        m_simulatedTangentSpaceCache.Invalidate();
+        m_renderTangentSpaceCache.Invalidate();
         m_actorClothColliders.reset();
         m_actorClothSkinning.reset();
         m_clothConstraints.reset();
@@ -415,9 +418,10 @@ namespace NvCloth
         }
 
         // Calculate normals of the cloth particles (simplified mesh).
-        AZStd::vector<AZ::Vector3> normals;
+        AZStd::vector<AZ::Vector3>& normals = m_simulatedNormals;
         [[maybe_unused]] bool normalsCalculated =
-            AZ::Interface<ITangentSpaceHelper>::Get()->CalculateNormals(particles, m_cloth->GetInitialIndices(), normals);
+            AZ::Interface<ITangentSpaceHelper>::Get()->CalculateNormals(
+                particles, m_cloth->GetInitialIndices(), normals, m_simulatedTangentSpaceCache);
         AZ_Assert(normalsCalculated, "Cloth component mesh failed to calculate normals.");
 
         // Copy particles and normals to render data.
@@ -446,7 +450,8 @@ namespace NvCloth
             AZ::Interface<ITangentSpaceHelper>::Get()->CalculateTangentsAndBitagents(
                 renderData.m_particles, m_meshClothInfo.m_indices,
                 m_meshClothInfo.m_uvs, renderData.m_normals,
-                renderData.m_tangents, renderData.m_bitangents);
+                renderData.m_tangents, renderData.m_bitangents,
+                m_renderTangentSpaceCache);
         AZ_Assert(tangentsAndBitangentsCalculated, "Cloth component mesh failed to calculate tangents and bitangents.");
     }
 
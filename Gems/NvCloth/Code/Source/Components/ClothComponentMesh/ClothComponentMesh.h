@@ -15,6 +15,7 @@
 #include <AzFramework/Physics/WindBus.h>
 
 #include <NvCloth/ICloth.h>
+#include <NvCloth/ITangentSpaceHelper.h>
 
 #include <Components/ClothConfiguration.h>
 
@@ -124,6 +125,11 @@ namespace NvCloth
         // Original cloth information from the mesh.
         MeshClothInfo m_meshClothInfo;
 
+        // Tangent space data reused every frame for the simplified mesh (simulation particles) and the full mesh.
+        AZStd::vector<AZ::Vector3> m_simulatedNormals;
+        TangentSpaceCache m_simulatedTangentSpaceCache;
+        TangentSpaceCache m_renderTangentSpaceCache;
+
         // Cloth Colliders from the character
         AZStd::unique_ptr<ActorClothColliders> m_actorClothColliders;
 
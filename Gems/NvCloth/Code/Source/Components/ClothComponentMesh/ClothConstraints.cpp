@@ -102,7 +102,7 @@ namespace NvCloth
 
         if (!m_separationConstraints.empty())
         {
-            [[maybe_unused]] bool normalsCalculated = AZ::Interface<ITangentSpaceHelper>::Get()->CalculateNormals(simParticles, simIndices, m_normals);
+            [[maybe_unused]] bool normalsCalculated = AZ::Interface<ITangentSpaceHelper>::Get()->CalculateNormals(simParticles, simIndices, m_normals, m_normalsCache);
             AZ_Assert(normalsCalculated, "Cloth constraints failed to calculate normals.");
 
             CalculateSeparationConstraints();
@@ -11,6 +11,7 @@
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/Component/EntityId.h>
 
+#include <NvCloth/ITangentSpaceHelper.h>
 #include <NvCloth/Types.h>
 
 namespace NvCloth
@@ -67,6 +68,7 @@ namespace NvCloth
         float m_backstopMaxBackOffset = 0.0f;
         float m_backstopMaxFrontOffset = 0.0f;
         AZStd::vector<AZ::Vector3> m_normals;
+        TangentSpaceCache m_normalsCache;
 
         // The current positions and radius of motion constraints.
         AZStd::vector<AZ::Vector4> m_motionConstraints;
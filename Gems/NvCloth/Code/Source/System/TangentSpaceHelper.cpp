@@ -10,17 +10,32 @@
 
 #include <AzCore/Debug/Profiler.h>
 
+#include <Utils/ParallelRangeHelper.h>
+
 namespace NvCloth
 {
     namespace
     {
         const float Tolerance = 1e-7f;
+
+        // Minimum number of triangles or vertices processed by each job.
+        const size_t MinElementsPerJob = 2048;
     }
 
     bool TangentSpaceHelper::CalculateNormals(
         const AZStd::vector<SimParticleFormat>& vertices,
         const AZStd::vector<SimIndexType>& indices,
         AZStd::vector<AZ::Vector3>& outNormals)
+    {
+        TangentSpaceCache cache;
+        return CalculateNormals(vertices, indices, outNormals, cache);
+    }
+
+    bool TangentSpaceHelper::CalculateNormals(
+        const AZStd::vector<SimParticleFormat>& vertices,
+        const AZStd::vector<SimIndexType>& indices,
+        AZStd::vector<AZ::Vector3>& outNormals,
+        TangentSpaceCache& cache)
     {
         AZ_PROFILE_FUNCTION(Cloth);
 
@@ -35,47 +50,60 @@ namespace NvCloth
         const size_t triangleCount = indices.size() / 3;
         const size_t vertexCount = vertices.size();
 
-        // Reset results
-        outNormals.resize(vertexCount);
-        AZStd::fill(outNormals.begin(), outNormals.end(), AZ::Vector3::CreateZero());
-
         // calculate the normals per triangle
-        for (size_t i = 0; i < triangleCount; ++i)
-        {
-            TriangleIndices triangleIndices;
-            TrianglePositions trianglePositions;
-            TriangleEdges triangleEdges;
-            GetTriangleData(
-                i, indices, vertices,
-                triangleIndices, trianglePositions, triangleEdges);
-
-            AZ::Vector3 normal;
-            ComputeNormal(triangleEdges, normal);
-
-            // distribute the normals to the vertices.
-            for (AZ::u32 vertexIndexInTriangle = 0; vertexIndexInTriangle < 3; ++vertexIndexInTriangle)
+        PrepareCache(indices, vertexCount, cache);
+        AZStd::vector<TriangleTangentSpace>& triangleTangentSpaces = cache.m_triangleTangentSpaces;
+        ParallelForRanges(triangleCount, MinElementsPerJob,
+            [this, &indices, &vertices, &triangleTangentSpaces](size_t rangeBegin, size_t rangeEnd)
             {
-                const float weight = GetVertexWeightInTriangle(vertexIndexInTriangle, trianglePositions);
-
-                const SimIndexType vertexIndex = triangleIndices[vertexIndexInTriangle];
-
-                outNormals[vertexIndex] += normal * AZStd::max(weight, Tolerance);
-            }
-        }
-
-        // adjust the normals per vertex
-        for (auto& outNormal : outNormals)
-        {
-            outNormal.NormalizeSafe(Tolerance);
-
-            // Safety check for situations where simulation gets out of control.
-            // Particles' positions can have huge floating point values that
-            // could lead to non-finite numbers when calculating tangent spaces.
-            if (!outNormal.IsFinite())
+                for (size_t i = rangeBegin; i < rangeEnd; ++i)
+                {
+                    TriangleIndices triangleIndices;
+                    TrianglePositions trianglePositions;
+                    TriangleEdges triangleEdges;
+                    GetTriangleData(
+                        i, indices, vertices,
+                        triangleIndices, trianglePositions, triangleEdges);
+
+                    TriangleTangentSpace& triangleTangentSpace = triangleTangentSpaces[i];
+                    ComputeNormal(triangleEdges, triangleTangentSpace.m_normal);
+                    ComputeVertexWeights(trianglePositions, triangleTangentSpace.m_vertexWeights);
+                }
+            });
+
+        const AZStd::vector<AZ::u32>& vertexCornerOffsets = cache.m_vertexCornerOffsets;
+        const AZStd::vector<AZ::u32>& vertexCorners = cache.m_vertexCorners;
+
+        // distribute the normals to the vertices and adjust them per vertex
+        outNormals.resize(vertexCount);
+        ParallelForRanges(vertexCount, MinElementsPerJob,
+            [&triangleTangentSpaces, &vertexCornerOffsets, &vertexCorners, &outNormals](size_t rangeBegin, size_t rangeEnd)
             {
-                outNormal = AZ::Vector3::CreateAxisZ();
-            }
-        }
+                for (size_t vertexIndex = rangeBegin; vertexIndex < rangeEnd; ++vertexIndex)
+                {
+                    AZ::Vector3 normal = AZ::Vector3::CreateZero();
+                    for (AZ::u32 i = vertexCornerOffsets[vertexIndex]; i < vertexCornerOffsets[vertexIndex + 1]; ++i)
+                    {
+                        const AZ::u32 corner = vertexCorners[i];
+                        const TriangleTangentSpace& triangleTangentSpace = triangleTangentSpaces[corner / 3];
+                        const float weight = triangleTangentSpace.m_vertexWeights[corner % 3];
+
+                        normal += triangleTangentSpace.m_normal * AZStd::max(weight, Tolerance);
+                    }
+
+                    normal.NormalizeSafe(Tolerance);
+
+                    // Safety check for situations where simulation gets out of control.
+                    // Particles' positions can have huge floating point values that
+                    // could lead to non-finite numbers when calculating tangent spaces.
+                    if (!normal.IsFinite())
+                    {
+                        normal = AZ::Vector3::CreateAxisZ();
+                    }
+
+                    outNormals[vertexIndex] = normal;
+                }
+            });
 
         return true;
     }
@@ -87,6 +115,19 @@ namespace NvCloth
         const AZStd::vector<AZ::Vector3>& normals,
         AZStd::vector<AZ::Vector3>& outTangents,
         AZStd::vector<AZ::Vector3>& outBitangents)
+    {
+        TangentSpaceCache cache;
+        return CalculateTangentsAndBitagents(vertices, indices, uvs, normals, outTangents, outBitangents, cache);
+    }
+
+    bool TangentSpaceHelper::CalculateTangentsAndBitagents(
+        const AZStd::vector<SimParticleFormat>& vertices,
+        const AZStd::vector<SimIndexType>& indices,
+        const AZStd::vector<SimUVType>& uvs,
+        const AZStd::vector<AZ::Vector3>& normals,
+        AZStd::vector<AZ::Vector3>& outTangents,
+        AZStd::vector<AZ::Vector3>& outBitangents,
+        TangentSpaceCache& cache)
     {
         AZ_PROFILE_FUNCTION(Cloth);
 
@@ -117,53 +158,68 @@ namespace NvCloth
         const size_t triangleCount = indices.size() / 3;
         const size_t vertexCount = vertices.size();
 
-        // Reset results
-        outTangents.resize(vertexCount);
-        outBitangents.resize(vertexCount);
-        AZStd::fill(outTangents.begin(), outTangents.end(), AZ::Vector3::CreateZero());
-        AZStd::fill(outBitangents.begin(), outBitangents.end(), AZ::Vector3::CreateZero());
-
         // calculate the base vectors per triangle
-        for (size_t i = 0; i < triangleCount; ++i)
-        {
-            TriangleIndices triangleIndices;
-            TrianglePositions trianglePositions;
-            TriangleEdges triangleEdges;
-            TriangleUVs triangleUVs;
-            GetTriangleData(
-                i, indices, vertices, uvs,
-                triangleIndices, trianglePositions, triangleEdges, triangleUVs);
-
-            AZ::Vector3 tangent, bitangent;
-            ComputeTangentAndBitangent(triangleUVs, triangleEdges, tangent, bitangent);
-
-            // distribute the uv vectors to the vertices.
-            for (AZ::u32 vertexIndexInTriangle = 0; vertexIndexInTriangle < 3; ++vertexIndexInTriangle)
+        PrepareCache(indices, vertexCount, cache);
+        AZStd::vector<TriangleTangentSpace>& triangleTangentSpaces = cache.m_triangleTangentSpaces;
+        ParallelForRanges(triangleCount, MinElementsPerJob,
+            [this, &indices, &vertices, &uvs, &triangleTangentSpaces](size_t rangeBegin, size_t rangeEnd)
             {
-                const float weight = GetVertexWeightInTriangle(vertexIndexInTriangle, trianglePositions);
-
-                const SimIndexType vertexIndex = triangleIndices[vertexIndexInTriangle];
-
-                outTangents[vertexIndex] += tangent * weight;
-                outBitangents[vertexIndex] += bitangent * weight;
-            }
-        }
-
-        // adjust the base vectors per vertex
-        for (size_t i = 0; i < vertexCount; ++i)
-        {
-            AdjustTangentAndBitangent(normals[i], outTangents[i], outBitangents[i]);
-
-            // Safety check for situations where simulation gets out of control.
-            // Particles' positions can have huge floating point values that
-            // could lead to non-finite numbers when calculating tangent spaces.
-            if (!outTangents[i].IsFinite() ||
-                !outBitangents[i].IsFinite())
+                for (size_t i = rangeBegin; i < rangeEnd; ++i)
+                {
+                    TriangleIndices triangleIndices;
+                    TrianglePositions trianglePositions;
+                    TriangleEdges triangleEdges;
+                    TriangleUVs triangleUVs;
+                    GetTriangleData(
+                        i, indices, vertices, uvs,
+                        triangleIndices, trianglePositions, triangleEdges, triangleUVs);
+
+                    TriangleTangentSpace& triangleTangentSpace = triangleTangentSpaces[i];
+                    ComputeTangentAndBitangent(triangleUVs, triangleEdges,
+                        triangleTangentSpace.m_tangent, triangleTangentSpace.m_bitangent);
+                    ComputeVertexWeights(trianglePositions, triangleTangentSpace.m_vertexWeights);
+                }
+            });
+
+        const AZStd::vector<AZ::u32>& vertexCornerOffsets = cache.m_vertexCornerOffsets;
+        const AZStd::vector<AZ::u32>& vertexCorners = cache.m_vertexCorners;
+
+        // distribute the uv vectors to the vertices and adjust the base vectors per vertex
+        outTangents.resize(vertexCount);
+        outBitangents.resize(vertexCount);
+        ParallelForRanges(vertexCount, MinElementsPerJob,
+            [this, &normals, &triangleTangentSpaces, &vertexCornerOffsets, &vertexCorners, &outTangents, &outBitangents](size_t rangeBegin, size_t rangeEnd)
             {
-                outTangents[i] = AZ::Vector3::CreateAxisX();
-                outBitangents[i] = AZ::Vector3::CreateAxisY();
-            }
-        }
+                for (size_t vertexIndex = rangeBegin; vertexIndex < rangeEnd; ++vertexIndex)
+                {
+                    AZ::Vector3 tangent = AZ::Vector3::CreateZero();
+                    AZ::Vector3 bitangent = AZ::Vector3::CreateZero();
+                    for (AZ::u32 i = vertexCornerOffsets[vertexIndex]; i < vertexCornerOffsets[vertexIndex + 1]; ++i)
+                    {
+                        const AZ::u32 corner = vertexCorners[i];
+                        const TriangleTangentSpace& triangleTangentSpace = triangleTangentSpaces[corner / 3];
+                        const float weight = triangleTangentSpace.m_vertexWeights[corner % 3];
+
+                        tangent += triangleTangentSpace.m_tangent * weight;
+                        bitangent += triangleTangentSpace.m_bitangent * weight;
+                    }
+
+                    AdjustTangentAndBitangent(normals[vertexIndex], tangent, bitangent);
+
+                    // Safety check for situations where simulation gets out of control.
+                    // Particles' positions can have huge floating point values that
+                    // could lead to non-finite numbers when calculating tangent spaces.
+                    if (!tangent.IsFinite() ||
+                        !bitangent.IsFinite())
+                    {
+                        tangent = AZ::Vector3::CreateAxisX();
+                        bitangent = AZ::Vector3::CreateAxisY();
+                    }
+
+                    outTangents[vertexIndex] = tangent;
+                    outBitangents[vertexIndex] = bitangent;
+                }
+            });
 
         return true;
     }
@@ -175,6 +231,19 @@ namespace NvCloth
         AZStd::vector<AZ::Vector3>& outTangents,
         AZStd::vector<AZ::Vector3>& outBitangents,
         AZStd::vector<AZ::Vector3>& outNormals)
+    {
+        TangentSpaceCache cache;
+        return CalculateTangentSpace(vertices, indices, uvs, outTangents, outBitangents, outNormals, cache);
+    }
+
+    bool TangentSpaceHelper::CalculateTangentSpace(
+        const AZStd::vector<SimParticleFormat>& vertices,
+        const AZStd::vector<SimIndexType>& indices,
+        const AZStd::vector<SimUVType>& uvs,
+        AZStd::vector<AZ::Vector3>& outTangents,
+        AZStd::vector<AZ::Vector3>& outBitangents,
+        AZStd::vector<AZ::Vector3>& outNormals,
+        TangentSpaceCache& cache)
     {
         AZ_PROFILE_FUNCTION(Cloth);
 
@@ -197,74 +266,129 @@ namespace NvCloth
         const size_t triangleCount = indices.size() / 3;
         const size_t vertexCount = vertices.size();
 
-        // Reset results
+        // calculate the base vectors per triangle
+        PrepareCache(indices, vertexCount, cache);
+        AZStd::vector<TriangleTangentSpace>& triangleTangentSpaces = cache.m_triangleTangentSpaces;
+        ParallelForRanges(triangleCount, MinElementsPerJob,
+            [this, &indices, &vertices, &uvs, &triangleTangentSpaces](size_t rangeBegin, size_t rangeEnd)
+            {
+                for (size_t i = rangeBegin; i < rangeEnd; ++i)
+                {
+                    TriangleIndices triangleIndices;
+                    TrianglePositions trianglePositions;
+                    TriangleEdges triangleEdges;
+                    TriangleUVs triangleUVs;
+                    GetTriangleData(
+                        i, indices, vertices, uvs,
+                        triangleIndices, trianglePositions, triangleEdges, triangleUVs);
+
+                    TriangleTangentSpace& triangleTangentSpace = triangleTangentSpaces[i];
+                    if (ComputeNormal(triangleEdges, triangleTangentSpace.m_normal))
+                    {
+                        ComputeTangentAndBitangent(triangleUVs, triangleEdges,
+                            triangleTangentSpace.m_tangent, triangleTangentSpace.m_bitangent);
+                    }
+                    else
+                    {
+                        // Use the identity base with low influence to leave other valid triangles to
+                        // affect these vertices. In case no other triangle affects the vertices the base
+                        // will still be valid with identity values as it gets normalized later.
+                        const float identityInfluence = 0.01f;
+                        triangleTangentSpace.m_tangent = AZ::Vector3::CreateAxisX(identityInfluence);
+                        triangleTangentSpace.m_bitangent = AZ::Vector3::CreateAxisY(identityInfluence);
+                    }
+                    ComputeVertexWeights(trianglePositions, triangleTangentSpace.m_vertexWeights);
+                }
+            });
+
+        const AZStd::vector<AZ::u32>& vertexCornerOffsets = cache.m_vertexCornerOffsets;
+        const AZStd::vector<AZ::u32>& vertexCorners = cache.m_vertexCorners;
+
+        // distribute the normals and uv vectors to the vertices and adjust the base vectors per vertex
         outTangents.resize(vertexCount);
         outBitangents.resize(vertexCount);
         outNormals.resize(vertexCount);
-        AZStd::fill(outTangents.begin(), outTangents.end(), AZ::Vector3::CreateZero());
-        AZStd::fill(outBitangents.begin(), outBitangents.end(), AZ::Vector3::CreateZero());
-        AZStd::fill(outNormals.begin(), outNormals.end(), AZ::Vector3::CreateZero());
-
-        // calculate the base vectors per triangle
-        for (size_t i = 0; i < triangleCount; ++i)
-        {
-            TriangleIndices triangleIndices;
-            TrianglePositions trianglePositions;
-            TriangleEdges triangleEdges;
-            TriangleUVs triangleUVs;
-            GetTriangleData(
-                i, indices, vertices, uvs,
-                triangleIndices, trianglePositions, triangleEdges, triangleUVs);
-
-            AZ::Vector3 tangent, bitangent, normal;
-            if (ComputeNormal(triangleEdges, normal))
-            {
-                ComputeTangentAndBitangent(triangleUVs, triangleEdges, tangent, bitangent);
-            }
-            else
+        ParallelForRanges(vertexCount, MinElementsPerJob,
+            [this, &triangleTangentSpaces, &vertexCornerOffsets, &vertexCorners, &outTangents, &outBitangents, &outNormals](size_t rangeBegin, size_t rangeEnd)
             {
-                // Use the identity base with low influence to leave other valid triangles to
-                // affect these vertices. In case no other triangle affects the vertices the base
-                // will still be valid with identity values as it gets normalized later.
-                const float identityInfluence = 0.01f;
-                tangent = AZ::Vector3::CreateAxisX(identityInfluence);
-                bitangent = AZ::Vector3::CreateAxisY(identityInfluence);
-            }
-
-            // distribute the normals and uv vectors to the vertices.
-            for (AZ::u32 vertexIndexInTriangle = 0; vertexIndexInTriangle < 3; ++vertexIndexInTriangle)
-            {
-                const float weight = GetVertexWeightInTriangle(vertexIndexInTriangle, trianglePositions);
+                for (size_t vertexIndex = rangeBegin; vertexIndex < rangeEnd; ++vertexIndex)
+                {
+                    AZ::Vector3 normal = AZ::Vector3::CreateZero();
+                    AZ::Vector3 tangent = AZ::Vector3::CreateZero();
+                    AZ::Vector3 bitangent = AZ::Vector3::CreateZero();
+                    for (AZ::u32 i = vertexCornerOffsets[vertexIndex]; i < vertexCornerOffsets[vertexIndex + 1]; ++i)
+                    {
+                        const AZ::u32 corner = vertexCorners[i];
+                        const TriangleTangentSpace& triangleTangentSpace = triangleTangentSpaces[corner / 3];
+                        const float weight = triangleTangentSpace.m_vertexWeights[corner % 3];
+
+                        normal += triangleTangentSpace.m_normal * AZStd::max(weight, Tolerance);
+                        tangent += triangleTangentSpace.m_tangent * weight;
+                        bitangent += triangleTangentSpace.m_bitangent * weight;
+                    }
+
+                    normal.NormalizeSafe(Tolerance);
+
+                    AdjustTangentAndBitangent(normal, tangent, bitangent);
+
+                    // Safety check for situations where simulation gets out of control.
+                    // Particles' positions can have huge floating point values that
+                    // could lead to non-finite numbers when calculating tangent spaces.
+                    if (!normal.IsFinite() ||
+                        !tangent.IsFinite() ||
+                        !bitangent.IsFinite())
+                    {
+                        tangent = AZ::Vector3::CreateAxisX();
+                        bitangent = AZ::Vector3::CreateAxisY();
+                        normal = AZ::Vector3::CreateAxisZ();
+                    }
+
+                    outTangents[vertexIndex] = tangent;
+                    outBitangents[vertexIndex] = bitangent;
+                    outNormals[vertexIndex] = normal;
+                }
+            });
 
-                const SimIndexType vertexIndex = triangleIndices[vertexIndexInTriangle];
+        return true;
+    }
 
-                outNormals[vertexIndex] += normal * AZStd::max(weight, Tolerance);
-                outTangents[vertexIndex] += tangent * weight;
-                outBitangents[vertexIndex] += bitangent * weight;
-            }
-        }
+    void TangentSpaceHelper::PrepareCache(
+        const AZStd::vector<SimIndexType>& indices,
+        size_t vertexCount,
+        TangentSpaceCache& cache)
+    {
+        // resize keeps the capacity, so a cache used for the same mesh every frame doesn't allocate
+        cache.m_triangleTangentSpaces.resize(indices.size() / 3);
 
-        // adjust the base vectors per vertex
-        for (size_t i = 0; i < vertexCount; ++i)
+        if (cache.m_isValid &&
+            cache.m_vertexCount == vertexCount &&
+            cache.m_indexCount == indices.size())
         {
-            outNormals[i].NormalizeSafe(Tolerance);
+            return;
+        }
 
-            AdjustTangentAndBitangent(outNormals[i], outTangents[i], outBitangents[i]);
+        // Counting sort of the triangle corners by vertex. Corners are visited in triangle order, so each vertex
+        // accumulates its triangles in the same order as a serial loop over the triangles would.
+        cache.m_vertexCornerOffsets.assign(vertexCount + 1, 0);
+        for (const SimIndexType vertexIndex : indices)
+        {
+            ++cache.m_vertexCornerOffsets[vertexIndex + 1];
+        }
+        for (size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
+        {
+            cache.m_vertexCornerOffsets[vertexIndex + 1] += cache.m_vertexCornerOffsets[vertexIndex];
+        }
 
-            // Safety check for situations where simulation gets out of control.
-            // Particles' positions can have huge floating point values that
-            // could lead to non-finite numbers when calculating tangent spaces.
-            if (!outNormals[i].IsFinite() ||
-                !outTangents[i].IsFinite() ||
-                !outBitangents[i].IsFinite())
-            {
-                outTangents[i] = AZ::Vector3::CreateAxisX();
-                outBitangents[i] = AZ::Vector3::CreateAxisY();
-                outNormals[i] = AZ::Vector3::CreateAxisZ();
-            }
+        cache.m_vertexCorners.resize(indices.size());
+        AZStd::vector<AZ::u32> insertPositions(cache.m_vertexCornerOffsets.begin(), cache.m_vertexCornerOffsets.end() - 1);
+        for (size_t corner = 0; corner < indices.size(); ++corner)
+        {
+            cache.m_vertexCorners[insertPositions[indices[corner]]++] = static_cast<AZ::u32>(corner);
         }
 
-        return true;
+        cache.m_vertexCount = vertexCount;
+        cache.m_indexCount = indices.size();
+        cache.m_isValid = true;
     }
 
     void TangentSpaceHelper::GetTriangleData(
@@ -384,6 +508,14 @@ namespace NvCloth
         bitangent = normal.Cross(tangent) * handedness;
     }
 
+    void TangentSpaceHelper::ComputeVertexWeights(const TrianglePositions& trianglePositions, AZStd::array<float, 3>& vertexWeights)
+    {
+        for (AZ::u32 vertexIndexInTriangle = 0; vertexIndexInTriangle < 3; ++vertexIndexInTriangle)
+        {
+            vertexWeights[vertexIndexInTriangle] = GetVertexWeightInTriangle(vertexIndexInTriangle, trianglePositions);
+        }
+    }
+
     float TangentSpaceHelper::GetVertexWeightInTriangle(AZ::u32 vertexIndexInTriangle, const TrianglePositions& trianglePositions)
     {
         // weight by angle to fix the L-Shape problem
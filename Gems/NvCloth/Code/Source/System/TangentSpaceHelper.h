@@ -29,6 +29,11 @@ namespace NvCloth
             const AZStd::vector<SimParticleFormat>& vertices,
             const AZStd::vector<SimIndexType>& indices,
             AZStd::vector<AZ::Vector3>& outNormals) override;
+        bool CalculateNormals(
+            const AZStd::vector<SimParticleFormat>& vertices,
+            const AZStd::vector<SimIndexType>& indices,
+            AZStd::vector<AZ::Vector3>& outNormals,
+            TangentSpaceCache& cache) override;
         bool CalculateTangentsAndBitagents(
             const AZStd::vector<SimParticleFormat>& vertices,
             const AZStd::vector<SimIndexType>& indices,
@@ -36,6 +41,14 @@ namespace NvCloth
             const AZStd::vector<AZ::Vector3>& normals,
             AZStd::vector<AZ::Vector3>& outTangents,
             AZStd::vector<AZ::Vector3>& outBitangents) override;
+        bool CalculateTangentsAndBitagents(
+            const AZStd::vector<SimParticleFormat>& vertices,
+            const AZStd::vector<SimIndexType>& indices,
+            const AZStd::vector<SimUVType>& uvs,
+            const AZStd::vector<AZ::Vector3>& normals,
+            AZStd::vector<AZ::Vector3>& outTangents,
+            AZStd::vector<AZ::Vector3>& outBitangents,
+            TangentSpaceCache& cache) override;
         bool CalculateTangentSpace(
             const AZStd::vector<SimParticleFormat>& vertices,
             const AZStd::vector<SimIndexType>& indices,
@@ -43,6 +56,14 @@ namespace NvCloth
             AZStd::vector<AZ::Vector3>& outTangents,
             AZStd::vector<AZ::Vector3>& outBitangents,
             AZStd::vector<AZ::Vector3>& outNormals) override;
+        bool CalculateTangentSpace(
+            const AZStd::vector<SimParticleFormat>& vertices,
+            const AZStd::vector<SimIndexType>& indices,
+            const AZStd::vector<SimUVType>& uvs,
+            AZStd::vector<AZ::Vector3>& outTangents,
+            AZStd::vector<AZ::Vector3>& outBitangents,
+            AZStd::vector<AZ::Vector3>& outNormals,
+            TangentSpaceCache& cache) override;
 
     private:
         using TriangleIndices = AZStd::array<SimIndexType, 3>;
@@ -50,6 +71,16 @@ namespace NvCloth
         using TriangleUVs = AZStd::array<SimUVType, 3>;
         using TriangleEdges = AZStd::array<AZ::Vector3, 2>;
 
+        using TriangleTangentSpace = TangentSpaceCache::TriangleTangentSpace;
+
+        //! Gathers the triangle corners using each vertex, if the cache doesn't have them for a mesh of
+        //! this size yet, and sizes the per triangle buffer. Gathering the triangles per vertex lets the
+        //! vertices be processed in parallel ranges without write conflicts.
+        void PrepareCache(
+            const AZStd::vector<SimIndexType>& indices,
+            size_t vertexCount,
+            TangentSpaceCache& cache);
+
         void GetTriangleData(
             size_t triangleIndex,
             const AZStd::vector<SimIndexType>& indices,
@@ -77,6 +108,8 @@ namespace NvCloth
         void AdjustTangentAndBitangent(
             const AZ::Vector3& normal, AZ::Vector3& tangent, AZ::Vector3& bitangent);
 
+        void ComputeVertexWeights(const TrianglePositions& trianglePositions, AZStd::array<float, 3>& vertexWeights);
+
         float GetVertexWeightInTriangle(AZ::u32 vertexIndexInTriangle, const TrianglePositions& trianglePositions);
     };
 } // namespace NvCloth
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/std/algorithm.h>
+
+namespace NvCloth
+{
+    //! Splits the elements [0, count) in contiguous ranges of at least minRangeSize elements
+    //! and calls function(rangeBegin, rangeEnd) for each of them using jobs, blocking until all ranges
+    //! are processed. The ranges never overlap, so each call can write to its own elements without locks.
+    //! When there is a single range or there is no job manager available the function runs in the calling thread.
+    template<typename Function>
+    void ParallelForRanges(size_t count, size_t minRangeSize, const Function& function)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        const size_t rangeCount = count / AZStd::max<size_t>(minRangeSize, 1);
+        if (rangeCount <= 1 || !AZ::JobContext::GetGlobalContext())
+        {
+            function(size_t(0), count);
+            return;
+        }
+
+        // The last range takes the remainder so every range has at least minRangeSize elements.
+        const size_t rangeSize = count / rangeCount;
+        AZ::parallel_for(size_t(0), rangeCount,
+            [&function, rangeSize, rangeCount, count](size_t rangeIndex)
+            {
+                const size_t rangeBegin = rangeIndex * rangeSize;
+                const size_t rangeEnd = (rangeIndex + 1 == rangeCount) ? count : rangeBegin + rangeSize;
+                function(rangeBegin, rangeEnd);
+            });
+    }
+} // namespace NvCloth
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/parallel/thread.h>
+
+#include <TriangleInputHelper.h>
+
+#include <System/TangentSpaceHelper.h>
+
+namespace UnitTest
+{
+    namespace TangentSpaceBenchmarkSettings
+    {
+        //! Segments per side of the cloth plane, 100 segments results in a 10k particles cloth.
+        static const int StartSegments = 25;
+        static const int EndSegments = 100;
+        static const int SegmentsMultiplier = 2;
+
+        //! Values passed to the benchmark to select whether the tangent space is calculated using jobs.
+        static const int Serial = 0;
+        static const int Parallel = 1;
+    } // namespace TangentSpaceBenchmarkSettings
+
+    //! Creates the tangent space helper and, for the parallel runs, a job manager using all the hardware threads.
+    //! The cloth plane is bent so the tangent space is different on every vertex.
+    class TangentSpaceHelperBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+        void internalSetUp(const benchmark::State& state)
+        {
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            if (state.range(1) == TangentSpaceBenchmarkSettings::Parallel)
+            {
+                AZ::JobManagerDesc jobManagerDesc;
+                const AZ::u32 numWorkerThreads = AZStd::thread::hardware_concurrency();
+                for (AZ::u32 i = 0; i < numWorkerThreads; ++i)
+                {
+                    jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+                }
+                m_jobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+                m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+                AZ::JobContext::SetGlobalContext(m_jobContext.get());
+            }
+
+            m_tangentSpaceHelper = AZStd::make_unique<NvCloth::TangentSpaceHelper>();
+
+            const AZ::u32 segments = static_cast<AZ::u32>(state.range(0));
+            m_cloth = CreatePlane(10.0f, 10.0f, segments, segments);
+            for (auto& particle : m_cloth.m_vertices)
+            {
+                particle.SetZ(AZStd::sin(particle.GetX()) * AZStd::cos(particle.GetY()));
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_cloth = {};
+            m_tangentSpaceHelper.reset();
+
+            AZ::JobContext::SetGlobalContext(nullptr);
+            m_jobContext.reset();
+            m_jobManager.reset();
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+        }
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        NvCloth::ITangentSpaceHelper* GetTangentSpaceHelper() const
+        {
+            return AZ::Interface<NvCloth::ITangentSpaceHelper>::Get();
+        }
+
+        TriangleInput m_cloth;
+
+    private:
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+        AZStd::unique_ptr<NvCloth::TangentSpaceHelper> m_tangentSpaceHelper;
+    };
+
+    //! Calculates the normals first and then the tangents and bitangents, without a cache, so every call
+    //! gathers the triangles of each vertex and allocates its per triangle buffer.
+    BENCHMARK_DEFINE_F(TangentSpaceHelperBenchmarkFixture, BM_TangentSpaceHelper_NormalsThenTangents)(benchmark::State& state)
+    {
+        AZStd::vector<AZ::Vector3> normals;
+        AZStd::vector<AZ::Vector3> tangents;
+        AZStd::vector<AZ::Vector3> bitangents;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            GetTangentSpaceHelper()->CalculateNormals(m_cloth.m_vertices, m_cloth.m_indices, normals);
+            GetTangentSpaceHelper()->CalculateTangentsAndBitagents(
+                m_cloth.m_vertices, m_cloth.m_indices, m_cloth.m_uvs, normals,
+                tangents, bitangents);
+            benchmark::DoNotOptimize(tangents.data());
+            benchmark::DoNotOptimize(bitangents.data());
+        }
+
+        state.counters["Particles"] = static_cast<double>(m_cloth.m_vertices.size());
+        state.SetItemsProcessed(state.iterations() * m_cloth.m_vertices.size());
+    }
+
+    //! Recalculates the tangent space of the cloth the same way the cloth component mesh does after every
+    //! simulation step, calculating the normals first and then the tangents and bitangents with caches
+    //! that persist between steps.
+    BENCHMARK_DEFINE_F(TangentSpaceHelperBenchmarkFixture, BM_TangentSpaceHelper_NormalsThenTangentsCached)(benchmark::State& state)
+    {
+        AZStd::vector<AZ::Vector3> normals;
+        AZStd::vector<AZ::Vector3> tangents;
+        AZStd::vector<AZ::Vector3> bitangents;
+        NvCloth::TangentSpaceCache normalsCache;
+        NvCloth::TangentSpaceCache tangentsCache;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            GetTangentSpaceHelper()->CalculateNormals(m_cloth.m_vertices, m_cloth.m_indices, normals, normalsCache);
+            GetTangentSpaceHelper()->CalculateTangentsAndBitagents(
+                m_cloth.m_vertices, m_cloth.m_indices, m_cloth.m_uvs, normals,
+                tangents, bitangents, tangentsCache);
+            benchmark::DoNotOptimize(tangents.data());
+            benchmark::DoNotOptimize(bitangents.data());
+        }
+
+        state.counters["Particles"] = static_cast<double>(m_cloth.m_vertices.size());
+        state.SetItemsProcessed(state.iterations() * m_cloth.m_vertices.size());
+    }
+
+    //! Calculates the full tangent space of the cloth in one call.
+    BENCHMARK_DEFINE_F(TangentSpaceHelperBenchmarkFixture, BM_TangentSpaceHelper_TangentSpace)(benchmark::State& state)
+    {
+        AZStd::vector<AZ::Vector3> normals;
+        AZStd::vector<AZ::Vector3> tangents;
+        AZStd::vector<AZ::Vector3> bitangents;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            GetTangentSpaceHelper()->CalculateTangentSpace(
+                m_cloth.m_vertices, m_cloth.m_indices, m_cloth.m_uvs,
+                tangents, bitangents, normals);
+            benchmark::DoNotOptimize(normals.data());
+            benchmark::DoNotOptimize(tangents.data());
+            benchmark::DoNotOptimize(bitangents.data());
+        }
+
+        state.counters["Particles"] = static_cast<double>(m_cloth.m_vertices.size());
+        state.SetItemsProcessed(state.iterations() * m_cloth.m_vertices.size());
+    }
+
+    BENCHMARK_REGISTER_F(TangentSpaceHelperBenchmarkFixture, BM_TangentSpaceHelper_NormalsThenTangents)
+        ->RangeMultiplier(TangentSpaceBenchmarkSettings::SegmentsMultiplier)
+        ->Ranges({ {TangentSpaceBenchmarkSettings::StartSegments, TangentSpaceBenchmarkSettings::EndSegments}, {TangentSpaceBenchmarkSettings::Serial, TangentSpaceBenchmarkSettings::Parallel} })
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(TangentSpaceHelperBenchmarkFixture, BM_TangentSpaceHelper_NormalsThenTangentsCached)
+        ->RangeMultiplier(TangentSpaceBenchmarkSettings::SegmentsMultiplier)
+        ->Ranges({ {TangentSpaceBenchmarkSettings::StartSegments, TangentSpaceBenchmarkSettings::EndSegments}, {TangentSpaceBenchmarkSettings::Serial, TangentSpaceBenchmarkSettings::Parallel} })
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(TangentSpaceHelperBenchmarkFixture, BM_TangentSpaceHelper_TangentSpace)
+        ->RangeMultiplier(TangentSpaceBenchmarkSettings::SegmentsMultiplier)
+        ->Ranges({ {TangentSpaceBenchmarkSettings::StartSegments, TangentSpaceBenchmarkSettings::EndSegments}, {TangentSpaceBenchmarkSettings::Serial, TangentSpaceBenchmarkSettings::Parallel} })
+        ->Unit(benchmark::kMicrosecond);
+} // namespace UnitTest
+#endif // HAVE_BENCHMARK
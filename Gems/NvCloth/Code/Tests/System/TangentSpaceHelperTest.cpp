@@ -9,9 +9,16 @@
 #include <AZTestShared/Math/MathTestHelpers.h>
 
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
 #include <AzCore/UnitTest/UnitTest.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #include <UnitTestHelper.h>
 #include <TriangleInputHelper.h>
@@ -571,4 +578,149 @@ namespace UnitTest
         EXPECT_THAT(bitangents, ::testing::Each(IsCloseTolerance(AZ::Vector3::CreateAxisY(), Tolerance)));
         EXPECT_THAT(normals, ::testing::Each(IsCloseTolerance(AZ::Vector3::CreateAxisX(), Tolerance)));
     }
+
+    TEST(NvClothSystem, TangentSpaceHelper_CalculateWithCache_MatchesResultsWithoutCache)
+    {
+        NvCloth::ITangentSpaceHelper* tangentSpaceHelper = AZ::Interface<NvCloth::ITangentSpaceHelper>::Get();
+
+        // The same cache is used while the mesh moves, as the cloth component mesh does every frame,
+        // and then for a mesh with a different number of vertices, which has to rebuild it.
+        NvCloth::TangentSpaceCache cache;
+        const AZ::u32 segmentCounts[] = { 4, 4, 6 };
+        float phase = 0.0f;
+        for (const AZ::u32 segments : segmentCounts)
+        {
+            TriangleInput mesh = CreatePlane(1.0f, 1.0f, segments, segments);
+            for (auto& vertex : mesh.m_vertices)
+            {
+                vertex.SetZ(0.25f * AZStd::sin(4.0f * vertex.GetX() + phase) * AZStd::cos(3.0f * vertex.GetY()));
+            }
+            phase += 1.0f;
+
+            AZStd::vector<AZ::Vector3> expectedTangents;
+            AZStd::vector<AZ::Vector3> expectedBitangents;
+            AZStd::vector<AZ::Vector3> expectedNormals;
+            tangentSpaceHelper->CalculateTangentSpace(
+                mesh.m_vertices, mesh.m_indices, mesh.m_uvs,
+                expectedTangents, expectedBitangents, expectedNormals);
+
+            AZStd::vector<AZ::Vector3> tangents;
+            AZStd::vector<AZ::Vector3> bitangents;
+            AZStd::vector<AZ::Vector3> normals;
+            EXPECT_TRUE(tangentSpaceHelper->CalculateTangentSpace(
+                mesh.m_vertices, mesh.m_indices, mesh.m_uvs,
+                tangents, bitangents, normals, cache));
+            EXPECT_THAT(tangents, ::testing::Pointwise(ContainerIsCloseTolerance(Tolerance), expectedTangents));
+            EXPECT_THAT(bitangents, ::testing::Pointwise(ContainerIsCloseTolerance(Tolerance), expectedBitangents));
+            EXPECT_THAT(normals, ::testing::Pointwise(ContainerIsCloseTolerance(Tolerance), expectedNormals));
+
+            // the split calculation shares the cache with the full one
+            AZStd::vector<AZ::Vector3> splitNormals;
+            AZStd::vector<AZ::Vector3> splitTangents;
+            AZStd::vector<AZ::Vector3> splitBitangents;
+            EXPECT_TRUE(tangentSpaceHelper->CalculateNormals(mesh.m_vertices, mesh.m_indices, splitNormals, cache));
+            EXPECT_TRUE(tangentSpaceHelper->CalculateTangentsAndBitagents(
+                mesh.m_vertices, mesh.m_indices, mesh.m_uvs, splitNormals,
+                splitTangents, splitBitangents, cache));
+            EXPECT_THAT(splitNormals, ::testing::Pointwise(ContainerIsCloseTolerance(Tolerance), expectedNormals));
+            EXPECT_THAT(splitTangents, ::testing::Pointwise(ContainerIsCloseTolerance(Tolerance), expectedTangents));
+            EXPECT_THAT(splitBitangents, ::testing::Pointwise(ContainerIsCloseTolerance(Tolerance), expectedBitangents));
+        }
+    }
+
+    //! Runs the tests with a job context of their own, so the tangent space helper processes large meshes in parallel ranges.
+    class NvClothTangentSpaceHelperJobsTest
+        : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            AZ::JobManagerDesc jobManagerDesc;
+            const AZ::u32 numWorkerThreads = AZStd::max(2u, AZStd::thread::hardware_concurrency());
+            for (AZ::u32 i = 0; i < numWorkerThreads; ++i)
+            {
+                jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+
+            m_prevJobContext = AZ::JobContext::GetGlobalContext();
+            AZ::JobContext::SetGlobalContext(m_jobContext.get());
+        }
+
+        void TearDown() override
+        {
+            AZ::JobContext::SetGlobalContext(m_prevJobContext);
+            m_prevJobContext = nullptr;
+
+            m_jobContext.reset();
+            m_jobManager.reset();
+        }
+
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+        AZ::JobContext* m_prevJobContext = nullptr;
+    };
+
+    TEST_F(NvClothTangentSpaceHelperJobsTest, TangentSpaceHelper_CalculateTangentSpaceLargeMesh_MatchesSmallMeshResults)
+    {
+        const float width = 1.0f;
+        const float height = 1.0f;
+        const AZ::u32 segmentsX = 5;
+        const AZ::u32 segmentsY = 5;
+
+        // Bend the plane so every vertex has a different tangent space.
+        TriangleInput smallMesh = CreatePlane(width, height, segmentsX, segmentsY);
+        for (auto& vertex : smallMesh.m_vertices)
+        {
+            vertex.SetZ(0.25f * AZStd::sin(4.0f * vertex.GetX()) * AZStd::cos(3.0f * vertex.GetY()));
+        }
+        const size_t smallMeshVertexCount = smallMesh.m_vertices.size();
+
+        // Build a mesh big enough to be processed in parallel ranges by placing copies of the small mesh next to each other.
+        const size_t copyCount = 512;
+        TriangleInput largeMesh;
+        for (size_t copyIndex = 0; copyIndex < copyCount; ++copyIndex)
+        {
+            const AZ::Vector3 offset(2.0f * width * static_cast<float>(copyIndex % 32), 2.0f * height * static_cast<float>(copyIndex / 32), 0.0f);
+            for (const auto& vertex : smallMesh.m_vertices)
+            {
+                largeMesh.m_vertices.push_back(NvCloth::SimParticleFormat::CreateFromVector3AndFloat(vertex.GetAsVector3() + offset, vertex.GetW()));
+            }
+            for (const NvCloth::SimIndexType index : smallMesh.m_indices)
+            {
+                largeMesh.m_indices.push_back(static_cast<NvCloth::SimIndexType>(index + copyIndex * smallMeshVertexCount));
+            }
+            largeMesh.m_uvs.insert(largeMesh.m_uvs.end(), smallMesh.m_uvs.begin(), smallMesh.m_uvs.end());
+        }
+
+        AZStd::vector<AZ::Vector3> smallTangents;
+        AZStd::vector<AZ::Vector3> smallBitangents;
+        AZStd::vector<AZ::Vector3> smallNormals;
+        AZ::Interface<NvCloth::ITangentSpaceHelper>::Get()->CalculateTangentSpace(
+            smallMesh.m_vertices, smallMesh.m_indices, smallMesh.m_uvs,
+            smallTangents, smallBitangents, smallNormals);
+
+        AZStd::vector<AZ::Vector3> largeTangents;
+        AZStd::vector<AZ::Vector3> largeBitangents;
+        AZStd::vector<AZ::Vector3> largeNormals;
+        bool tangentsCalculated = AZ::Interface<NvCloth::ITangentSpaceHelper>::Get()->CalculateTangentSpace(
+            largeMesh.m_vertices, largeMesh.m_indices, largeMesh.m_uvs,
+            largeTangents, largeBitangents, largeNormals);
+
+        EXPECT_TRUE(tangentsCalculated);
+        ASSERT_EQ(largeTangents.size(), largeMesh.m_vertices.size());
+        ASSERT_EQ(largeBitangents.size(), largeMesh.m_vertices.size());
+        ASSERT_EQ(largeNormals.size(), largeMesh.m_vertices.size());
+        for (size_t copyIndex = 0; copyIndex < copyCount; ++copyIndex)
+        {
+            for (size_t vertexIndex = 0; vertexIndex < smallMeshVertexCount; ++vertexIndex)
+            {
+                const size_t largeVertexIndex = copyIndex * smallMeshVertexCount + vertexIndex;
+                EXPECT_THAT(largeTangents[largeVertexIndex], IsCloseTolerance(smallTangents[vertexIndex], Tolerance));
+                EXPECT_THAT(largeBitangents[largeVertexIndex], IsCloseTolerance(smallBitangents[vertexIndex], Tolerance));
+                EXPECT_THAT(largeNormals[largeVertexIndex], IsCloseTolerance(smallNormals[vertexIndex], Tolerance));
+            }
+        }
+    }
 } // namespace UnitTest
@@ -48,4 +48,5 @@ set(FILES
     Source/Utils/AssetHelper.cpp
     Source/Utils/MeshAssetHelper.cpp
     Source/Utils/MeshAssetHelper.h
+    Source/Utils/ParallelRangeHelper.h
 )
@@ -22,6 +22,7 @@ set(FILES
     Tests/System/SolverTest.cpp
     Tests/System/NvTypesTest.cpp
     Tests/System/TangentSpaceHelperTest.cpp
+    Tests/System/TangentSpaceHelperBenchmarks.cpp
     Tests/Components/ClothComponentTest.cpp
     Tests/Components/ClothComponentMesh/ClothComponentMeshTest.cpp
     Tests/Components/ClothComponentMesh/ActorClothCollidersTest.cpp
@@ -39,6 +39,20 @@ namespace PhysX
         bool operator!=(const WindConfiguration& other) const;
     };
 
+    //! Scheduler that runs the tasks PhysX submits while simulating.
+    enum class CpuDispatcherType : AZ::u8
+    {
+        JobManager, //!< Runs every task as a new AZ::Job.
+        TaskExecutor //!< Runs the tasks on the AZ::TaskExecutor, recycling the task wrappers.
+    };
+
+    //! Point of the frame where the results of a concurrent scene simulation are fetched.
+    enum class SimulationSyncPoint : AZ::u8
+    {
+        EndOfSimulate, //!< Results are fetched before the system finishes simulating the frame.
+        NextSimulate //!< Results are fetched when the next frame is simulated, the simulation overlaps the rest of the frame.
+    };
+
     //! Contains global physics settings.
     //! Used to initialize the Physics System.
     struct PhysXSystemConfiguration : public AzPhysics::SystemConfiguration
@@ -50,6 +64,17 @@ namespace PhysX
         static PhysXSystemConfiguration CreateDefault();
 
         WindConfiguration m_windConfiguration; //!< Wind configuration for PhysX.
+        CpuDispatcherType m_cpuDispatcherType = CpuDispatcherType::JobManager; //!< Scheduler used for the PhysX simulation tasks.
+        //! Worker threads reserved for the PhysX simulation tasks when using the TaskExecutor dispatcher.
+        //! When 0 the tasks share the global task executor with the rest of the engine.
+        AZ::u32 m_dedicatedWorkerCount = 0;
+        //! Starts the simulation of all the enabled scenes before waiting for any of them, instead of one scene after the other.
+        bool m_simulateScenesConcurrently = false;
+        //! When the results of a concurrent simulation are fetched.
+        SimulationSyncPoint m_simulationSyncPoint = SimulationSyncPoint::EndOfSimulate;
+
+        bool IsTaskExecutorDispatcher() const { return m_cpuDispatcherType == CpuDispatcherType::TaskExecutor; }
+        bool IsSimulatingScenesConcurrently() const { return m_simulateScenesConcurrently; }
 
         bool operator==(const PhysXSystemConfiguration& other) const;
         bool operator!=(const PhysXSystemConfiguration& other) const;
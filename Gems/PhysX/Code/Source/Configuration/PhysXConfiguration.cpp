@@ -92,6 +92,10 @@ namespace PhysX
             serializeContext->Class<PhysX::PhysXSystemConfiguration, AzPhysics::SystemConfiguration>()
                 ->Version(2, &PhysXInternal::PhysXSystemConfigurationConverter)
                 ->Field("WindConfiguration", &PhysXSystemConfiguration::m_windConfiguration)
+                ->Field("CpuDispatcherType", &PhysXSystemConfiguration::m_cpuDispatcherType)
+                ->Field("DedicatedWorkerCount", &PhysXSystemConfiguration::m_dedicatedWorkerCount)
+                ->Field("SimulateScenesConcurrently", &PhysXSystemConfiguration::m_simulateScenesConcurrently)
+                ->Field("SimulationSyncPoint", &PhysXSystemConfiguration::m_simulationSyncPoint)
                 ;
 
             if (AZ::EditContext* editContext = serializeContext->GetEditContext())
@@ -100,6 +104,26 @@ namespace PhysX
                 editContext->Class<PhysX::PhysXSystemConfiguration>("System Configuration", "PhysX system configuration")
                     ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
                         ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+                    ->DataElement(AZ::Edit::UIHandlers::ComboBox, &PhysXSystemConfiguration::m_cpuDispatcherType,
+                        "CPU dispatcher", "Scheduler used to run the PhysX simulation tasks. Takes effect the next time the physics system is initialized.")
+                        ->EnumAttribute(CpuDispatcherType::JobManager, "Job Manager")
+                        ->EnumAttribute(CpuDispatcherType::TaskExecutor, "Task Executor")
+                        ->Attribute(AZ::Edit::Attributes::ChangeNotify, AZ::Edit::PropertyRefreshLevels::EntireTree)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &PhysXSystemConfiguration::m_dedicatedWorkerCount,
+                        "Dedicated workers", "Worker threads reserved for the PhysX simulation tasks.\n"
+                        "When 0 the tasks share the worker threads of the engine task executor.")
+                        ->Attribute(AZ::Edit::Attributes::Visibility, &PhysXSystemConfiguration::IsTaskExecutorDispatcher)
+                        ->Attribute(AZ::Edit::Attributes::Max, 64)
+                    ->DataElement(AZ::Edit::UIHandlers::CheckBox, &PhysXSystemConfiguration::m_simulateScenesConcurrently,
+                        "Simulate scenes concurrently", "Start the simulation of every enabled scene before waiting for the results of any of them.")
+                        ->Attribute(AZ::Edit::Attributes::ChangeNotify, AZ::Edit::PropertyRefreshLevels::EntireTree)
+                    ->DataElement(AZ::Edit::UIHandlers::ComboBox, &PhysXSystemConfiguration::m_simulationSyncPoint,
+                        "Simulation sync point", "When the results of the concurrent simulation are fetched.\n"
+                        "Next simulate lets the last substep run while the rest of the frame updates, "
+                        "the post simulate event of a frame is then signaled when the next frame is simulated.")
+                        ->EnumAttribute(SimulationSyncPoint::EndOfSimulate, "End of simulate")
+                        ->EnumAttribute(SimulationSyncPoint::NextSimulate, "Next simulate")
+                        ->Attribute(AZ::Edit::Attributes::Visibility, &PhysXSystemConfiguration::IsSimulatingScenesConcurrently)
                     ;
             }
         }
@@ -115,7 +139,11 @@ namespace PhysX
     bool PhysXSystemConfiguration::operator==(const PhysXSystemConfiguration& other) const
     {
         return AzPhysics::SystemConfiguration::operator==(other) &&
-            m_windConfiguration == other.m_windConfiguration
+            m_windConfiguration == other.m_windConfiguration &&
+            m_cpuDispatcherType == other.m_cpuDispatcherType &&
+            m_dedicatedWorkerCount == other.m_dedicatedWorkerCount &&
+            m_simulateScenesConcurrently == other.m_simulateScenesConcurrently &&
+            m_simulationSyncPoint == other.m_simulationSyncPoint
             ;
     }
 
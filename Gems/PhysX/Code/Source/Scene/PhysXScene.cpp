@@ -12,6 +12,7 @@
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Physics/Character.h>
+#include <AzFramework/Physics/Ragdoll.h>
 #include <AzFramework/Physics/Collision/CollisionEvents.h>
 #include <AzFramework/Physics/Configuration/RigidBodyConfiguration.h>
 #include <AzFramework/Physics/Configuration/StaticRigidBodyConfiguration.h>
@@ -41,6 +42,13 @@ namespace PhysX
 
     namespace Internal
     {
+        //! Entity the body is indexed under in the physics system.
+        //! Ragdolls are not tied to an entity of their own, so they are left out of the index.
+        AZ::EntityId GetIndexedEntityId(const AzPhysics::SimulatedBody& body)
+        {
+            return azrtti_cast<const Physics::Ragdoll*>(&body) ? AZ::EntityId() : body.GetEntityId();
+        }
+
         physx::PxScene* CreatePxScene(const AzPhysics::SceneConfiguration& config,
             SceneSimulationFilterCallback* filterCallback,
             SceneSimulationEventCallback* simEventCallback)
@@ -508,6 +516,11 @@ namespace PhysX
                     DisableSimulationOfBodyInternal(*simulatedBody.second);
                 }
                 m_simulatedBodyRemovedEvent.Signal(m_sceneHandle, simulatedBody.second->m_bodyHandle);
+                if (auto* physXSystem = GetPhysXSystem())
+                {
+                    physXSystem->UnregisterEntityBody(
+                        Internal::GetIndexedEntityId(*simulatedBody.second), m_sceneHandle, simulatedBody.second->m_bodyHandle);
+                }
                 delete simulatedBody.second;
             }
         }
@@ -697,6 +710,10 @@ namespace PhysX
             const AzPhysics::SimulatedBodyHandle newBodyHandle(newBodyCrc, index);
             newBody->m_sceneOwner = m_sceneHandle;
             newBody->m_bodyHandle = newBodyHandle;
+            if (auto* physXSystem = GetPhysXSystem())
+            {
+                physXSystem->RegisterEntityBody(Internal::GetIndexedEntityId(*newBody), m_sceneHandle, newBodyHandle);
+            }
             m_simulatedBodyAddedEvent.Signal(m_sceneHandle, newBodyHandle);
 
             // Enable simulation by default (not signaling OnSimulationBodySimulationEnabled event)
@@ -766,6 +783,10 @@ namespace PhysX
             }
 
             m_simulatedBodyRemovedEvent.Signal(m_sceneHandle, bodyHandle);
+            if (auto* physXSystem = GetPhysXSystem())
+            {
+                physXSystem->UnregisterEntityBody(Internal::GetIndexedEntityId(*m_simulatedBodies[index].second), m_sceneHandle, bodyHandle);
+            }
 
             m_deferredDeletions.push_back(m_simulatedBodies[index].second);
             m_simulatedBodies[index] = AZStd::make_pair(AZ::Crc32(), nullptr);
@@ -7,11 +7,14 @@
  */
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/algorithm.h>
 
 #include <Scene/PhysXScene.h>
 #include <System/PhysXSystem.h>
 #include <System/PhysXAllocator.h>
 #include <System/PhysXCpuDispatcher.h>
+#include <System/PhysXTaskDispatcher.h>
 #include <PhysX/Debug/PhysXDebugConfiguration.h>
 
 #include <PxPhysicsAPI.h>
@@ -97,6 +100,12 @@ namespace PhysX
             m_systemConfig = *physXConfig;
         }
 
+        // Scenes keep a pointer to the dispatcher, it can only be replaced while there are none.
+        if (AZStd::all_of(m_sceneList.begin(), m_sceneList.end(), [](const auto& scenePtr) { return scenePtr == nullptr; }))
+        {
+            CreateCpuDispatcher();
+        }
+
         AzFramework::AssetCatalogEventBus::Handler::BusConnect();
 
         m_state = State::Initialized;
@@ -138,17 +147,8 @@ namespace PhysX
             return;
         }
 
-        auto simulateScenes = [this](float timeStep)
-        {
-            for (auto& scenePtr : m_sceneList)
-            {
-                if (scenePtr != nullptr && scenePtr->IsEnabled())
-                {
-                    scenePtr->StartSimulation(timeStep);
-                    scenePtr->FinishSimulation();
-                }
-            }
-        };
+        // The previous frame has to be finished first, so its post simulate event is signaled before this frame's pre simulate event.
+        FinishPendingSimulation();
 
 #ifdef ENABLE_PHYSX_TIMESTEP_WARNING
         if (FrameTimeWarning::NumSamples < FrameTimeWarning::MaxSamples)
@@ -173,6 +173,8 @@ namespace PhysX
         deltaTime = AZ::GetClamp(deltaTime, 0.0f, m_systemConfig.m_maxTimestep);
 
         AZ_Assert(m_systemConfig.m_fixedTimestep >= 0.0f, "PhysXSystem - fixed timestep is negitive.");
+        const bool deferResults = m_systemConfig.m_simulateScenesConcurrently &&
+            m_systemConfig.m_simulationSyncPoint == SimulationSyncPoint::NextSimulate;
         float tickTime = deltaTime;
         if (m_systemConfig.m_fixedTimestep > 0.0f) //use the fixed timestep
         {
@@ -183,19 +185,101 @@ namespace PhysX
 
             while (m_accumulatedTime >= m_systemConfig.m_fixedTimestep)
             {
-                simulateScenes(m_systemConfig.m_fixedTimestep);
                 m_accumulatedTime -= m_systemConfig.m_fixedTimestep;
+                // Only the last substep can be left running, every other substep depends on the results of the previous one.
+                const bool lastSubstep = m_accumulatedTime < m_systemConfig.m_fixedTimestep;
+                SimulateScenes(m_systemConfig.m_fixedTimestep, deferResults && lastSubstep);
             }
         }
         else
         {
             m_preSimulateEvent.Signal(tickTime);
 
-            simulateScenes(tickTime);
+            SimulateScenes(tickTime, deferResults);
+        }
+
+        if (m_simulationPending)
+        {
+            m_pendingTickTime = tickTime;
+            return;
         }
         m_postSimulateEvent.Signal(tickTime);
     }
 
+    void PhysXSystem::SimulateScenes(float timeStep, bool deferResults)
+    {
+        if (m_taskDispatcher)
+        {
+            m_taskDispatcher->BeginSubstep();
+        }
+
+        if (!m_systemConfig.m_simulateScenesConcurrently)
+        {
+            for (auto& scenePtr : m_sceneList)
+            {
+                if (scenePtr != nullptr && scenePtr->IsEnabled())
+                {
+                    scenePtr->StartSimulation(timeStep);
+                    scenePtr->FinishSimulation();
+                }
+            }
+        }
+        else
+        {
+            // PxScene::simulate only kicks the simulation tasks, so all the scenes simulate at the same time
+            // until their results are fetched.
+            m_simulatingScenes.clear();
+            for (auto& scenePtr : m_sceneList)
+            {
+                if (scenePtr != nullptr && scenePtr->IsEnabled())
+                {
+                    scenePtr->StartSimulation(timeStep);
+                    m_simulatingScenes.push_back(scenePtr.get());
+                }
+            }
+
+            if (deferResults && !m_simulatingScenes.empty())
+            {
+                m_simulationPending = true;
+                return;
+            }
+
+            for (AzPhysics::Scene* scene : m_simulatingScenes)
+            {
+                scene->FinishSimulation();
+            }
+            m_simulatingScenes.clear();
+        }
+
+        if (m_taskDispatcher)
+        {
+            m_taskDispatcher->EndSubstep();
+        }
+    }
+
+    void PhysXSystem::FinishPendingSimulation()
+    {
+        if (!m_simulationPending)
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(Physics);
+
+        m_simulationPending = false;
+        for (AzPhysics::Scene* scene : m_simulatingScenes)
+        {
+            scene->FinishSimulation();
+        }
+        m_simulatingScenes.clear();
+
+        if (m_taskDispatcher)
+        {
+            m_taskDispatcher->EndSubstep();
+        }
+        m_postSimulateEvent.Signal(m_pendingTickTime);
+    }
+
     AzPhysics::SceneHandle PhysXSystem::AddScene(const AzPhysics::SceneConfiguration& config)
     {
         if (config.m_sceneName.empty())
@@ -310,6 +394,7 @@ namespace PhysX
             {
                 if (scenePtr->GetId() == AZStd::get<AzPhysics::HandleTypeIndex::Crc>(handle))
                 {
+                    FinishPendingSimulation();
                     m_sceneRemovedEvent.Signal(handle);
                     m_sceneList[index].reset();
                     m_freeSceneSlots.push(static_cast<AzPhysics::SceneIndex>(index));
@@ -328,6 +413,7 @@ namespace PhysX
 
     void PhysXSystem::RemoveAllScenes()
     {
+        FinishPendingSimulation();
         m_sceneList.clear();
 
         //clear the free slots queue
@@ -337,24 +423,61 @@ namespace PhysX
 
     AZStd::pair<AzPhysics::SceneHandle, AzPhysics::SimulatedBodyHandle> PhysXSystem::FindAttachedBodyHandleFromEntityId(AZ::EntityId entityId)
     {
-        for (auto& scenePtr : m_sceneList)
+        if (auto entityBodyItr = m_entityBodies.find(entityId);
+            entityBodyItr != m_entityBodies.end())
+        {
+            return entityBodyItr->second;
+        }
+        return AZStd::make_pair(AzPhysics::InvalidSceneHandle, AzPhysics::InvalidSimulatedBodyHandle);
+    }
+
+    void PhysXSystem::RegisterEntityBody(AZ::EntityId entityId, AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle)
+    {
+        if (!entityId.IsValid())
+        {
+            return;
+        }
+
+        if (auto [entityBodyItr, inserted] = m_entityBodies.emplace(entityId, SceneBodyHandlePair(sceneHandle, bodyHandle));
+            !inserted)
+        {
+            m_additionalEntityBodies.emplace(entityId, SceneBodyHandlePair(sceneHandle, bodyHandle));
+        }
+    }
+
+    void PhysXSystem::UnregisterEntityBody(AZ::EntityId entityId, AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle)
+    {
+        auto entityBodyItr = m_entityBodies.find(entityId);
+        if (entityBodyItr == m_entityBodies.end())
+        {
+            return;
+        }
+
+        const SceneBodyHandlePair sceneBodyHandles(sceneHandle, bodyHandle);
+        auto [additionalBegin, additionalEnd] = m_additionalEntityBodies.equal_range(entityId);
+        if (entityBodyItr->second == sceneBodyHandles)
         {
-            if (scenePtr == nullptr)
+            if (additionalBegin != additionalEnd)
             {
-                continue;
+                // Another body of the entity takes over.
+                entityBodyItr->second = additionalBegin->second;
+                m_additionalEntityBodies.erase(additionalBegin);
             }
-            if (auto* physXScene = azdynamic_cast<PhysXScene*>(scenePtr.get()))
+            else
             {
-                for (const auto& [_, body] : physXScene->GetSimulatedBodyList())
-                {
-                    if (body != nullptr && body->GetEntityId() == entityId)
-                    {
-                        return AZStd::make_pair(physXScene->GetSceneHandle(), body->m_bodyHandle);
-                    }
-                }
+                m_entityBodies.erase(entityBodyItr);
+            }
+            return;
+        }
+
+        for (auto additionalItr = additionalBegin; additionalItr != additionalEnd; ++additionalItr)
+        {
+            if (additionalItr->second == sceneBodyHandles)
+            {
+                m_additionalEntityBodies.erase(additionalItr);
+                return;
             }
         }
-        return AZStd::make_pair(AzPhysics::InvalidSceneHandle, AzPhysics::InvalidSimulatedBodyHandle);
     }
 
     const AzPhysics::SystemConfiguration* PhysXSystem::GetConfiguration() const
@@ -383,6 +506,9 @@ namespace PhysX
         if (const auto* physXConfig = azdynamic_cast<const PhysXSystemConfiguration*>(newConfig);
             m_systemConfig != (*physXConfig))
         {
+            // The pending simulation was started with the previous settings and has to finish with them.
+            FinishPendingSimulation();
+
             const bool newMaterialLibrary = m_systemConfig.m_materialLibraryAsset != physXConfig->m_materialLibraryAsset;
             m_systemConfig = (*physXConfig);
             m_configChangeEvent.Signal(physXConfig);
@@ -416,7 +542,29 @@ namespace PhysX
         // set up cooking for height fields, meshes etc.
         m_physXSdk.m_cooking = PxCreateCooking(PX_PHYSICS_VERSION, *m_physXSdk.m_foundation, cookingParams);
 
-        // Set up CPU dispatcher
+        CreateCpuDispatcher();
+
+        PxSetProfilerCallback(&m_pxAzProfilerCallback);
+    }
+
+    void PhysXSystem::CreateCpuDispatcher()
+    {
+        delete m_cpuDispatcher;
+        m_cpuDispatcher = nullptr;
+        m_taskDispatcher = nullptr;
+
+        if (m_systemConfig.m_cpuDispatcherType == CpuDispatcherType::TaskExecutor)
+        {
+            // Sharing the engine workers requires the global task executor.
+            if (m_systemConfig.m_dedicatedWorkerCount > 0 || AZ::Interface<AZ::TaskGraphActiveInterface>::Get() != nullptr)
+            {
+                m_taskDispatcher = aznew PhysXTaskDispatcher(m_systemConfig.m_dedicatedWorkerCount);
+                m_cpuDispatcher = m_taskDispatcher;
+                return;
+            }
+            AZ_Warning("PhysXSystem", false, "The task executor is not available, PhysX tasks will run on the job manager instead.");
+        }
+
 #if defined(AZ_PLATFORM_LINUX)
         // Temporary workaround for linux. At the moment using AzPhysXCpuDispatcher results in an assert at
         // PhysX mutex indicating it must be unlocked only by the thread that has already acquired lock.
@@ -424,14 +572,13 @@ namespace PhysX
 #else
         m_cpuDispatcher = PhysXCpuDispatcherCreate();
 #endif
-
-        PxSetProfilerCallback(&m_pxAzProfilerCallback);
     }
 
     void PhysXSystem::ShutdownPhysXSdk()
     {
         delete m_cpuDispatcher;
         m_cpuDispatcher = nullptr;
+        m_taskDispatcher = nullptr;
 
         m_physXSdk.m_cooking->release();
         m_physXSdk.m_cooking = nullptr;
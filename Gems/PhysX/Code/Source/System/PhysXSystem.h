@@ -10,6 +10,7 @@
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzFramework/Asset/AssetCatalogBus.h>
 #include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/Configuration/SystemConfiguration.h>
@@ -33,6 +34,8 @@ namespace physx
 
 namespace PhysX
 {
+    class PhysXTaskDispatcher;
+
     class PhysXSystem
         : public AZ::Interface<AzPhysics::SystemInterface>::Registrar
         , private AzFramework::AssetCatalogEventBus::Handler
@@ -64,6 +67,15 @@ namespace PhysX
         void UpdateDefaultSceneConfiguration(const AzPhysics::SceneConfiguration& sceneConfiguration) override;
         const AzPhysics::SceneConfiguration& GetDefaultSceneConfiguration() const override;
 
+        //! Fetches the results of a simulation that was left running by the NextSimulate sync point
+        //! and signals its post simulate event. Does nothing when no simulation is pending.
+        void FinishPendingSimulation();
+
+        //! Adds a body to the entity index used by FindAttachedBodyHandleFromEntityId. Called by the scenes when a body is added.
+        void RegisterEntityBody(AZ::EntityId entityId, AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle);
+        //! Removes a body from the entity index. Called by the scenes when a body is removed or the scene is destroyed.
+        void UnregisterEntityBody(AZ::EntityId entityId, AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle);
+
         //! Accessor to get the current PhysX configuration data.
         const PhysXSystemConfiguration& GetPhysXConfiguration() const;
 
@@ -80,6 +92,8 @@ namespace PhysX
             AZ_Assert(m_cpuDispatcher, "PhysX CPU dispatcher was not created");
             return m_cpuDispatcher;
         }
+        //! Returns the TaskExecutor CPU dispatcher, or nullptr when the PhysX tasks are run by another dispatcher.
+        const PhysXTaskDispatcher* GetTaskDispatcher() const { return m_taskDispatcher; }
         void SetCollisionLayerName(int index, const AZStd::string& layerName);
         void CreateCollisionGroup(const AZStd::string& groupName, const AzPhysics::CollisionGroup& group);
         //TEMP -- until these are fully moved over here
@@ -89,6 +103,11 @@ namespace PhysX
         //! @param cookingParams The cooking params to use when setting up PhysX cooking interface. 
         void InitializePhysXSdk(const physx::PxCookingParams& cookingParams);
         void ShutdownPhysXSdk();
+        //! Creates the CPU dispatcher selected in the system configuration, replacing the current one.
+        void CreateCpuDispatcher();
+        //! Simulates all the enabled scenes for one substep.
+        //! @param deferResults When simulating concurrently, leave the scenes running and fetch their results in FinishPendingSimulation.
+        void SimulateScenes(float timeStep, bool deferResults);
         bool LoadMaterialLibrary();
 
         // AzFramework::AssetCatalogEventBus::Handler ...
@@ -99,8 +118,18 @@ namespace PhysX
         AzPhysics::SceneList m_sceneList;
         AZStd::queue<AzPhysics::SceneIndex> m_freeSceneSlots; //when a scene is removed cache its index here to be used for the next add.
 
+        using SceneBodyHandlePair = AZStd::pair<AzPhysics::SceneHandle, AzPhysics::SimulatedBodyHandle>;
+        //! First body registered for each entity, this is what FindAttachedBodyHandleFromEntityId returns.
+        AZStd::unordered_map<AZ::EntityId, SceneBodyHandlePair> m_entityBodies;
+        //! Any other body of an entity that has several, one of them replaces the indexed body when it is removed.
+        AZStd::unordered_multimap<AZ::EntityId, SceneBodyHandlePair> m_additionalEntityBodies;
+
         float m_accumulatedTime = 0.0f;
 
+        AZStd::vector<AzPhysics::Scene*> m_simulatingScenes; //!< Scenes started by the current substep when simulating concurrently.
+        float m_pendingTickTime = 0.0f; //!< Tick time of the frame whose results are still being simulated.
+        bool m_simulationPending = false;
+
         struct PhysXSdk
         {
             physx::PxFoundation* m_foundation = nullptr;
@@ -113,6 +142,7 @@ namespace PhysX
         PxAzProfilerCallback m_pxAzProfilerCallback;
 
         physx::PxCpuDispatcher* m_cpuDispatcher = nullptr;
+        PhysXTaskDispatcher* m_taskDispatcher = nullptr; //!< Same object as m_cpuDispatcher when the TaskExecutor dispatcher is in use.
 
         enum class State : AZ::u8
         {
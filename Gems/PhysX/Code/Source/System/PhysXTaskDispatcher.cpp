@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <System/PhysXTaskDispatcher.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/time.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+
+namespace PhysX
+{
+    namespace Internal
+    {
+        static const AZ::TaskDescriptor PhysXTaskDescriptor{ "PhysX Task", "Physics" };
+    }
+
+    //! Runs PhysX tasks through a retained task graph so the graph and its task are only allocated once.
+    class PhysXTaskDispatcher::PooledTask
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(PooledTask, PhysXAllocator, 0);
+
+        explicit PooledTask(PhysXTaskDispatcher& dispatcher)
+        {
+            m_taskGraph.AddTask(Internal::PhysXTaskDescriptor, [this, &dispatcher]()
+                {
+                    Run(dispatcher);
+                });
+        }
+
+        ~PooledTask()
+        {
+            WaitUntilSettled();
+        }
+
+        void Submit(physx::PxBaseTask& pxTask, AZ::TaskExecutor& executor)
+        {
+            m_pxTask = &pxTask;
+            m_submitted = true;
+            m_taskGraph.SubmitOnExecutor(executor, &m_settledEvent);
+        }
+
+        //! The wrapper is returned to the pool from inside its own task, the worker still has to release the task graph
+        //! after that before the graph can be submitted again. This is very short so it is not worth blocking on.
+        void WaitUntilSettled()
+        {
+            if (m_submitted)
+            {
+                while (!m_settledEvent.IsSignaled())
+                {
+                    AZStd::this_thread::yield();
+                }
+                m_submitted = false;
+            }
+        }
+
+    private:
+        void Run(PhysXTaskDispatcher& dispatcher)
+        {
+            physx::PxBaseTask* pxTask = m_pxTask;
+
+            const AZStd::sys_time_t startTime = AZStd::GetTimeNowMicroSecond();
+            {
+                AZ_PROFILE_SCOPE(Physics, pxTask->getName());
+                pxTask->run();
+            }
+            dispatcher.RecordTaskTime(aznumeric_cast<AZ::u64>(AZStd::GetTimeNowMicroSecond() - startTime));
+
+            // Releasing the task may submit the tasks that depend on it.
+            pxTask->release();
+            dispatcher.ReleasePooledTask(this);
+        }
+
+        AZ::TaskGraph m_taskGraph;
+        AZ::TaskGraphEvent m_settledEvent;
+        physx::PxBaseTask* m_pxTask = nullptr;
+        bool m_submitted = false;
+    };
+
+    PhysXTaskDispatcher::PhysXTaskDispatcher(AZ::u32 dedicatedWorkerCount)
+    {
+        if (dedicatedWorkerCount > 0)
+        {
+            m_dedicatedExecutor.reset(aznew AZ::TaskExecutor(dedicatedWorkerCount));
+            m_executor = m_dedicatedExecutor.get();
+        }
+        else
+        {
+            m_executor = &AZ::TaskExecutor::Instance();
+        }
+    }
+
+    PhysXTaskDispatcher::~PhysXTaskDispatcher()
+    {
+        // Wait for the task graphs to settle before the executor running them goes away.
+        m_freePooledTasks.clear();
+        m_pooledTasks.clear();
+        m_dedicatedExecutor.reset();
+    }
+
+    void PhysXTaskDispatcher::BeginSubstep()
+    {
+        m_taskCount = 0;
+        m_totalTaskTimeUs = 0;
+        m_longestTaskTimeUs = 0;
+    }
+
+    void PhysXTaskDispatcher::EndSubstep()
+    {
+        m_lastSubstepStats.m_taskCount = m_taskCount;
+        m_lastSubstepStats.m_totalTaskTimeUs = m_totalTaskTimeUs;
+        m_lastSubstepStats.m_longestTaskTimeUs = m_longestTaskTimeUs;
+    }
+
+    const PhysXTaskDispatcherStats& PhysXTaskDispatcher::GetLastSubstepStats() const
+    {
+        return m_lastSubstepStats;
+    }
+
+    void PhysXTaskDispatcher::submitTask(physx::PxBaseTask& task)
+    {
+        AcquirePooledTask()->Submit(task, *m_executor);
+    }
+
+    physx::PxU32 PhysXTaskDispatcher::getWorkerCount() const
+    {
+        return m_executor->GetThreadCount();
+    }
+
+    PhysXTaskDispatcher::PooledTask* PhysXTaskDispatcher::AcquirePooledTask()
+    {
+        PooledTask* pooledTask = nullptr;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_poolMutex);
+            if (m_freePooledTasks.empty())
+            {
+                m_pooledTasks.emplace_back(aznew PooledTask(*this));
+                return m_pooledTasks.back().get();
+            }
+            pooledTask = m_freePooledTasks.back();
+            m_freePooledTasks.pop_back();
+        }
+
+        pooledTask->WaitUntilSettled();
+        return pooledTask;
+    }
+
+    void PhysXTaskDispatcher::ReleasePooledTask(PooledTask* pooledTask)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_poolMutex);
+        m_freePooledTasks.push_back(pooledTask);
+    }
+
+    void PhysXTaskDispatcher::RecordTaskTime(AZ::u64 taskTimeUs)
+    {
+        ++m_taskCount;
+        m_totalTaskTimeUs += taskTimeUs;
+
+        AZ::u64 longestTaskTimeUs = m_longestTaskTimeUs;
+        while (taskTimeUs > longestTaskTimeUs && !m_longestTaskTimeUs.compare_exchange_weak(longestTaskTimeUs, taskTimeUs))
+        {
+        }
+    }
+} // namespace PhysX
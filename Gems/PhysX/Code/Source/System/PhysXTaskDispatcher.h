@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <PxPhysicsAPI.h>
+#include <System/PhysXAllocator.h>
+
+namespace AZ
+{
+    class TaskExecutor;
+}
+
+namespace PhysX
+{
+    //! Timings of the PhysX tasks that ran during one simulation substep.
+    struct PhysXTaskDispatcherStats
+    {
+        AZ::u32 m_taskCount = 0; //!< Number of PhysX tasks that ran.
+        AZ::u64 m_totalTaskTimeUs = 0; //!< Sum of the run times of all the tasks, in microseconds.
+        AZ::u64 m_longestTaskTimeUs = 0; //!< Run time of the longest task, in microseconds.
+    };
+
+    //! CPU dispatcher which runs tasks submitted by PhysX on the AZ::TaskExecutor.
+    //! Every PhysX task is run through a pooled wrapper that owns a retained single task graph, so once the pool
+    //! has grown to the peak number of tasks in flight, submitting a task no longer allocates.
+    class PhysXTaskDispatcher
+        : public physx::PxCpuDispatcher
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(PhysXTaskDispatcher, PhysXAllocator, 0);
+
+        //! @param dedicatedWorkerCount Number of worker threads reserved for physics.
+        //! When 0 the tasks run on the global task executor, shared with the rest of the engine.
+        explicit PhysXTaskDispatcher(AZ::u32 dedicatedWorkerCount);
+        ~PhysXTaskDispatcher();
+
+        //! Starts collecting the stats of a new simulation substep.
+        void BeginSubstep();
+        //! Stops collecting the stats of the current substep, they are available from GetLastSubstepStats afterwards.
+        void EndSubstep();
+        const PhysXTaskDispatcherStats& GetLastSubstepStats() const;
+
+    private:
+        class PooledTask;
+
+        // PxCpuDispatcher implementation
+        void submitTask(physx::PxBaseTask& task) override;
+        physx::PxU32 getWorkerCount() const override;
+
+        PooledTask* AcquirePooledTask();
+        void ReleasePooledTask(PooledTask* pooledTask);
+        void RecordTaskTime(AZ::u64 taskTimeUs);
+
+        AZStd::unique_ptr<AZ::TaskExecutor> m_dedicatedExecutor; //!< Only created when physics has its own worker threads.
+        AZ::TaskExecutor* m_executor = nullptr;
+
+        AZStd::mutex m_poolMutex;
+        AZStd::vector<AZStd::unique_ptr<PooledTask>> m_pooledTasks; //!< Owns every wrapper created so far.
+        AZStd::vector<PooledTask*> m_freePooledTasks;
+
+        AZStd::atomic<AZ::u32> m_taskCount{ 0 };
+        AZStd::atomic<AZ::u64> m_totalTaskTimeUs{ 0 };
+        AZStd::atomic<AZ::u64> m_longestTaskTimeUs{ 0 };
+        PhysXTaskDispatcherStats m_lastSubstepStats;
+    };
+} // namespace PhysX
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+
+#include <AzTest/AzTest.h>
+#include <AzFramework/Physics/PhysicsSystem.h>
+
+#include <Benchmarks/PhysXBenchmarksUtilities.h>
+#include <Benchmarks/PhysXBenchmarksCommon.h>
+
+#include <PhysXTestCommon.h>
+#include <System/PhysXSystem.h>
+
+namespace PhysX::Benchmarks
+{
+    namespace MultiSceneConstants
+    {
+        //! Controls the simulation length of the test. 10secs at 60fps
+        static const int GameFramesToSimulate = 600;
+
+        //! The size of the test terrain of each scene
+        static const float TerrainSize = 200.0f;
+
+        //! Number of rigid bodies falling on the terrain of each scene
+        static const int RigidBodiesPerScene = 256;
+
+        static const float BoxSize = 2.0f;
+
+        //! Settings used to setup each benchmark
+        namespace BenchmarkSettings
+        {
+            //! Values passed to benchmark to select the number of independent scenes to simulate.
+            static const int StartRange = 1;
+            static const int EndRange = 16;
+            static const int RangeMultipler = 2;
+
+            //! Flags to select how the scenes are simulated
+            static const int Sequential = 0; // one scene after the other
+            static const int Concurrent = 1; // all scenes at the same time, results fetched at the end of Simulate
+            static const int ConcurrentDeferred = 2; // all scenes at the same time, results fetched on the next Simulate
+
+            //! Number of iterations for each test
+            static const int NumIterations = 3;
+        } // namespace BenchmarkSettings
+    } // namespace MultiSceneConstants
+
+    //! Multi scene performance fixture.
+    //! Creates the requested number of independent scenes, each with a terrain and a stack of rigid bodies.
+    class PhysXMultiSceneBenchmarkFixture
+        : public benchmark::Fixture
+    {
+        void internalSetUp(const benchmark::State& state)
+        {
+            auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+            m_preBenchmarkConfig = GetPhysXSystem()->GetPhysXConfiguration();
+
+            const int simulationMode = static_cast<int>(state.range(1));
+            PhysXSystemConfiguration config = m_preBenchmarkConfig;
+            config.m_simulateScenesConcurrently = simulationMode != MultiSceneConstants::BenchmarkSettings::Sequential;
+            config.m_simulationSyncPoint = simulationMode == MultiSceneConstants::BenchmarkSettings::ConcurrentDeferred
+                ? SimulationSyncPoint::NextSimulate
+                : SimulationSyncPoint::EndOfSimulate;
+            physicsSystem->UpdateConfiguration(&config);
+
+            const int numScenes = static_cast<int>(state.range(0));
+            for (int i = 0; i < numScenes; i++)
+            {
+                AzPhysics::SceneConfiguration sceneConfig = AzPhysics::SceneConfiguration::CreateDefault();
+                sceneConfig.m_sceneName = AZStd::string::format("MultiSceneBenchmark-%d", i);
+                const AzPhysics::SceneHandle sceneHandle = physicsSystem->AddScene(sceneConfig);
+
+                m_terrainEntities.emplace_back(
+                    TestUtils::CreateFlatTestTerrain(sceneHandle, MultiSceneConstants::TerrainSize, MultiSceneConstants::TerrainSize));
+
+                const float spacing = MultiSceneConstants::BoxSize + 1.0f;
+                Utils::GenerateSpawnPositionFuncPtr posGenerator = [spacing](int idx) -> const AZ::Vector3
+                {
+                    // stacks of 16 boxes on a grid, so the scenes keep colliding for the whole benchmark
+                    return AZ::Vector3(spacing * (idx % 4), spacing * ((idx / 4) % 4), spacing * (1 + idx / 16));
+                };
+                auto boxShapeConfiguration = AZStd::make_shared<Physics::BoxShapeConfiguration>(AZ::Vector3(MultiSceneConstants::BoxSize));
+                Utils::GenerateColliderFuncPtr colliderGenerator = [&boxShapeConfiguration]([[maybe_unused]] int idx)
+                {
+                    return boxShapeConfiguration;
+                };
+                Utils::CreateRigidBodies(MultiSceneConstants::RigidBodiesPerScene, physicsSystem->GetScene(sceneHandle),
+                    false, &colliderGenerator, &posGenerator);
+            }
+        }
+
+        void internalTearDown()
+        {
+            auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+            m_terrainEntities.clear();
+            physicsSystem->RemoveAllScenes();
+            physicsSystem->UpdateConfiguration(&m_preBenchmarkConfig);
+
+            TestUtils::ResetPhysXSystem();
+        }
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+    protected:
+        PhysXSystemConfiguration m_preBenchmarkConfig;
+        AZStd::vector<EntityPtr> m_terrainEntities;
+    };
+
+    //! BM_MultiScene_Simulate - This test will create the requested number of independent scenes and simulate
+    //! them through the physics system for ~600 game frames at 60fps, one scene after the other or concurrently.
+    //! The frame time is the time the calling thread spends in Simulate.
+    BENCHMARK_DEFINE_F(PhysXMultiSceneBenchmarkFixture, BM_MultiScene_Simulate)(benchmark::State& state)
+    {
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+
+        Types::TimeList tickTimes;
+        for (auto _ : state)
+        {
+            for (AZ::u32 i = 0; i < MultiSceneConstants::GameFramesToSimulate; i++)
+            {
+                auto start = AZStd::chrono::system_clock::now();
+                physicsSystem->Simulate(DefaultTimeStep);
+
+                //time each physics tick and store it to analyze
+                auto tickElapsedMilliseconds = Types::double_milliseconds(AZStd::chrono::system_clock::now() - start);
+                tickTimes.emplace_back(tickElapsedMilliseconds.count());
+            }
+            GetPhysXSystem()->FinishPendingSimulation();
+        }
+
+        //sort the frame times and get the P50, P90, P99 percentiles
+        Utils::ReportPercentiles(state, tickTimes);
+        Utils::ReportStandardDeviationAndMeanCounters(state, tickTimes);
+    }
+
+    BENCHMARK_REGISTER_F(PhysXMultiSceneBenchmarkFixture, BM_MultiScene_Simulate)
+        ->RangeMultiplier(MultiSceneConstants::BenchmarkSettings::RangeMultipler)
+        ->Ranges({ {MultiSceneConstants::BenchmarkSettings::StartRange, MultiSceneConstants::BenchmarkSettings::EndRange}, {MultiSceneConstants::BenchmarkSettings::Sequential, MultiSceneConstants::BenchmarkSettings::Sequential} })
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(MultiSceneConstants::BenchmarkSettings::NumIterations)
+        ;
+
+    BENCHMARK_REGISTER_F(PhysXMultiSceneBenchmarkFixture, BM_MultiScene_Simulate)
+        ->RangeMultiplier(MultiSceneConstants::BenchmarkSettings::RangeMultipler)
+        ->Ranges({ {MultiSceneConstants::BenchmarkSettings::StartRange, MultiSceneConstants::BenchmarkSettings::EndRange}, {MultiSceneConstants::BenchmarkSettings::Concurrent, MultiSceneConstants::BenchmarkSettings::Concurrent} })
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(MultiSceneConstants::BenchmarkSettings::NumIterations)
+        ;
+
+    BENCHMARK_REGISTER_F(PhysXMultiSceneBenchmarkFixture, BM_MultiScene_Simulate)
+        ->RangeMultiplier(MultiSceneConstants::BenchmarkSettings::RangeMultipler)
+        ->Ranges({ {MultiSceneConstants::BenchmarkSettings::StartRange, MultiSceneConstants::BenchmarkSettings::EndRange}, {MultiSceneConstants::BenchmarkSettings::ConcurrentDeferred, MultiSceneConstants::BenchmarkSettings::ConcurrentDeferred} })
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(MultiSceneConstants::BenchmarkSettings::NumIterations)
+        ;
+} // namespace PhysX::Benchmarks
+#endif //HAVE_BENCHMARK
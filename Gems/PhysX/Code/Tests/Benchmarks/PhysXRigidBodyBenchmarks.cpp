@@ -12,6 +12,8 @@
 #include <AzTest/AzTest.h>
 #include <AzFramework/Physics/Collision/CollisionEvents.h>
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
+#include <AzFramework/Physics/Configuration/RigidBodyConfiguration.h>
+#include <AzFramework/Physics/Configuration/StaticRigidBodyConfiguration.h>
 
 #include <Benchmarks/PhysXBenchmarksUtilities.h>
 #include <Benchmarks/PhysXBenchmarksCommon.h>
@@ -71,6 +73,11 @@ namespace PhysX::Benchmarks
 
             //! Number of iterations for each test
             static const int NumIterations = 3;
+
+            //! Values passed to the activation benchmark to select the number of bodies to add, these are in the range of a large level.
+            static const int ActivationStartRange = 1024;
+            static const int ActivationEndRange = 65536;
+            static const int ActivationRangeMultipler = 4;
         } // namespace BenchmarkRange
     } // namespace RigidBodyConstants
 
@@ -501,6 +508,63 @@ namespace PhysX::Benchmarks
         state.counters["Collisions-End"] = static_cast<double>(m_collisionEndCount);
     }
 
+    //! BM_RigidBody_ActivationLookup - This test will add the requested number of static and dynamic rigid bodies, each with its own
+    //! entity, and look up the body of each entity right after adding it, as the physics components do when entities activate.
+    //! The frame time is the time taken to add and find all the bodies.
+    BENCHMARK_DEFINE_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_ActivationLookup)(benchmark::State& state)
+    {
+        const int numRigidBodies = static_cast<int>(state.range(0));
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+
+        auto boxShapeConfiguration = AZStd::make_shared<Physics::BoxShapeConfiguration>(AZ::Vector3(RigidBodyConstants::RigidBodys::BoxSize));
+        auto colliderConfiguration = AZStd::make_shared<Physics::ColliderConfiguration>();
+
+        Types::TimeList activationTimes;
+        for (auto _ : state)
+        {
+            AzPhysics::SimulatedBodyHandleList bodies;
+            bodies.reserve(numRigidBodies);
+
+            auto start = AZStd::chrono::system_clock::now();
+            for (int i = 0; i < numRigidBodies; i++)
+            {
+                const AZ::EntityId entityId(RigidBodyConstants::RigidBodys::RigidBodyEntityIdStart + i);
+                const AZ::Vector3 position(static_cast<float>(i % 256) * RigidBodyConstants::RigidBodys::BoxSize,
+                    static_cast<float>(i / 256) * RigidBodyConstants::RigidBodys::BoxSize, RigidBodyConstants::RigidBodys::BoxSize);
+
+                //half of the bodies are static, like the level geometry
+                if (i % 2 == 0)
+                {
+                    AzPhysics::StaticRigidBodyConfiguration staticConfig;
+                    staticConfig.m_entityId = entityId;
+                    staticConfig.m_position = position;
+                    staticConfig.m_colliderAndShapeData = AzPhysics::ShapeColliderPair(colliderConfiguration, boxShapeConfiguration);
+                    bodies.push_back(m_defaultScene->AddSimulatedBody(&staticConfig));
+                }
+                else
+                {
+                    AzPhysics::RigidBodyConfiguration rigidBodyConfig;
+                    rigidBodyConfig.m_entityId = entityId;
+                    rigidBodyConfig.m_position = position;
+                    rigidBodyConfig.m_colliderAndShapeData = AzPhysics::ShapeColliderPair(colliderConfiguration, boxShapeConfiguration);
+                    bodies.push_back(m_defaultScene->AddSimulatedBody(&rigidBodyConfig));
+                }
+
+                auto [sceneHandle, bodyHandle] = physicsSystem->FindAttachedBodyHandleFromEntityId(entityId);
+                benchmark::DoNotOptimize(bodyHandle);
+            }
+            activationTimes.emplace_back(Types::double_milliseconds(AZStd::chrono::system_clock::now() - start).count());
+
+            //object clean up
+            state.PauseTiming();
+            m_defaultScene->RemoveSimulatedBodies(bodies);
+            state.ResumeTiming();
+        }
+
+        Utils::ReportPercentiles(state, activationTimes);
+        Utils::ReportStandardDeviationAndMeanCounters(state, activationTimes);
+    }
+
     BENCHMARK_REGISTER_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_AtRest)
         ->RangeMultiplier(RigidBodyConstants::BenchmarkSettings::RangeMultipler)
         ->Range(RigidBodyConstants::BenchmarkSettings::StartRange, RigidBodyConstants::BenchmarkSettings::EndRange)
@@ -535,5 +599,12 @@ namespace PhysX::Benchmarks
         ->Unit(benchmark::kMillisecond)
         ->Iterations(RigidBodyConstants::BenchmarkSettings::NumIterations)
         ;
+
+    BENCHMARK_REGISTER_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_ActivationLookup)
+        ->RangeMultiplier(RigidBodyConstants::BenchmarkSettings::ActivationRangeMultipler)
+        ->Range(RigidBodyConstants::BenchmarkSettings::ActivationStartRange, RigidBodyConstants::BenchmarkSettings::ActivationEndRange)
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(RigidBodyConstants::BenchmarkSettings::NumIterations)
+        ;
 } // namespace PhysX::Benchmarks
 #endif
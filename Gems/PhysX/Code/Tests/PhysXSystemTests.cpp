@@ -11,8 +11,12 @@
 #include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
+#include <AzFramework/Physics/RigidBody.h>
+#include <AzFramework/Physics/Configuration/StaticRigidBodyConfiguration.h>
 
 #include <PhysX/Configuration/PhysXConfiguration.h>
+#include <System/PhysXSystem.h>
+#include <System/PhysXTaskDispatcher.h>
 
 namespace PhysX
 {
@@ -317,4 +321,130 @@ namespace PhysX
         physicsSystem->RemoveScenes(sceneHandles);
         EXPECT_EQ(removedCount, m_sceneConfigs.size());
     }
+
+    TEST_F(PhysXSystemFixture, TaskExecutorDispatcher_WithDedicatedWorkers_SimulatesScene)
+    {
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        const PhysXSystemConfiguration preTestConfig = GetPhysXSystem()->GetPhysXConfiguration();
+
+        PhysXSystemConfiguration taskExecutorConfig = preTestConfig;
+        taskExecutorConfig.m_cpuDispatcherType = CpuDispatcherType::TaskExecutor;
+        taskExecutorConfig.m_dedicatedWorkerCount = 2;
+        physicsSystem->RemoveAllScenes();
+        physicsSystem->Shutdown();
+        physicsSystem->Initialize(&taskExecutorConfig);
+
+        const PhysXTaskDispatcher* taskDispatcher = GetPhysXSystem()->GetTaskDispatcher();
+        ASSERT_NE(taskDispatcher, nullptr);
+
+        AzPhysics::SceneHandle sceneHandle = physicsSystem->AddScene(m_sceneConfigs[0]);
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        AzPhysics::SimulatedBodyHandle sphereHandle = TestUtils::AddSphereToScene(sceneHandle, AZ::Vector3(0.0f, 0.0f, 10.0f));
+        auto* sphere = azdynamic_cast<AzPhysics::RigidBody*>(sceneInterface->GetSimulatedBodyFromHandle(sceneHandle, sphereHandle));
+        ASSERT_NE(sphere, nullptr);
+
+        // run enough frames for the task wrappers to be recycled several times
+        for (int i = 0; i < 30; i++)
+        {
+            physicsSystem->Simulate(taskExecutorConfig.m_fixedTimestep);
+        }
+
+        EXPECT_LT(sphere->GetPosition().GetZ(), 10.0f);
+        EXPECT_GT(taskDispatcher->GetLastSubstepStats().m_taskCount, 0u);
+        EXPECT_LE(taskDispatcher->GetLastSubstepStats().m_longestTaskTimeUs, taskDispatcher->GetLastSubstepStats().m_totalTaskTimeUs);
+
+        // restore the dispatcher used by the other tests
+        physicsSystem->RemoveAllScenes();
+        physicsSystem->Shutdown();
+        physicsSystem->Initialize(&preTestConfig);
+        EXPECT_EQ(GetPhysXSystem()->GetTaskDispatcher(), nullptr);
+    }
+
+    TEST_F(PhysXSystemFixture, ConcurrentSimulation_NextSimulateSyncPoint_SignalsPostSimulateBeforeNextPreSimulate)
+    {
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        const PhysXSystemConfiguration preTestConfig = GetPhysXSystem()->GetPhysXConfiguration();
+
+        PhysXSystemConfiguration concurrentConfig = preTestConfig;
+        concurrentConfig.m_simulateScenesConcurrently = true;
+        concurrentConfig.m_simulationSyncPoint = SimulationSyncPoint::NextSimulate;
+        physicsSystem->UpdateConfiguration(&concurrentConfig);
+
+        AzPhysics::SceneHandleList sceneHandles = physicsSystem->AddScenes(m_sceneConfigs);
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        AZStd::vector<AzPhysics::RigidBody*> spheres;
+        for (const AzPhysics::SceneHandle& sceneHandle : sceneHandles)
+        {
+            AzPhysics::SimulatedBodyHandle sphereHandle = TestUtils::AddSphereToScene(sceneHandle, AZ::Vector3(0.0f, 0.0f, 10.0f));
+            spheres.push_back(azdynamic_cast<AzPhysics::RigidBody*>(sceneInterface->GetSimulatedBodyFromHandle(sceneHandle, sphereHandle)));
+        }
+
+        AZStd::string events;
+        AzPhysics::SystemEvents::OnPresimulateEvent::Handler preSimEvent(
+            [&events]([[maybe_unused]] float deltaTime)
+            {
+                events += "pre ";
+            });
+        AzPhysics::SystemEvents::OnPostsimulateEvent::Handler postSimEvent(
+            [&events]([[maybe_unused]] float deltaTime)
+            {
+                events += "post ";
+            });
+        physicsSystem->RegisterPreSimulateEvent(preSimEvent);
+        physicsSystem->RegisterPostSimulateEvent(postSimEvent);
+
+        // the results of a frame are only fetched when the next frame is simulated
+        const float frameDeltaTime = concurrentConfig.m_fixedTimestep;
+        physicsSystem->Simulate(frameDeltaTime);
+        EXPECT_STREQ(events.c_str(), "pre ");
+        physicsSystem->Simulate(frameDeltaTime);
+        EXPECT_STREQ(events.c_str(), "pre post pre ");
+        GetPhysXSystem()->FinishPendingSimulation();
+        EXPECT_STREQ(events.c_str(), "pre post pre post ");
+        GetPhysXSystem()->FinishPendingSimulation();
+        EXPECT_STREQ(events.c_str(), "pre post pre post ");
+
+        // every scene was simulated
+        for (AzPhysics::RigidBody* sphere : spheres)
+        {
+            EXPECT_LT(sphere->GetPosition().GetZ(), 10.0f);
+        }
+
+        physicsSystem->UpdateConfiguration(&preTestConfig);
+    }
+
+    TEST_F(PhysXSystemFixture, FindAttachedBodyHandleFromEntityId_FollowsAddedAndRemovedBodies)
+    {
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        AzPhysics::SceneHandleList sceneHandles = physicsSystem->AddScenes({ m_sceneConfigs[0], m_sceneConfigs[1] });
+
+        const AZ::EntityId entityId(1234);
+        AzPhysics::StaticRigidBodyConfiguration config;
+        config.m_entityId = entityId;
+
+        auto [noSceneHandle, noBodyHandle] = physicsSystem->FindAttachedBodyHandleFromEntityId(entityId);
+        EXPECT_EQ(noSceneHandle, AzPhysics::InvalidSceneHandle);
+        EXPECT_EQ(noBodyHandle, AzPhysics::InvalidSimulatedBodyHandle);
+
+        // an entity with bodies in two scenes is found until its last body is removed
+        AzPhysics::SimulatedBodyHandle firstBodyHandle = sceneInterface->AddSimulatedBody(sceneHandles[0], &config);
+        AzPhysics::SimulatedBodyHandle secondBodyHandle = sceneInterface->AddSimulatedBody(sceneHandles[1], &config);
+        const AzPhysics::SimulatedBodyHandle expectedSecondBodyHandle = secondBodyHandle;
+
+        auto [firstSceneHandle, firstFoundHandle] = physicsSystem->FindAttachedBodyHandleFromEntityId(entityId);
+        EXPECT_EQ(firstSceneHandle, sceneHandles[0]);
+        EXPECT_EQ(firstFoundHandle, firstBodyHandle);
+
+        sceneInterface->RemoveSimulatedBody(sceneHandles[0], firstBodyHandle);
+        auto [secondSceneHandle, secondFoundHandle] = physicsSystem->FindAttachedBodyHandleFromEntityId(entityId);
+        EXPECT_EQ(secondSceneHandle, sceneHandles[1]);
+        EXPECT_EQ(secondFoundHandle, expectedSecondBodyHandle);
+
+        // removing the scene removes its bodies from the index
+        physicsSystem->RemoveScene(sceneHandles[1]);
+        auto [removedSceneHandle, removedBodyHandle] = physicsSystem->FindAttachedBodyHandleFromEntityId(entityId);
+        EXPECT_EQ(removedSceneHandle, AzPhysics::InvalidSceneHandle);
+        EXPECT_EQ(removedBodyHandle, AzPhysics::InvalidSimulatedBodyHandle);
+    }
 }
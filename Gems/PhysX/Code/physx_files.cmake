@@ -136,4 +136,6 @@ set(FILES
     Source/System/PhysXSdkCallbacks.cpp
     Source/System/PhysXSystem.h
     Source/System/PhysXSystem.cpp
+    Source/System/PhysXTaskDispatcher.cpp
+    Source/System/PhysXTaskDispatcher.h
 )
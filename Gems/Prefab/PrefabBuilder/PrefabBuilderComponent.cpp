@@ -8,6 +8,11 @@
 
 #include "PrefabBuilderComponent.h"
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/parallel/atomic.h>
+
 namespace AZ::Prefab
 {
     void PrefabBuilderComponent::Reflect(AZ::ReflectContext* context)
@@ -177,15 +182,50 @@ namespace AZ::Prefab
     {
         outputProducts.reserve(store.size());
 
-        AZStd::vector<uint8_t> data;
-        for (auto& object : store)
+        // Products don't depend on each other, so serialize them concurrently and write the results in order afterwards.
+        AZStd::vector<AZStd::vector<uint8_t>> serializedProducts(store.size());
+        AZStd::atomic_bool serializationFailed{ false };
+        auto serializeProduct = [&store, &serializedProducts, &serializationFailed](size_t index)
         {
-            AZ_TracePrintf("Prefab Builder", "    Serializing Prefab product '%s'.\n", object.GetId().c_str());
-            if (!object.Serialize(data))
+            AZ_TracePrintf("Prefab Builder", "    Serializing Prefab product '%s'.\n", store[index].GetId().c_str());
+            if (!store[index].Serialize(serializedProducts[index]))
             {
-                AZ_Error("Prefab Builder", false, "Failed to serialize object '%s'.", object.GetId().c_str());
-                return false;
+                AZ_Error("Prefab Builder", false, "Failed to serialize object '%s'.", store[index].GetId().c_str());
+                serializationFailed = true;
+            }
+        };
+
+        if (store.size() > 1 && AZ::JobContext::GetGlobalContext())
+        {
+            AZ::JobCompletion completion;
+            for (size_t index = 0; index < store.size(); ++index)
+            {
+                AZ::Job* job = AZ::CreateJobFunction([&serializeProduct, index]()
+                    {
+                        serializeProduct(index);
+                    }, true);
+                job->SetDependent(&completion);
+                job->Start();
+            }
+            completion.StartAndWaitForCompletion();
+        }
+        else
+        {
+            for (size_t index = 0; index < store.size(); ++index)
+            {
+                serializeProduct(index);
             }
+        }
+
+        if (serializationFailed)
+        {
+            return false;
+        }
+
+        for (size_t index = 0; index < store.size(); ++index)
+        {
+            const auto& object = store[index];
+            const AZStd::vector<uint8_t>& data = serializedProducts[index];
 
             AZ::IO::Path productPath = tempDirPath;
             productPath /= object.GetId();
@@ -225,8 +265,6 @@ namespace AZ::Prefab
 
                 outputProducts.push_back(AZStd::move(product));
             }
-
-            data.clear();
         }
         return true;
     }
@@ -59,6 +59,7 @@ namespace ScriptCanvasBuilder
         PrefabIntegration,
         CorrectGraphVariableVersion,
         ReflectEntityIdNodes,
+        NativeTranslationProducts,
         // add new entries above
         Current,
     };
@@ -140,6 +141,8 @@ namespace ScriptCanvasBuilder
 
     ScriptCanvasEditor::Graph* PrepareSourceGraph(AZ::Entity* const buildEntity);
 
+    void SaveNativeTranslation(ProcessTranslationJobInput& input, const ScriptCanvas::Translation::Result& translationResult);
+
     AZ::Outcome<void, AZStd::string> SaveSubgraphInterface(ProcessTranslationJobInput& input, ScriptCanvas::SubgraphInterfaceData& subgraphInterface);
 
     AZ::Outcome<void, AZStd::string> SaveRuntimeAsset(ProcessTranslationJobInput& input, ScriptCanvas::RuntimeData& runtimeData);
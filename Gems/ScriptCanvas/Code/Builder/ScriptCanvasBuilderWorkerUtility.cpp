@@ -27,6 +27,7 @@
 #include <ScriptCanvas/Core/Node.h>
 #include <ScriptCanvas/Grammar/AbstractCodeModel.h>
 #include <ScriptCanvas/Results/ErrorText.h>
+#include <ScriptCanvas/Translation/TranslationUtilities.h>
 #include <ScriptCanvas/Utils/BehaviorContextUtils.h>
 #include <Source/Components/SceneComponent.h>
 
@@ -504,7 +505,18 @@ namespace ScriptCanvasBuilder
         request.rawSaveDebugOutput = ScriptCanvas::Grammar::g_saveRawTranslationOuputToFile;
         request.printModelToConsole = ScriptCanvas::Grammar::g_printAbstractCodeModel;
 
-        ScriptCanvas::Translation::Result translationResult = TranslateToLua(request);
+        // graphs selected for native execution are also translated to C++, the Lua translation remains the fallback
+        const bool isNativeRequested = sourceGraph->GetExecutionMode() == ScriptCanvas::ExecutionMode::Native;
+        if (isNativeRequested)
+        {
+            request.translationTargetFlags = ScriptCanvas::Translation::TargetFlags::Lua
+                | ScriptCanvas::Translation::TargetFlags::Cpp
+                | ScriptCanvas::Translation::TargetFlags::Hpp;
+        }
+
+        ScriptCanvas::Translation::Result translationResult = isNativeRequested
+            ? ScriptCanvas::Translation::ParseAndTranslateGraph(request)
+            : TranslateToLua(request);
         auto outcome = translationResult.IsSuccess(ScriptCanvas::Translation::TargetFlags::Lua);
         if (!outcome.IsSuccess())
         {
@@ -566,9 +578,70 @@ namespace ScriptCanvasBuilder
         input.runtimeDataOut.m_debugMap = AZStd::move(translation.m_debugMap);
         input.interfaceOut = AZStd::move(translation.m_subgraphInterface);
 
+        if (isNativeRequested)
+        {
+            SaveNativeTranslation(input, translationResult);
+        }
+
         return AZ::Success();
     }
 
+    void SaveNativeTranslation(ProcessTranslationJobInput& input, const ScriptCanvas::Translation::Result& translationResult)
+    {
+        using namespace ScriptCanvas::Translation;
+
+        auto dotH = translationResult.m_translations.find(TargetFlags::Hpp);
+        auto dotCPP = translationResult.m_translations.find(TargetFlags::Cpp);
+        if (dotH == translationResult.m_translations.end() || dotCPP == translationResult.m_translations.end())
+        {
+            AZ_Warning(s_scriptCanvasBuilder, false, "%s will execute in Lua, it could not be translated to C++: %s"
+                , input.fileNameOnly.c_str(), translationResult.ErrorsToString().c_str());
+            return;
+        }
+
+        // The translations are products of the job, so the build compiles them from the cache, see ScriptCanvasNative.cmake.
+        // Nothing loads them as assets, the type only tells them apart from the other products.
+        static const AZ::Uuid s_nativeTranslationType("{5B0E0D4E-6C2A-4E3B-9A57-8F6C2D1E7B93}");
+
+        const ScriptCanvas::Grammar::Source& source = translationResult.m_model->GetSource();
+        const AZStd::pair<const char*, const TargetResult*> files[] =
+        {
+            { "h", &dotH->second },
+            { "cpp", &dotCPP->second },
+        };
+
+        AZStd::vector<AssetBuilderSDK::JobProduct> products;
+
+        for (const auto& extensionAndTranslation : files)
+        {
+            AZStd::string productPath;
+            AzFramework::StringFunc::Path::Join(input.request->m_tempDirPath.c_str(), GetNativeFileName(source, extensionAndTranslation.first).c_str(), productPath, true, true);
+
+            const AZStd::string& text = extensionAndTranslation.second->m_text;
+            AZ::IO::FileIOStream outFileStream(productPath.c_str(), AZ::IO::OpenMode::ModeWrite);
+            if (!outFileStream.IsOpen() || outFileStream.Write(text.size(), text.data()) != text.size())
+            {
+                AZ_Warning(s_scriptCanvasBuilder, false, "%s will execute in Lua, its C++ translation could not be saved to %s"
+                    , input.fileNameOnly.c_str(), productPath.c_str());
+                return;
+            }
+
+            AssetBuilderSDK::JobProduct jobProduct;
+            jobProduct.m_productFileName = productPath;
+            jobProduct.m_productAssetType = s_nativeTranslationType;
+            jobProduct.m_productSubID = AZ::Crc32(extensionAndTranslation.first);
+            jobProduct.m_dependenciesHandled = true;
+            products.push_back(AZStd::move(jobProduct));
+        }
+
+        input.response->m_outputProducts.insert(input.response->m_outputProducts.end(), products.begin(), products.end());
+
+        // the runtime only selects native execution once the project has been rebuilt with the generated files,
+        // until then the graph is not registered and it keeps executing in Lua
+        input.runtimeDataOut.m_input.m_executionMode = ScriptCanvas::ExecutionMode::Native;
+        input.runtimeDataOut.m_input.m_nativeName = source.m_name;
+    }
+
     AZ::Outcome<void, AZStd::string> SaveSubgraphInterface(ProcessTranslationJobInput& input, ScriptCanvas::SubgraphInterfaceData& subgraphInterface)
     {
         AZ::Data::Asset<ScriptCanvas::SubgraphInterfaceAsset> runtimeAsset;
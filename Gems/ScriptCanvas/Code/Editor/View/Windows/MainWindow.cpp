@@ -2159,6 +2159,7 @@ namespace ScriptCanvasEditor
         connect(ui->action_ClearSelection, &QAction::triggered, this, &MainWindow::OnClearSelection);
         connect(ui->action_EnableSelection, &QAction::triggered, this, &MainWindow::OnEnableSelection);
         connect(ui->action_DisableSelection, &QAction::triggered, this, &MainWindow::OnDisableSelection);
+        connect(ui->action_ExecuteNatively, &QAction::triggered, this, &MainWindow::OnExecuteNatively);
         connect(ui->action_AlignTop, &QAction::triggered, this, &MainWindow::OnAlignTop);
         connect(ui->action_AlignBottom, &QAction::triggered, this, &MainWindow::OnAlignBottom);
         connect(ui->action_AlignLeft, &QAction::triggered, this, &MainWindow::OnAlignLeft);
@@ -2211,6 +2212,7 @@ namespace ScriptCanvasEditor
     void MainWindow::OnEditMenuShow()
     {
         RefreshGraphPreferencesAction();
+        RefreshExecuteNativelyAction();
 
         ui->action_Screenshot->setEnabled(GetActiveGraphCanvasGraphId().IsValid());
         ui->menuSelect->setEnabled(GetActiveGraphCanvasGraphId().IsValid());
@@ -2234,6 +2236,15 @@ namespace ScriptCanvasEditor
         ui->action_GraphPreferences->setEnabled(GetActiveGraphCanvasGraphId().IsValid());
     }
 
+    void MainWindow::RefreshExecuteNativelyAction()
+    {
+        ScriptCanvas::Graph* graph = nullptr;
+        GraphRequestBus::EventResult(graph, GetActiveScriptCanvasId(), &GraphRequests::GetGraph);
+
+        ui->action_ExecuteNatively->setEnabled(graph != nullptr);
+        ui->action_ExecuteNatively->setChecked(graph && graph->GetExecutionMode() == ScriptCanvas::ExecutionMode::Native);
+    }
+
     void MainWindow::OnEditCut()
     {
         AZ::EntityId graphCanvasGraphId = GetActiveGraphCanvasGraphId();
@@ -2340,6 +2351,20 @@ namespace ScriptCanvasEditor
         GraphCanvas::SceneRequestBus::Event(graphCanvasGraphId, &GraphCanvas::SceneRequests::DisableSelection);
     }
 
+    void MainWindow::OnExecuteNatively(bool checked)
+    {
+        ScriptCanvas::ScriptCanvasId scriptCanvasId = GetActiveScriptCanvasId();
+
+        ScriptCanvas::Graph* graph = nullptr;
+        GraphRequestBus::EventResult(graph, scriptCanvasId, &GraphRequests::GetGraph);
+
+        if (graph)
+        {
+            graph->SetExecutionMode(checked ? ScriptCanvas::ExecutionMode::Native : ScriptCanvas::ExecutionMode::Interpreted);
+            PostUndoPoint(scriptCanvasId);
+        }
+    }
+
     void MainWindow::OnAlignTop()
     {
         GraphCanvas::AlignConfig alignConfig;
@@ -3541,6 +3566,7 @@ namespace ScriptCanvasEditor
         ui->action_Close->setEnabled(enabled);
 
         RefreshGraphPreferencesAction();
+        RefreshExecuteNativelyAction();
 
         UpdateAssignToSelectionState();
         UpdateUndoRedoState();
@@ -338,6 +338,7 @@ namespace ScriptCanvasEditor
         void OnEditMenuShow();
         void RefreshPasteAction();
         void RefreshGraphPreferencesAction();
+        void RefreshExecuteNativelyAction();
         void OnEditCut();
         void OnEditCopy();
         void OnEditPaste();
@@ -354,6 +355,7 @@ namespace ScriptCanvasEditor
         void OnClearSelection();
         void OnEnableSelection();
         void OnDisableSelection();
+        void OnExecuteNatively(bool checked);
         void OnAlignTop();
         void OnAlignBottom();
         void OnAlignLeft();
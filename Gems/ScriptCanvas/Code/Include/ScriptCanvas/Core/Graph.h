@@ -195,6 +195,10 @@ namespace ScriptCanvas
 
         const AZStd::unordered_map<AZ::EntityId, Node* >& GetNodeMapping() const { return m_nodeMapping; }
 
+        //! Native graphs are also translated to C++ when built, and execute natively once the module they are compiled into registers them.
+        ExecutionMode GetExecutionMode() const { return m_executionMode; }
+        void SetExecutionMode(ExecutionMode executionMode) { m_executionMode = executionMode; }
+
     protected:
         void VersioningRemoveSlot(ScriptCanvas::Node& scriptCanvasNode, const SlotId& slotId);
 
@@ -14,6 +14,8 @@
 #include "Interpreted/ExecutionStateInterpretedPure.h"
 #include "Interpreted/ExecutionStateInterpretedPerActivation.h"
 #include "Interpreted/ExecutionStateInterpretedSingleton.h"
+#include "Native/ExecutionStateNative.h"
+#include "NativeHostDefinitions.h"
 
 #include "ExecutionState.h"
 
@@ -31,6 +33,20 @@ namespace ScriptCanvas
 
     ExecutionStatePtr ExecutionState::Create(const ExecutionStateConfig& config)
     {
+        const AZStd::string& nativeName = config.runtimeData.m_input.m_nativeName;
+
+        // native execution is opt-in per graph, and only taken once the module the graph is compiled into registers it
+        if (config.runtimeData.m_input.m_executionMode == ExecutionMode::Native && !nativeName.empty())
+        {
+            if (IsNativeGraphRegistered(nativeName))
+            {
+                return AZStd::make_shared<ExecutionStateNative>(config);
+            }
+
+            AZ_Warning("ScriptCanvas", false, "Graph %s was translated to C++, but the module that contains it has not registered it. "
+                "Falling back to interpreted execution.", nativeName.c_str());
+        }
+
         Grammar::ExecutionStateSelection selection = config.runtimeData.m_input.m_executionSelection;
 
         switch (selection)
@@ -108,6 +124,7 @@ namespace ScriptCanvas
         ExecutionStateInterpretedPure::Reflect(reflectContext);
         ExecutionStateInterpretedPureOnGraphStart::Reflect(reflectContext);
         ExecutionStateInterpretedSingleton::Reflect(reflectContext);
+        ExecutionStateNative::Reflect(reflectContext);
     }
 
     ExecutionStatePtr ExecutionState::SharedFromThis()
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <ScriptCanvas/Core/EBusHandler.h>
+
+#include "ExecutionNativeAPI.h"
+
+namespace ExecutionNativeAPICpp
+{
+    const AZ::BehaviorContext* GetBehaviorContext()
+    {
+        AZ::BehaviorContext* behaviorContext = nullptr;
+        AZ::ComponentApplicationBus::BroadcastResult(behaviorContext, &AZ::ComponentApplicationRequests::GetBehaviorContext);
+        AZ_Error("ScriptCanvas", behaviorContext, "A BehaviorContext is required to execute native graphs");
+        return behaviorContext;
+    }
+
+    template<typename Map>
+    typename Map::mapped_type Find(const Map& map, AZStd::string_view name)
+    {
+        auto iter = map.find(name);
+        return iter != map.end() ? iter->second : nullptr;
+    }
+}
+
+namespace ScriptCanvas
+{
+    namespace Execution
+    {
+        const AZ::BehaviorMethod* FindNativeMethod(AZStd::string_view className, AZStd::string_view methodName)
+        {
+            const AZ::BehaviorContext* behaviorContext = ExecutionNativeAPICpp::GetBehaviorContext();
+            return behaviorContext ? FindNativeMethod(*behaviorContext, className, methodName) : nullptr;
+        }
+
+        const AZ::BehaviorMethod* FindNativeMethod(const AZ::BehaviorContext& behaviorContext, AZStd::string_view className, AZStd::string_view methodName)
+        {
+            using namespace ExecutionNativeAPICpp;
+
+            const AZ::BehaviorMethod* method = nullptr;
+
+            if (className.empty())
+            {
+                method = Find(behaviorContext.m_methods, methodName);
+            }
+            else if (const AZ::BehaviorClass* behaviorClass = Find(behaviorContext.m_classes, className))
+            {
+                method = Find(behaviorClass->m_methods, methodName);
+            }
+
+            AZ_Error("ScriptCanvas", method, "Native graph method %.*s.%.*s was not found in the BehaviorContext"
+                , aznumeric_cast<int>(className.size()), className.data(), aznumeric_cast<int>(methodName.size()), methodName.data());
+            return method;
+        }
+
+        const AZ::BehaviorMethod* FindNativeEBusEvent(AZStd::string_view busName, AZStd::string_view eventName, EventType eventType)
+        {
+            const AZ::BehaviorContext* behaviorContext = ExecutionNativeAPICpp::GetBehaviorContext();
+            return behaviorContext ? FindNativeEBusEvent(*behaviorContext, busName, eventName, eventType) : nullptr;
+        }
+
+        const AZ::BehaviorMethod* FindNativeEBusEvent(const AZ::BehaviorContext& behaviorContext, AZStd::string_view busName, AZStd::string_view eventName, EventType eventType)
+        {
+            using namespace ExecutionNativeAPICpp;
+
+            const AZ::BehaviorMethod* method = nullptr;
+
+            if (const AZ::BehaviorEBus* behaviorEBus = Find(behaviorContext.m_ebuses, busName))
+            {
+                auto sender = behaviorEBus->m_events.find(eventName);
+                if (sender != behaviorEBus->m_events.end())
+                {
+                    switch (eventType)
+                    {
+                    case EventType::Broadcast:
+                        method = sender->second.m_broadcast;
+                        break;
+                    case EventType::BroadcastQueue:
+                        method = sender->second.m_queueBroadcast;
+                        break;
+                    case EventType::Event:
+                        method = sender->second.m_event;
+                        break;
+                    case EventType::EventQueue:
+                        method = sender->second.m_queueEvent;
+                        break;
+                    default:
+                        break;
+                    }
+                }
+            }
+
+            AZ_Error("ScriptCanvas", method, "Native graph EBus event %.*s.%.*s was not found in the BehaviorContext"
+                , aznumeric_cast<int>(busName.size()), busName.data(), aznumeric_cast<int>(eventName.size()), eventName.data());
+            return method;
+        }
+
+        bool HandleNativeEBusEvent(EBusHandler& handler, AZStd::string_view eventName, FunctorOut&& out)
+        {
+            const int eventIndex = handler.GetEventIndex(eventName);
+            if (eventIndex < 0)
+            {
+                AZ_Error("ScriptCanvas", false, "Native graph EBus handler event %s.%.*s was not found in the BehaviorContext"
+                    , handler.GetEBusName().c_str(), aznumeric_cast<int>(eventName.size()), eventName.data());
+                return false;
+            }
+
+            handler.HandleEvent(eventIndex);
+            handler.SetExecutionOut(eventIndex, AZStd::move(out));
+            return true;
+        }
+
+        bool GetNativeEBusHandlerEventArguments(const AZ::BehaviorContext& behaviorContext, AZStd::string_view busName, AZStd::string_view eventName, AZStd::vector<AZ::BehaviorParameter>& argumentsOut)
+        {
+            using namespace ExecutionNativeAPICpp;
+
+            const AZ::BehaviorEBus* behaviorEBus = Find(behaviorContext.m_ebuses, busName);
+            if (!behaviorEBus || !behaviorEBus->m_createHandler || !behaviorEBus->m_destroyHandler)
+            {
+                return false;
+            }
+
+            // the event signatures are only available from a handler instance
+            AZ::BehaviorEBusHandler* handler = nullptr;
+            if (!behaviorEBus->m_createHandler->InvokeResult(handler) || !handler)
+            {
+                return false;
+            }
+
+            const AZStd::string eventNameString(eventName);
+            const int eventIndex = handler->GetFunctionIndex(eventNameString.c_str());
+            const bool isFound = eventIndex >= 0;
+
+            if (isFound)
+            {
+                const auto& parameters = handler->GetEvents()[eventIndex].m_parameters;
+                argumentsOut.assign(parameters.begin() + AZ::eBehaviorBusForwarderEventIndices::ParameterFirst, parameters.end());
+            }
+
+            behaviorEBus->m_destroyHandler->Invoke(handler);
+            return isFound;
+        }
+
+        void ReportNativeCallError(const AZ::BehaviorMethod* method)
+        {
+            AZ_Error("ScriptCanvas", false, "Native graph call to %s failed", method ? method->m_name.c_str() : "an unresolved method");
+        }
+    }
+}
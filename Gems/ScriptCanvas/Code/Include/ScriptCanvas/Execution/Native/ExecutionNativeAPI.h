@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/string/string_view.h>
+
+#include <ScriptCanvas/Core/Core.h>
+#include <ScriptCanvas/Core/Nodeable.h>
+
+namespace ScriptCanvas
+{
+    class EBusHandler;
+
+    namespace Execution
+    {
+        // The API used by graphs translated to C++. Methods and EBus events are looked up once, by the name the translator
+        // resolved from the BehaviorContext, and every call after that goes straight through BehaviorMethod::Call, with
+        // none of the Lua stack marshalling that the interpreted runtime pays on each node.
+
+        //! Finds a method reflected to the BehaviorContext. An empty class name finds a global method.
+        const AZ::BehaviorMethod* FindNativeMethod(AZStd::string_view className, AZStd::string_view methodName);
+
+        const AZ::BehaviorMethod* FindNativeMethod(const AZ::BehaviorContext& behaviorContext, AZStd::string_view className, AZStd::string_view methodName);
+
+        //! Finds the sender of an EBus event reflected to the BehaviorContext, for the given kind of call.
+        const AZ::BehaviorMethod* FindNativeEBusEvent(AZStd::string_view busName, AZStd::string_view eventName, EventType eventType);
+
+        const AZ::BehaviorMethod* FindNativeEBusEvent(const AZ::BehaviorContext& behaviorContext, AZStd::string_view busName, AZStd::string_view eventName, EventType eventType);
+
+        //! Routes an event of the handler's bus to out, by the name the translator resolved. Returns false if the bus no longer has the event.
+        bool HandleNativeEBusEvent(EBusHandler& handler, AZStd::string_view eventName, FunctorOut&& out);
+
+        //! Gets the argument types of an event received by handlers of the bus, returns false if there is no such event.
+        //! The translator uses these to unpack the arguments of handled events.
+        bool GetNativeEBusHandlerEventArguments(const AZ::BehaviorContext& behaviorContext, AZStd::string_view busName, AZStd::string_view eventName, AZStd::vector<AZ::BehaviorParameter>& argumentsOut);
+
+        void ReportNativeCallError(const AZ::BehaviorMethod* method);
+
+        template<typename... Args>
+        void CallNative(const AZ::BehaviorMethod* method, Args&&... args)
+        {
+            if (!method || !method->Invoke(AZStd::forward<Args>(args)...))
+            {
+                ReportNativeCallError(method);
+            }
+        }
+
+        template<typename R, typename... Args>
+        R CallNativeResult(const AZ::BehaviorMethod* method, Args&&... args)
+        {
+            R result{};
+
+            if (!method || !method->InvokeResult(result, AZStd::forward<Args>(args)...))
+            {
+                ReportNativeCallError(method);
+            }
+
+            return result;
+        }
+    }
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <ScriptCanvas/Execution/ExecutionContext.h>
+#include <ScriptCanvas/Execution/NativeHostDefinitions.h>
+#include <ScriptCanvas/Execution/RuntimeComponent.h>
+
+#include "ExecutionStateNative.h"
+
+namespace ScriptCanvas
+{
+    ExecutionStateNative::ExecutionStateNative(const ExecutionStateConfig& config)
+        : ExecutionState(config)
+        , m_nativeName(config.runtimeData.m_input.m_nativeName)
+    {}
+
+    ExecutionStateNative::~ExecutionStateNative() = default;
+
+    void ExecutionStateNative::Execute()
+    {
+        if (m_graph)
+        {
+            m_graph->Activate();
+        }
+    }
+
+    ExecutionMode ExecutionStateNative::GetExecutionMode() const
+    {
+        return ExecutionMode::Native;
+    }
+
+    void ExecutionStateNative::Initialize()
+    {
+        Execution::ActivationInputArray storage;
+        Execution::ActivationData data(m_component->GetRuntimeDataOverrides(), storage);
+        Execution::ActivationInputRange range = Execution::Context::CreateActivateInputRange(data, m_component->GetEntityId());
+
+        // native graphs have no nodeables, the inputs are the variables followed by the entity ids
+        const RuntimeContext context
+            ( GetScriptCanvasId()
+            , GetEntityId()
+            , this
+            , range.inputs + range.nodeableCount
+            , range.variableCount + range.entityIdCount);
+
+        m_graph = CreateNativeGraph(m_nativeName, context);
+        AZ_Error("ScriptCanvas", m_graph != nullptr, "Native graph %s is no longer registered", m_nativeName.c_str());
+    }
+
+    void ExecutionStateNative::StopExecution()
+    {
+        if (m_graph)
+        {
+            m_graph->Deactivate();
+        }
+    }
+
+    void ExecutionStateNative::Reflect(AZ::ReflectContext* reflectContext)
+    {
+        if (AZ::BehaviorContext* behaviorContext = azrtti_cast<AZ::BehaviorContext*>(reflectContext))
+        {
+            behaviorContext->Class<ExecutionStateNative>()
+                ;
+        }
+    }
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+
+#include "Execution/ExecutionState.h"
+
+namespace ScriptCanvas
+{
+    class NativeGraph;
+
+    //! Executes a graph that was translated to C++ and compiled into a module, which registered it with the native host.
+    //! The graph instance is created on initialization, from the variable overrides of the runtime component, and its
+    //! event handlers stay connected from execution until execution is stopped.
+    class ExecutionStateNative
+        : public ExecutionState
+    {
+    public:
+        AZ_RTTI(ExecutionStateNative, "{3C5B7E0A-2E8B-4A29-9E1D-6B6B0C3F4D57}", ExecutionState);
+        AZ_CLASS_ALLOCATOR(ExecutionStateNative, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::ReflectContext* reflectContext);
+
+        ExecutionStateNative(const ExecutionStateConfig& config);
+
+        ~ExecutionStateNative() override;
+
+        void Execute() override;
+
+        ExecutionMode GetExecutionMode() const override;
+
+        void Initialize() override;
+
+        void StopExecution() override;
+
+    private:
+        AZStd::string m_nativeName;
+        AZStd::unique_ptr<NativeGraph> m_graph;
+    };
+}
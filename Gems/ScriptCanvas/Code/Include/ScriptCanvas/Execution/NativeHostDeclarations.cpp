@@ -6,6 +6,8 @@
  *
  */
 
+#include <AzCore/RTTI/BehaviorContext.h>
+
 #include "NativeHostDeclarations.h"
 
 namespace ScriptCanvas
@@ -13,4 +15,33 @@ namespace ScriptCanvas
     RuntimeContext::RuntimeContext(AZ::EntityId graphId)
         : m_graphId(graphId)
     {}
+
+    RuntimeContext::RuntimeContext(AZ::EntityId graphId, AZ::EntityId selfId)
+        : m_graphId(graphId)
+        , m_selfId(selfId)
+    {}
+
+    RuntimeContext::RuntimeContext(AZ::EntityId graphId, AZ::EntityId selfId, ExecutionStateWeakPtr executionState)
+        : m_graphId(graphId)
+        , m_selfId(selfId)
+        , m_executionState(executionState)
+    {}
+
+    RuntimeContext::RuntimeContext(AZ::EntityId graphId, AZ::EntityId selfId, ExecutionStateWeakPtr executionState, const AZ::BehaviorValueParameter* inputs, size_t inputCount)
+        : m_graphId(graphId)
+        , m_selfId(selfId)
+        , m_executionState(executionState)
+        , m_inputs(inputs)
+        , m_inputCount(inputCount)
+    {}
+
+    const void* RuntimeContext::GetInput(size_t index, const AZ::TypeId& typeId) const
+    {
+        if (index < m_inputCount && m_inputs[index].m_typeId == typeId)
+        {
+            return m_inputs[index].GetValueAddress();
+        }
+
+        return nullptr;
+    }
 }
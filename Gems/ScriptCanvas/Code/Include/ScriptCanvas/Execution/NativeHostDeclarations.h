@@ -9,17 +9,54 @@
 #pragma once
 
 #include <AzCore/Component/EntityId.h>
+#include <AzCore/RTTI/TypeInfo.h>
+#include <ScriptCanvas/Execution/ExecutionStateDeclarations.h>
+
+namespace AZ
+{
+    struct BehaviorValueParameter;
+}
 
 namespace ScriptCanvas
 {
     class RuntimeContext
     {
     public:
-        RuntimeContext(AZ::EntityId graphId);      
-        
+        RuntimeContext(AZ::EntityId graphId);
+
+        RuntimeContext(AZ::EntityId graphId, AZ::EntityId selfId);
+
+        RuntimeContext(AZ::EntityId graphId, AZ::EntityId selfId, ExecutionStateWeakPtr executionState);
+
+        //! The inputs are the graph's (possibly overridden) variables followed by its entity ids, in the order of
+        //! the RuntimeInputs of the graph. They are only valid while the native graph is being constructed.
+        RuntimeContext(AZ::EntityId graphId, AZ::EntityId selfId, ExecutionStateWeakPtr executionState, const AZ::BehaviorValueParameter* inputs, size_t inputCount);
+
         AZ_INLINE AZ::EntityId GetGraphId() const { return m_graphId; }
 
+        //! The entity that owns the executing graph, what the graph refers to as "Self".
+        AZ_INLINE AZ::EntityId GetSelfId() const { return m_selfId; }
+
+        //! The execution state that runs the graph, required by EBus handlers.
+        AZ_INLINE ExecutionStateWeakPtr GetExecutionState() const { return m_executionState; }
+
+        //! Returns the input at index, or nullptr if there is no such input or it is not of the given type.
+        const void* GetInput(size_t index, const AZ::TypeId& typeId) const;
+
+        //! Returns the input at index, or defaultValue if there is no such input of type T, which happens when the graph
+        //! is executed without the component that supplies its variable overrides.
+        template<typename T>
+        T GetInputAs(size_t index, const T& defaultValue) const
+        {
+            const void* input = GetInput(index, azrtti_typeid<T>());
+            return input ? *reinterpret_cast<const T*>(input) : defaultValue;
+        }
+
     protected:
         AZ::EntityId m_graphId;
+        AZ::EntityId m_selfId;
+        ExecutionStateWeakPtr m_executionState = nullptr;
+        const AZ::BehaviorValueParameter* m_inputs = nullptr;
+        size_t m_inputCount = 0;
     };
 }
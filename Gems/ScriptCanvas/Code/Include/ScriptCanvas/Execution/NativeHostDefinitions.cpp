@@ -7,14 +7,40 @@
  */
 
 #include "NativeHostDefinitions.h"
+#include <AzCore/Module/Environment.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
 
 namespace NativeHostDefinitionsCPP
 {
     using namespace ScriptCanvas;
 
     using FunctionMap = AZStd::unordered_map<AZStd::string, GraphStartFunction>;
-    FunctionMap s_functionMap;
+    using FactoryMap = AZStd::unordered_map<AZStd::string, NativeGraphFactory>;
+
+    // graphs are compiled into project gems, so the registry is shared through the environment rather than being
+    // a static of the ScriptCanvas library, which is linked into more than one module
+    struct FunctionRegistry
+    {
+        AZStd::mutex m_mutex;
+        FunctionMap m_functions;
+        FactoryMap m_factories;
+    };
+
+    constexpr const char* k_functionRegistryName = "ScriptCanvasNativeGraphStartFunctions";
+
+    FunctionRegistry& GetFunctionRegistry()
+    {
+        static AZ::EnvironmentVariable<FunctionRegistry> s_functionRegistry;
+
+        if (!s_functionRegistry)
+        {
+            s_functionRegistry = AZ::Environment::CreateVariable<FunctionRegistry>(k_functionRegistryName);
+        }
+
+        return *s_functionRegistry;
+    }
 }
 
 namespace ScriptCanvas
@@ -23,24 +49,46 @@ namespace ScriptCanvas
     {
         using namespace NativeHostDefinitionsCPP;
 
-        auto iter = s_functionMap.find(name);
-        if (iter != s_functionMap.end())
+        GraphStartFunction function = nullptr;
+
+        {
+            FunctionRegistry& registry = GetFunctionRegistry();
+            AZStd::lock_guard<AZStd::mutex> lock(registry.m_mutex);
+            auto iter = registry.m_functions.find(name);
+            if (iter != registry.m_functions.end())
+            {
+                function = iter->second;
+            }
+        }
+
+        if (function)
         {
-            iter->second(context);
+            function(context);
             return true;
         }
 
         return false;
     }
 
+    bool IsNativeGraphStartRegistered(AZStd::string_view name)
+    {
+        using namespace NativeHostDefinitionsCPP;
+
+        FunctionRegistry& registry = GetFunctionRegistry();
+        AZStd::lock_guard<AZStd::mutex> lock(registry.m_mutex);
+        return registry.m_functions.find(name) != registry.m_functions.end();
+    }
+
     bool RegisterNativeGraphStart(AZStd::string_view name, GraphStartFunction function)
     {
         using namespace NativeHostDefinitionsCPP;
         
-        auto iter = s_functionMap.find(name);
-        if (iter == s_functionMap.end())
+        FunctionRegistry& registry = GetFunctionRegistry();
+        AZStd::lock_guard<AZStd::mutex> lock(registry.m_mutex);
+        auto iter = registry.m_functions.find(name);
+        if (iter == registry.m_functions.end())
         {
-            s_functionMap.insert({ name, function });
+            registry.m_functions.insert({ name, function });
             return true;
         }
         
@@ -52,14 +100,68 @@ namespace ScriptCanvas
     {
         using namespace NativeHostDefinitionsCPP;
         
-        auto iter = s_functionMap.find(name);
-        if (iter != s_functionMap.end())
+        FunctionRegistry& registry = GetFunctionRegistry();
+        AZStd::lock_guard<AZStd::mutex> lock(registry.m_mutex);
+        auto iter = registry.m_functions.find(name);
+        if (iter != registry.m_functions.end())
         {
-            s_functionMap.erase(iter);
+            registry.m_functions.erase(iter);
             return true;
         }
 
         return false;
     }
 
+    AZStd::unique_ptr<NativeGraph> CreateNativeGraph(AZStd::string_view name, const RuntimeContext& context)
+    {
+        using namespace NativeHostDefinitionsCPP;
+
+        NativeGraphFactory factory = nullptr;
+
+        {
+            FunctionRegistry& registry = GetFunctionRegistry();
+            AZStd::lock_guard<AZStd::mutex> lock(registry.m_mutex);
+            auto iter = registry.m_factories.find(name);
+            if (iter != registry.m_factories.end())
+            {
+                factory = iter->second;
+            }
+        }
+
+        return factory ? factory(context) : nullptr;
+    }
+
+    bool IsNativeGraphRegistered(AZStd::string_view name)
+    {
+        using namespace NativeHostDefinitionsCPP;
+
+        FunctionRegistry& registry = GetFunctionRegistry();
+        AZStd::lock_guard<AZStd::mutex> lock(registry.m_mutex);
+        return registry.m_factories.find(name) != registry.m_factories.end();
+    }
+
+    bool RegisterNativeGraph(AZStd::string_view name, NativeGraphFactory factory)
+    {
+        using namespace NativeHostDefinitionsCPP;
+
+        FunctionRegistry& registry = GetFunctionRegistry();
+        AZStd::lock_guard<AZStd::mutex> lock(registry.m_mutex);
+        return registry.m_factories.insert({ name, factory }).second;
+    }
+
+    bool UnregisterNativeGraph(AZStd::string_view name)
+    {
+        using namespace NativeHostDefinitionsCPP;
+
+        FunctionRegistry& registry = GetFunctionRegistry();
+        AZStd::lock_guard<AZStd::mutex> lock(registry.m_mutex);
+        auto iter = registry.m_factories.find(name);
+        if (iter != registry.m_factories.end())
+        {
+            registry.m_factories.erase(iter);
+            return true;
+        }
+
+        return false;
+    }
 }
@@ -6,6 +6,11 @@
  *
  */
 
+#pragma once
+
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string_view.h>
+
 #include "NativeHostDeclarations.h"
 
 namespace ScriptCanvas
@@ -15,10 +20,82 @@ namespace ScriptCanvas
     using GraphStartFunction = void(*)(const RuntimeContext&);
 
     bool CallNativeGraphStart(AZStd::string_view name, const RuntimeContext& context);
-    
+
+    bool IsNativeGraphStartRegistered(AZStd::string_view name);
+
     bool RegisterNativeGraphStart(AZStd::string_view name, GraphStartFunction function);
-    
+
     // this may never have to be necessary
     bool UnregisterNativeGraphStart(AZStd::string_view name);
 
+    //! The base of the classes that graphs are translated to in C++. One is constructed for every activation of a
+    //! graph, with its variables initialized from the inputs of the RuntimeContext.
+    class NativeGraph
+    {
+    public:
+        virtual ~NativeGraph() = default;
+
+        //! Connects the event handlers of the graph, and executes On Graph Start if the graph has one.
+        virtual void Activate() = 0;
+
+        //! Disconnects the event handlers of the graph, no execution of the graph follows it.
+        virtual void Deactivate() = 0;
+    };
+
+    using NativeGraphFactory = AZStd::unique_ptr<NativeGraph>(*)(const RuntimeContext&);
+
+    //! Returns nullptr if no graph is registered by that name.
+    AZStd::unique_ptr<NativeGraph> CreateNativeGraph(AZStd::string_view name, const RuntimeContext& context);
+
+    bool IsNativeGraphRegistered(AZStd::string_view name);
+
+    bool RegisterNativeGraph(AZStd::string_view name, NativeGraphFactory factory);
+
+    bool UnregisterNativeGraph(AZStd::string_view name);
+
+    //! Collects the graphs translated to C++ that are compiled into a module. Each generated .cpp file declares one
+    //! static registrar, and the module registers all of them with the native host once it has attached to the
+    //! AZ::Environment, typically from the Activate() of its system component:
+    //!     ScriptCanvas::NativeGraphRegistrar::RegisterAll();
+    //! and unregisters them from Deactivate():
+    //!     ScriptCanvas::NativeGraphRegistrar::UnregisterAll();
+    //! The list is intrusive and built during static initialization, so it never allocates and is local to each module.
+    class NativeGraphRegistrar
+    {
+    public:
+        NativeGraphRegistrar(const char* name, NativeGraphFactory factory)
+            : m_name(name)
+            , m_factory(factory)
+            , m_next(GetHead())
+        {
+            GetHead() = this;
+        }
+
+        static void RegisterAll()
+        {
+            for (const NativeGraphRegistrar* registrar = GetHead(); registrar; registrar = registrar->m_next)
+            {
+                RegisterNativeGraph(registrar->m_name, registrar->m_factory);
+            }
+        }
+
+        static void UnregisterAll()
+        {
+            for (const NativeGraphRegistrar* registrar = GetHead(); registrar; registrar = registrar->m_next)
+            {
+                UnregisterNativeGraph(registrar->m_name);
+            }
+        }
+
+    private:
+        static NativeGraphRegistrar*& GetHead()
+        {
+            static NativeGraphRegistrar* s_head = nullptr;
+            return s_head;
+        }
+
+        const char* m_name;
+        NativeGraphFactory m_factory;
+        NativeGraphRegistrar* m_next;
+    };
 }
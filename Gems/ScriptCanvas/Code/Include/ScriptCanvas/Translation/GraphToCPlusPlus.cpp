@@ -8,8 +8,174 @@
 
 #include "GraphToCPlusPlus.h"
 
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/algorithm.h>
+#include <cmath>
+#include <ScriptCanvas/Data/Data.h>
+#include <ScriptCanvas/Debugger/ValidationEvents/ParsingValidation/ParsingValidations.h>
+#include <ScriptCanvas/Execution/Native/ExecutionNativeAPI.h>
 #include <ScriptCanvas/Grammar/AbstractCodeModel.h>
+#include <ScriptCanvas/Grammar/ParsingUtilities.h>
 #include <ScriptCanvas/Grammar/Primitives.h>
+#include <ScriptCanvas/Grammar/PrimitivesExecution.h>
+
+namespace GraphToCPlusPlusCpp
+{
+    using namespace ScriptCanvas;
+
+    struct NativeType
+    {
+        AZ::TypeId m_typeId;
+        const char* m_name;
+        bool m_isNumber;
+    };
+
+    // every type that a native graph can store in a variable or receive as the result of a call
+    const NativeType* FindNativeType(const AZ::TypeId& typeId)
+    {
+        static const NativeType s_nativeTypes[] =
+        {
+            { azrtti_typeid<bool>(), "bool", false },
+            { azrtti_typeid<double>(), "double", true },
+            { azrtti_typeid<float>(), "float", true },
+            { azrtti_typeid<AZ::s8>(), "AZ::s8", true },
+            { azrtti_typeid<AZ::u8>(), "AZ::u8", true },
+            { azrtti_typeid<AZ::s16>(), "AZ::s16", true },
+            { azrtti_typeid<AZ::u16>(), "AZ::u16", true },
+            { azrtti_typeid<AZ::s32>(), "AZ::s32", true },
+            { azrtti_typeid<AZ::u32>(), "AZ::u32", true },
+            { azrtti_typeid<AZ::s64>(), "AZ::s64", true },
+            { azrtti_typeid<AZ::u64>(), "AZ::u64", true },
+            { azrtti_typeid<Data::AABBType>(), "AZ::Aabb", false },
+            { azrtti_typeid<Data::ColorType>(), "AZ::Color", false },
+            { azrtti_typeid<Data::CRCType>(), "AZ::Crc32", false },
+            { azrtti_typeid<Data::EntityIDType>(), "AZ::EntityId", false },
+            { azrtti_typeid<Data::Matrix3x3Type>(), "AZ::Matrix3x3", false },
+            { azrtti_typeid<Data::Matrix4x4Type>(), "AZ::Matrix4x4", false },
+            { azrtti_typeid<Data::QuaternionType>(), "AZ::Quaternion", false },
+            { azrtti_typeid<Data::StringType>(), "AZStd::string", false },
+            { azrtti_typeid<Data::TransformType>(), "AZ::Transform", false },
+            { azrtti_typeid<Data::Vector2Type>(), "AZ::Vector2", false },
+            { azrtti_typeid<Data::Vector3Type>(), "AZ::Vector3", false },
+            { azrtti_typeid<Data::Vector4Type>(), "AZ::Vector4", false },
+        };
+
+        for (const NativeType& nativeType : s_nativeTypes)
+        {
+            if (nativeType.m_typeId == typeId)
+            {
+                return &nativeType;
+            }
+        }
+
+        return nullptr;
+    }
+
+    const char* GetEventTypeName(EventType eventType)
+    {
+        switch (eventType)
+        {
+        case EventType::Broadcast:
+            return "Broadcast";
+        case EventType::BroadcastQueue:
+            return "BroadcastQueue";
+        case EventType::Event:
+            return "Event";
+        case EventType::EventQueue:
+            return "EventQueue";
+        default:
+            return "Count";
+        }
+    }
+
+    // shortest representation that survives the round trip, always with a decimal point so it parses as floating point
+    AZStd::string ToNumberLiteral(double value, const char* format, const char* suffix, const char* typeName)
+    {
+        // there are no literals for these, the format would write inf or nan
+        if (std::isnan(value))
+        {
+            return AZStd::string::format("std::numeric_limits<%s>::quiet_NaN()", typeName);
+        }
+
+        if (std::isinf(value))
+        {
+            return AZStd::string::format("%sstd::numeric_limits<%s>::infinity()", value < 0.0 ? "-" : "", typeName);
+        }
+
+        AZStd::string literal = AZStd::string::format(format, value);
+
+        if (literal.find_first_of(".eE") == AZStd::string::npos)
+        {
+            literal += ".0";
+        }
+
+        return literal + suffix;
+    }
+
+    AZStd::string ToDoubleLiteral(double value)
+    {
+        return ToNumberLiteral(value, "%.17g", "", "double");
+    }
+
+    AZStd::string ToFloatLiteral(float value)
+    {
+        return ToNumberLiteral(value, "%.9g", "f", "float");
+    }
+
+    AZStd::string ToStringLiteral(AZStd::string_view value)
+    {
+        AZStd::string literal = "\"";
+
+        for (char character : value)
+        {
+            switch (character)
+            {
+            case '\"':
+                literal += "\\\"";
+                break;
+            case '\\':
+                literal += "\\\\";
+                break;
+            case '\n':
+                literal += "\\n";
+                break;
+            case '\r':
+                literal += "\\r";
+                break;
+            case '\t':
+                literal += "\\t";
+                break;
+            default:
+                literal += character;
+                break;
+            }
+        }
+
+        literal += "\"";
+        return literal;
+    }
+
+    AZStd::string ToVector3Literal(const AZ::Vector3& value)
+    {
+        return AZStd::string::format("AZ::Vector3(%s, %s, %s)"
+            , ToFloatLiteral(value.GetX()).c_str(), ToFloatLiteral(value.GetY()).c_str(), ToFloatLiteral(value.GetZ()).c_str());
+    }
+
+    AZStd::string ToVector4Literal(const AZ::Vector4& value)
+    {
+        return AZStd::string::format("AZ::Vector4(%s, %s, %s, %s)"
+            , ToFloatLiteral(value.GetX()).c_str(), ToFloatLiteral(value.GetY()).c_str(), ToFloatLiteral(value.GetZ()).c_str(), ToFloatLiteral(value.GetW()).c_str());
+    }
+
+    AZStd::string ToQuaternionLiteral(const AZ::Quaternion& value)
+    {
+        return AZStd::string::format("AZ::Quaternion(%s, %s, %s, %s)"
+            , ToFloatLiteral(value.GetX()).c_str(), ToFloatLiteral(value.GetY()).c_str(), ToFloatLiteral(value.GetZ()).c_str(), ToFloatLiteral(value.GetW()).c_str());
+    }
+
+    const char* k_unsupportedFeature = "Translation to C++ does not support %s, the graph will execute its Lua translation.";
+}
 
 namespace ScriptCanvas
 {
@@ -20,6 +186,9 @@ namespace ScriptCanvas
             Configuration configuration;
             configuration.m_blockCommentClose = "*/";
             configuration.m_blockCommentOpen = "/*";
+            configuration.m_executionStateEntityIdRef = "m_context.GetSelfId()";
+            configuration.m_executionStateScriptCanvasIdRef = "m_context.GetGraphId()";
+            configuration.m_lexicalScopeDelimiter = "::";
             configuration.m_namespaceClose = "}";
             configuration.m_namespaceOpen = "{";
             configuration.m_namespaceOpenPrefix = "namespace";
@@ -30,30 +199,186 @@ namespace ScriptCanvas
         }
 
         GraphToCPlusPlus::GraphToCPlusPlus(const Grammar::AbstractCodeModel& model)
-            : GraphToX(CreateCPlusPluseConfig(), model) 
+            : GraphToX(CreateCPlusPluseConfig(), model)
         {
-            WriteHeaderDotH();
-            WriteHeaderDotCPP();
-            
-            TranslateDependenciesDotH();
-            TranslateDependenciesDotCPP();
-                        
-            TranslateNamespaceOpen();
+            MarkTranslationStart();
+
+            AZ::BehaviorContext* behaviorContext = nullptr;
+            AZ::ComponentApplicationBus::BroadcastResult(behaviorContext, &AZ::ComponentApplicationRequests::GetBehaviorContext);
+            m_behaviorContext = behaviorContext;
+
+            CheckSupport();
+
+            if (IsSuccessfull())
             {
-                TranslateClassOpen();
+                const auto& runtimeInputs = m_model.GetRuntimeInputs();
+                m_constructionInputs = m_model.CombineVariableLists(runtimeInputs.m_nodeables, runtimeInputs.m_variables, runtimeInputs.m_entityIds);
+
+                WriteHeaderDotH();
+                WriteHeaderDotCPP();
+
+                TranslateDependenciesDotH();
+                TranslateDependenciesDotCPP();
+
+                TranslateNamespaceOpen();
                 {
-                    TranslateVariables();
-                    TranslateHandlers();
+                    TranslateClassOpen();
+                    {
+                        TranslateVariables();
+                    }
+                    TranslateClassClose();
+
                     TranslateConstruction();
-                    TranslateDestruction();
+                    TranslateActivation();
                     TranslateStartNode();
+                    TranslateEBusHandlerEvents();
+                }
+                TranslateNamespaceClose();
+
+                TranslateRegistration();
+            }
+
+            MarkTranslationStop();
+        }
+
+        void GraphToCPlusPlus::CheckSupport()
+        {
+            using namespace GraphToCPlusPlusCpp;
+
+            auto addError = [this](const char* feature)
+            {
+                AddError(nullptr, aznew Internal::ParseError(AZ::EntityId(), AZStd::string::format(k_unsupportedFeature, feature)));
+            };
+
+            if (!m_behaviorContext)
+            {
+                addError("translation without a BehaviorContext");
+            }
+
+            if (!m_model.GetStart() && m_model.GetEBusHandlings().empty())
+            {
+                addError("graphs without an On Graph Start node or EBus handlers");
+            }
+
+            for (auto& function : m_model.GetFunctions())
+            {
+                // the EBus handlers are disconnected by the translated Deactivate()
+                if (function->GetName() != Grammar::k_DeactivateName)
+                {
+                    addError("functions or latent execution");
+                    break;
+                }
+            }
+
+            for (auto& ebusHandling : m_model.GetEBusHandlings())
+            {
+                if (!ebusHandling->m_startsConnected || ebusHandling->RequiresConnectionControl())
+                {
+                    addError(AZStd::string::format("connecting or disconnecting %s from the graph", ebusHandling->m_ebusName.c_str()).c_str());
+                }
+
+                if (ebusHandling->m_isAddressed && (!ebusHandling->m_startingAdress || !ebusHandling->m_startingAdress->m_isMember))
+                {
+                    addError(AZStd::string::format("the address of %s", ebusHandling->m_ebusName.c_str()).c_str());
+                }
+
+                for (auto& nameAndEventThread : ebusHandling->m_events)
+                {
+                    if (nameAndEventThread.second->HasReturnValues())
+                    {
+                        addError(AZStd::string::format("returning values from %s.%s", ebusHandling->m_ebusName.c_str(), nameAndEventThread.first.c_str()).c_str());
+                    }
+                }
+            }
+
+            if (!m_model.GetEventHandlings().empty())
+            {
+                addError("AZ::Event handling");
+            }
+
+            if (!m_model.GetNodeableParse().empty())
+            {
+                addError("nodeables");
+            }
+
+            if (!m_model.GetStaticVariablesNames().empty())
+            {
+                addError("static variables");
+            }
+
+            for (auto& variable : m_model.GetVariables())
+            {
+                if (variable->m_isMember)
+                {
+                    if (!m_model.GetVariableHandling(variable).empty())
+                    {
+                        addError("handling variable changes");
+                    }
+
+                    if (!FindNativeType(variable->m_datum.GetType().GetAZType()))
+                    {
+                        addError(AZStd::string::format("the type of variable %s", variable->m_name.c_str()).c_str());
+                    }
                 }
-                TranslateClassClose();
             }
-            TranslateNamespaceClose();
         }
 
-        AZ::Outcome<void, AZStd::pair<AZStd::string, AZStd::string>> GraphToCPlusPlus::Translate(const Grammar::AbstractCodeModel& model, AZStd::string& dotH, AZStd::string& dotCPP)
+        AZStd::string GraphToCPlusPlus::GetConstructionInputName(Grammar::VariableConstPtr variable) const
+        {
+            // the inputs of pure graphs are local to Start(), so they are kept apart from the member variables
+            return variable->m_isMember
+                ? AZStd::string::format("m_%s", variable->m_name.c_str())
+                : AZStd::string::format("m_%sInput", variable->m_name.c_str());
+        }
+
+        AZStd::string GraphToCPlusPlus::GetEBusEventFunctionName(Grammar::EBusHandlingConstPtr ebusHandling, AZStd::string_view eventName) const
+        {
+            return AZStd::string::format("%s_%s", ebusHandling->m_handlerName.c_str(), Grammar::ToIdentifierSafe(eventName).c_str());
+        }
+
+        const char* GraphToCPlusPlus::GetNativeTypeName(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr variable)
+        {
+            const GraphToCPlusPlusCpp::NativeType* nativeType = GraphToCPlusPlusCpp::FindNativeType(variable->m_datum.GetType().GetAZType());
+
+            if (!nativeType)
+            {
+                AddError(execution, aznew Internal::ParseError(execution ? execution->GetNodeId() : AZ::EntityId()
+                    , AZStd::string::format(GraphToCPlusPlusCpp::k_unsupportedFeature, AZStd::string::format("the type of variable %s", variable->m_name.c_str()).c_str())));
+                return nullptr;
+            }
+
+            return nativeType->m_name;
+        }
+
+        AZStd::string_view GraphToCPlusPlus::GetOperatorString(Grammar::ExecutionTreeConstPtr execution)
+        {
+            switch (execution->GetSymbol())
+            {
+            case Grammar::Symbol::OperatorAddition:
+                return " + ";
+            case Grammar::Symbol::OperatorDivision:
+                return " / ";
+            case Grammar::Symbol::OperatorMultiplication:
+                return " * ";
+            case Grammar::Symbol::OperatorSubraction:
+                return " - ";
+            default:
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::UntranslatedArithmetic));
+                return "";
+            }
+        }
+
+        bool GraphToCPlusPlus::IsConstructionInput(Grammar::VariableConstPtr variable) const
+        {
+            return AZStd::find(m_constructionInputs.begin(), m_constructionInputs.end(), variable) != m_constructionInputs.end();
+        }
+
+        GraphToCPlusPlus::IsNamed GraphToCPlusPlus::IsInputNamed(Grammar::VariableConstPtr input, Grammar::ExecutionTreeConstPtr execution)
+        {
+            return input->m_source != execution || input->m_requiresCreationFunction ? IsNamed::Yes : IsNamed::No;
+        }
+
+        AZ::Outcome<void, ErrorList> GraphToCPlusPlus::Translate(const Grammar::AbstractCodeModel& model, AZStd::string& dotH, AZStd::string& dotCPP)
         {
             GraphToCPlusPlus translation(model);
 
@@ -65,8 +390,51 @@ namespace ScriptCanvas
             }
             else
             {
-                return AZ::Failure(AZStd::make_pair(AZStd::string(".h errors"), AZStd::string(".cpp errors")));
+                return AZ::Failure(AZStd::move(translation.MoveErrors()));
+            }
+        }
+
+        void GraphToCPlusPlus::TranslateActivation()
+        {
+            const auto ebusHandlings = m_model.GetEBusHandlings();
+
+            m_dotCPP.WriteLineIndented("void %s::Activate()", GetGraphName().data());
+            OpenScope(m_dotCPP);
+            {
+                for (auto& ebusHandling : ebusHandlings)
+                {
+                    if (ebusHandling->m_isAddressed)
+                    {
+                        OpenScope(m_dotCPP);
+                        m_dotCPP.WriteIndented("AZ::BehaviorValueParameter address(&");
+                        WriteVariableReference(ebusHandling->m_startingAdress);
+                        m_dotCPP.WriteLine(");");
+                        m_dotCPP.WriteLineIndented("m_%s->ConnectTo(address);", ebusHandling->m_handlerName.c_str());
+                        CloseScope(m_dotCPP);
+                    }
+                    else
+                    {
+                        m_dotCPP.WriteLineIndented("m_%s->Connect();", ebusHandling->m_handlerName.c_str());
+                    }
+                }
+
+                if (m_model.GetStart())
+                {
+                    m_dotCPP.WriteLineIndented("Start();");
+                }
+            }
+            CloseScope(m_dotCPP);
+            m_dotCPP.WriteNewLine();
+
+            m_dotCPP.WriteLineIndented("void %s::Deactivate()", GetGraphName().data());
+            OpenScope(m_dotCPP);
+            {
+                for (auto& ebusHandling : ebusHandlings)
+                {
+                    m_dotCPP.WriteLineIndented("m_%s->Disconnect();", ebusHandling->m_handlerName.c_str());
+                }
             }
+            CloseScope(m_dotCPP);
         }
 
         void GraphToCPlusPlus::TranslateClassClose()
@@ -82,98 +450,801 @@ namespace ScriptCanvas
 
         void GraphToCPlusPlus::TranslateClassOpen()
         {
+            const auto ebusHandlings = m_model.GetEBusHandlings();
+
             m_dotH.WriteIndent();
             m_dotH.WriteLine("class %s", GetGraphName().data());
+            m_dotH.WriteLineIndented("    : public NativeGraph");
             m_dotH.WriteIndent();
             m_dotH.WriteLine("{");
+            m_dotH.WriteLineIndented("public:");
+            m_dotH.Indent();
+            m_dotH.WriteLineIndented("static AZStd::unique_ptr<NativeGraph> Create(const RuntimeContext& context);");
+            m_dotH.WriteNewLine();
+            m_dotH.WriteLineIndented("%s(const RuntimeContext& context);", GetGraphName().data());
+            m_dotH.WriteNewLine();
+            m_dotH.WriteLineIndented("void Activate() override;");
+            m_dotH.WriteNewLine();
+            m_dotH.WriteLineIndented("void Deactivate() override;");
+            m_dotH.WriteNewLine();
+            m_dotH.Outdent();
+            m_dotH.WriteLineIndented("private:");
             m_dotH.Indent();
+
+            if (m_model.GetStart())
+            {
+                m_dotH.WriteLineIndented("void Start();");
+                m_dotH.WriteNewLine();
+            }
+
+            for (auto& ebusHandling : ebusHandlings)
+            {
+                for (auto& nameAndEventThread : ebusHandling->m_events)
+                {
+                    m_dotH.WriteLineIndented("void %s(AZ::BehaviorValueParameter* arguments);", GetEBusEventFunctionName(ebusHandling, nameAndEventThread.first).c_str());
+                    m_dotH.WriteNewLine();
+                }
+            }
+
+            // a copy without the inputs, which are only valid during construction
+            m_dotH.WriteLineIndented("[[maybe_unused]] RuntimeContext m_context;");
+
+            for (auto& ebusHandling : ebusHandlings)
+            {
+                m_dotH.WriteLineIndented("AZStd::unique_ptr<EBusHandler> m_%s;", ebusHandling->m_handlerName.c_str());
+            }
         }
 
         void GraphToCPlusPlus::TranslateConstruction()
         {
+            using namespace GraphToCPlusPlusCpp;
 
-        }
+            m_dotCPP.WriteLineIndented("AZStd::unique_ptr<NativeGraph> %s::Create(const RuntimeContext& context)", GetGraphName().data());
+            OpenScope(m_dotCPP);
+            m_dotCPP.WriteLineIndented("return AZStd::make_unique<%s>(context);", GetGraphName().data());
+            CloseScope(m_dotCPP);
+            m_dotCPP.WriteNewLine();
 
-        void GraphToCPlusPlus::TranslateDependencies()
-        {
-            TranslateDependenciesDotH();
-            TranslateDependenciesDotCPP();
+            auto writeInputInitialization = [this](Grammar::VariableConstPtr variable)
+            {
+                const size_t index = AZStd::distance(m_constructionInputs.begin(), AZStd::find(m_constructionInputs.begin(), m_constructionInputs.end(), variable));
+
+                if (const char* typeName = GetNativeTypeName(nullptr, variable))
+                {
+                    // the default is only used when the graph executes without the component that supplies its variable overrides
+                    m_dotCPP.WriteLineIndented(", %s(context.GetInputAs<%s>(%zu, %s))"
+                        , GetConstructionInputName(variable).c_str(), typeName, index, ToValueString(nullptr, variable->m_datum).c_str());
+                }
+            };
+
+            m_dotCPP.WriteLineIndented("%s::%s(const RuntimeContext& context)", GetGraphName().data(), GetGraphName().data());
+            m_dotCPP.Indent();
+            m_dotCPP.WriteLineIndented(": m_context(context.GetGraphId(), context.GetSelfId(), context.GetExecutionState())");
+
+            // in the order of declaration, see TranslateVariables()
+            for (auto& variable : m_model.GetVariables())
+            {
+                if (variable->m_isMember && IsConstructionInput(variable))
+                {
+                    writeInputInitialization(variable);
+                }
+            }
+
+            for (auto& variable : m_constructionInputs)
+            {
+                if (!variable->m_isMember)
+                {
+                    writeInputInitialization(variable);
+                }
+            }
+
+            m_dotCPP.Outdent();
+
+            const auto ebusHandlings = m_model.GetEBusHandlings();
+
+            if (ebusHandlings.empty())
+            {
+                m_dotCPP.WriteLineIndented("{}");
+            }
+            else
+            {
+                OpenScope(m_dotCPP);
+
+                for (auto& ebusHandling : ebusHandlings)
+                {
+                    m_dotCPP.WriteLineIndented("m_%s.reset(EBusHandler::Create(m_context.GetExecutionState(), %s));"
+                        , ebusHandling->m_handlerName.c_str(), ToStringLiteral(ebusHandling->m_ebusName).c_str());
+
+                    for (auto& nameAndEventThread : ebusHandling->m_events)
+                    {
+                        m_dotCPP.WriteLineIndented("ScriptCanvas::Execution::HandleNativeEBusEvent(*m_%s, %s, [this](AZ::BehaviorValueParameter*, AZ::BehaviorValueParameter* arguments, int) { %s(arguments); });"
+                            , ebusHandling->m_handlerName.c_str()
+                            , ToStringLiteral(nameAndEventThread.first).c_str()
+                            , GetEBusEventFunctionName(ebusHandling, nameAndEventThread.first).c_str());
+                    }
+                }
+
+                CloseScope(m_dotCPP);
+            }
+
+            m_dotCPP.WriteNewLine();
         }
 
         void GraphToCPlusPlus::TranslateDependenciesDotH()
         {
+            m_dotH.WriteLine("#include <AzCore/Component/EntityId.h>");
+            m_dotH.WriteLine("#include <AzCore/Math/Aabb.h>");
+            m_dotH.WriteLine("#include <AzCore/Math/Color.h>");
+            m_dotH.WriteLine("#include <AzCore/Math/Crc.h>");
+            m_dotH.WriteLine("#include <AzCore/Math/Matrix3x3.h>");
+            m_dotH.WriteLine("#include <AzCore/Math/Matrix4x4.h>");
+            m_dotH.WriteLine("#include <AzCore/Math/Quaternion.h>");
+            m_dotH.WriteLine("#include <AzCore/Math/Transform.h>");
+            m_dotH.WriteLine("#include <AzCore/Math/Vector2.h>");
+            m_dotH.WriteLine("#include <AzCore/Math/Vector3.h>");
+            m_dotH.WriteLine("#include <AzCore/Math/Vector4.h>");
+            m_dotH.WriteLine("#include <AzCore/std/smart_ptr/unique_ptr.h>");
+            m_dotH.WriteLine("#include <AzCore/std/string/string.h>");
+            m_dotH.WriteLine("#include <limits>");
+
+            if (!m_model.GetEBusHandlings().empty())
+            {
+                m_dotH.WriteLine("#include <ScriptCanvas/Core/EBusHandler.h>");
+            }
 
+            m_dotH.WriteLine("#include <ScriptCanvas/Execution/NativeHostDefinitions.h>");
+            m_dotH.WriteNewLine();
         }
 
         void GraphToCPlusPlus::TranslateDependenciesDotCPP()
         {
-
+            m_dotCPP.WriteLine("#include <AzCore/Math/MathUtils.h>");
+            m_dotCPP.WriteLine("#include <ScriptCanvas/Execution/Native/ExecutionNativeAPI.h>");
+            m_dotCPP.WriteNewLine();
         }
 
-        void GraphToCPlusPlus::TranslateDestruction()
-        {
-
-        }
-                
-        void GraphToCPlusPlus::TranslateHandlers()
+        void GraphToCPlusPlus::TranslateEBusHandlerEvent(Grammar::EBusHandlingConstPtr ebusHandling, AZStd::string_view eventName, Grammar::ExecutionTreeConstPtr eventThread)
         {
+            m_dotCPP.WriteLineIndented("void %s::%s([[maybe_unused]] AZ::BehaviorValueParameter* arguments)"
+                , GetGraphName().data(), GetEBusEventFunctionName(ebusHandling, eventName).c_str());
+            OpenScope(m_dotCPP);
+            {
+                WriteEBusHandlerEventArguments(ebusHandling, eventName, eventThread);
+                WriteOutputAssignments(eventThread);
+                WriteLocalVariableInitialization(eventThread);
 
+                if (eventThread->GetChildrenCount() > 0 && eventThread->GetChild(0).m_execution)
+                {
+                    TranslateExecutionTreeEntry(eventThread->GetChild(0).m_execution);
+                }
+            }
+            CloseScope(m_dotCPP);
         }
 
-        void GraphToCPlusPlus::TranslateNamespaceOpen()
+        void GraphToCPlusPlus::TranslateEBusHandlerEvents()
         {
-            OpenNamespace(m_dotH, "ScriptCanvas");
-            OpenNamespace(m_dotH, GetAutoNativeNamespace());
-            OpenNamespace(m_dotCPP, "ScriptCanvas");
-            OpenNamespace(m_dotCPP, GetAutoNativeNamespace());
+            for (auto& ebusHandling : m_model.GetEBusHandlings())
+            {
+                for (auto& nameAndEventThread : ebusHandling->m_events)
+                {
+                    m_dotCPP.WriteNewLine();
+                    TranslateEBusHandlerEvent(ebusHandling, nameAndEventThread.first, nameAndEventThread.second);
+                }
+            }
         }
 
-        void GraphToCPlusPlus::TranslateNamespaceClose()
+        void GraphToCPlusPlus::TranslateExecutionTreeChildPost(Grammar::ExecutionTreeConstPtr execution, size_t index)
         {
-            CloseNamespace(m_dotH, "ScriptCanvas");
-            CloseNamespace(m_dotH, GetAutoNativeNamespace());
-            CloseNamespace(m_dotCPP, "ScriptCanvas");
-            CloseNamespace(m_dotCPP, GetAutoNativeNamespace());
+            switch (execution->GetSymbol())
+            {
+            case Grammar::Symbol::While:
+                if (index == 0)
+                {
+                    CloseScope(m_dotCPP);
+                }
+                break;
+
+            default:
+                break;
+            }
         }
 
-        void GraphToCPlusPlus::TranslateStartNode()
+        void GraphToCPlusPlus::TranslateExecutionTreeChildPre(Grammar::ExecutionTreeConstPtr execution, size_t index)
         {
-            // write a start function
-            const Node* startNode = nullptr;
-            
-            if (startNode)
+            switch (execution->GetSymbol())
             {
-                { // .h
-                    m_dotH.WriteIndent();
-                    m_dotH.WriteLine("public: static void %s(const RuntimeContext& context);", Grammar::k_OnGraphStartFunctionName);
+            case Grammar::Symbol::IfCondition:
+                if (index != 0)
+                {
+                    CloseScope(m_dotCPP);
+                    m_dotCPP.WriteLineIndented("else");
+                    OpenScope(m_dotCPP);
                 }
-                
-                { // .cpp
-                    m_dotCPP.WriteIndent();
-                    m_dotCPP.WriteLine("void %s::%s(const RuntimeContext& context)", GetGraphName().data(), Grammar::k_OnGraphStartFunctionName);
+                break;
+
+            case Grammar::Symbol::While:
+                if (index == 0)
+                {
+                    m_dotCPP.WriteIndented("while (");
+                    WriteFunctionCallInput(execution, 0);
+                    m_dotCPP.WriteLine(")");
                     OpenScope(m_dotCPP);
-                    {
-                        m_dotCPP.WriteIndent();
-                        m_dotCPP.WriteLine("AZ_TracePrintf(\"ScriptCanvas\", \"This call wasn't generated from parsing a print node!\");");
-                        m_dotCPP.WriteLine("LogNotificationBus::Event(context.GetGraphId(), &LogNotifications::LogMessage, \"This call wasn't generated from parsing a print node!\");");
-                        // get the related function call and call it
-                        // with possible appropriate variables
-                    }
-                    CloseScope(m_dotCPP);
                 }
+                break;
+
+            default:
+                break;
             }
         }
 
-        void GraphToCPlusPlus::TranslateVariables()
+        void GraphToCPlusPlus::TranslateExecutionTreeEntry(Grammar::ExecutionTreeConstPtr execution)
         {
-
+            TranslateExecutionTreeEntryPre(execution);
+            TranslateExecutionTreeEntryRecurse(execution);
+            TranslateExecutionTreeEntryPost(execution);
         }
 
-        void GraphToCPlusPlus::WriteHeader()
+        void GraphToCPlusPlus::TranslateExecutionTreeEntryPost(Grammar::ExecutionTreeConstPtr execution)
         {
-            WriteHeaderDotH();
-            WriteHeaderDotCPP();
-        }
+            switch (execution->GetSymbol())
+            {
+            case Grammar::Symbol::IfCondition:
+                CloseScope(m_dotCPP);
+                break;
+
+            default:
+                break;
+            }
+        }
+
+        void GraphToCPlusPlus::TranslateExecutionTreeEntryPre(Grammar::ExecutionTreeConstPtr execution)
+        {
+            switch (execution->GetSymbol())
+            {
+            case Grammar::Symbol::IfCondition:
+                m_dotCPP.WriteIndented("if (");
+                WriteFunctionCallInput(execution, 0);
+                m_dotCPP.WriteLine(")");
+                OpenScope(m_dotCPP);
+                break;
+
+            default:
+                break;
+            }
+        }
+
+        void GraphToCPlusPlus::TranslateExecutionTreeEntryRecurse(Grammar::ExecutionTreeConstPtr execution)
+        {
+            using namespace GraphToCPlusPlusCpp;
+
+            switch (execution->GetSymbol())
+            {
+            case Grammar::Symbol::Break:
+                m_dotCPP.WriteLineIndented("break;");
+                break;
+
+            case Grammar::Symbol::CompareEqual:
+            case Grammar::Symbol::CompareGreater:
+            case Grammar::Symbol::CompareGreaterEqual:
+            case Grammar::Symbol::CompareLess:
+            case Grammar::Symbol::CompareLessEqual:
+            case Grammar::Symbol::CompareNotEqual:
+            case Grammar::Symbol::LogicalAND:
+            case Grammar::Symbol::LogicalNOT:
+            case Grammar::Symbol::LogicalOR:
+            case Grammar::Symbol::FunctionCall:
+            case Grammar::Symbol::OperatorAddition:
+            case Grammar::Symbol::OperatorDivision:
+            case Grammar::Symbol::OperatorMultiplication:
+            case Grammar::Symbol::OperatorSubraction:
+            case Grammar::Symbol::VariableAssignment:
+                TranslateExecutionTreeFunctionCall(execution);
+                break;
+
+            case Grammar::Symbol::VariableDeclaration:
+            {
+                auto variable = execution->GetInput(0).m_value;
+                m_dotCPP.WriteIndent();
+                if (WriteVariableDeclaration(m_dotCPP, execution, variable))
+                {
+                    m_dotCPP.WriteLine(" = %s;", ToValueString(execution, variable->m_datum).c_str());
+                }
+                break;
+            }
+
+            case Grammar::Symbol::Cycle:
+            case Grammar::Symbol::ForEach:
+            case Grammar::Symbol::IsNull:
+            case Grammar::Symbol::RandomSwitch:
+            case Grammar::Symbol::Switch:
+            case Grammar::Symbol::UserOut:
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId()
+                    , AZStd::string::format(k_unsupportedFeature, Grammar::GetSymbolName(execution->GetSymbol()))));
+                break;
+
+            default:
+                break;
+            }
+
+            for (size_t childIndex = 0; childIndex < execution->GetChildrenCount(); ++childIndex)
+            {
+                const auto& child = execution->GetChild(childIndex);
+
+                if (child.m_execution && !child.m_execution->IsInternalOut())
+                {
+                    TranslateExecutionTreeChildPre(execution, childIndex);
+                    TranslateExecutionTreeEntry(child.m_execution);
+                    TranslateExecutionTreeChildPost(execution, childIndex);
+                }
+            }
+        }
+
+        void GraphToCPlusPlus::TranslateExecutionTreeFunctionCall(Grammar::ExecutionTreeConstPtr execution)
+        {
+            using namespace GraphToCPlusPlusCpp;
+
+            const char* unsupported = nullptr;
+
+            if (execution->GetNodeable())
+            {
+                unsupported = "nodeables";
+            }
+            else if (Grammar::IsUserFunctionCall(execution))
+            {
+                unsupported = "function or subgraph calls";
+            }
+            else if (Grammar::IsWrittenMathExpression(execution))
+            {
+                unsupported = "math expressions";
+            }
+            else if (Grammar::IsExecutedPropertyExtraction(execution)
+                || Grammar::IsGlobalPropertyRead(execution)
+                || Grammar::IsClassPropertyRead(execution)
+                || Grammar::IsClassPropertyWrite(execution))
+            {
+                unsupported = "property access";
+            }
+            else if (Grammar::IsEventConnectCall(execution) || Grammar::IsEventDisconnectCall(execution))
+            {
+                unsupported = "event connection";
+            }
+            else if (Grammar::IsFunctionCallNullCheckRequired(execution))
+            {
+                unsupported = "calls on objects that may be null";
+            }
+            else if (!execution->GetConversions().empty())
+            {
+                unsupported = "input conversions";
+            }
+
+            if (unsupported)
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), AZStd::string::format(k_unsupportedFeature, unsupported)));
+                return;
+            }
+
+            const bool isWrittenOutputPossible = execution->GetChildrenCount() == 1;
+            const bool isMethodCall = !Grammar::IsLogicalExpression(execution)
+                && !Grammar::IsVariableGet(execution)
+                && !Grammar::IsVariableSet(execution)
+                && execution->GetSymbol() != Grammar::Symbol::VariableAssignment
+                && !Grammar::IsOperatorArithmetic(execution);
+
+            // the method is looked up once, the first time the statement executes
+            const MethodCall methodCall = isMethodCall ? WriteFunctionCallLookup(execution) : MethodCall();
+
+            m_dotCPP.WriteIndent();
+
+            if (isWrittenOutputPossible)
+            {
+                WriteVariableWrite(execution, execution->GetChild(0).m_output);
+            }
+
+            if (Grammar::IsLogicalExpression(execution))
+            {
+                WriteLogicalExpression(execution);
+            }
+            else if (Grammar::IsVariableGet(execution))
+            {
+                WriteVariableReference(execution->GetInput(0).m_value);
+            }
+            else if (Grammar::IsVariableSet(execution) || execution->GetSymbol() == Grammar::Symbol::VariableAssignment)
+            {
+                WriteFunctionCallInput(execution, 0);
+            }
+            else if (Grammar::IsOperatorArithmetic(execution))
+            {
+                WriteOperatorArithmetic(execution);
+            }
+            else if (methodCall.m_method)
+            {
+                WriteFunctionCallOfNode(execution, methodCall);
+            }
+
+            m_dotCPP.WriteLine(";");
+
+            WriteOutputAssignments(execution);
+        }
+
+        void GraphToCPlusPlus::TranslateNamespaceOpen()
+        {
+            OpenNamespace(m_dotH, "ScriptCanvas");
+            OpenNamespace(m_dotH, GetAutoNativeNamespace());
+            OpenNamespace(m_dotCPP, "ScriptCanvas");
+            OpenNamespace(m_dotCPP, GetAutoNativeNamespace());
+        }
+
+        void GraphToCPlusPlus::TranslateNamespaceClose()
+        {
+            CloseNamespace(m_dotH, GetAutoNativeNamespace());
+            CloseNamespace(m_dotH, "ScriptCanvas");
+            CloseNamespace(m_dotCPP, GetAutoNativeNamespace());
+            CloseNamespace(m_dotCPP, "ScriptCanvas");
+        }
+
+        void GraphToCPlusPlus::TranslateRegistration()
+        {
+            // the registrar is named after the graph so that generated files can share a unity build
+            m_dotCPP.WriteNewLine();
+            m_dotCPP.WriteLine("namespace");
+            m_dotCPP.WriteLine("{");
+            m_dotCPP.Indent();
+            m_dotCPP.WriteLineIndented("const ScriptCanvas::NativeGraphRegistrar s_%sRegistrar(%s, &ScriptCanvas::%s::%s::Create);"
+                , GetGraphName().data()
+                , GraphToCPlusPlusCpp::ToStringLiteral(GetGraphName()).c_str()
+                , GetAutoNativeNamespace().data()
+                , GetGraphName().data());
+            m_dotCPP.Outdent();
+            m_dotCPP.WriteLine("}");
+        }
+
+        void GraphToCPlusPlus::TranslateStartNode()
+        {
+            auto start = m_model.GetStart();
+
+            if (!start)
+            {
+                return;
+            }
+
+            m_dotCPP.WriteNewLine();
+            m_dotCPP.WriteLineIndented("void %s::Start()", GetGraphName().data());
+            OpenScope(m_dotCPP);
+            {
+                WriteOutputAssignments(start);
+                WriteLocalVariableInitialization(start);
+
+                if (start->GetChildrenCount() > 0 && start->GetChild(0).m_execution)
+                {
+                    TranslateExecutionTreeEntry(start->GetChild(0).m_execution);
+                }
+            }
+            CloseScope(m_dotCPP);
+        }
+
+        void GraphToCPlusPlus::TranslateVariables()
+        {
+            for (auto& variable : m_model.GetVariables())
+            {
+                if (variable->m_isMember)
+                {
+                    m_dotH.WriteIndent();
+                    if (WriteVariableDeclaration(m_dotH, nullptr, variable))
+                    {
+                        // inputs are initialized by the constructor
+                        if (IsConstructionInput(variable))
+                        {
+                            m_dotH.WriteLine(";");
+                        }
+                        else
+                        {
+                            m_dotH.WriteLine(" = %s;", ToValueString(nullptr, variable->m_datum).c_str());
+                        }
+                    }
+                }
+            }
+
+            for (auto& variable : m_constructionInputs)
+            {
+                if (!variable->m_isMember)
+                {
+                    if (const char* typeName = GetNativeTypeName(nullptr, variable))
+                    {
+                        m_dotH.WriteLineIndented("%s %s;", typeName, GetConstructionInputName(variable).c_str());
+                    }
+                }
+            }
+        }
+
+        AZStd::string GraphToCPlusPlus::ToValueString(Grammar::ExecutionTreeConstPtr execution, const Datum& datum)
+        {
+            using namespace GraphToCPlusPlusCpp;
+
+            switch (datum.GetType().GetType())
+            {
+            case Data::eType::AABB:
+            {
+                const Data::AABBType& value = *datum.GetAs<Data::AABBType>();
+                return AZStd::string::format("AZ::Aabb::CreateFromMinMax(%s, %s)", ToVector3Literal(value.GetMin()).c_str(), ToVector3Literal(value.GetMax()).c_str());
+            }
+
+            case Data::eType::Boolean:
+                return *datum.GetAs<Data::BooleanType>() ? "true" : "false";
+
+            case Data::eType::Color:
+            {
+                const Data::ColorType& value = *datum.GetAs<Data::ColorType>();
+                return AZStd::string::format("AZ::Color(%s, %s, %s, %s)"
+                    , ToFloatLiteral(value.GetR()).c_str(), ToFloatLiteral(value.GetG()).c_str(), ToFloatLiteral(value.GetB()).c_str(), ToFloatLiteral(value.GetA()).c_str());
+            }
+
+            case Data::eType::CRC:
+                return AZStd::string::format("AZ::Crc32(%uu)", static_cast<AZ::u32>(*datum.GetAs<Data::CRCType>()));
+
+            case Data::eType::EntityID:
+            {
+                const Data::EntityIDType& value = *datum.GetAs<Data::EntityIDType>();
+
+                if (value == GraphOwnerId || value == UniqueId)
+                {
+                    return EntityIdValueToString(value, m_configuration);
+                }
+
+                return AZStd::string::format("AZ::EntityId(%sull)", EntityIdToU64String(value).c_str());
+            }
+
+            case Data::eType::Matrix3x3:
+            {
+                Data::Vector3Type r0, r1, r2;
+                datum.GetAs<Data::Matrix3x3Type>()->GetRows(&r0, &r1, &r2);
+                return AZStd::string::format("AZ::Matrix3x3::CreateFromRows(%s, %s, %s)"
+                    , ToVector3Literal(r0).c_str(), ToVector3Literal(r1).c_str(), ToVector3Literal(r2).c_str());
+            }
+
+            case Data::eType::Matrix4x4:
+            {
+                Data::Vector4Type r0, r1, r2, r3;
+                datum.GetAs<Data::Matrix4x4Type>()->GetRows(&r0, &r1, &r2, &r3);
+                return AZStd::string::format("AZ::Matrix4x4::CreateFromRows(%s, %s, %s, %s)"
+                    , ToVector4Literal(r0).c_str(), ToVector4Literal(r1).c_str(), ToVector4Literal(r2).c_str(), ToVector4Literal(r3).c_str());
+            }
+
+            case Data::eType::Number:
+                return ToDoubleLiteral(*datum.GetAs<Data::NumberType>());
+
+            case Data::eType::Quaternion:
+                return ToQuaternionLiteral(*datum.GetAs<Data::QuaternionType>());
+
+            case Data::eType::String:
+                return AZStd::string::format("AZStd::string(%s)", ToStringLiteral(*datum.GetAs<Data::StringType>()).c_str());
+
+            case Data::eType::Transform:
+            {
+                const Data::TransformType& value = *datum.GetAs<Data::TransformType>();
+                return AZStd::string::format("AZ::Transform(%s, %s, %s)"
+                    , ToVector3Literal(value.GetTranslation()).c_str(), ToQuaternionLiteral(value.GetRotation()).c_str(), ToFloatLiteral(value.GetUniformScale()).c_str());
+            }
+
+            case Data::eType::Vector2:
+            {
+                const Data::Vector2Type& value = *datum.GetAs<Data::Vector2Type>();
+                return AZStd::string::format("AZ::Vector2(%s, %s)", ToFloatLiteral(value.GetX()).c_str(), ToFloatLiteral(value.GetY()).c_str());
+            }
+
+            case Data::eType::Vector3:
+                return ToVector3Literal(*datum.GetAs<Data::Vector3Type>());
+
+            case Data::eType::Vector4:
+                return ToVector4Literal(*datum.GetAs<Data::Vector4Type>());
+
+            default:
+                AddError(execution, aznew Internal::ParseError(execution ? execution->GetNodeId() : AZ::EntityId()
+                    , AZStd::string::format(k_unsupportedFeature, AZStd::string::format("values of type %s", Data::GetName(datum.GetType()).c_str()).c_str())));
+                return "";
+            }
+        }
+
+        void GraphToCPlusPlus::WriteEBusHandlerEventArguments(Grammar::EBusHandlingConstPtr ebusHandling, AZStd::string_view eventName, Grammar::ExecutionTreeConstPtr eventThread)
+        {
+            using namespace GraphToCPlusPlusCpp;
+
+            if (eventThread->GetChildrenCount() == 0 || eventThread->GetChild(0).m_output.empty())
+            {
+                return;
+            }
+
+            const auto& output = eventThread->GetChild(0).m_output;
+            AZStd::vector<AZ::BehaviorParameter> arguments;
+
+            if (!Execution::GetNativeEBusHandlerEventArguments(*m_behaviorContext, ebusHandling->m_ebusName, eventName, arguments) || arguments.size() < output.size())
+            {
+                AddError(eventThread, aznew Internal::ParseError(eventThread->GetNodeId()
+                    , AZStd::string::format(k_unsupportedFeature, AZStd::string::format("the arguments of %s.%.*s", ebusHandling->m_ebusName.c_str(), aznumeric_cast<int>(eventName.size()), eventName.data()).c_str())));
+                return;
+            }
+
+            for (size_t index = 0; index < output.size(); ++index)
+            {
+                Grammar::VariableConstPtr parameter = output[index].second->m_source;
+                const AZ::BehaviorParameter& argument = arguments[index];
+                const NativeType* argumentType = (argument.m_traits & AZ::BehaviorParameter::TR_POINTER) ? nullptr : FindNativeType(argument.m_typeId);
+                const Data::Type& parameterType = parameter->m_datum.GetType();
+
+                // arguments are unpacked only when the graph reads them, see WriteVariableReference()
+                if (argumentType && argument.m_typeId == parameterType.GetAZType())
+                {
+                    m_dotCPP.WriteLineIndented("[[maybe_unused]] %s %s = *arguments[%zu].GetAsUnsafe<%s>();"
+                        , argumentType->m_name, parameter->m_name.c_str(), index, argumentType->m_name);
+                }
+                else if (argumentType && argumentType->m_isNumber && parameterType == Data::Type::Number())
+                {
+                    // the graph stores every number as a double
+                    m_dotCPP.WriteLineIndented("[[maybe_unused]] double %s = static_cast<double>(*arguments[%zu].GetAsUnsafe<%s>());"
+                        , parameter->m_name.c_str(), index, argumentType->m_name);
+                }
+                else
+                {
+                    m_undeclaredVariables.insert(parameter);
+                }
+            }
+        }
+
+        void GraphToCPlusPlus::WriteFunctionCallArgument(Grammar::ExecutionTreeConstPtr execution, size_t index, const AZ::BehaviorParameter& argument)
+        {
+            using namespace GraphToCPlusPlusCpp;
+
+            const Data::Type& inputType = execution->GetInput(index).m_value->m_datum.GetType();
+            const NativeType* argumentType = FindNativeType(argument.m_typeId);
+            const bool isPointer = (argument.m_traits & AZ::BehaviorParameter::TR_POINTER) && !(argument.m_traits & AZ::BehaviorParameter::TR_THIS_PTR);
+
+            if (!isPointer && argument.m_typeId == inputType.GetAZType())
+            {
+                WriteFunctionCallInput(execution, index);
+            }
+            else if (!isPointer && argumentType && argumentType->m_isNumber && inputType == Data::Type::Number())
+            {
+                m_dotCPP.Write("static_cast<%s>(", argumentType->m_name);
+                WriteFunctionCallInput(execution, index);
+                m_dotCPP.Write(")");
+            }
+            else if (!isPointer && argument.m_typeId == azrtti_typeid<AZStd::string_view>() && inputType == Data::Type::String())
+            {
+                m_dotCPP.Write("AZStd::string_view(");
+                WriteFunctionCallInput(execution, index);
+                m_dotCPP.Write(")");
+            }
+            else
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId()
+                    , AZStd::string::format(k_unsupportedFeature, AZStd::string::format("passing %s to argument %zu of %s", Data::GetName(inputType).c_str(), index, execution->GetName().c_str()).c_str())));
+            }
+        }
+
+        void GraphToCPlusPlus::WriteFunctionCallInput(Grammar::ExecutionTreeConstPtr execution, size_t index)
+        {
+            auto& input = execution->GetInput(index).m_value;
+
+            if (IsInputNamed(input, execution) == IsNamed::No)
+            {
+                m_dotCPP.Write(ToValueString(execution, input->m_datum));
+            }
+            else
+            {
+                WriteVariableReference(input);
+            }
+        }
+
+        void GraphToCPlusPlus::WriteFunctionCallOfNode(Grammar::ExecutionTreeConstPtr execution, const MethodCall& methodCall)
+        {
+            using namespace GraphToCPlusPlusCpp;
+
+            const AZ::BehaviorMethod& method = *methodCall.m_method;
+            const size_t inputCount = execution->GetInputCount();
+
+            if (method.GetNumArguments() != inputCount)
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId()
+                    , AZStd::string::format(k_unsupportedFeature, AZStd::string::format("the input of %s", execution->GetName().c_str()).c_str())));
+                return;
+            }
+
+            const bool isResultUsed = execution->GetChildrenCount() == 1 && !execution->GetChild(0).m_output.empty();
+            bool isResultConverted = false;
+
+            if (isResultUsed)
+            {
+                const AZ::BehaviorParameter* result = method.HasResult() ? method.GetResult() : nullptr;
+                const NativeType* resultType = result && !(result->m_traits & AZ::BehaviorParameter::TR_POINTER) ? FindNativeType(result->m_typeId) : nullptr;
+                const Data::Type& outputType = execution->GetChild(0).m_output[0].second->m_source->m_datum.GetType();
+
+                if (!resultType)
+                {
+                    AddError(execution, aznew Internal::ParseError(execution->GetNodeId()
+                        , AZStd::string::format(k_unsupportedFeature, AZStd::string::format("the result of %s", execution->GetName().c_str()).c_str())));
+                    return;
+                }
+
+                // the graph stores every number as a double
+                isResultConverted = resultType->m_isNumber && outputType == Data::Type::Number() && result->m_typeId != outputType.GetAZType();
+
+                if (!isResultConverted && result->m_typeId != outputType.GetAZType())
+                {
+                    AddError(execution, aznew Internal::ParseError(execution->GetNodeId()
+                        , AZStd::string::format(k_unsupportedFeature, AZStd::string::format("assigning the result of %s to %s", execution->GetName().c_str(), Data::GetName(outputType).c_str()).c_str())));
+                    return;
+                }
+
+                if (isResultConverted)
+                {
+                    m_dotCPP.Write("static_cast<double>(");
+                }
+
+                m_dotCPP.Write("ScriptCanvas::Execution::CallNativeResult<%s>(%s", resultType->m_name, methodCall.m_variableName.c_str());
+            }
+            else
+            {
+                m_dotCPP.Write("ScriptCanvas::Execution::CallNative(%s", methodCall.m_variableName.c_str());
+            }
+
+            for (size_t index = 0; index < inputCount; ++index)
+            {
+                m_dotCPP.Write(", ");
+                WriteFunctionCallArgument(execution, index, *method.GetArgument(index));
+            }
+
+            m_dotCPP.Write(isResultConverted ? "))" : ")");
+        }
+
+        GraphToCPlusPlus::MethodCall GraphToCPlusPlus::WriteFunctionCallLookup(Grammar::ExecutionTreeConstPtr execution)
+        {
+            using namespace GraphToCPlusPlusCpp;
+
+            MethodCall methodCall;
+            const AZStd::string& name = execution->GetName();
+            const Grammar::LexicalScope& lexicalScope = execution->GetNameLexicalScope();
+            AZStd::string lookup;
+
+            if (lexicalScope.m_namespaces.size() > 1)
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), AZStd::string::format(k_unsupportedFeature, "nested namespaces")));
+                return methodCall;
+            }
+
+            const AZStd::string scopeName = lexicalScope.m_namespaces.empty() ? "" : lexicalScope.m_namespaces[0];
+
+            if (execution->GetEventType() != EventType::Count)
+            {
+                methodCall.m_method = Execution::FindNativeEBusEvent(*m_behaviorContext, scopeName, name, execution->GetEventType());
+                lookup = AZStd::string::format("ScriptCanvas::Execution::FindNativeEBusEvent(%s, %s, ScriptCanvas::EventType::%s)"
+                    , ToStringLiteral(scopeName).c_str(), ToStringLiteral(name).c_str(), GetEventTypeName(execution->GetEventType()));
+            }
+            else
+            {
+                AZStd::string className = scopeName;
+
+                if (lexicalScope.m_type == Grammar::LexicalScopeType::Variable && execution->GetInputCount() > 0)
+                {
+                    // member functions are called on the first input, which determines the class
+                    auto classIter = m_behaviorContext->m_typeToClassMap.find(execution->GetInput(0).m_value->m_datum.GetType().GetAZType());
+                    className = classIter != m_behaviorContext->m_typeToClassMap.end() && classIter->second ? classIter->second->m_name : "";
+                }
+
+                methodCall.m_method = Execution::FindNativeMethod(*m_behaviorContext, className, name);
+                lookup = AZStd::string::format("ScriptCanvas::Execution::FindNativeMethod(%s, %s)", ToStringLiteral(className).c_str(), ToStringLiteral(name).c_str());
+            }
+
+            if (!methodCall.m_method || methodCall.m_method->m_overload)
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId()
+                    , AZStd::string::format(k_unsupportedFeature, AZStd::string::format("%s, it is overloaded or not reflected to the BehaviorContext", name.c_str()).c_str())));
+                methodCall.m_method = nullptr;
+                return methodCall;
+            }
+
+            methodCall.m_variableName = AZStd::string::format("s_method%zu", m_methodCount++);
+            m_dotCPP.WriteLineIndented("static const AZ::BehaviorMethod* const %s = %s;", methodCall.m_variableName.c_str(), lookup.c_str());
+            return methodCall;
+        }
 
         void GraphToCPlusPlus::WriteHeaderDotCPP()
         {
@@ -181,7 +1252,7 @@ namespace ScriptCanvas
             m_dotCPP.WriteNewLine();
             WriteDoNotModify(m_dotCPP);
             m_dotCPP.WriteNewLine();
-            m_dotCPP.WriteLine("#include \"%s.h\"", GetGraphName().data());
+            m_dotCPP.WriteLine("#include \"%s\"", GetNativeFileName(m_model.GetSource(), "h").c_str());
             m_dotCPP.WriteNewLine();
         }
 
@@ -193,9 +1264,219 @@ namespace ScriptCanvas
             m_dotH.WriteNewLine();
             WriteDoNotModify(m_dotH);
             m_dotH.WriteNewLine();
-            m_dotH.WriteLine("#include <Execution/NativeHostDeclarations.h>");
-            m_dotH.WriteNewLine();
         }
 
-    } 
-} 
+        void GraphToCPlusPlus::WriteLocalVariableInitialization(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (const auto& localDeclaredVariables = m_model.GetLocalVariables(execution))
+            {
+                for (const auto& variable : *localDeclaredVariables)
+                {
+                    m_dotCPP.WriteIndent();
+                    if (WriteVariableDeclaration(m_dotCPP, execution, variable))
+                    {
+                        // values that the runtime supplies per component were read when the graph was constructed
+                        if (IsConstructionInput(variable))
+                        {
+                            m_dotCPP.WriteLine(" = %s;", GetConstructionInputName(variable).c_str());
+                        }
+                        else
+                        {
+                            m_dotCPP.WriteLine(" = %s;", ToValueString(execution, variable->m_datum).c_str());
+                        }
+                    }
+                }
+            }
+        }
+
+        void GraphToCPlusPlus::WriteLogicalExpression(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (execution->GetSymbol() == Grammar::Symbol::LogicalNOT)
+            {
+                m_dotCPP.Write("!");
+                WriteFunctionCallInput(execution, 0);
+            }
+            else if (Grammar::IsFloatingPointNumberEqualityComparison(execution))
+            {
+                // matches the tolerance used by the Lua translation
+                m_dotCPP.Write(execution->GetSymbol() == Grammar::Symbol::CompareEqual ? "AZ::IsClose(" : "!AZ::IsClose(");
+                WriteFunctionCallInput(execution, 0);
+                m_dotCPP.Write(", ");
+                WriteFunctionCallInput(execution, 1);
+                m_dotCPP.Write(", %s)", Grammar::k_LuaEpsilonString);
+            }
+            else
+            {
+                WriteFunctionCallInput(execution, 0);
+
+                switch (execution->GetSymbol())
+                {
+                case Grammar::Symbol::CompareEqual:
+                    m_dotCPP.Write(" == ");
+                    break;
+                case Grammar::Symbol::CompareGreater:
+                    m_dotCPP.Write(" > ");
+                    break;
+                case Grammar::Symbol::CompareGreaterEqual:
+                    m_dotCPP.Write(" >= ");
+                    break;
+                case Grammar::Symbol::CompareLess:
+                    m_dotCPP.Write(" < ");
+                    break;
+                case Grammar::Symbol::CompareLessEqual:
+                    m_dotCPP.Write(" <= ");
+                    break;
+                case Grammar::Symbol::CompareNotEqual:
+                    m_dotCPP.Write(" != ");
+                    break;
+                case Grammar::Symbol::LogicalAND:
+                    m_dotCPP.Write(" && ");
+                    break;
+                case Grammar::Symbol::LogicalOR:
+                    m_dotCPP.Write(" || ");
+                    break;
+                default:
+                    break;
+                }
+
+                WriteFunctionCallInput(execution, 1);
+            }
+        }
+
+        void GraphToCPlusPlus::WriteOperatorArithmetic(Grammar::ExecutionTreeConstPtr execution)
+        {
+            const auto count = execution->GetInputCount();
+
+            if (count < 2)
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NotEnoughInputForArithmeticOperator));
+                return;
+            }
+
+            const AZStd::string_view operatorString = GetOperatorString(execution);
+
+            // the math types only operate on floats, so numbers mixed with them are narrowed explicitly
+            bool isMixed = false;
+            for (size_t i(0); i < count; ++i)
+            {
+                isMixed = isMixed || execution->GetInput(i).m_value->m_datum.GetType() != Data::Type::Number();
+            }
+
+            auto writeOperand = [&](size_t index)
+            {
+                const bool isNarrowed = isMixed && execution->GetInput(index).m_value->m_datum.GetType() == Data::Type::Number();
+                m_dotCPP.Write(isNarrowed ? "static_cast<float>(" : "");
+                WriteFunctionCallInput(execution, index);
+                m_dotCPP.Write(isNarrowed ? ")" : "");
+            };
+
+            for (size_t i(0); i < (count - 1); ++i)
+            {
+                m_dotCPP.Write("(");
+            }
+
+            // write operand 0 + operand 1
+            writeOperand(0);
+            m_dotCPP.Write(operatorString);
+            writeOperand(1);
+            m_dotCPP.Write(")");
+
+            for (size_t i(2); i < count; ++i)
+            {
+                m_dotCPP.Write(operatorString);
+                writeOperand(i);
+                m_dotCPP.Write(")");
+            }
+        }
+
+        void GraphToCPlusPlus::WriteOutputAssignments(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (const auto output = execution->GetLocalOutput())
+            {
+                for (auto outputIter : *output)
+                {
+                    if (!outputIter.second->m_sourceConversions.empty())
+                    {
+                        AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), AZStd::string::format(GraphToCPlusPlusCpp::k_unsupportedFeature, "output conversions")));
+                        continue;
+                    }
+
+                    for (auto& assignment : outputIter.second->m_assignments)
+                    {
+                        m_dotCPP.WriteIndent();
+                        WriteVariableReference(assignment);
+                        m_dotCPP.Write(" = ");
+                        WriteVariableReference(outputIter.second->m_source);
+                        m_dotCPP.WriteLine(";");
+                    }
+                }
+            }
+        }
+
+        bool GraphToCPlusPlus::WriteVariableDeclaration(Writer& writer, Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr variable)
+        {
+            const char* typeName = GetNativeTypeName(execution, variable);
+
+            if (!typeName)
+            {
+                return false;
+            }
+
+            writer.Write("%s %s%s", typeName, variable->m_isMember ? "m_" : "", variable->m_name.c_str());
+            return true;
+        }
+
+        void GraphToCPlusPlus::WriteVariableReference(Grammar::VariableConstPtr variable)
+        {
+            AZ_Assert(variable, "non valid variable");
+
+            if (m_undeclaredVariables.find(variable) != m_undeclaredVariables.end())
+            {
+                AddError(variable->m_source, aznew Internal::ParseError(variable->m_source ? variable->m_source->GetNodeId() : AZ::EntityId()
+                    , AZStd::string::format(GraphToCPlusPlusCpp::k_unsupportedFeature, AZStd::string::format("reading the argument %s", variable->m_name.c_str()).c_str())));
+            }
+
+            if (variable->m_isMember)
+            {
+                m_dotCPP.Write("m_");
+            }
+
+            m_dotCPP.Write(variable->m_name.data());
+        }
+
+        void GraphToCPlusPlus::WriteVariableWrite(Grammar::ExecutionTreeConstPtr execution, const AZStd::vector<AZStd::pair<const Slot*, Grammar::OutputAssignmentConstPtr>>& output)
+        {
+            if (!output.empty())
+            {
+                if (output.size() > 1)
+                {
+                    AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), AZStd::string::format(GraphToCPlusPlusCpp::k_unsupportedFeature, "multiple return values")));
+                    return;
+                }
+
+                auto firstOutput = output[0].second;
+
+                if (firstOutput->m_source->m_source == execution)
+                {
+                    AZ_Assert(!firstOutput->m_source->m_isMember, "this should never be true");
+
+                    // results that nothing reads are still declared, keep them from failing builds that treat warnings as errors
+                    if (firstOutput->m_source->m_isUnused)
+                    {
+                        m_dotCPP.Write("[[maybe_unused]] ");
+                    }
+
+                    if (WriteVariableDeclaration(m_dotCPP, execution, firstOutput->m_source))
+                    {
+                        m_dotCPP.Write(" = ");
+                    }
+                }
+                else
+                {
+                    WriteVariableReference(firstOutput->m_source);
+                    m_dotCPP.Write(" = ");
+                }
+            }
+        }
+    }
+}
@@ -9,10 +9,19 @@
 #pragma once
 
 #include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/containers/unordered_set.h>
 
+#include "TranslationResult.h"
 #include "TranslationUtilities.h"
 #include "GraphToX.h"
 
+namespace AZ
+{
+    class BehaviorContext;
+    class BehaviorMethod;
+    struct BehaviorParameter;
+}
+
 namespace ScriptCanvas
 {
     class Graph;
@@ -24,37 +33,81 @@ namespace ScriptCanvas
 
     namespace Translation
     {
+        // Translates a graph to a C++ NativeGraph that calls BehaviorContext methods directly. Graphs that start from
+        // On Graph Start or handle EBus events, and use plain function calls, operators, variables, and if/while/sequence
+        // flow control are supported, anything else is reported as an error and the graph keeps executing its Lua translation.
+        // Variables that the runtime supplies per component are read from the RuntimeContext when the graph is constructed.
         class GraphToCPlusPlus
             : public GraphToX
         {
         public:
-            static AZ::Outcome<void, AZStd::pair<AZStd::string, AZStd::string>> Translate(const Grammar::AbstractCodeModel& model, AZStd::string& dotH, AZStd::string& dotCPP);
-            
-            AZ_INLINE bool IsSuccessfull() const { return false;  }
-        private:         
+            static AZ::Outcome<void, ErrorList> Translate(const Grammar::AbstractCodeModel& model, AZStd::string& dotH, AZStd::string& dotCPP);
+
+        private:
+            enum class IsNamed { No, Yes };
+
+            struct MethodCall
+            {
+                const AZ::BehaviorMethod* m_method = nullptr;
+                AZStd::string m_variableName;
+            };
+
             // cpp only
+            const AZ::BehaviorContext* m_behaviorContext = nullptr;
+            size_t m_methodCount = 0;
+            // in the order of the inputs of the RuntimeContext
+            AZStd::vector<Grammar::VariableConstPtr> m_constructionInputs;
+            // handled event arguments that can't be unpacked, any use of them is an error
+            AZStd::unordered_set<Grammar::VariableConstPtr> m_undeclaredVariables;
             Writer m_dotH;
             Writer m_dotCPP;
-            
+
+            static IsNamed IsInputNamed(Grammar::VariableConstPtr input, Grammar::ExecutionTreeConstPtr execution);
+
             GraphToCPlusPlus(const Grammar::AbstractCodeModel& model);
 
+            void CheckSupport();
+            AZStd::string GetConstructionInputName(Grammar::VariableConstPtr variable) const;
+            AZStd::string GetEBusEventFunctionName(Grammar::EBusHandlingConstPtr ebusHandling, AZStd::string_view eventName) const;
+            const char* GetNativeTypeName(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr variable);
+            AZStd::string_view GetOperatorString(Grammar::ExecutionTreeConstPtr execution);
+            bool IsConstructionInput(Grammar::VariableConstPtr variable) const;
+            void TranslateActivation();
             void TranslateClassClose();
             void TranslateClassOpen();
             void TranslateConstruction();
-            void TranslateDependencies();
             void TranslateDependenciesDotH();
             void TranslateDependenciesDotCPP();
-            void TranslateDestruction();
-            void TranslateFunctions();
-            void TranslateHandlers();
+            void TranslateEBusHandlerEvent(Grammar::EBusHandlingConstPtr ebusHandling, AZStd::string_view eventName, Grammar::ExecutionTreeConstPtr eventThread);
+            void TranslateEBusHandlerEvents();
+            void TranslateExecutionTreeChildPost(Grammar::ExecutionTreeConstPtr execution, size_t index);
+            void TranslateExecutionTreeChildPre(Grammar::ExecutionTreeConstPtr execution, size_t index);
+            void TranslateExecutionTreeEntry(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeEntryPost(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeEntryPre(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeEntryRecurse(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeFunctionCall(Grammar::ExecutionTreeConstPtr execution);
             void TranslateNamespaceOpen();
             void TranslateNamespaceClose();
+            void TranslateRegistration();
             void TranslateStartNode();
             void TranslateVariables();
-            void WriteHeader(); // Write, not translate, because this should be less dependent on the contents of the graph
+            AZStd::string ToValueString(Grammar::ExecutionTreeConstPtr execution, const Datum& datum);
+            void WriteFunctionCallArgument(Grammar::ExecutionTreeConstPtr execution, size_t index, const AZ::BehaviorParameter& argument);
+            void WriteFunctionCallInput(Grammar::ExecutionTreeConstPtr execution, size_t index);
+            void WriteEBusHandlerEventArguments(Grammar::EBusHandlingConstPtr ebusHandling, AZStd::string_view eventName, Grammar::ExecutionTreeConstPtr eventThread);
+            void WriteFunctionCallOfNode(Grammar::ExecutionTreeConstPtr execution, const MethodCall& methodCall);
+            MethodCall WriteFunctionCallLookup(Grammar::ExecutionTreeConstPtr execution);
             void WriteHeaderDotH(); // Write, not translate, because this should be less dependent on the contents of the graph
             void WriteHeaderDotCPP(); // Write, not translate, because this should be less dependent on the contents of the graph
+            void WriteLocalVariableInitialization(Grammar::ExecutionTreeConstPtr execution);
+            void WriteLogicalExpression(Grammar::ExecutionTreeConstPtr execution);
+            void WriteOperatorArithmetic(Grammar::ExecutionTreeConstPtr execution);
+            void WriteOutputAssignments(Grammar::ExecutionTreeConstPtr execution);
+            bool WriteVariableDeclaration(Writer& writer, Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr variable);
+            void WriteVariableReference(Grammar::VariableConstPtr variable);
+            void WriteVariableWrite(Grammar::ExecutionTreeConstPtr execution, const AZStd::vector<AZStd::pair<const Slot*, Grammar::OutputAssignmentConstPtr>>& output);
         };
-    } 
+    }
 
 }
@@ -131,6 +131,7 @@ namespace ScriptCanvas
             writer.WriteSpace();
             writer.Write(ns);
             writer.WriteNewLine();
+            writer.WriteIndent();
             writer.Write(m_configuration.m_namespaceOpen);
             writer.WriteNewLine();
             writer.Indent();
@@ -27,8 +27,7 @@ namespace TranslationCPP
     using namespace ScriptCanvas;
     using namespace ScriptCanvas::Translation;
 
-    /*
-    AZ::Outcome<AZStd::pair<AZStd::string, AZStd::string>, AZStd::pair<AZStd::string, AZStd::string>> ToCPlusPlus(const Grammar::AbstractCodeModel& model, bool rawSave = false)
+    AZ::Outcome<AZStd::pair<TargetResult, TargetResult>, ErrorList> ToCPlusPlus(const Grammar::AbstractCodeModel& model, bool rawSave = false)
     {
         AZStd::string dotH, dotCPP;
         auto outcome = GraphToCPlusPlus::Translate(model, dotH, dotCPP);
@@ -53,14 +52,18 @@ namespace TranslationCPP
                     AZ_TracePrintf("Save failed %s", saveOutcome.GetError().data());
                 }
             }
-            return AZ::Success(AZStd::make_pair(AZStd::move(dotH), AZStd::move(dotCPP)));
+
+            TargetResult hppResult;
+            hppResult.m_text = AZStd::move(dotH);
+            TargetResult cppResult;
+            cppResult.m_text = AZStd::move(dotCPP);
+            return AZ::Success(AZStd::make_pair(AZStd::move(hppResult), AZStd::move(cppResult)));
         }
         else
         {
             return AZ::Failure(outcome.TakeError());
         }
     }
-    */
 
     AZ::Outcome<TargetResult, ErrorList> ToLua(const Grammar::AbstractCodeModel& model, bool rawSave = false)
     {
@@ -134,32 +137,22 @@ namespace ScriptCanvas
                     }
                 }
 
-                // Translation to C++ (executed via BehaviorContext calls) has been demonstrated in the past and is partially in progress.
-                // These calls allow for users to execute multiple translations from the same abstract code model.
-                // More work is required to complete all the latest features of the ACM, and do integrate output files into the build.
-                // 
-                //                 if (targetFlags & (TargetFlags::Cpp | TargetFlags::Hpp))
-                //                 {
-                //                     auto outcomeCPP = TranslationCPP::ToCPlusPlus(*model.get(), rawSave);
-                //                     if (outcomeCPP.IsSuccess())
-                //                     {
-                //                         auto hppAndCpp = outcomeCPP.TakeValue();
-                //                         
-                //                         TargetResult cppResult;
-                //                         cppResult.m_text = AZStd::move(hppAndCpp.first);
-                //                         translations.emplace(TargetFlags::Hpp, AZStd::move(cppResult));
-                //                         TargetResult hppResult;
-                //                         hppResult.m_text = AZStd::move(hppAndCpp.second);
-                //                         translations.emplace(TargetFlags::Cpp, AZStd::move(hppResult));
-                //                     }
-                //                     else
-                //                     {
-                //                         auto hppAndCpp = outcomeCPP.TakeError();
-                //                         errors.emplace(TargetFlags::Hpp, AZStd::move(hppAndCpp.first));
-                //                         errors.emplace(TargetFlags::Cpp, AZStd::move(hppAndCpp.second));
-                //                     }
-                //                 }
-
+                // Translation to C++ executes via direct BehaviorContext calls. It supports a subset of the graph features,
+                // and a failure is not fatal: the graph keeps executing the Lua translation.
+                if (request.translationTargetFlags & (TargetFlags::Cpp | TargetFlags::Hpp))
+                {
+                    auto outcomeCPP = TranslationCPP::ToCPlusPlus(*model.get(), request.rawSaveDebugOutput);
+                    if (outcomeCPP.IsSuccess())
+                    {
+                        auto hppAndCpp = outcomeCPP.TakeValue();
+                        translations.emplace(TargetFlags::Hpp, AZStd::move(hppAndCpp.first));
+                        translations.emplace(TargetFlags::Cpp, AZStd::move(hppAndCpp.second));
+                    }
+                    else
+                    {
+                        errors.emplace(TargetFlags::Cpp, outcomeCPP.TakeError());
+                    }
+                }
             }
 
             return Result(model, AZStd::move(translations), AZStd::move(errors));
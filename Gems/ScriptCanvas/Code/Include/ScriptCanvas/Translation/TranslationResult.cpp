@@ -19,6 +19,8 @@ namespace TranslationResultCpp
         AddedStaticVariables,
         SupportMemberVariableInputs,
         ExecutionStateSelectionIncludesOnGraphStart,
+        AddNativeName,
+        AddExecutionMode,
         // add your entry above
         Current
     };
@@ -146,6 +148,8 @@ namespace ScriptCanvas
                 m_variables = AZStd::move(rhs.m_variables);
                 m_entityIds = AZStd::move(rhs.m_entityIds);
                 m_staticVariables = AZStd::move(rhs.m_staticVariables);
+                m_executionMode = rhs.m_executionMode;
+                m_nativeName = AZStd::move(rhs.m_nativeName);
             }
 
             return *this;
@@ -162,6 +166,8 @@ namespace ScriptCanvas
                     ->Field("variables", &RuntimeInputs::m_variables)
                     ->Field("entityIds", &RuntimeInputs::m_entityIds)
                     ->Field("staticVariables", &RuntimeInputs::m_staticVariables)
+                    ->Field("executionMode", &RuntimeInputs::m_executionMode)
+                    ->Field("nativeName", &RuntimeInputs::m_nativeName)
                     ;
             }
         }
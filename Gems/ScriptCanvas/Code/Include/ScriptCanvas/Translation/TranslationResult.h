@@ -64,6 +64,13 @@ namespace ScriptCanvas
             // when the system can't pass in the input from C++.
             AZStd::vector<AZStd::pair<VariableId, AZStd::any>> m_staticVariables;
 
+            // Native only when the source graph opted into native execution.
+            ExecutionMode m_executionMode = ExecutionMode::Interpreted;
+
+            // The name a module registered the C++ translation of the graph under, empty when the graph is only interpreted.
+            // The interpreted translation is always built as well, and is used whenever the native one is not registered.
+            AZStd::string m_nativeName;
+
             RuntimeInputs() = default;
             RuntimeInputs(const RuntimeInputs&) = default;
             RuntimeInputs(RuntimeInputs&&);
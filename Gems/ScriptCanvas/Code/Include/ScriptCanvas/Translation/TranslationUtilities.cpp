@@ -10,6 +10,7 @@
 
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/FileIOEventBus.h>
+#include <AzCore/std/string/conversions.h>
 #include <AzFramework/API/ApplicationAPI.h>
 #include <ScriptCanvas/Core/Node.h>
 #include <ScriptCanvas/Core/Slot.h>
@@ -24,6 +25,7 @@ namespace TranslationUtilitiesCPP
     
     const char* k_namespaceNameNative = "AutoNative";
     const char* k_fileDirectoryPathLua = "@usercache@/DebugScriptCanvas2LuaOutput/";
+    const char* k_fileSuffixNative = "_scriptcanvas_native";
     const char* k_space = " ";
     
     const size_t k_maxTabs = 20;
@@ -71,6 +73,11 @@ namespace TranslationUtilitiesCPP
         return AZStd::string::format("%s%s_VM.%s", TranslationUtilitiesCPP::k_fileDirectoryPathLua, source.m_name.data(), extension.data());
     }
 
+    AZStd::string GetDebugNativeFilePath(const Grammar::Source& source, AZStd::string_view extension)
+    {
+        return AZStd::string::format("%s%s", TranslationUtilitiesCPP::k_fileDirectoryPathLua, GetNativeFileName(source, extension).c_str());
+    }
+
     class FileEventHandler
         : public AZ::IO::FileIOEventBus::Handler
     {
@@ -99,7 +106,7 @@ namespace TranslationUtilitiesCPP
         }
     };
 
-    AZ::Outcome<void, AZStd::string> SaveFile(const Grammar::Source& source, AZStd::string_view text, AZStd::string_view extension)
+    AZ::Outcome<void, AZStd::string> SaveFile(const AZStd::string& filePath, AZStd::string_view text)
     {
         AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
 
@@ -108,9 +115,6 @@ namespace TranslationUtilitiesCPP
             return AZ::Failure(AZStd::string("FileIOBase unavailable"));
         }
 
-        // \todo get a (debug) file path based on the extension
-        const AZStd::string filePath = TranslationUtilitiesCPP::GetDebugLuaFilePath(source, extension);
-
         FileEventHandler eventHandler;
 
         AZ::IO::HandleType fileHandle = AZ::IO::InvalidHandle;
@@ -185,19 +189,27 @@ namespace ScriptCanvas
                 ;
         }
 
+        AZStd::string GetNativeFileName(const Grammar::Source& source, AZStd::string_view extension)
+        {
+            AZStd::string fileName = AZStd::string::format("%s%s.%.*s", source.m_name.c_str(), TranslationUtilitiesCPP::k_fileSuffixNative
+                , aznumeric_cast<int>(extension.size()), extension.data());
+            AZStd::to_lower(fileName.begin(), fileName.end());
+            return fileName;
+        }
+
         AZ::Outcome<void, AZStd::string> SaveDotCPP(const Grammar::Source& source, AZStd::string_view dotCPP)
         {
-            return TranslationUtilitiesCPP::SaveFile(source, dotCPP, "cpp");
+            return TranslationUtilitiesCPP::SaveFile(TranslationUtilitiesCPP::GetDebugNativeFilePath(source, "cpp"), dotCPP);
         }
 
         AZ::Outcome<void, AZStd::string> SaveDotH(const Grammar::Source& source, AZStd::string_view dotH)
         {
-            return TranslationUtilitiesCPP::SaveFile(source, dotH, "h");
+            return TranslationUtilitiesCPP::SaveFile(TranslationUtilitiesCPP::GetDebugNativeFilePath(source, "h"), dotH);
         }
 
         AZ::Outcome<void, AZStd::string> SaveDotLua(const Grammar::Source& source, AZStd::string_view dotLua)
         {
-            return TranslationUtilitiesCPP::SaveFile(source, dotLua, "lua");
+            return TranslationUtilitiesCPP::SaveFile(TranslationUtilitiesCPP::GetDebugLuaFilePath(source, "lua"), dotLua);
         }
       
         Writer::Writer()
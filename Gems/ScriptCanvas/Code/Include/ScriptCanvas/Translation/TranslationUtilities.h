@@ -41,6 +41,10 @@ namespace ScriptCanvas
 
         AZStd::string_view GetDoNotModifyCommentText();
 
+        // The file name of a C++ translation of the graph. It is lower case, like every product of the Asset Processor, and has
+        // a suffix that lets the build find the translations among the other products, see ScriptCanvasNative.cmake.
+        AZStd::string GetNativeFileName(const Grammar::Source& source, AZStd::string_view extension);
+
         AZ::Outcome<void, AZStd::string> SaveDotCPP(const Grammar::Source& source, AZStd::string_view dotCPP);
 
         AZ::Outcome<void, AZStd::string> SaveDotH(const Grammar::Source& source, AZStd::string_view dotH);
@@ -0,0 +1,58 @@
+#
+# Copyright (c) Contributors to the Open 3D Engine Project.
+# For complete copyright and license terms please see the LICENSE at the root of this distribution.
+#
+# SPDX-License-Identifier: Apache-2.0 OR MIT
+#
+#
+
+#! ly_add_script_canvas_native_sources: compiles the C++ translations of a project's graphs into one of its targets.
+#
+# The Script Canvas builder saves the translation of every graph that is set to execute natively as products in
+# the asset cache of the project. The target that compiles them registers them with the native host once it has
+# attached to the AZ::Environment, typically from the Activate() of its system component:
+#     ScriptCanvas::NativeGraphRegistrar::RegisterAll();
+# and unregisters them from Deactivate():
+#     ScriptCanvas::NativeGraphRegistrar::UnregisterAll();
+# Projects are configured before the gems they enable, so they include this file from the engine:
+#     include(${LY_ROOT_FOLDER}/Gems/ScriptCanvas/Code/ScriptCanvasNative.cmake)
+#     ly_add_script_canvas_native_sources(TARGET MyProject PROJECT_PATH ${CMAKE_CURRENT_LIST_DIR}/../..)
+# Translations the Asset Processor adds or removes are picked up by the next build of the project, until then those
+# graphs are not registered and they keep executing in Lua.
+#
+# \arg:TARGET the target that compiles the translations
+# \arg:PROJECT_PATH the root folder of the project, the one that holds its Cache folder
+function(ly_add_script_canvas_native_sources)
+
+    set(options)
+    set(oneValueArgs TARGET PROJECT_PATH)
+    set(multiValueArgs)
+
+    cmake_parse_arguments(ly_add_script_canvas_native_sources "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
+
+    if(NOT ly_add_script_canvas_native_sources_TARGET)
+        message(FATAL_ERROR "You must provide the target that compiles the Script Canvas translations")
+    endif()
+    if(NOT ly_add_script_canvas_native_sources_PROJECT_PATH)
+        message(FATAL_ERROR "You must provide the path of the project whose Script Canvas translations are compiled")
+    endif()
+
+    cmake_path(SET cache_product_path NORMALIZE "${ly_add_script_canvas_native_sources_PROJECT_PATH}/Cache/${LY_ASSET_DEPLOY_ASSET_TYPE}")
+
+    # the builder lower cases the products, see ScriptCanvas::Translation::GetNativeFileName
+    file(GLOB_RECURSE native_files CONFIGURE_DEPENDS
+        ${cache_product_path}/*_scriptcanvas_native.h
+        ${cache_product_path}/*_scriptcanvas_native.cpp
+    )
+
+    if(NOT native_files)
+        return()
+    endif()
+
+    target_sources(${ly_add_script_canvas_native_sources_TARGET} PRIVATE ${native_files})
+    source_group("Script Canvas Native" FILES ${native_files})
+
+    # every translation registers itself with the native host of the ScriptCanvas gem
+    target_link_libraries(${ly_add_script_canvas_native_sources_TARGET} PRIVATE Gem::ScriptCanvas.Static)
+
+endfunction()
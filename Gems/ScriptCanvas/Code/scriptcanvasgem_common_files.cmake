@@ -81,6 +81,8 @@ set(FILES
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedPure.cpp
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedSingleton.cpp
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedUtility.cpp
+    Include/ScriptCanvas/Execution/Native/ExecutionNativeAPI.cpp
+    Include/ScriptCanvas/Execution/Native/ExecutionStateNative.cpp
     Include/ScriptCanvas/Grammar/AbstractCodeModel.cpp
     Include/ScriptCanvas/Grammar/DebugMap.cpp
     Include/ScriptCanvas/Grammar/ExecutionTraversalListeners.cpp
@@ -116,6 +116,8 @@ set(FILES
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedPure.h
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedSingleton.h
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedUtility.h
+    Include/ScriptCanvas/Execution/Native/ExecutionNativeAPI.h
+    Include/ScriptCanvas/Execution/Native/ExecutionStateNative.h
     Include/ScriptCanvas/Execution/NodeableOut/NodeableOutNative.h
     Include/ScriptCanvas/Grammar/AbstractCodeModel.h
     Include/ScriptCanvas/Grammar/DebugMap.h
@@ -0,0 +1,83 @@
+/*
+* Copyright (c) Contributors to the Open 3D Engine Project.
+* For complete copyright and license terms please see the LICENSE at the root of this distribution.
+*
+* SPDX-License-Identifier: Apache-2.0 OR MIT
+*
+*/
+
+/*
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+
+DO NOT MODIFY THIS FILE, IT IS AUTO-GENERATED FROM A SCRIPT CANVAS GRAPH!
+
+GRAPH NAME: NativeBenchmarkMath
+FULL PATH: 
+Last written: 10:00:00 10-19-2026
+
+DO NOT MODIFY THIS FILE, IT IS AUTO-GENERATED FROM A SCRIPT CANVAS GRAPH!
+
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+*/
+
+#include "nativebenchmarkmath_scriptcanvas_native.h"
+
+#include <AzCore/Math/MathUtils.h>
+#include <ScriptCanvas/Execution/Native/ExecutionNativeAPI.h>
+
+namespace ScriptCanvas
+{
+	namespace AutoNative
+	{
+		AZStd::unique_ptr<NativeGraph> NativeBenchmarkMath::Create(const RuntimeContext& context)
+		{
+			return AZStd::make_unique<NativeBenchmarkMath>(context);
+		}
+
+		NativeBenchmarkMath::NativeBenchmarkMath(const RuntimeContext& context)
+			: m_context(context.GetGraphId(), context.GetSelfId(), context.GetExecutionState())
+			, m_VelocityInput(context.GetInputAs<AZ::Vector3>(0, AZ::Vector3(1.0f, 2.0f, 2.0f)))
+		{}
+
+		void NativeBenchmarkMath::Activate()
+		{
+			Start();
+		}
+
+		void NativeBenchmarkMath::Deactivate()
+		{
+		}
+
+		void NativeBenchmarkMath::Start()
+		{
+			AZ::Vector3 Velocity = m_VelocityInput;
+			static const AZ::BehaviorMethod* const s_method0 = ScriptCanvas::Execution::FindNativeMethod("Vector3", "GetLength");
+			[[maybe_unused]] double Result = static_cast<double>(ScriptCanvas::Execution::CallNativeResult<float>(s_method0, Velocity));
+			static const AZ::BehaviorMethod* const s_method1 = ScriptCanvas::Execution::FindNativeMethod("Vector3", "GetLength");
+			[[maybe_unused]] double Result_1 = static_cast<double>(ScriptCanvas::Execution::CallNativeResult<float>(s_method1, Velocity));
+			static const AZ::BehaviorMethod* const s_method2 = ScriptCanvas::Execution::FindNativeMethod("Vector3", "GetLength");
+			[[maybe_unused]] double Result_2 = static_cast<double>(ScriptCanvas::Execution::CallNativeResult<float>(s_method2, Velocity));
+			static const AZ::BehaviorMethod* const s_method3 = ScriptCanvas::Execution::FindNativeMethod("Vector3", "GetLength");
+			[[maybe_unused]] double Result_3 = static_cast<double>(ScriptCanvas::Execution::CallNativeResult<float>(s_method3, Velocity));
+			static const AZ::BehaviorMethod* const s_method4 = ScriptCanvas::Execution::FindNativeMethod("Vector3", "GetLength");
+			[[maybe_unused]] double Result_4 = static_cast<double>(ScriptCanvas::Execution::CallNativeResult<float>(s_method4, Velocity));
+			static const AZ::BehaviorMethod* const s_method5 = ScriptCanvas::Execution::FindNativeMethod("Vector3", "GetLength");
+			[[maybe_unused]] double Result_5 = static_cast<double>(ScriptCanvas::Execution::CallNativeResult<float>(s_method5, Velocity));
+			static const AZ::BehaviorMethod* const s_method6 = ScriptCanvas::Execution::FindNativeMethod("Vector3", "GetLength");
+			[[maybe_unused]] double Result_6 = static_cast<double>(ScriptCanvas::Execution::CallNativeResult<float>(s_method6, Velocity));
+			static const AZ::BehaviorMethod* const s_method7 = ScriptCanvas::Execution::FindNativeMethod("Vector3", "GetLength");
+			[[maybe_unused]] double Result_7 = static_cast<double>(ScriptCanvas::Execution::CallNativeResult<float>(s_method7, Velocity));
+		}
+	} // namespace AutoNative
+} // namespace ScriptCanvas
+
+namespace
+{
+	const ScriptCanvas::NativeGraphRegistrar s_NativeBenchmarkMathRegistrar("NativeBenchmarkMath", &ScriptCanvas::AutoNative::NativeBenchmarkMath::Create);
+}
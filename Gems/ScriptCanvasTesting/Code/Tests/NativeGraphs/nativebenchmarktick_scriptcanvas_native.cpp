@@ -0,0 +1,87 @@
+/*
+* Copyright (c) Contributors to the Open 3D Engine Project.
+* For complete copyright and license terms please see the LICENSE at the root of this distribution.
+*
+* SPDX-License-Identifier: Apache-2.0 OR MIT
+*
+*/
+
+/*
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+
+DO NOT MODIFY THIS FILE, IT IS AUTO-GENERATED FROM A SCRIPT CANVAS GRAPH!
+
+GRAPH NAME: NativeBenchmarkTick
+FULL PATH: 
+Last written: 10:00:00 10-19-2026
+
+DO NOT MODIFY THIS FILE, IT IS AUTO-GENERATED FROM A SCRIPT CANVAS GRAPH!
+
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+*/
+
+#include "nativebenchmarktick_scriptcanvas_native.h"
+
+#include <AzCore/Math/MathUtils.h>
+#include <ScriptCanvas/Execution/Native/ExecutionNativeAPI.h>
+
+namespace ScriptCanvas
+{
+	namespace AutoNative
+	{
+		AZStd::unique_ptr<NativeGraph> NativeBenchmarkTick::Create(const RuntimeContext& context)
+		{
+			return AZStd::make_unique<NativeBenchmarkTick>(context);
+		}
+
+		NativeBenchmarkTick::NativeBenchmarkTick(const RuntimeContext& context)
+			: m_context(context.GetGraphId(), context.GetSelfId(), context.GetExecutionState())
+			, m_Velocity(context.GetInputAs<AZ::Vector3>(0, AZ::Vector3(1.0f, 2.0f, 2.0f)))
+		{
+			m_TickBusHandler.reset(EBusHandler::Create(m_context.GetExecutionState(), "TickBus"));
+			ScriptCanvas::Execution::HandleNativeEBusEvent(*m_TickBusHandler, "OnTick", [this](AZ::BehaviorValueParameter*, AZ::BehaviorValueParameter* arguments, int) { TickBusHandler_OnTick(arguments); });
+		}
+
+		void NativeBenchmarkTick::Activate()
+		{
+			m_TickBusHandler->Connect();
+		}
+
+		void NativeBenchmarkTick::Deactivate()
+		{
+			m_TickBusHandler->Disconnect();
+		}
+
+		void NativeBenchmarkTick::TickBusHandler_OnTick([[maybe_unused]] AZ::BehaviorValueParameter* arguments)
+		{
+			[[maybe_unused]] double deltaTime = static_cast<double>(*arguments[0].GetAsUnsafe<float>());
+			static const AZ::BehaviorMethod* const s_method0 = ScriptCanvas::Execution::FindNativeEBusEvent("TickRequestBus", "GetTickDeltaTime", ScriptCanvas::EventType::Broadcast);
+			[[maybe_unused]] double Result = static_cast<double>(ScriptCanvas::Execution::CallNativeResult<float>(s_method0));
+			static const AZ::BehaviorMethod* const s_method1 = ScriptCanvas::Execution::FindNativeMethod("Vector3", "GetLength");
+			[[maybe_unused]] double Result_1 = static_cast<double>(ScriptCanvas::Execution::CallNativeResult<float>(s_method1, m_Velocity));
+			static const AZ::BehaviorMethod* const s_method2 = ScriptCanvas::Execution::FindNativeEBusEvent("TickRequestBus", "GetTickDeltaTime", ScriptCanvas::EventType::Broadcast);
+			[[maybe_unused]] double Result_2 = static_cast<double>(ScriptCanvas::Execution::CallNativeResult<float>(s_method2));
+			static const AZ::BehaviorMethod* const s_method3 = ScriptCanvas::Execution::FindNativeMethod("Vector3", "GetLength");
+			[[maybe_unused]] double Result_3 = static_cast<double>(ScriptCanvas::Execution::CallNativeResult<float>(s_method3, m_Velocity));
+			static const AZ::BehaviorMethod* const s_method4 = ScriptCanvas::Execution::FindNativeEBusEvent("TickRequestBus", "GetTickDeltaTime", ScriptCanvas::EventType::Broadcast);
+			[[maybe_unused]] double Result_4 = static_cast<double>(ScriptCanvas::Execution::CallNativeResult<float>(s_method4));
+			static const AZ::BehaviorMethod* const s_method5 = ScriptCanvas::Execution::FindNativeMethod("Vector3", "GetLength");
+			[[maybe_unused]] double Result_5 = static_cast<double>(ScriptCanvas::Execution::CallNativeResult<float>(s_method5, m_Velocity));
+			static const AZ::BehaviorMethod* const s_method6 = ScriptCanvas::Execution::FindNativeEBusEvent("TickRequestBus", "GetTickDeltaTime", ScriptCanvas::EventType::Broadcast);
+			[[maybe_unused]] double Result_6 = static_cast<double>(ScriptCanvas::Execution::CallNativeResult<float>(s_method6));
+			static const AZ::BehaviorMethod* const s_method7 = ScriptCanvas::Execution::FindNativeMethod("Vector3", "GetLength");
+			[[maybe_unused]] double Result_7 = static_cast<double>(ScriptCanvas::Execution::CallNativeResult<float>(s_method7, m_Velocity));
+		}
+	} // namespace AutoNative
+} // namespace ScriptCanvas
+
+namespace
+{
+	const ScriptCanvas::NativeGraphRegistrar s_NativeBenchmarkTickRegistrar("NativeBenchmarkTick", &ScriptCanvas::AutoNative::NativeBenchmarkTick::Create);
+}
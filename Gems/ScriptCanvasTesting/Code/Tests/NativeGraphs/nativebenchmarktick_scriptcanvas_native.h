@@ -0,0 +1,72 @@
+/*
+* Copyright (c) Contributors to the Open 3D Engine Project.
+* For complete copyright and license terms please see the LICENSE at the root of this distribution.
+*
+* SPDX-License-Identifier: Apache-2.0 OR MIT
+*
+*/
+
+#pragma once
+
+/*
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+
+DO NOT MODIFY THIS FILE, IT IS AUTO-GENERATED FROM A SCRIPT CANVAS GRAPH!
+
+GRAPH NAME: NativeBenchmarkTick
+FULL PATH: 
+Last written: 10:00:00 10-19-2026
+
+DO NOT MODIFY THIS FILE, IT IS AUTO-GENERATED FROM A SCRIPT CANVAS GRAPH!
+
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+*/
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Color.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Math/Matrix3x3.h>
+#include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <limits>
+#include <ScriptCanvas/Core/EBusHandler.h>
+#include <ScriptCanvas/Execution/NativeHostDefinitions.h>
+
+namespace ScriptCanvas
+{
+	namespace AutoNative
+	{
+		class NativeBenchmarkTick
+		    : public NativeGraph
+		{
+		public:
+			static AZStd::unique_ptr<NativeGraph> Create(const RuntimeContext& context);
+
+			NativeBenchmarkTick(const RuntimeContext& context);
+
+			void Activate() override;
+
+			void Deactivate() override;
+
+		private:
+			void TickBusHandler_OnTick(AZ::BehaviorValueParameter* arguments);
+
+			[[maybe_unused]] RuntimeContext m_context;
+			AZStd::unique_ptr<EBusHandler> m_TickBusHandler;
+			AZ::Vector3 m_Velocity;
+		}; // class NativeBenchmarkTick
+	} // namespace AutoNative
+} // namespace ScriptCanvas
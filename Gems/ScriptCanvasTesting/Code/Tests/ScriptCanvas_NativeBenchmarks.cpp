@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Math/MathReflection.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Script/ScriptContext.h>
+#include <AzCore/Script/ScriptSystemComponent.h>
+#include <AzCore/UnitTest/MockComponentApplication.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzTest/AzTest.h>
+
+#include <NativeGraphs/nativebenchmarkmath_scriptcanvas_native.h>
+#include <NativeGraphs/nativebenchmarktick_scriptcanvas_native.h>
+
+namespace ScriptCanvasNativeBenchmarks
+{
+    // The native graphs are the GraphToCPlusPlus translations of the graphs built by the NativeTranslation tests, which
+    // fail if the files in Tests/NativeGraphs no longer match the translation.
+    //
+    // The Lua chunks have the shape of the GraphToLua translations of the same graphs. Both sides are compiled and
+    // constructed before the timed loop, which only executes them: On Graph Start for NativeBenchmarkMath, and a TickBus
+    // broadcast for NativeBenchmarkTick.
+    constexpr const char* k_luaGraphs =
+        "function NativeBenchmarkMath_OnGraphStart(Velocity)\n"
+        "    local Result = Vector3.GetLength(Velocity)\n"
+        "    local Result_1 = Vector3.GetLength(Velocity)\n"
+        "    local Result_2 = Vector3.GetLength(Velocity)\n"
+        "    local Result_3 = Vector3.GetLength(Velocity)\n"
+        "    local Result_4 = Vector3.GetLength(Velocity)\n"
+        "    local Result_5 = Vector3.GetLength(Velocity)\n"
+        "    local Result_6 = Vector3.GetLength(Velocity)\n"
+        "    local Result_7 = Vector3.GetLength(Velocity)\n"
+        "end\n"
+        "NativeBenchmarkTick = {}\n"
+        "function NativeBenchmarkTick:OnTick(deltaTime, time)\n"
+        "    local Result = TickRequestBus.Broadcast.GetTickDeltaTime()\n"
+        "    local Result_1 = Vector3.GetLength(self.Velocity)\n"
+        "    local Result_2 = TickRequestBus.Broadcast.GetTickDeltaTime()\n"
+        "    local Result_3 = Vector3.GetLength(self.Velocity)\n"
+        "    local Result_4 = TickRequestBus.Broadcast.GetTickDeltaTime()\n"
+        "    local Result_5 = Vector3.GetLength(self.Velocity)\n"
+        "    local Result_6 = TickRequestBus.Broadcast.GetTickDeltaTime()\n"
+        "    local Result_7 = Vector3.GetLength(self.Velocity)\n"
+        "end\n"
+        "function NativeBenchmarkTick_Activate(Velocity)\n"
+        "    NativeBenchmarkTick.Velocity = Velocity\n"
+        "    NativeBenchmarkTick.tickBusHandler = TickBus.Connect(NativeBenchmarkTick)\n"
+        "end\n"
+        "function NativeBenchmarkTick_Deactivate()\n"
+        "    NativeBenchmarkTick.tickBusHandler:Disconnect()\n"
+        "end\n";
+
+    constexpr int k_callsPerExecution = 8;
+
+    // the translations look their methods up once, in function local statics, from the application's BehaviorContext
+    class NativeGraphBenchmarkApplication
+        : public UnitTest::MockComponentApplication
+    {
+    public:
+        explicit NativeGraphBenchmarkApplication(AZ::BehaviorContext* behaviorContext)
+            : m_behaviorContext(behaviorContext)
+        {}
+
+        AZ::BehaviorContext* GetBehaviorContext() override
+        {
+            return m_behaviorContext;
+        }
+
+    private:
+        AZ::BehaviorContext* m_behaviorContext = nullptr;
+    };
+
+    //! Owns the BehaviorContext for all of the benchmarks, since the methods that the native graphs look up stay
+    //! cached for the lifetime of the module.
+    class NativeGraphBenchmarkEnvironment
+        : public AZ::Test::BenchmarkEnvironmentBase
+    {
+    public:
+        AZ::BehaviorContext* m_behaviorContext = nullptr;
+        AZ::ScriptContext* m_scriptContext = nullptr;
+        bool m_areLuaGraphsLoaded = false;
+
+    protected:
+        void SetUpBenchmark() override
+        {
+            if (!AZ::AllocatorInstance<AZ::SystemAllocator>::IsReady())
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Create();
+                m_ownsAllocator = true;
+            }
+
+            m_behaviorContext = aznew AZ::BehaviorContext();
+            AZ::MathReflect(m_behaviorContext);
+
+            // TickBus and TickRequestBus
+            AZStd::unique_ptr<AZ::ComponentDescriptor> scriptSystemDescriptor(AZ::ScriptSystemComponent::CreateDescriptor());
+            scriptSystemDescriptor->Reflect(m_behaviorContext);
+
+            m_application = AZStd::make_unique<NativeGraphBenchmarkApplication>(m_behaviorContext);
+
+            m_scriptContext = aznew AZ::ScriptContext();
+            m_scriptContext->BindTo(m_behaviorContext);
+            m_areLuaGraphsLoaded = m_scriptContext->Execute(k_luaGraphs, "NativeBenchmarkGraphs");
+        }
+
+        void TearDownBenchmark() override
+        {
+            delete m_scriptContext;
+            m_scriptContext = nullptr;
+
+            m_application.reset();
+
+            delete m_behaviorContext;
+            m_behaviorContext = nullptr;
+
+            if (m_ownsAllocator)
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Destroy();
+                m_ownsAllocator = false;
+            }
+        }
+
+    private:
+        AZStd::unique_ptr<NativeGraphBenchmarkApplication> m_application;
+        bool m_ownsAllocator = false;
+    };
+
+    static NativeGraphBenchmarkEnvironment& s_environment = AZ::Test::RegisterBenchmarkEnvironment<NativeGraphBenchmarkEnvironment>();
+
+    // the inputs are only valid during construction, as they are when ExecutionStateNative creates the graph
+    template<typename NativeGraphType>
+    AZStd::unique_ptr<ScriptCanvas::NativeGraph> CreateNativeGraph(AZ::Vector3 velocity)
+    {
+        const AZ::BehaviorValueParameter inputs[] = { AZ::BehaviorValueParameter(&velocity) };
+        const ScriptCanvas::RuntimeContext context(AZ::EntityId(), AZ::EntityId(), nullptr, inputs, AZ_ARRAY_SIZE(inputs));
+        return NativeGraphType::Create(context);
+    }
+
+    void BroadcastTick()
+    {
+        AZ::TickBus::Broadcast(&AZ::TickEvents::OnTick, 0.016f, AZ::ScriptTimePoint());
+    }
+
+    static void BM_GraphStart_Lua(benchmark::State& state)
+    {
+        if (!s_environment.m_areLuaGraphsLoaded)
+        {
+            state.SkipWithError("The Lua graphs failed to compile");
+            return;
+        }
+
+        const AZ::Vector3 velocity(0.5f, 0.25f, 0.125f);
+
+        for ([[maybe_unused]] auto value : state)
+        {
+            AZ::ScriptDataContext call;
+            if (s_environment.m_scriptContext->Call("NativeBenchmarkMath_OnGraphStart", call))
+            {
+                call.PushArg(velocity);
+                call.CallExecute();
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * k_callsPerExecution);
+    }
+
+    static void BM_GraphStart_Native(benchmark::State& state)
+    {
+        AZStd::unique_ptr<ScriptCanvas::NativeGraph> graph = CreateNativeGraph<ScriptCanvas::AutoNative::NativeBenchmarkMath>(AZ::Vector3(0.5f, 0.25f, 0.125f));
+
+        // a graph without event handlers only executes On Graph Start when it is activated
+        for ([[maybe_unused]] auto value : state)
+        {
+            graph->Activate();
+        }
+
+        graph->Deactivate();
+        state.SetItemsProcessed(state.iterations() * k_callsPerExecution);
+    }
+
+    static void BM_GraphTick_Lua(benchmark::State& state)
+    {
+        if (!s_environment.m_areLuaGraphsLoaded)
+        {
+            state.SkipWithError("The Lua graphs failed to compile");
+            return;
+        }
+
+        AZ::ScriptDataContext activate;
+        if (s_environment.m_scriptContext->Call("NativeBenchmarkTick_Activate", activate))
+        {
+            activate.PushArg(AZ::Vector3(0.5f, 0.25f, 0.125f));
+            activate.CallExecute();
+        }
+
+        for ([[maybe_unused]] auto value : state)
+        {
+            BroadcastTick();
+        }
+
+        AZ::ScriptDataContext deactivate;
+        if (s_environment.m_scriptContext->Call("NativeBenchmarkTick_Deactivate", deactivate))
+        {
+            deactivate.CallExecute();
+        }
+
+        state.SetItemsProcessed(state.iterations() * k_callsPerExecution);
+    }
+
+    static void BM_GraphTick_Native(benchmark::State& state)
+    {
+        AZStd::unique_ptr<ScriptCanvas::NativeGraph> graph = CreateNativeGraph<ScriptCanvas::AutoNative::NativeBenchmarkTick>(AZ::Vector3(0.5f, 0.25f, 0.125f));
+        graph->Activate();
+
+        for ([[maybe_unused]] auto value : state)
+        {
+            BroadcastTick();
+        }
+
+        graph->Deactivate();
+        state.SetItemsProcessed(state.iterations() * k_callsPerExecution);
+    }
+
+    BENCHMARK(BM_GraphStart_Lua)->Unit(benchmark::kMicrosecond);
+    BENCHMARK(BM_GraphStart_Native)->Unit(benchmark::kMicrosecond);
+    BENCHMARK(BM_GraphTick_Lua)->Unit(benchmark::kMicrosecond);
+    BENCHMARK(BM_GraphTick_Native)->Unit(benchmark::kMicrosecond);
+}
+
+#endif
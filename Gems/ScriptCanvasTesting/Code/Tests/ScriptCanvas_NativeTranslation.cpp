@@ -0,0 +1,445 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/EntityUtils.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/limits.h>
+#include <Builder/ScriptCanvasBuilderWorker.h>
+#include <Editor/Framework/ScriptCanvasGraphUtilities.h>
+#include <ScriptCanvas/Libraries/Core/EBusEventHandler.h>
+#include <ScriptCanvas/Libraries/Core/Method.h>
+#include <ScriptCanvas/Libraries/Core/Start.h>
+#include <ScriptCanvas/Translation/Translation.h>
+#include <ScriptCanvas/Variable/VariableBus.h>
+#include <Source/Framework/ScriptCanvasTestFixture.h>
+#include <Source/Framework/ScriptCanvasTestUtilities.h>
+
+using namespace ScriptCanvasTests;
+using namespace ScriptCanvas;
+
+namespace ScriptCanvasNativeTranslationTests
+{
+    const char* k_unitTestDirPath = "@engroot@/Gems/ScriptCanvasTesting/Assets/ScriptCanvas/UnitTests";
+
+    Translation::Result TranslateGraph(const Graph& graph, AZStd::string_view name)
+    {
+        Grammar::Request request;
+        request.graph = &graph;
+        request.name = name;
+        request.translationTargetFlags = Translation::TargetFlags::Lua | Translation::TargetFlags::Cpp;
+        request.addDebugInformation = false;
+        return Translation::ParseAndTranslateGraph(request);
+    }
+
+    const AZStd::string& GetText(const Translation::Result& result, Translation::TargetFlags target)
+    {
+        static const AZStd::string s_empty;
+        auto iter = result.m_translations.find(target);
+        return iter != result.m_translations.end() ? iter->second.m_text : s_empty;
+    }
+
+    // A graph with a Vector3 variable that is a component property, read by a call to Vector3.GetLength.
+    class NativeTranslationGraph
+    {
+    public:
+        explicit NativeTranslationGraph(const Data::Vector3Type& velocity = Data::Vector3Type(1.0f, 2.0f, 2.0f))
+        {
+            m_entity = aznew AZ::Entity("Native Translation");
+            SystemRequestBus::Broadcast(&SystemRequests::CreateEngineComponentsOnEntity, m_entity);
+            m_graph = AZ::EntityUtils::FindFirstDerivedComponent<Graph>(m_entity);
+            m_entity->Init();
+
+            m_variableId = CreateVariable(GetScriptCanvasId(), velocity, "Velocity");
+
+            GraphVariable* variable = nullptr;
+            GraphVariableManagerRequestBus::EventResult(variable, GetScriptCanvasId(), &GraphVariableManagerRequests::FindVariableById, m_variableId);
+            EXPECT_TRUE(variable != nullptr);
+
+            if (variable)
+            {
+                // the value is overridden per component, so the translation must read it at activation
+                variable->SetInitialValueSource(VariableFlags::InitialValueSource::Component);
+            }
+
+            m_lengthId = AddLengthNode();
+        }
+
+        ~NativeTranslationGraph()
+        {
+            delete m_entity;
+        }
+
+        const ScriptCanvasId& GetScriptCanvasId() const
+        {
+            return m_graph->GetScriptCanvasId();
+        }
+
+        Nodes::Core::Method* GetMethodNode(const AZ::EntityId& nodeId) const
+        {
+            Nodes::Core::Method* node = nullptr;
+            SystemRequestBus::BroadcastResult(node, &SystemRequests::GetNode<Nodes::Core::Method>, nodeId);
+            return node;
+        }
+
+        Nodes::Core::Method* GetLengthNode() const
+        {
+            return GetMethodNode(m_lengthId);
+        }
+
+        //! Adds a call to Vector3.GetLength that reads the variable.
+        AZ::EntityId AddLengthNode()
+        {
+            const AZ::EntityId lengthId = CreateClassFunctionNode(GetScriptCanvasId(), "Vector3", "GetLength");
+
+            if (Nodes::Core::Method* lengthNode = GetMethodNode(lengthId))
+            {
+                for (const Slot* slot : lengthNode->GetSlotsByType(CombinedSlotType::DataIn))
+                {
+                    lengthNode->GetSlot(slot->GetId())->SetVariableReference(m_variableId);
+                }
+            }
+
+            return lengthId;
+        }
+
+        //! Adds a broadcast of an EBus event.
+        AZ::EntityId AddEBusEventNode(AZStd::string_view busName, AZStd::string_view eventName)
+        {
+            AZ::EntityId eventId;
+            if (auto eventNode = CreateTestNode<Nodes::Core::Method>(GetScriptCanvasId(), eventId))
+            {
+                eventNode->InitializeEvent(NamespacePath(), busName, eventName);
+            }
+
+            return eventId;
+        }
+
+        Translation::Result Translate(AZStd::string_view name)
+        {
+            if (m_entity->GetState() == AZ::Entity::State::Init)
+            {
+                m_entity->Activate();
+            }
+
+            return TranslateGraph(*m_graph, name);
+        }
+
+        AZ::Entity* m_entity = nullptr;
+        Graph* m_graph = nullptr;
+        VariableId m_variableId;
+        AZ::EntityId m_lengthId;
+    };
+}
+
+namespace ScriptCanvasNativeTranslationTests
+{
+    // The benchmarks execute the translations of these graphs, see ScriptCanvas_NativeBenchmarks.cpp. Translated graphs
+    // are compiled with the project that contains them, see ScriptCanvasNative.cmake, so the translations are checked in
+    // to Tests/NativeGraphs.
+    const char* k_nativeGraphsDirPath = "@engroot@/Gems/ScriptCanvasTesting/Code/Tests/NativeGraphs";
+
+    // On Graph Start reads the length of the variable eight times.
+    Translation::Result TranslateNativeBenchmarkMath()
+    {
+        NativeTranslationGraph graph;
+        AZ::EntityId previousId;
+        CreateTestNode<Nodes::Core::Start>(graph.GetScriptCanvasId(), previousId);
+
+        for (int lengthIndex = 0; lengthIndex < 8; ++lengthIndex)
+        {
+            const AZ::EntityId lengthId = lengthIndex == 0 ? graph.m_lengthId : graph.AddLengthNode();
+            EXPECT_TRUE(Connect(*graph.m_graph, previousId, "Out", lengthId, "In"));
+            previousId = lengthId;
+        }
+
+        return graph.Translate("NativeBenchmarkMath");
+    }
+
+    // Every TickBus.OnTick broadcasts TickRequestBus.GetTickDeltaTime and reads the length of the variable, four times.
+    Translation::Result TranslateNativeBenchmarkTick()
+    {
+        NativeTranslationGraph graph;
+        AZ::EntityId handlerId;
+        auto handler = CreateTestNode<Nodes::Core::EBusEventHandler>(graph.GetScriptCanvasId(), handlerId);
+        EXPECT_TRUE(handler != nullptr);
+        handler->InitializeBus("TickBus");
+
+        auto onTick = handler->FindEvent("OnTick");
+        EXPECT_TRUE(onTick != nullptr);
+
+        AZ::EntityId previousId = handlerId;
+        SlotId previousSlotId = onTick->m_eventSlotId;
+
+        for (int callIndex = 0; callIndex < 4; ++callIndex)
+        {
+            const AZ::EntityId eventId = graph.AddEBusEventNode("TickRequestBus", "GetTickDeltaTime");
+            const AZ::EntityId lengthId = callIndex == 0 ? graph.m_lengthId : graph.AddLengthNode();
+
+            EXPECT_TRUE(graph.m_graph->Connect(previousId, previousSlotId, eventId, graph.GetMethodNode(eventId)->GetSlotId("In")));
+            EXPECT_TRUE(Connect(*graph.m_graph, eventId, "Out", lengthId, "In"));
+            previousId = lengthId;
+            previousSlotId = graph.GetMethodNode(lengthId)->GetSlotId("Out");
+        }
+
+        return graph.Translate("NativeBenchmarkTick");
+    }
+
+    // What the translation executes, without the names that the translator chooses for local variables: the included
+    // headers, the string literals, the method lookups and the native calls, in order.
+    AZStd::vector<AZStd::string> GetNativeStatements(AZStd::string_view text)
+    {
+        static const AZStd::string_view s_statements[] =
+        {
+            "CallNative", "CallNativeResult", "Connect", "Disconnect", "FindNativeEBusEvent", "FindNativeMethod", "GetInputAs", "HandleNativeEBusEvent", "Start"
+        };
+
+        auto isIdentifier = [](char character)
+        {
+            return AZStd::is_alnum(character) || character == '_';
+        };
+
+        auto findEnd = [&text](AZStd::string_view delimiter, size_t index)
+        {
+            const size_t end = text.find(delimiter, index);
+            return end == AZStd::string_view::npos ? text.size() : end + delimiter.size();
+        };
+
+        AZStd::vector<AZStd::string> statements;
+        size_t index = 0;
+
+        while (index < text.size())
+        {
+            const AZStd::string_view remaining = text.substr(index);
+
+            if (remaining.starts_with("/*"))
+            {
+                index = findEnd("*/", index + 2);
+            }
+            else if (remaining.starts_with("//"))
+            {
+                index = findEnd("\n", index);
+            }
+            else if (remaining.starts_with("#"))
+            {
+                const size_t end = findEnd("\n", index);
+
+                // the header of the graph is named after the path of its source
+                if (remaining.starts_with("#include <"))
+                {
+                    AZStd::string include(text.substr(index, end - index));
+                    statements.emplace_back(AZ::StringFunc::TrimWhiteSpace(include, false, true));
+                }
+
+                index = end;
+            }
+            else if (remaining.starts_with("\""))
+            {
+                size_t end = index + 1;
+                while (end < text.size() && text[end] != '"')
+                {
+                    end += text[end] == '\\' ? 2 : 1;
+                }
+
+                end = AZStd::min(end + 1, text.size());
+                statements.emplace_back(text.substr(index, end - index));
+                index = end;
+            }
+            else if (isIdentifier(text[index]))
+            {
+                size_t end = index;
+                while (end < text.size() && isIdentifier(text[end]))
+                {
+                    ++end;
+                }
+
+                const AZStd::string_view identifier = text.substr(index, end - index);
+
+                if (identifier.starts_with("s_method") || AZStd::find(AZStd::begin(s_statements), AZStd::end(s_statements), identifier) != AZStd::end(s_statements))
+                {
+                    AZStd::string statement(identifier);
+
+                    if (end < text.size() && text[end] == '<')
+                    {
+                        const size_t templateEnd = findEnd(">", end);
+                        statement.append(text.substr(end, templateEnd - end));
+                        end = templateEnd;
+                    }
+
+                    statements.emplace_back(AZStd::move(statement));
+                }
+
+                index = end;
+            }
+            else
+            {
+                ++index;
+            }
+        }
+
+        return statements;
+    }
+
+    AZStd::string ReadNativeGraph(AZStd::string_view fileName)
+    {
+        const AZStd::string path = AZStd::string::format("%s/%.*s", k_nativeGraphsDirPath, aznumeric_cast<int>(fileName.size()), fileName.data());
+        const AZStd::optional<AZ::IO::FixedMaxPath> resolvedPath = AZ::IO::FileIOBase::GetInstance()->ResolvePath(AZ::IO::PathView(path));
+        EXPECT_TRUE(resolvedPath.has_value()) << path.c_str();
+
+        auto readOutcome = resolvedPath ? AZ::Utils::ReadFile(resolvedPath->c_str()) : AZ::Outcome<AZStd::string, AZStd::string>(AZ::Failure(path));
+        EXPECT_TRUE(readOutcome.IsSuccess()) << readOutcome.GetError().c_str();
+        return readOutcome.IsSuccess() ? readOutcome.TakeValue() : AZStd::string();
+    }
+
+    void ExpectTranslationIsCheckedIn(const Translation::Result& result, AZStd::string_view name)
+    {
+        ASSERT_TRUE(result.TranslationSucceed(Translation::TargetFlags::Cpp)) << result.ErrorsToString().c_str();
+
+        AZStd::string fileName = AZStd::string::format("%.*s_scriptcanvas_native", aznumeric_cast<int>(name.size()), name.data());
+        AZStd::to_lower(fileName.begin(), fileName.end());
+
+        // regenerate the files from the translation if this fails
+        const AZStd::string& dotH = GetText(result, Translation::TargetFlags::Hpp);
+        EXPECT_EQ(GetNativeStatements(ReadNativeGraph(fileName + ".h")), GetNativeStatements(dotH)) << dotH.c_str();
+
+        const AZStd::string& dotCPP = GetText(result, Translation::TargetFlags::Cpp);
+        EXPECT_EQ(GetNativeStatements(ReadNativeGraph(fileName + ".cpp")), GetNativeStatements(dotCPP)) << dotCPP.c_str();
+    }
+}
+
+using namespace ScriptCanvasNativeTranslationTests;
+
+TEST_F(ScriptCanvasTestFixture, NativeTranslationOnGraphStart)
+{
+    NativeTranslationGraph graph;
+    AZ::EntityId startId;
+    CreateTestNode<Nodes::Core::Start>(graph.GetScriptCanvasId(), startId);
+    EXPECT_TRUE(Connect(*graph.m_graph, startId, "Out", graph.m_lengthId, "In"));
+
+    const Translation::Result result = graph.Translate("NativeTranslationOnGraphStart");
+    ASSERT_TRUE(result.IsModelValid()) << result.ErrorsToString().c_str();
+    EXPECT_TRUE(result.TranslationSucceed(Translation::TargetFlags::Lua)) << result.ErrorsToString().c_str();
+    ASSERT_TRUE(result.TranslationSucceed(Translation::TargetFlags::Cpp)) << result.ErrorsToString().c_str();
+
+    const AZStd::string& dotH = GetText(result, Translation::TargetFlags::Hpp);
+    EXPECT_NE(dotH.find("class NativeTranslationOnGraphStart"), AZStd::string::npos);
+    EXPECT_NE(dotH.find(": public NativeGraph"), AZStd::string::npos);
+    EXPECT_NE(dotH.find("void Start();"), AZStd::string::npos);
+    EXPECT_EQ(dotH.find("EBusHandler"), AZStd::string::npos);
+
+    const AZStd::string& dotCPP = GetText(result, Translation::TargetFlags::Cpp);
+    EXPECT_NE(dotCPP.find("NativeTranslationOnGraphStart::Create(const RuntimeContext& context)"), AZStd::string::npos);
+    EXPECT_NE(dotCPP.find("ScriptCanvas::Execution::FindNativeMethod(\"Vector3\", \"GetLength\")"), AZStd::string::npos);
+    EXPECT_NE(dotCPP.find("ScriptCanvas::NativeGraphRegistrar s_NativeTranslationOnGraphStartRegistrar(\"NativeTranslationOnGraphStart\""), AZStd::string::npos);
+    EXPECT_NE(dotCPP.find("Start();"), AZStd::string::npos);
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeTranslationReadsVariableOverrides)
+{
+    NativeTranslationGraph graph;
+    AZ::EntityId startId;
+    CreateTestNode<Nodes::Core::Start>(graph.GetScriptCanvasId(), startId);
+    EXPECT_TRUE(Connect(*graph.m_graph, startId, "Out", graph.m_lengthId, "In"));
+
+    const Translation::Result result = graph.Translate("NativeTranslationReadsVariableOverrides");
+    ASSERT_TRUE(result.TranslationSucceed(Translation::TargetFlags::Lua)) << result.ErrorsToString().c_str();
+    ASSERT_TRUE(result.TranslationSucceed(Translation::TargetFlags::Cpp)) << result.ErrorsToString().c_str();
+
+    // the native graph reads the activation inputs that the runtime builds from the inputs of the Lua translation
+    const Translation::RuntimeInputs& inputs = result.m_translations.find(Translation::TargetFlags::Lua)->second.m_runtimeInputs;
+    auto variableIter = AZStd::find_if(inputs.m_variables.begin(), inputs.m_variables.end(), [&graph](const auto& idAndDatum) { return idAndDatum.first == graph.m_variableId; });
+    ASSERT_NE(variableIter, inputs.m_variables.end());
+    const size_t index = inputs.m_nodeables.size() + AZStd::distance(inputs.m_variables.begin(), variableIter);
+
+    const AZStd::string& dotCPP = GetText(result, Translation::TargetFlags::Cpp);
+    EXPECT_NE(dotCPP.find(AZStd::string::format("context.GetInputAs<AZ::Vector3>(%zu, AZ::Vector3(", index)), AZStd::string::npos) << dotCPP.c_str();
+
+    // and no longer writes the default value of the variable into its declaration
+    const AZStd::string& dotH = GetText(result, Translation::TargetFlags::Hpp);
+    EXPECT_EQ(dotH.find(" Velocity = "), AZStd::string::npos) << dotH.c_str();
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeTranslationNonFiniteNumbers)
+{
+    const float infinity = AZStd::numeric_limits<float>::infinity();
+    NativeTranslationGraph graph(Data::Vector3Type(infinity, -infinity, AZStd::numeric_limits<float>::quiet_NaN()));
+    AZ::EntityId startId;
+    CreateTestNode<Nodes::Core::Start>(graph.GetScriptCanvasId(), startId);
+    EXPECT_TRUE(Connect(*graph.m_graph, startId, "Out", graph.m_lengthId, "In"));
+
+    const Translation::Result result = graph.Translate("NativeTranslationNonFiniteNumbers");
+    ASSERT_TRUE(result.TranslationSucceed(Translation::TargetFlags::Cpp)) << result.ErrorsToString().c_str();
+
+    // printf writes inf and nan, which do not compile
+    const AZStd::string& dotCPP = GetText(result, Translation::TargetFlags::Cpp);
+    EXPECT_NE(dotCPP.find("AZ::Vector3(std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN())"), AZStd::string::npos) << dotCPP.c_str();
+    EXPECT_EQ(dotCPP.find("inff"), AZStd::string::npos) << dotCPP.c_str();
+    EXPECT_EQ(dotCPP.find("nanf"), AZStd::string::npos) << dotCPP.c_str();
+
+    const AZStd::string& dotH = GetText(result, Translation::TargetFlags::Hpp);
+    EXPECT_NE(dotH.find("#include <limits>"), AZStd::string::npos);
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeTranslationEBusHandler)
+{
+    NativeTranslationGraph graph;
+    AZ::EntityId handlerId;
+    auto handler = CreateTestNode<Nodes::Core::EBusEventHandler>(graph.GetScriptCanvasId(), handlerId);
+    ASSERT_TRUE(handler != nullptr);
+    handler->InitializeBus("TickBus");
+
+    auto onTick = handler->FindEvent("OnTick");
+    ASSERT_TRUE(onTick != nullptr);
+
+    Nodes::Core::Method* lengthNode = graph.GetLengthNode();
+    ASSERT_TRUE(lengthNode != nullptr);
+    EXPECT_TRUE(graph.m_graph->Connect(handlerId, onTick->m_eventSlotId, graph.m_lengthId, lengthNode->GetSlotId("In")));
+
+    const Translation::Result result = graph.Translate("NativeTranslationEBusHandler");
+    EXPECT_TRUE(result.TranslationSucceed(Translation::TargetFlags::Lua)) << result.ErrorsToString().c_str();
+    ASSERT_TRUE(result.TranslationSucceed(Translation::TargetFlags::Cpp)) << result.ErrorsToString().c_str();
+
+    const AZStd::string& dotH = GetText(result, Translation::TargetFlags::Hpp);
+    EXPECT_NE(dotH.find("#include <ScriptCanvas/Core/EBusHandler.h>"), AZStd::string::npos);
+    EXPECT_NE(dotH.find("AZStd::unique_ptr<EBusHandler> m_"), AZStd::string::npos);
+    EXPECT_EQ(dotH.find("void Start();"), AZStd::string::npos);
+
+    const AZStd::string& dotCPP = GetText(result, Translation::TargetFlags::Cpp);
+    EXPECT_NE(dotCPP.find("EBusHandler::Create(m_context.GetExecutionState(), \"TickBus\")"), AZStd::string::npos) << dotCPP.c_str();
+    EXPECT_NE(dotCPP.find("ScriptCanvas::Execution::HandleNativeEBusEvent("), AZStd::string::npos);
+    EXPECT_NE(dotCPP.find("\"OnTick\""), AZStd::string::npos);
+    EXPECT_NE(dotCPP.find("->Connect();"), AZStd::string::npos);
+    EXPECT_NE(dotCPP.find("->Disconnect();"), AZStd::string::npos);
+    EXPECT_NE(dotCPP.find("ScriptCanvas::Execution::FindNativeMethod(\"Vector3\", \"GetLength\")"), AZStd::string::npos);
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeTranslationUnsupportedKeepsLua)
+{
+    // nodeables are only supported by the Lua translation, which the graph keeps executing
+    const AZStd::string path = AZStd::string::format("%s/%s.scriptcanvas", k_unitTestDirPath, "LY_SC_UnitTest_NodeableTimeDelay");
+
+    ScriptCanvasEditor::TraceSuppressionBus::Broadcast(&ScriptCanvasEditor::TraceSuppressionRequests::SuppressPrintf, true);
+    ScriptCanvasEditor::LoadTestGraphResult loadResult = ScriptCanvasEditor::LoadTestGraph(path);
+    ScriptCanvasEditor::TraceSuppressionBus::Broadcast(&ScriptCanvasEditor::TraceSuppressionRequests::SuppressPrintf, false);
+    ASSERT_TRUE(loadResult.m_editorAsset.GetData() != nullptr);
+
+    const Graph* sourceGraph = ScriptCanvasBuilder::PrepareSourceGraph(loadResult.m_editorAsset.Get()->GetScriptCanvasEntity());
+    ASSERT_TRUE(sourceGraph != nullptr);
+
+    const Translation::Result result = TranslateGraph(*sourceGraph, "LY_SC_UnitTest_NodeableTimeDelay");
+    EXPECT_TRUE(result.TranslationSucceed(Translation::TargetFlags::Lua)) << result.ErrorsToString().c_str();
+    EXPECT_FALSE(result.TranslationSucceed(Translation::TargetFlags::Cpp));
+    EXPECT_NE(result.m_errors.find(Translation::TargetFlags::Cpp), result.m_errors.end());
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeTranslationBenchmarkGraphsAreCheckedIn)
+{
+    ExpectTranslationIsCheckedIn(TranslateNativeBenchmarkMath(), "NativeBenchmarkMath");
+    ExpectTranslationIsCheckedIn(TranslateNativeBenchmarkTick(), "NativeBenchmarkTick");
+}
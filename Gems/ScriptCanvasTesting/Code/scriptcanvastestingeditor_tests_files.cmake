@@ -15,6 +15,10 @@ set(FILES
     Source/Framework/ScriptCanvasTestUtilities.cpp
     Source/Framework/ScriptCanvasTestApplication.h
     Source/Framework/EntityRefTests.h
+    Tests/NativeGraphs/nativebenchmarkmath_scriptcanvas_native.h
+    Tests/NativeGraphs/nativebenchmarkmath_scriptcanvas_native.cpp
+    Tests/NativeGraphs/nativebenchmarktick_scriptcanvas_native.h
+    Tests/NativeGraphs/nativebenchmarktick_scriptcanvas_native.cpp
     Tests/ScriptCanvasTestingTest.cpp
     Tests/ScriptCanvas_BehaviorContext.cpp
     Tests/ScriptCanvas_ContainerSupport.cpp
@@ -22,6 +26,8 @@ set(FILES
     Tests/ScriptCanvas_EventHandlers.cpp
     Tests/ScriptCanvas_Math.cpp
     Tests/ScriptCanvas_MethodOverload.cpp
+    Tests/ScriptCanvas_NativeBenchmarks.cpp
+    Tests/ScriptCanvas_NativeTranslation.cpp
     Tests/ScriptCanvas_NodeGenerics.cpp
     Tests/ScriptCanvas_Regressions.cpp
     Tests/ScriptCanvas_RuntimeInterpreted.cpp
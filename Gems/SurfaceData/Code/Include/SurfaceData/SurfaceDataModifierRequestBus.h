@@ -9,8 +9,11 @@
 #pragma once
 
 #include <AzCore/EBus/EBus.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/Math/Aabb.h>
 #include <SurfaceData/SurfaceDataTypes.h>
+#include <SurfaceData/SurfacePointBuffer.h>
 
 namespace SurfaceData
 {
@@ -29,9 +32,38 @@ namespace SurfaceData
         ////////////////////////////////////////////////////////////////////////
 
         //! allows multiple threads to call
-        using MutexType = AZStd::recursive_mutex;
+        //! Events are dispatched under a shared lock so region queries can call the modifiers from several threads at once,
+        //! connecting and disconnecting still wait for the dispatches in progress. Handlers must not connect or disconnect
+        //! from within an event.
+        using MutexType = AZStd::shared_mutex;
+        template<typename DispatchMutex, bool IsLocklessDispatch>
+        using DispatchLockGuard = AZStd::shared_lock<DispatchMutex>;
 
         virtual void ModifySurfacePoints(SurfacePointList& surfacePointList) const = 0;
+
+        //! Modifies the surface points of an input position of the buffer.
+        //! The default implementation goes through ModifySurfacePoints, modifiers override it to write straight into the buffer.
+        virtual void ModifySurfacePointsInBuffer(size_t inPositionIndex, SurfacePointBuffer& surfacePointBuffer) const
+        {
+            SurfacePointList surfacePointList;
+            surfacePointBuffer.GetSurfacePointList(inPositionIndex, surfacePointList);
+            ModifySurfacePoints(surfacePointList);
+            surfacePointBuffer.SetSurfaceTagWeights(inPositionIndex, surfacePointList);
+        }
+
+        //! Modifies the surface points of the input positions [firstInPositionIndex, endInPositionIndex) of the buffer.
+        //! Region queries call this once per contiguous run of input positions inside the modifier bounds instead of once per
+        //! input position. The default implementation calls ModifySurfacePointsInBuffer for each input position that has points.
+        virtual void ModifySurfacePointsInBufferRange(size_t firstInPositionIndex, size_t endInPositionIndex, SurfacePointBuffer& surfacePointBuffer) const
+        {
+            for (size_t inPositionIndex = firstInPositionIndex; inPositionIndex < endInPositionIndex; ++inPositionIndex)
+            {
+                if (surfacePointBuffer.GetSurfacePointCount(inPositionIndex) > 0)
+                {
+                    ModifySurfacePointsInBuffer(inPositionIndex, surfacePointBuffer);
+                }
+            }
+        }
     };
 
     typedef AZ::EBus<SurfaceDataModifierRequests> SurfaceDataModifierRequestBus;
@@ -9,7 +9,10 @@
 #pragma once
 
 #include <AzCore/EBus/EBus.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 #include <SurfaceData/SurfaceDataTypes.h>
+#include <SurfaceData/SurfacePointBuffer.h>
 
 namespace SurfaceData
 {
@@ -28,9 +31,26 @@ namespace SurfaceData
         ////////////////////////////////////////////////////////////////////////
 
         //! allows multiple threads to call
-        using MutexType = AZStd::recursive_mutex;
+        //! Events are dispatched under a shared lock so region queries can call the providers from several threads at once,
+        //! connecting and disconnecting still wait for the dispatches in progress. Handlers must not connect or disconnect
+        //! from within an event.
+        using MutexType = AZStd::shared_mutex;
+        template<typename DispatchMutex, bool IsLocklessDispatch>
+        using DispatchLockGuard = AZStd::shared_lock<DispatchMutex>;
 
         virtual void GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const = 0;
+
+        //! Adds the surface points at inPosition to the last input position of the buffer.
+        //! The default implementation goes through GetSurfacePoints, providers override it to write straight into the buffer.
+        virtual void AddSurfacePointsToBuffer(const AZ::Vector3& inPosition, SurfacePointBuffer& surfacePointBuffer) const
+        {
+            SurfacePointList surfacePointList;
+            GetSurfacePoints(inPosition, surfacePointList);
+            for (const SurfacePoint& point : surfacePointList)
+            {
+                surfacePointBuffer.AddSurfacePoint(point);
+            }
+        }
     };
 
     typedef AZ::EBus<SurfaceDataProviderRequests> SurfaceDataProviderRequestBus;
@@ -13,6 +13,7 @@
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/Math/Vector2.h>
 #include <SurfaceData/SurfaceDataTypes.h>
+#include <SurfaceData/SurfacePointBuffer.h>
 
 namespace SurfaceData
 {
@@ -32,6 +33,11 @@ namespace SurfaceData
         //! allows multiple threads to call
         using MutexType = AZStd::recursive_mutex;
 
+        //! The surface data system connects on activation and disconnects on deactivation, and protects its registry with its own lock,
+        //! so requests don't need to lock the bus. This also lets region queries run the providers and modifiers on worker threads
+        //! while the calling thread waits, even when those call back into this bus.
+        static const bool LocklessDispatch = true;
+
         // Get all surface points located at the inPosition that matches one or more of the desiredTags.  Only the XY components of inPosition are used.
         virtual void GetSurfacePoints(const AZ::Vector3& inPosition, const SurfaceTagVector& desiredTags, SurfacePointList& surfacePointList) const = 0;
 
@@ -41,6 +47,12 @@ namespace SurfaceData
         virtual void GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags,
                                                 SurfacePointListPerPosition& surfacePointListPerPosition) const = 0;
 
+        // Same as GetSurfacePointsFromRegion, but fills a structure-of-arrays buffer that the providers and modifiers write into directly.
+        // The buffer is cleared first and keeps its memory, so reusing a buffer across queries avoids allocating a list per position.
+        // Large regions are split in tiles of rows that are queried in parallel on the job system when a global job context exists.
+        virtual void GetSurfacePointBufferFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags,
+                                                     SurfacePointBuffer& surfacePointBuffer) const = 0;
+
         virtual SurfaceDataRegistryHandle RegisterSurfaceDataProvider(const SurfaceDataRegistryEntry& entry) = 0;
         virtual void UnregisterSurfaceDataProvider(const SurfaceDataRegistryHandle& handle) = 0;
         virtual void UpdateSurfaceDataProvider(const SurfaceDataRegistryHandle& handle, const SurfaceDataRegistryEntry& entry) = 0;
@@ -12,7 +12,9 @@
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/string/string.h>
+#include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
 #include <SurfaceData/SurfaceTag.h>
 
 namespace SurfaceData
@@ -36,6 +38,189 @@ namespace SurfaceData
     using SurfacePointList = AZStd::vector<SurfacePoint>;
     using SurfacePointListPerPosition = AZStd::vector<AZStd::pair<AZ::Vector3, SurfacePointList>>;
 
+    //! A surface tag and its contribution factor on a surface point.
+    struct SurfaceTagWeight
+    {
+        AZ::Crc32 m_surfaceType;
+        float m_weight = 0.0f;
+    };
+
+    //! Surface tag weights of a surface point, stored inline so surface points with up to MaxSurfaceWeights tags don't allocate.
+    //! Points with more tags than that spill all their weights to the heap, so no tag is ever dropped.
+    //! Holds the same data as a SurfaceTagWeightMap: adding a tag that is already present keeps the highest weight.
+    class SurfaceTagWeights
+    {
+    public:
+        static constexpr size_t MaxSurfaceWeights = 16;
+        using WeightsVector = AZStd::fixed_vector<SurfaceTagWeight, MaxSurfaceWeights>;
+        using const_iterator = const SurfaceTagWeight*;
+
+        SurfaceTagWeights() = default;
+
+        explicit SurfaceTagWeights(const SurfaceTagWeightMap& weights)
+        {
+            for (const auto& weight : weights)
+            {
+                AddSurfaceTagWeight(weight.first, weight.second);
+            }
+        }
+
+        //! Removes all the weights. Weights that spilled to the heap keep their memory, so reusing the weights doesn't allocate.
+        void Clear()
+        {
+            m_weights.clear();
+            m_heapWeights.clear();
+        }
+
+        void AddSurfaceTagWeight(const AZ::Crc32 tag, const float weight)
+        {
+            SurfaceTagWeight* weights = IsOnHeap() ? m_heapWeights.data() : m_weights.data();
+            const size_t weightCount = GetSize();
+            for (size_t i = 0; i < weightCount; ++i)
+            {
+                if (weights[i].m_surfaceType == tag)
+                {
+                    weights[i].m_weight = AZStd::max(weights[i].m_weight, weight);
+                    return;
+                }
+            }
+
+            if (IsOnHeap())
+            {
+                m_heapWeights.push_back({ tag, weight });
+            }
+            else if (m_weights.size() < MaxSurfaceWeights)
+            {
+                m_weights.push_back({ tag, weight });
+            }
+            else
+            {
+                // Rare, move every weight to the heap so that iterating the weights still sees a single range
+                m_heapWeights.reserve(MaxSurfaceWeights * 2);
+                m_heapWeights.assign(m_weights.begin(), m_weights.end());
+                m_heapWeights.push_back({ tag, weight });
+                m_weights.clear();
+            }
+        }
+
+        void AddSurfaceTagWeights(const SurfaceTagVector& tags, const float weight)
+        {
+            for (const auto& tag : tags)
+            {
+                AddSurfaceTagWeight(tag, weight);
+            }
+        }
+
+        void AddSurfaceWeightsIfGreater(const SurfaceTagWeights& weights)
+        {
+            for (const SurfaceTagWeight& weight : weights)
+            {
+                AddSurfaceTagWeight(weight.m_surfaceType, weight.m_weight);
+            }
+        }
+
+        bool HasMatchingTag(const AZ::Crc32 sampleTag) const
+        {
+            for (const SurfaceTagWeight& weight : *this)
+            {
+                if (weight.m_surfaceType == sampleTag)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool HasMatchingTags(const SurfaceTagVector& sampleTags) const
+        {
+            for (const auto& sampleTag : sampleTags)
+            {
+                if (HasMatchingTag(sampleTag))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool HasMatchingTag(const AZ::Crc32 sampleTag, float valueMin, float valueMax) const
+        {
+            for (const SurfaceTagWeight& weight : *this)
+            {
+                if (weight.m_surfaceType == sampleTag)
+                {
+                    return valueMin <= weight.m_weight && valueMax >= weight.m_weight;
+                }
+            }
+            return false;
+        }
+
+        bool HasMatchingTags(const SurfaceTagVector& sampleTags, float valueMin, float valueMax) const
+        {
+            for (const auto& sampleTag : sampleTags)
+            {
+                if (HasMatchingTag(sampleTag, valueMin, valueMax))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        //! Returns true if any of the tags is not the unassigned tag.
+        bool HasValidTags() const
+        {
+            for (const SurfaceTagWeight& weight : *this)
+            {
+                if (weight.m_surfaceType != Constants::s_unassignedTagCrc)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        //! Replaces the contents of the map with these weights, for code that still uses SurfaceTagWeightMap.
+        void GetSurfaceTagWeightMap(SurfaceTagWeightMap& weights) const
+        {
+            weights.clear();
+            for (const SurfaceTagWeight& weight : *this)
+            {
+                weights.emplace(weight.m_surfaceType, weight.m_weight);
+            }
+        }
+
+        size_t GetSize() const
+        {
+            return IsOnHeap() ? m_heapWeights.size() : m_weights.size();
+        }
+
+        bool IsEmpty() const
+        {
+            return GetSize() == 0;
+        }
+
+        const_iterator begin() const
+        {
+            return IsOnHeap() ? m_heapWeights.data() : m_weights.data();
+        }
+
+        const_iterator end() const
+        {
+            return begin() + GetSize();
+        }
+
+    private:
+        //! The weights only spill to the heap when there are more than MaxSurfaceWeights of them, so the heap is never empty then.
+        bool IsOnHeap() const
+        {
+            return !m_heapWeights.empty();
+        }
+
+        WeightsVector m_weights;
+        AZStd::vector<SurfaceTagWeight> m_heapWeights;
+    };
+
     struct SurfaceDataRegistryEntry
     {
         AZ::EntityId m_entityId;
@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/utils.h>
+#include <SurfaceData/SurfaceDataTypes.h>
+
+namespace SurfaceData
+{
+    //! Structure-of-arrays list of the surface points found at a list of input positions.
+    //! The points of all the input positions are stored in flat arrays, the points of each input position are contiguous and
+    //! located with a per-position offset. Providers and modifiers write straight into the arrays, and clearing the buffer keeps
+    //! the memory, so a buffer reused for queries of similar sizes doesn't allocate.
+    //!
+    //! Points can only be added to the last input position: the buffer is filled one input position at a time.
+    class SurfacePointBuffer
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SurfacePointBuffer, AZ::SystemAllocator, 0);
+
+        //! Removes all the input positions and points, keeping the memory for the next query.
+        void Clear()
+        {
+            m_inputPositions.clear();
+            m_inputPointOffsets.clear();
+            m_entityIds.clear();
+            m_positions.clear();
+            m_normals.clear();
+            m_weights.clear();
+        }
+
+        //! Reserves memory for the given number of input positions and points.
+        void Reserve(size_t inputPositionCount, size_t pointCount)
+        {
+            m_inputPositions.reserve(inputPositionCount);
+            m_inputPointOffsets.reserve(inputPositionCount);
+            m_entityIds.reserve(pointCount);
+            m_positions.reserve(pointCount);
+            m_normals.reserve(pointCount);
+            m_weights.reserve(pointCount);
+        }
+
+        //! Adds an input position, the points added next belong to this input position.
+        void AddInputPosition(const AZ::Vector3& inPosition)
+        {
+            m_inputPositions.push_back(inPosition);
+            m_inputPointOffsets.push_back(m_positions.size());
+        }
+
+        //! Adds a point to the last input position.
+        void AddSurfacePoint(const AZ::EntityId& entityId, const AZ::Vector3& position, const AZ::Vector3& normal, const SurfaceTagWeights& weights)
+        {
+            AZ_Assert(!m_inputPositions.empty(), "An input position needs to be added before its surface points.");
+            m_entityIds.push_back(entityId);
+            m_positions.push_back(position);
+            m_normals.push_back(normal);
+            m_weights.push_back(weights);
+        }
+
+        //! Adds a point to the last input position.
+        void AddSurfacePoint(const SurfacePoint& point)
+        {
+            AddSurfacePoint(point.m_entityId, point.m_position, point.m_normal, SurfaceTagWeights(point.m_masks));
+        }
+
+        size_t GetInputPositionCount() const
+        {
+            return m_inputPositions.size();
+        }
+
+        const AZ::Vector3& GetInputPosition(size_t inPositionIndex) const
+        {
+            return m_inputPositions[inPositionIndex];
+        }
+
+        //! Total number of points of all the input positions.
+        size_t GetSurfacePointCount() const
+        {
+            return m_positions.size();
+        }
+
+        //! Index of the first point of an input position in the point arrays.
+        size_t GetFirstPointIndex(size_t inPositionIndex) const
+        {
+            return m_inputPointOffsets[inPositionIndex];
+        }
+
+        //! Index past the last point of an input position in the point arrays.
+        size_t GetEndPointIndex(size_t inPositionIndex) const
+        {
+            return (inPositionIndex + 1 < m_inputPointOffsets.size()) ? m_inputPointOffsets[inPositionIndex + 1] : m_positions.size();
+        }
+
+        size_t GetSurfacePointCount(size_t inPositionIndex) const
+        {
+            return GetEndPointIndex(inPositionIndex) - GetFirstPointIndex(inPositionIndex);
+        }
+
+        const AZ::EntityId& GetEntityId(size_t pointIndex) const
+        {
+            return m_entityIds[pointIndex];
+        }
+
+        const AZ::Vector3& GetPosition(size_t pointIndex) const
+        {
+            return m_positions[pointIndex];
+        }
+
+        const AZ::Vector3& GetNormal(size_t pointIndex) const
+        {
+            return m_normals[pointIndex];
+        }
+
+        const SurfaceTagWeights& GetSurfaceTagWeights(size_t pointIndex) const
+        {
+            return m_weights[pointIndex];
+        }
+
+        SurfaceTagWeights& GetSurfaceTagWeights(size_t pointIndex)
+        {
+            return m_weights[pointIndex];
+        }
+
+        //! Calls modifier(position, weights) for each point of an input position that wasn't created by the given entity,
+        //! which is how surface modifiers annotate the points of other surfaces.
+        template<typename Modifier>
+        void ModifySurfaceWeights(size_t inPositionIndex, const AZ::EntityId& currentEntityId, const Modifier& modifier)
+        {
+            ModifySurfaceWeights(inPositionIndex, inPositionIndex + 1, currentEntityId, modifier);
+        }
+
+        //! Calls modifier(position, weights) for each point of the input positions [firstInPositionIndex, endInPositionIndex)
+        //! that wasn't created by the given entity. The points of consecutive input positions are contiguous, so the whole range
+        //! is a single loop over the point arrays.
+        template<typename Modifier>
+        void ModifySurfaceWeights(size_t firstInPositionIndex, size_t endInPositionIndex, const AZ::EntityId& currentEntityId, const Modifier& modifier)
+        {
+            if (firstInPositionIndex >= endInPositionIndex)
+            {
+                return;
+            }
+
+            const size_t endPointIndex = GetEndPointIndex(endInPositionIndex - 1);
+            for (size_t pointIndex = GetFirstPointIndex(firstInPositionIndex); pointIndex < endPointIndex; ++pointIndex)
+            {
+                if (m_entityIds[pointIndex] != currentEntityId)
+                {
+                    modifier(m_positions[pointIndex], m_weights[pointIndex]);
+                }
+            }
+        }
+
+        //! Sorts the points of each input position from firstInPositionIndex to the last one in decreasing height, merges the
+        //! neighboring points that have close positions and normals and removes the points that don't have any of the desired tags.
+        //! The points that are kept are compacted in place, so the input positions stay contiguous.
+        void CombineSortAndFilterPoints(size_t firstInPositionIndex, bool hasDesiredTags, const SurfaceTagVector& desiredTags)
+        {
+            if (firstInPositionIndex >= m_inputPositions.size())
+            {
+                return;
+            }
+
+            size_t targetPointIndex = m_inputPointOffsets[firstInPositionIndex];
+            for (size_t inPositionIndex = firstInPositionIndex; inPositionIndex < m_inputPositions.size(); ++inPositionIndex)
+            {
+                const size_t firstPointIndex = m_inputPointOffsets[inPositionIndex];
+                const size_t endPointIndex = GetEndPointIndex(inPositionIndex);
+
+                // There are only a few points per input position, an insertion sort is the fastest way to sort them
+                for (size_t sortIndex = firstPointIndex + 1; sortIndex < endPointIndex; ++sortIndex)
+                {
+                    for (size_t pointIndex = sortIndex; pointIndex > firstPointIndex &&
+                        m_positions[pointIndex - 1].GetZ() < m_positions[pointIndex].GetZ(); --pointIndex)
+                    {
+                        SwapPoints(pointIndex - 1, pointIndex);
+                    }
+                }
+
+                // Compact the points that are kept after the points of the previous input positions, comparing each point with
+                // the last point kept for this input position
+                const size_t firstTargetPointIndex = targetPointIndex;
+                for (size_t sourcePointIndex = firstPointIndex; sourcePointIndex < endPointIndex; ++sourcePointIndex)
+                {
+                    if (hasDesiredTags && !m_weights[sourcePointIndex].HasMatchingTags(desiredTags))
+                    {
+                        continue;
+                    }
+
+                    // [LY-90907] need to add a configurable tolerance for comparison
+                    if (targetPointIndex > firstTargetPointIndex &&
+                        m_positions[targetPointIndex - 1].IsClose(m_positions[sourcePointIndex]) &&
+                        m_normals[targetPointIndex - 1].IsClose(m_normals[sourcePointIndex]))
+                    {
+                        m_weights[targetPointIndex - 1].AddSurfaceWeightsIfGreater(m_weights[sourcePointIndex]);
+                        continue;
+                    }
+
+                    if (targetPointIndex != sourcePointIndex)
+                    {
+                        m_entityIds[targetPointIndex] = m_entityIds[sourcePointIndex];
+                        m_positions[targetPointIndex] = m_positions[sourcePointIndex];
+                        m_normals[targetPointIndex] = m_normals[sourcePointIndex];
+                        m_weights[targetPointIndex] = m_weights[sourcePointIndex];
+                    }
+                    ++targetPointIndex;
+                }
+
+                m_inputPointOffsets[inPositionIndex] = firstTargetPointIndex;
+            }
+
+            m_entityIds.resize(targetPointIndex);
+            m_positions.resize(targetPointIndex);
+            m_normals.resize(targetPointIndex);
+            m_weights.resize(targetPointIndex);
+        }
+
+        //! Appends the input positions and points of another buffer after the ones of this buffer.
+        //! Region queries fill one buffer per tile and append them in order.
+        void Append(const SurfacePointBuffer& surfacePointBuffer)
+        {
+            const size_t pointOffset = m_positions.size();
+            m_inputPositions.insert(m_inputPositions.end(), surfacePointBuffer.m_inputPositions.begin(), surfacePointBuffer.m_inputPositions.end());
+            for (size_t inputPointOffset : surfacePointBuffer.m_inputPointOffsets)
+            {
+                m_inputPointOffsets.push_back(pointOffset + inputPointOffset);
+            }
+            m_entityIds.insert(m_entityIds.end(), surfacePointBuffer.m_entityIds.begin(), surfacePointBuffer.m_entityIds.end());
+            m_positions.insert(m_positions.end(), surfacePointBuffer.m_positions.begin(), surfacePointBuffer.m_positions.end());
+            m_normals.insert(m_normals.end(), surfacePointBuffer.m_normals.begin(), surfacePointBuffer.m_normals.end());
+            m_weights.insert(m_weights.end(), surfacePointBuffer.m_weights.begin(), surfacePointBuffer.m_weights.end());
+        }
+
+        //! Copies the points of an input position into a SurfacePointList.
+        void GetSurfacePointList(size_t inPositionIndex, SurfacePointList& surfacePointList) const
+        {
+            const size_t firstPointIndex = GetFirstPointIndex(inPositionIndex);
+            const size_t endPointIndex = GetEndPointIndex(inPositionIndex);
+            surfacePointList.resize(endPointIndex - firstPointIndex);
+            for (size_t pointIndex = firstPointIndex; pointIndex < endPointIndex; ++pointIndex)
+            {
+                SurfacePoint& point = surfacePointList[pointIndex - firstPointIndex];
+                point.m_entityId = m_entityIds[pointIndex];
+                point.m_position = m_positions[pointIndex];
+                point.m_normal = m_normals[pointIndex];
+                m_weights[pointIndex].GetSurfaceTagWeightMap(point.m_masks);
+            }
+        }
+
+        //! Copies the weights of a SurfacePointList back into the points of an input position.
+        //! The list needs to have the same points as the input position, in the same order.
+        void SetSurfaceTagWeights(size_t inPositionIndex, const SurfacePointList& surfacePointList)
+        {
+            const size_t firstPointIndex = GetFirstPointIndex(inPositionIndex);
+            AZ_Assert(surfacePointList.size() == GetSurfacePointCount(inPositionIndex), "The surface point list doesn't match the input position.");
+            for (size_t listIndex = 0; listIndex < surfacePointList.size(); ++listIndex)
+            {
+                m_weights[firstPointIndex + listIndex] = SurfaceTagWeights(surfacePointList[listIndex].m_masks);
+            }
+        }
+
+        //! Copies the whole buffer into a SurfacePointListPerPosition, for code that still uses the list per position.
+        void GetSurfacePointListPerPosition(SurfacePointListPerPosition& surfacePointListPerPosition) const
+        {
+            surfacePointListPerPosition.clear();
+            surfacePointListPerPosition.reserve(m_inputPositions.size());
+            for (size_t inPositionIndex = 0; inPositionIndex < m_inputPositions.size(); ++inPositionIndex)
+            {
+                surfacePointListPerPosition.emplace_back(m_inputPositions[inPositionIndex], SurfacePointList{});
+                GetSurfacePointList(inPositionIndex, surfacePointListPerPosition.back().second);
+            }
+        }
+
+    private:
+        void SwapPoints(size_t pointIndexA, size_t pointIndexB)
+        {
+            AZStd::swap(m_entityIds[pointIndexA], m_entityIds[pointIndexB]);
+            AZStd::swap(m_positions[pointIndexA], m_positions[pointIndexB]);
+            AZStd::swap(m_normals[pointIndexA], m_normals[pointIndexB]);
+            AZStd::swap(m_weights[pointIndexA], m_weights[pointIndexB]);
+        }
+
+        AZStd::vector<AZ::Vector3> m_inputPositions;
+        //! Index of the first point of each input position.
+        AZStd::vector<size_t> m_inputPointOffsets;
+
+        AZStd::vector<AZ::EntityId> m_entityIds;
+        AZStd::vector<AZ::Vector3> m_positions;
+        AZStd::vector<AZ::Vector3> m_normals;
+        AZStd::vector<SurfaceTagWeights> m_weights;
+    };
+} // namespace SurfaceData
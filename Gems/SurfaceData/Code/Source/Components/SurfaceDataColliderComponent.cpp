@@ -245,6 +245,52 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataColliderComponent::AddSurfacePointsToBuffer(const AZ::Vector3& inPosition, SurfacePointBuffer& surfacePointBuffer) const
+    {
+        AZ::Vector3 hitPosition;
+        AZ::Vector3 hitNormal;
+
+        // We want a full raycast, so don't just query the start point.
+        constexpr bool queryPointOnly = false;
+
+        if (DoRayTrace(inPosition, queryPointOnly, hitPosition, hitNormal))
+        {
+            SurfaceTagWeights weights;
+            weights.AddSurfaceTagWeights(m_configuration.m_providerTags, 1.0f);
+            surfacePointBuffer.AddSurfacePoint(GetEntityId(), hitPosition, hitNormal, weights);
+        }
+    }
+
+    void SurfaceDataColliderComponent::ModifySurfacePointsInBuffer(size_t inPositionIndex, SurfacePointBuffer& surfacePointBuffer) const
+    {
+        ModifySurfacePointsInBufferRange(inPositionIndex, inPositionIndex + 1, surfacePointBuffer);
+    }
+
+    void SurfaceDataColliderComponent::ModifySurfacePointsInBufferRange(size_t firstInPositionIndex, size_t endInPositionIndex, SurfacePointBuffer& surfacePointBuffer) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        if (m_colliderBounds.IsValid() && !m_configuration.m_modifierTags.empty())
+        {
+            surfacePointBuffer.ModifySurfaceWeights(firstInPositionIndex, endInPositionIndex, GetEntityId(),
+                [this](const AZ::Vector3& position, SurfaceTagWeights& weights)
+                {
+                    if (m_colliderBounds.Contains(position))
+                    {
+                        AZ::Vector3 hitPosition;
+                        AZ::Vector3 hitNormal;
+                        constexpr bool queryPointOnly = true;
+                        if (DoRayTrace(position, queryPointOnly, hitPosition, hitNormal))
+                        {
+                            weights.AddSurfaceTagWeights(m_configuration.m_modifierTags, 1.0f);
+                        }
+                    }
+                });
+        }
+    }
+
     void SurfaceDataColliderComponent::ModifySurfacePoints(SurfacePointList& surfacePointList) const
     {
         AZ_PROFILE_FUNCTION(Entity);
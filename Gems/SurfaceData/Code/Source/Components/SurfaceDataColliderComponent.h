@@ -81,10 +81,13 @@ namespace SurfaceData
         ////////////////////////////////////////////////////////////////////////
         // SurfaceDataProviderRequestBus
         void GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const override;
+        void AddSurfacePointsToBuffer(const AZ::Vector3& inPosition, SurfacePointBuffer& surfacePointBuffer) const override;
 
         //////////////////////////////////////////////////////////////////////////
         // SurfaceDataModifierRequestBus
         void ModifySurfacePoints(SurfacePointList& surfacePointList) const override;
+        void ModifySurfacePointsInBuffer(size_t inPositionIndex, SurfacePointBuffer& surfacePointBuffer) const override;
+        void ModifySurfacePointsInBufferRange(size_t firstInPositionIndex, size_t endInPositionIndex, SurfacePointBuffer& surfacePointBuffer) const override;
 
     private:
         bool DoRayTrace(const AZ::Vector3& inPosition, bool queryPointOnly, AZ::Vector3& outPosition, AZ::Vector3& outNormal) const;
@@ -12,6 +12,7 @@
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/vector.h>
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
 #include <SurfaceData/Utility/SurfaceDataUtility.h>
 
@@ -141,10 +142,8 @@ namespace SurfaceData
         return false;
     }
 
-    void SurfaceDataShapeComponent::GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const
+    bool SurfaceDataShapeComponent::GetShapeIntersection(const AZ::Vector3& inPosition, AZ::Vector3& outPosition) const
     {
-        AZ_PROFILE_FUNCTION(Entity);
-
         AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
 
         if (m_shapeBoundsIsValid)
@@ -156,12 +155,83 @@ namespace SurfaceData
             LmbrCentral::ShapeComponentRequestsBus::EventResult(hitShape, GetEntityId(), &LmbrCentral::ShapeComponentRequestsBus::Events::IntersectRay, rayOrigin, rayDirection, intersectionDistance);
             if (hitShape)
             {
-                SurfacePoint point;
-                point.m_entityId = GetEntityId();
-                point.m_position = rayOrigin + intersectionDistance * rayDirection;
-                point.m_normal = AZ::Vector3::CreateAxisZ();
-                AddMaxValueForMasks(point.m_masks, m_configuration.m_providerTags, 1.0f);
-                surfacePointList.push_back(point);
+                outPosition = rayOrigin + intersectionDistance * rayDirection;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void SurfaceDataShapeComponent::GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZ::Vector3 hitPosition;
+        if (GetShapeIntersection(inPosition, hitPosition))
+        {
+            SurfacePoint point;
+            point.m_entityId = GetEntityId();
+            point.m_position = hitPosition;
+            point.m_normal = AZ::Vector3::CreateAxisZ();
+            AddMaxValueForMasks(point.m_masks, m_configuration.m_providerTags, 1.0f);
+            surfacePointList.push_back(point);
+        }
+    }
+
+    void SurfaceDataShapeComponent::AddSurfacePointsToBuffer(const AZ::Vector3& inPosition, SurfacePointBuffer& surfacePointBuffer) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZ::Vector3 hitPosition;
+        if (GetShapeIntersection(inPosition, hitPosition))
+        {
+            SurfaceTagWeights weights;
+            weights.AddSurfaceTagWeights(m_configuration.m_providerTags, 1.0f);
+            surfacePointBuffer.AddSurfacePoint(GetEntityId(), hitPosition, AZ::Vector3::CreateAxisZ(), weights);
+        }
+    }
+
+    void SurfaceDataShapeComponent::ModifySurfacePointsInBuffer(size_t inPositionIndex, SurfacePointBuffer& surfacePointBuffer) const
+    {
+        ModifySurfacePointsInBufferRange(inPositionIndex, inPositionIndex + 1, surfacePointBuffer);
+    }
+
+    void SurfaceDataShapeComponent::ModifySurfacePointsInBufferRange(size_t firstInPositionIndex, size_t endInPositionIndex, SurfacePointBuffer& surfacePointBuffer) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        if (m_shapeBoundsIsValid && !m_configuration.m_modifierTags.empty() && firstInPositionIndex < endInPositionIndex)
+        {
+            // Gather the points of the range within the shape bounds and test them against the shape with a single request
+            const AZ::EntityId entityId = GetEntityId();
+            const size_t endPointIndex = surfacePointBuffer.GetEndPointIndex(endInPositionIndex - 1);
+            AZStd::vector<size_t> candidatePointIndices;
+            AZStd::vector<AZ::Vector3> candidatePositions;
+            for (size_t pointIndex = surfacePointBuffer.GetFirstPointIndex(firstInPositionIndex); pointIndex < endPointIndex; ++pointIndex)
+            {
+                if (surfacePointBuffer.GetEntityId(pointIndex) != entityId && m_shapeBounds.Contains(surfacePointBuffer.GetPosition(pointIndex)))
+                {
+                    candidatePointIndices.push_back(pointIndex);
+                    candidatePositions.push_back(surfacePointBuffer.GetPosition(pointIndex));
+                }
+            }
+
+            if (candidatePositions.empty())
+            {
+                return;
+            }
+
+            AZStd::vector<bool> inside(candidatePositions.size(), false);
+            LmbrCentral::ShapeComponentRequestsBus::Event(entityId, &LmbrCentral::ShapeComponentRequestsBus::Events::ArePointsInside,
+                candidatePositions.data(), inside.data(), candidatePositions.size());
+            for (size_t candidateIndex = 0; candidateIndex < candidatePointIndices.size(); ++candidateIndex)
+            {
+                if (inside[candidateIndex])
+                {
+                    surfacePointBuffer.GetSurfaceTagWeights(candidatePointIndices[candidateIndex]).AddSurfaceTagWeights(m_configuration.m_modifierTags, 1.0f);
+                }
             }
         }
     }
@@ -65,10 +65,13 @@ namespace SurfaceData
         //////////////////////////////////////////////////////////////////////////
         // SurfaceDataProviderRequestBus
         void GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const override;
+        void AddSurfacePointsToBuffer(const AZ::Vector3& inPosition, SurfacePointBuffer& surfacePointBuffer) const override;
 
         //////////////////////////////////////////////////////////////////////////
         // SurfaceDataModifierRequestBus
         void ModifySurfacePoints(SurfacePointList& surfacePointList) const override;
+        void ModifySurfacePointsInBuffer(size_t inPositionIndex, SurfacePointBuffer& surfacePointBuffer) const override;
+        void ModifySurfacePointsInBufferRange(size_t firstInPositionIndex, size_t endInPositionIndex, SurfacePointBuffer& surfacePointBuffer) const override;
 
         //////////////////////////////////////////////////////////////////////////
         // AZ::TransformNotificationBus
@@ -84,6 +87,7 @@ namespace SurfaceData
     private:
         void OnCompositionChanged();
         void UpdateShapeData();
+        bool GetShapeIntersection(const AZ::Vector3& inPosition, AZ::Vector3& outPosition) const;
 
         SurfaceDataShapeConfig m_configuration;
 
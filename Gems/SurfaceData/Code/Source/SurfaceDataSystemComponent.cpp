@@ -7,6 +7,10 @@
  */
 
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
@@ -23,6 +27,15 @@
 
 namespace SurfaceData
 {
+    namespace
+    {
+        //! Minimum number of input positions queried by a region query tile, smaller tiles cost more to schedule than they save.
+        constexpr size_t RegionQueryMinInputPositionsPerTile = 1024;
+
+        //! Tiles created per worker thread, so tiles that overlap more providers than the others don't leave workers idle.
+        constexpr size_t RegionQueryTilesPerWorker = 2;
+    } // namespace
+
     void SurfaceDataSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         SurfaceTag::Reflect(context);
@@ -183,11 +196,15 @@ namespace SurfaceData
     {
         AZ_PROFILE_FUNCTION(Entity);
 
+        // The bus uses lockless dispatch for the region queries, single point queries still lock the bus context before the
+        // registration lock so they keep the lock order of the gradient samplers, which lock the bus context and can call back in here.
+        auto& surfaceDataContext = SurfaceDataSystemRequestBus::GetOrCreateContext(false);
+        AZStd::lock_guard<decltype(surfaceDataContext.m_contextMutex)> contextLock(surfaceDataContext.m_contextMutex);
+        AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
+
         const bool hasDesiredTags = HasValidTags(desiredTags);
         const bool hasModifierTags = hasDesiredTags && HasMatchingTags(desiredTags, m_registeredModifierTags);
 
-        AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
-
         surfacePointList.clear();
 
         //gather all intersecting points
@@ -229,73 +246,198 @@ namespace SurfaceData
 
     void SurfaceDataSystemComponent::GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags, SurfacePointListPerPosition& surfacePointListPerPosition) const
     {
-        AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
+        SurfacePointBuffer surfacePointBuffer;
+        GetSurfacePointBufferFromRegion(inRegion, stepSize, desiredTags, surfacePointBuffer);
+        surfacePointBuffer.GetSurfacePointListPerPosition(surfacePointListPerPosition);
+    }
+
+    void SurfaceDataSystemComponent::GetSurfacePointBufferFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags, SurfacePointBuffer& surfacePointBuffer) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
 
-        surfacePointListPerPosition.clear();
-        surfacePointListPerPosition.reserve(aznumeric_cast<uint32_t>(ceil(inRegion.GetXExtent() / stepSize.GetX())) * aznumeric_cast<uint32_t>(ceil(inRegion.GetYExtent() / stepSize.GetY())));
+        const bool hasDesiredTags = HasValidTags(desiredTags);
 
-        // Initialize our list-per-position list with every input position to query from the region.
-        // This is inclusive on the min sides of inRegion, and exclusive on the max sides.
-        for (float y = inRegion.GetMin().GetY(); y < inRegion.GetMax().GetY(); y += stepSize.GetY())
+        // Find the data providers and modifiers that can affect the region.  This allows us to check the tags and the overall
+        // AABB bounds just once per provider, instead of once per point.  The handles and bounds are copied so the registration
+        // lock is only held here, and not while the providers and modifiers run on other threads.
+        RegionQueryEntryList regionProviders;
+        RegionQueryEntryList regionModifiers;
         {
-            for (float x = inRegion.GetMin().GetX(); x < inRegion.GetMax().GetX(); x += stepSize.GetX())
+            AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
+
+            const bool hasModifierTags = hasDesiredTags && HasMatchingTags(desiredTags, m_registeredModifierTags);
+
+            for (const auto& entryPair : m_registeredSurfaceDataProviders)
+            {
+                const SurfaceDataRegistryEntry& entry = entryPair.second;
+                if ((!hasDesiredTags || hasModifierTags || HasMatchingTags(desiredTags, entry.m_tags)) &&
+                    (!entry.m_bounds.IsValid() || AabbOverlaps2D(entry.m_bounds, inRegion)))
+                {
+                    regionProviders.push_back({ entryPair.first, entry.m_bounds });
+                }
+            }
+
+            for (const auto& entryPair : m_registeredSurfaceDataModifiers)
             {
-                surfacePointListPerPosition.emplace_back(AZ::Vector3(x, y, AZ::Constants::FloatMax), SurfaceData::SurfacePointList{});
+                const SurfaceDataRegistryEntry& entry = entryPair.second;
+                if (!entry.m_bounds.IsValid() || AabbOverlaps2D(entry.m_bounds, inRegion))
+                {
+                    regionModifiers.push_back({ entryPair.first, entry.m_bounds });
+                }
             }
         }
 
-        const bool hasDesiredTags = HasValidTags(desiredTags);
-        const bool hasModifierTags = hasDesiredTags && HasMatchingTags(desiredTags, m_registeredModifierTags);
+        // The input positions are inclusive on the min sides of inRegion, and exclusive on the max sides.  They're computed once up front
+        // so that every tile uses exactly the same coordinates as a single pass over the region would.
+        AZStd::vector<float> xPositions;
+        AZStd::vector<float> yPositions;
+        for (float x = inRegion.GetMin().GetX(); x < inRegion.GetMax().GetX(); x += stepSize.GetX())
+        {
+            xPositions.push_back(x);
+        }
+        for (float y = inRegion.GetMin().GetY(); y < inRegion.GetMax().GetY(); y += stepSize.GetY())
+        {
+            yPositions.push_back(y);
+        }
 
-        // Loop through each data provider, and query all the points for each one.  This allows us to check the tags and the overall
-        // AABB bounds just once per provider, instead of once per point.  It also allows for an eventual optimization in which we could send
-        // the list of points directly into each SurfaceDataProvider.
-        for (const auto& entryPair : m_registeredSurfaceDataProviders)
+        surfacePointBuffer.Clear();
+        if (xPositions.empty() || yPositions.empty())
         {
-            const SurfaceDataRegistryEntry& entry = entryPair.second;
-            bool alwaysApplies = !entry.m_bounds.IsValid();
+            return;
+        }
 
-            if ((!hasDesiredTags || hasModifierTags || HasMatchingTags(desiredTags, entry.m_tags)) &&
-                ( alwaysApplies || AabbOverlaps2D(entry.m_bounds, inRegion) )
-                )
+        const size_t rowCount = yPositions.size();
+        const size_t rowsPerTile = GetRegionQueryRowsPerTile(xPositions.size(), rowCount);
+        const size_t tileCount = (rowCount + rowsPerTile - 1) / rowsPerTile;
+        if (tileCount <= 1)
+        {
+            GetSurfacePointBufferFromTile(xPositions, yPositions, 0, rowCount, regionProviders, regionModifiers,
+                hasDesiredTags, desiredTags, surfacePointBuffer);
+            return;
+        }
+
+        // Each tile fills its own buffer on the job system, then the tiles are appended in order so the result is the same as
+        // querying the whole region in one pass.
+        AZStd::vector<SurfacePointBuffer> tileBuffers(tileCount);
+        AZ::JobCompletion jobCompletion;
+        for (size_t tileIndex = 0; tileIndex < tileCount; ++tileIndex)
+        {
+            const size_t firstRow = tileIndex * rowsPerTile;
+            const size_t endRow = AZStd::min(firstRow + rowsPerTile, rowCount);
+            AZ::Job* tileJob = AZ::CreateJobFunction(
+                [&, tileIndex, firstRow, endRow]()
+                {
+                    GetSurfacePointBufferFromTile(xPositions, yPositions, firstRow, endRow, regionProviders, regionModifiers,
+                        hasDesiredTags, desiredTags, tileBuffers[tileIndex]);
+                },
+                true);
+            tileJob->SetDependent(&jobCompletion);
+            tileJob->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+
+        size_t pointCount = 0;
+        for (const SurfacePointBuffer& tileBuffer : tileBuffers)
+        {
+            pointCount += tileBuffer.GetSurfacePointCount();
+        }
+        surfacePointBuffer.Reserve(xPositions.size() * rowCount, pointCount);
+        for (const SurfacePointBuffer& tileBuffer : tileBuffers)
+        {
+            surfacePointBuffer.Append(tileBuffer);
+        }
+    }
+
+    void SurfaceDataSystemComponent::GetSurfacePointBufferFromTile(const AZStd::vector<float>& xPositions, const AZStd::vector<float>& yPositions,
+        size_t firstRow, size_t endRow, const RegionQueryEntryList& regionProviders, const RegionQueryEntryList& regionModifiers,
+        bool hasDesiredTags, const SurfaceTagVector& desiredTags, SurfacePointBuffer& tileBuffer)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        const AZ::Aabb tileBounds = AZ::Aabb::CreateFromMinMax(
+            AZ::Vector3(xPositions.front(), yPositions[firstRow], -AZ::Constants::FloatMax),
+            AZ::Vector3(xPositions.back(), yPositions[endRow - 1], AZ::Constants::FloatMax));
+
+        // Only keep the providers and modifiers that overlap this tile, a tile is usually much smaller than the bounds of the
+        // region query, so most of the per-position bounds checks are skipped.
+        RegionQueryEntryList tileProviders;
+        for (const RegionQueryEntry& provider : regionProviders)
+        {
+            if (!provider.m_bounds.IsValid() || AabbOverlaps2D(provider.m_bounds, tileBounds))
+            {
+                tileProviders.push_back(provider);
+            }
+        }
+
+        RegionQueryEntryList tileModifiers;
+        for (const RegionQueryEntry& modifier : regionModifiers)
+        {
+            if (!modifier.m_bounds.IsValid() || AabbOverlaps2D(modifier.m_bounds, tileBounds))
             {
-                for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+                tileModifiers.push_back(modifier);
+            }
+        }
+
+        const size_t inputPositionCount = xPositions.size() * (endRow - firstRow);
+        tileBuffer.Clear();
+        tileBuffer.Reserve(inputPositionCount, inputPositionCount * AZStd::max<size_t>(tileProviders.size(), 1));
+
+        // Each input position gets the points of all the providers before moving to the next one, so its points stay contiguous in the buffer.
+        for (size_t row = firstRow; row < endRow; ++row)
+        {
+            const float y = yPositions[row];
+            for (const float x : xPositions)
+            {
+                tileBuffer.AddInputPosition(AZ::Vector3(x, y, AZ::Constants::FloatMax));
+
+                for (const RegionQueryEntry& provider : tileProviders)
                 {
-                    const auto& point2d = surfacePointListAndPoint.first;
-                    SurfacePointList& surfacePointList = surfacePointListAndPoint.second;
-                    AZ::Vector3 point3d(point2d.GetX(), point2d.GetY(), entry.m_bounds.GetMax().GetZ());
-                    if (alwaysApplies || entry.m_bounds.Contains(point3d))
+                    AZ::Vector3 point3d(x, y, provider.m_bounds.GetMax().GetZ());
+                    if (!provider.m_bounds.IsValid() || provider.m_bounds.Contains(point3d))
                     {
-                        SurfaceDataProviderRequestBus::Event(entryPair.first, &SurfaceDataProviderRequestBus::Events::GetSurfacePoints, point3d, surfacePointList);
+                        SurfaceDataProviderRequestBus::Event(provider.m_handle, &SurfaceDataProviderRequestBus::Events::AddSurfacePointsToBuffer,
+                            point3d, tileBuffer);
                     }
                 }
             }
         }
 
-        // Once we have our list of surface points created, run through the list of surface data modifiers to potentially add
+        if (tileBuffer.GetSurfacePointCount() == 0)
+        {
+            return;
+        }
+
+        // Once we have the surface points of the tile, run through the list of surface data modifiers to potentially add
         // surface tags / values onto each point.  The difference between this and the above loop is that surface data *providers*
         // create new surface points, but surface data *modifiers* simply annotate points that have already been created.  The modifiers
         // are used to annotate points that occur within a volume.  A common example is marking points as "underwater" for points that occur
         // within a water volume.
-        for (const auto& entryPair : m_registeredSurfaceDataModifiers)
+        // Each modifier is called once per run of consecutive input positions inside its bounds, which is the whole tile when the modifier
+        // covers it.
+        for (const RegionQueryEntry& modifier : tileModifiers)
         {
-            const SurfaceDataRegistryEntry& entry = entryPair.second;
-            bool alwaysApplies = !entry.m_bounds.IsValid();
-
-            if (alwaysApplies || AabbOverlaps2D(entry.m_bounds, inRegion))
+            size_t firstRunIndex = 0;
+            bool inRun = false;
+            for (size_t inPositionIndex = 0; inPositionIndex <= inputPositionCount; ++inPositionIndex)
             {
-                for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+                bool inBounds = false;
+                if (inPositionIndex < inputPositionCount)
                 {
-                    const auto& point2d = surfacePointListAndPoint.first;
-                    SurfacePointList& surfacePointList = surfacePointListAndPoint.second;
-                    if (!surfacePointList.empty())
-                    {
-                        AZ::Vector3 point3d(point2d.GetX(), point2d.GetY(), entry.m_bounds.GetMax().GetZ());
-                        if (alwaysApplies || entry.m_bounds.Contains(point3d))
-                        {
-                            SurfaceDataModifierRequestBus::Event(entryPair.first, &SurfaceDataModifierRequestBus::Events::ModifySurfacePoints, surfacePointList);
-                        }
-                    }
+                    const AZ::Vector3& inPosition = tileBuffer.GetInputPosition(inPositionIndex);
+                    AZ::Vector3 point3d(inPosition.GetX(), inPosition.GetY(), modifier.m_bounds.GetMax().GetZ());
+                    inBounds = !modifier.m_bounds.IsValid() || modifier.m_bounds.Contains(point3d);
+                }
+
+                if (inBounds && !inRun)
+                {
+                    firstRunIndex = inPositionIndex;
+                    inRun = true;
+                }
+                else if (!inBounds && inRun)
+                {
+                    SurfaceDataModifierRequestBus::Event(modifier.m_handle, &SurfaceDataModifierRequestBus::Events::ModifySurfacePointsInBufferRange,
+                        firstRunIndex, inPositionIndex, tileBuffer);
+                    inRun = false;
                 }
             }
         }
@@ -304,14 +446,22 @@ namespace SurfaceData
         // same XY coordinates and extremely similar Z values.  This produces results that are sorted in decreasing Z order.
         // Also, this filters out any remaining points that don't match the desired tag list.  This can happen when a surface provider
         // doesn't add a desired tag, and a surface modifier has the *potential* to add it, but then doesn't.
-        for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+        tileBuffer.CombineSortAndFilterPoints(0, hasDesiredTags, desiredTags);
+    }
+
+    size_t SurfaceDataSystemComponent::GetRegionQueryRowsPerTile(size_t columnCount, size_t rowCount)
+    {
+        // Without a job context the region is queried on the calling thread in a single tile
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        if (!jobContext)
         {
-            auto& surfacePointList = surfacePointListAndPoint.second;
-            if (!surfacePointList.empty())
-            {
-                CombineSortAndFilterNeighboringPoints(surfacePointList, hasDesiredTags, desiredTags);
-            }
+            return rowCount;
         }
+
+        const size_t tileCount = AZStd::max<size_t>(jobContext->GetJobManager().GetNumWorkerThreads(), 1) * RegionQueryTilesPerWorker;
+        const size_t minRowsPerTile = (RegionQueryMinInputPositionsPerTile + columnCount - 1) / columnCount;
+        const size_t balancedRowsPerTile = (rowCount + tileCount - 1) / tileCount;
+        return AZStd::clamp(balancedRowsPerTile, minRowsPerTile, AZStd::max(rowCount, minRowsPerTile));
     }
 
     void SurfaceDataSystemComponent::CombineSortAndFilterNeighboringPoints(SurfacePointList& sourcePointList, bool hasDesiredTags, const SurfaceTagVector& desiredTags) const
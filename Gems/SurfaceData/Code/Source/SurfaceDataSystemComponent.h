@@ -40,6 +40,7 @@ namespace SurfaceData
         // SurfaceDataSystemRequestBus implementation
         void GetSurfacePoints(const AZ::Vector3& inPosition, const SurfaceTagVector& desiredTags, SurfacePointList& surfacePointList) const override;
         void GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags, SurfacePointListPerPosition& surfacePointListPerPosition) const override;
+        void GetSurfacePointBufferFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags, SurfacePointBuffer& surfacePointBuffer) const override;
 
         SurfaceDataRegistryHandle RegisterSurfaceDataProvider(const SurfaceDataRegistryEntry& entry) override;
         void UnregisterSurfaceDataProvider(const SurfaceDataRegistryHandle& handle) override;
@@ -51,6 +52,24 @@ namespace SurfaceData
 
         void RefreshSurfaceData(const AZ::Aabb& dirtyArea) override;
     private:
+        //! Handle and bounds of a provider or modifier, copied out of the registry so region queries don't hold the
+        //! registration lock while the providers and modifiers run.
+        struct RegionQueryEntry
+        {
+            SurfaceDataRegistryHandle m_handle = InvalidSurfaceDataRegistryHandle;
+            AZ::Aabb m_bounds = AZ::Aabb::CreateNull();
+        };
+        using RegionQueryEntryList = AZStd::vector<RegionQueryEntry>;
+
+        //! Queries the rows [firstRow, endRow) of the region grid into the tile buffer, using only the providers and modifiers
+        //! that overlap the tile.
+        static void GetSurfacePointBufferFromTile(const AZStd::vector<float>& xPositions, const AZStd::vector<float>& yPositions,
+            size_t firstRow, size_t endRow, const RegionQueryEntryList& regionProviders, const RegionQueryEntryList& regionModifiers,
+            bool hasDesiredTags, const SurfaceTagVector& desiredTags, SurfacePointBuffer& tileBuffer);
+
+        //! Returns the number of grid rows queried by each tile, or the row count when the region is queried in a single tile.
+        static size_t GetRegionQueryRowsPerTile(size_t columnCount, size_t rowCount);
+
         void CombineSortAndFilterNeighboringPoints(SurfacePointList& sourcePointList, bool hasDesiredTags, const SurfaceTagVector& desiredTags) const;
 
         SurfaceDataRegistryHandle RegisterSurfaceDataProviderInternal(const SurfaceDataRegistryEntry& entry);
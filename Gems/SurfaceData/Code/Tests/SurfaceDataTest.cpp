@@ -7,6 +7,9 @@
  */
 
 #include <AzTest/AzTest.h>
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+#endif
 #include <Mocks/ITimerMock.h>
 #include <Mocks/ICryPakMock.h>
 #include <Mocks/IConsoleMock.h>
@@ -14,12 +17,17 @@
 
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/Memory/Memory.h>
+#include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Script/ScriptContext.h>
 #include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/parallel/thread.h>
 #include <SurfaceDataSystemComponent.h>
 #include <SurfaceDataModule.h>
 #include <SurfaceData/SurfaceDataProviderRequestBus.h>
@@ -183,6 +191,21 @@ class MockSurfaceProvider
             }
         }
 
+        void AddSurfacePointsToBuffer(const AZ::Vector3& inPosition, SurfaceData::SurfacePointBuffer& surfacePointBuffer) const override
+        {
+            auto surfacePoints = m_GetSurfacePoints.find(AZStd::make_pair(inPosition.GetX(), inPosition.GetY()));
+
+            if (surfacePoints != m_GetSurfacePoints.end())
+            {
+                SurfaceData::SurfaceTagWeights weights;
+                weights.AddSurfaceTagWeights(m_tags, 1.0f);
+                for (auto& point : surfacePoints->second)
+                {
+                    surfacePointBuffer.AddSurfacePoint(point.m_entityId, point.m_position, point.m_normal, weights);
+                }
+            }
+        }
+
         //////////////////////////////////////////////////////////////////////////
         // SurfaceDataModifierRequestBus
         void ModifySurfacePoints(SurfaceData::SurfacePointList& surfacePointList) const override
@@ -199,6 +222,20 @@ class MockSurfaceProvider
 
         }
 
+        void ModifySurfacePointsInBuffer(size_t inPositionIndex, SurfaceData::SurfacePointBuffer& surfacePointBuffer) const override
+        {
+            // The mock modifies the points of every entity, including its own, to match ModifySurfacePoints.
+            const size_t endPointIndex = surfacePointBuffer.GetEndPointIndex(inPositionIndex);
+            for (size_t pointIndex = surfacePointBuffer.GetFirstPointIndex(inPositionIndex); pointIndex < endPointIndex; ++pointIndex)
+            {
+                const AZ::Vector3& position = surfacePointBuffer.GetPosition(pointIndex);
+                if (m_GetSurfacePoints.find(AZStd::make_pair(position.GetX(), position.GetY())) != m_GetSurfacePoints.end())
+                {
+                    surfacePointBuffer.GetSurfaceTagWeights(pointIndex).AddSurfaceTagWeights(m_tags, 1.0f);
+                }
+            }
+        }
+
         SurfaceData::SurfaceDataRegistryHandle m_providerHandle = SurfaceData::InvalidSurfaceDataRegistryHandle;
 
 };
@@ -743,4 +780,337 @@ TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromRegion_DissimilarPoi
     }
 }
 
+TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointBufferFromRegionMatchesListPerPosition)
+{
+    // This test verifies that the structure-of-arrays buffer query returns the same points as the list per position query,
+    // including merged points, modified tags and filtered points, and that a reused buffer doesn't keep results of a previous query.
+
+    SurfaceData::SurfaceTagVector provider1Tags = { SurfaceData::SurfaceTag(m_testSurface1Crc) };
+    MockSurfaceProvider mockProvider1(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, provider1Tags,
+                                      AZ::Vector3(0.0f), AZ::Vector3(8.0f), AZ::Vector3(1.0f, 1.0f, 4.0f),
+                                      AZ::EntityId(0x11111111));
+
+    SurfaceData::SurfaceTagVector provider2Tags = { SurfaceData::SurfaceTag(m_testSurface2Crc) };
+    MockSurfaceProvider mockProvider2(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, provider2Tags,
+                                      AZ::Vector3(0.0f, 0.0f, 0.0f + (AZ::Constants::Tolerance / 2.0f)),
+                                      AZ::Vector3(4.0f, 4.0f, 8.0f + (AZ::Constants::Tolerance / 2.0f)),
+                                      AZ::Vector3(1.0f, 1.0f, 2.0f),
+                                      AZ::EntityId(0x22222222));
+
+    SurfaceData::SurfaceTagVector modifierTags = { SurfaceData::SurfaceTag(m_testSurfaceNoMatchCrc) };
+    MockSurfaceProvider mockModifier(MockSurfaceProvider::ProviderType::SURFACE_MODIFIER, modifierTags,
+                                     AZ::Vector3(2.0f, 2.0f, 0.0f), AZ::Vector3(6.0f, 6.0f, 8.0f), AZ::Vector3(1.0f, 1.0f, 4.0f));
+
+    SurfaceData::SurfaceTagVector tagTests[] =
+    {
+        {},
+        { SurfaceData::SurfaceTag(m_testSurface2Crc) },
+        { SurfaceData::SurfaceTag(m_testSurfaceNoMatchCrc) },
+    };
+
+    SurfaceData::SurfacePointBuffer surfacePointBuffer;
+    for (auto& tagTest : tagTests)
+    {
+        AZ::Vector2 stepSize(1.0f, 1.0f);
+        AZ::Aabb regionBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(8.0f));
+
+        SurfaceData::SurfacePointListPerPosition availablePointsPerPosition;
+        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+            &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+            regionBounds, stepSize, tagTest, availablePointsPerPosition);
+
+        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+            &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointBufferFromRegion,
+            regionBounds, stepSize, tagTest, surfacePointBuffer);
+
+        ASSERT_EQ(surfacePointBuffer.GetInputPositionCount(), availablePointsPerPosition.size());
+        for (size_t inPositionIndex = 0; inPositionIndex < availablePointsPerPosition.size(); ++inPositionIndex)
+        {
+            const SurfaceData::SurfacePointList& pointList = availablePointsPerPosition[inPositionIndex].second;
+            EXPECT_TRUE(surfacePointBuffer.GetInputPosition(inPositionIndex).IsClose(availablePointsPerPosition[inPositionIndex].first));
+            ASSERT_EQ(surfacePointBuffer.GetSurfacePointCount(inPositionIndex), pointList.size());
+
+            const size_t firstPointIndex = surfacePointBuffer.GetFirstPointIndex(inPositionIndex);
+            for (size_t listIndex = 0; listIndex < pointList.size(); ++listIndex)
+            {
+                const size_t pointIndex = firstPointIndex + listIndex;
+                EXPECT_EQ(surfacePointBuffer.GetEntityId(pointIndex), pointList[listIndex].m_entityId);
+                EXPECT_TRUE(surfacePointBuffer.GetPosition(pointIndex).IsClose(pointList[listIndex].m_position));
+                EXPECT_TRUE(surfacePointBuffer.GetNormal(pointIndex).IsClose(pointList[listIndex].m_normal));
+
+                const SurfaceData::SurfaceTagWeights& weights = surfacePointBuffer.GetSurfaceTagWeights(pointIndex);
+                EXPECT_EQ(weights.GetSize(), pointList[listIndex].m_masks.size());
+                for (const auto& weight : weights)
+                {
+                    auto maskItr = pointList[listIndex].m_masks.find(weight.m_surfaceType);
+                    ASSERT_TRUE(maskItr != pointList[listIndex].m_masks.end());
+                    EXPECT_FLOAT_EQ(weight.m_weight, maskItr->second);
+                }
+            }
+        }
+    }
+}
+
+TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointBufferFromRegionInParallelTiles)
+{
+    // This test verifies that a region big enough to be split in tiles on the job system returns the same points as a query
+    // on the calling thread, with a modifier that only covers some of the tiles.
+
+    SurfaceData::SurfaceTagVector providerTags = { SurfaceData::SurfaceTag(m_testSurface1Crc) };
+    MockSurfaceProvider mockProvider(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, providerTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(64.0f, 64.0f, 8.0f), AZ::Vector3(1.0f, 1.0f, 4.0f),
+                                     AZ::EntityId(0x11111111));
+
+    SurfaceData::SurfaceTagVector modifierTags = { SurfaceData::SurfaceTag(m_testSurface2Crc) };
+    MockSurfaceProvider mockModifier(MockSurfaceProvider::ProviderType::SURFACE_MODIFIER, modifierTags,
+                                     AZ::Vector3(16.0f, 16.0f, 0.0f), AZ::Vector3(48.0f, 48.0f, 8.0f), AZ::Vector3(1.0f, 1.0f, 4.0f));
+
+    const AZ::Vector2 stepSize(1.0f, 1.0f);
+    const AZ::Aabb regionBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(64.0f));
+
+    // Without a global job context the region is queried on this thread.
+    SurfaceData::SurfacePointBuffer serialBuffer;
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointBufferFromRegion,
+        regionBounds, stepSize, SurfaceData::SurfaceTagVector(), serialBuffer);
+
+    AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+    AZ::JobManagerDesc jobDesc;
+    for (int workerIndex = 0; workerIndex < 4; ++workerIndex)
+    {
+        jobDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+    }
+    auto jobManager = AZStd::make_unique<AZ::JobManager>(jobDesc);
+    auto jobContext = AZStd::make_unique<AZ::JobContext>(*jobManager);
+    AZ::JobContext::SetGlobalContext(jobContext.get());
+
+    SurfaceData::SurfacePointBuffer parallelBuffer;
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointBufferFromRegion,
+        regionBounds, stepSize, SurfaceData::SurfaceTagVector(), parallelBuffer);
+
+    AZ::JobContext::SetGlobalContext(nullptr);
+    jobContext.reset();
+    jobManager.reset();
+    AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+
+    ASSERT_EQ(serialBuffer.GetInputPositionCount(), 64 * 64);
+    ASSERT_EQ(parallelBuffer.GetInputPositionCount(), serialBuffer.GetInputPositionCount());
+    ASSERT_EQ(parallelBuffer.GetSurfacePointCount(), serialBuffer.GetSurfacePointCount());
+    for (size_t inPositionIndex = 0; inPositionIndex < serialBuffer.GetInputPositionCount(); ++inPositionIndex)
+    {
+        EXPECT_TRUE(parallelBuffer.GetInputPosition(inPositionIndex).IsClose(serialBuffer.GetInputPosition(inPositionIndex)));
+        ASSERT_EQ(parallelBuffer.GetFirstPointIndex(inPositionIndex), serialBuffer.GetFirstPointIndex(inPositionIndex));
+        ASSERT_EQ(parallelBuffer.GetSurfacePointCount(inPositionIndex), serialBuffer.GetSurfacePointCount(inPositionIndex));
+    }
+    for (size_t pointIndex = 0; pointIndex < serialBuffer.GetSurfacePointCount(); ++pointIndex)
+    {
+        EXPECT_EQ(parallelBuffer.GetEntityId(pointIndex), serialBuffer.GetEntityId(pointIndex));
+        EXPECT_TRUE(parallelBuffer.GetPosition(pointIndex).IsClose(serialBuffer.GetPosition(pointIndex)));
+        EXPECT_EQ(parallelBuffer.GetSurfaceTagWeights(pointIndex).GetSize(), serialBuffer.GetSurfaceTagWeights(pointIndex).GetSize());
+    }
+}
+
+TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfaceTagWeightsBeyondInlineCapacity)
+{
+    // Points with more tags than fit inline move their weights to the heap instead of dropping tags
+    const size_t tagCount = SurfaceData::SurfaceTagWeights::MaxSurfaceWeights * 2;
+
+    SurfaceData::SurfaceTagWeights weights;
+    for (size_t tagIndex = 0; tagIndex < tagCount; ++tagIndex)
+    {
+        weights.AddSurfaceTagWeight(AZ::Crc32(static_cast<AZ::u32>(tagIndex + 1)), 0.5f);
+    }
+
+    // adding a tag that is already present keeps the highest weight, whether the weights are inline or on the heap
+    weights.AddSurfaceTagWeight(AZ::Crc32(1), 1.0f);
+    weights.AddSurfaceTagWeight(AZ::Crc32(static_cast<AZ::u32>(tagCount)), 0.25f);
+
+    ASSERT_EQ(weights.GetSize(), tagCount);
+    size_t tagIndex = 0;
+    for (const SurfaceData::SurfaceTagWeight& weight : weights)
+    {
+        EXPECT_EQ(weight.m_surfaceType, AZ::Crc32(static_cast<AZ::u32>(tagIndex + 1)));
+        EXPECT_FLOAT_EQ(weight.m_weight, (tagIndex == 0) ? 1.0f : 0.5f);
+        ++tagIndex;
+    }
+    EXPECT_TRUE(weights.HasMatchingTag(AZ::Crc32(static_cast<AZ::u32>(tagCount))));
+
+    // clearing the weights returns them to the inline storage
+    weights.Clear();
+    EXPECT_TRUE(weights.IsEmpty());
+    weights.AddSurfaceTagWeight(AZ::Crc32(1), 1.0f);
+    EXPECT_EQ(weights.GetSize(), 1);
+}
+
+#ifdef HAVE_BENCHMARK
+namespace SurfaceDataBenchmarkSettings
+{
+    //! Number of points per side of the queried region, a vegetation sector with the maximum density is 256 points wide.
+    static const int StartPointsPerSide = 32;
+    static const int EndPointsPerSide = 256;
+    static const int PointsPerSideMultiplier = 2;
+
+    //! Number of providers covering the whole region, each one adds a point per input position.
+    static const int StartProviderCount = 1;
+    static const int EndProviderCount = 8;
+
+    //! Values passed to the benchmark to select whether a job context is created, which lets region queries run in parallel tiles.
+    static const int Serial = 0;
+    static const int Parallel = 1;
+} // namespace SurfaceDataBenchmarkSettings
+
+//! Queries a region the same way the vegetation system fills a sector, with providers covering the region and
+//! a modifier covering half of it. For the parallel runs a job manager using all the hardware threads is created.
+class SurfaceDataBenchmark
+    : public ::benchmark::Fixture
+{
+    void internalSetUp(const benchmark::State& state)
+    {
+        AZ::ComponentApplication::Descriptor appDesc;
+        appDesc.m_memoryBlocksByteSize = 256 * 1024 * 1024;
+
+        AZ::ComponentApplication::StartupParameters appStartup;
+        appStartup.m_createStaticModulesCallback =
+            [](AZStd::vector<AZ::Module*>& modules)
+        {
+            modules.emplace_back(new SurfaceData::SurfaceDataModule);
+        };
+
+        m_mocks = AZStd::make_unique<MockGlobalEnvironment>();
+        m_application = AZStd::make_unique<AZ::ComponentApplication>();
+        AZ::Entity* systemEntity = m_application->Create(appDesc, appStartup);
+        systemEntity->Init();
+        systemEntity->Activate();
+
+        if (state.range(2) == SurfaceDataBenchmarkSettings::Parallel)
+        {
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+            AZ::JobManagerDesc jobManagerDesc;
+            const AZ::u32 numWorkerThreads = AZStd::thread::hardware_concurrency();
+            for (AZ::u32 i = 0; i < numWorkerThreads; ++i)
+            {
+                jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext.get());
+        }
+
+        m_pointsPerSide = static_cast<float>(state.range(0));
+        const SurfaceData::SurfaceTagVector providerTags = { SurfaceData::SurfaceTag(AZ::Crc32("test_surface1")) };
+        const int providerCount = aznumeric_cast<int>(state.range(1));
+        for (int providerIndex = 0; providerIndex < providerCount; ++providerIndex)
+        {
+            // Each provider has its own entity and height, so their points aren't merged together
+            const float height = aznumeric_cast<float>(providerIndex);
+            m_providers.emplace_back(AZStd::make_unique<MockSurfaceProvider>(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, providerTags,
+                AZ::Vector3(0.0f, 0.0f, height), AZ::Vector3(m_pointsPerSide, m_pointsPerSide, height + 1.0f), AZ::Vector3(1.0f),
+                AZ::EntityId(0x10000000 + providerIndex)));
+        }
+
+        const SurfaceData::SurfaceTagVector modifierTags = { SurfaceData::SurfaceTag(AZ::Crc32("test_surface2")) };
+        m_modifier = AZStd::make_unique<MockSurfaceProvider>(MockSurfaceProvider::ProviderType::SURFACE_MODIFIER, modifierTags,
+            AZ::Vector3(0.0f), AZ::Vector3(m_pointsPerSide / 2.0f, m_pointsPerSide, 1.0f), AZ::Vector3(1.0f));
+    }
+
+    void internalTearDown()
+    {
+        m_modifier.reset();
+        m_providers.clear();
+
+        if (m_jobContext)
+        {
+            AZ::JobContext::SetGlobalContext(nullptr);
+            m_jobContext.reset();
+            m_jobManager.reset();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+        }
+
+        m_application->Destroy();
+        m_application.reset();
+        m_mocks.reset();
+    }
+
+public:
+    void SetUp(const benchmark::State& state) override
+    {
+        internalSetUp(state);
+    }
+    void SetUp(benchmark::State& state) override
+    {
+        internalSetUp(state);
+    }
+
+    void TearDown(const benchmark::State&) override
+    {
+        internalTearDown();
+    }
+    void TearDown(benchmark::State&) override
+    {
+        internalTearDown();
+    }
+
+protected:
+    AZ::Aabb GetRegion() const
+    {
+        return AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(m_pointsPerSide, m_pointsPerSide, 1.0f));
+    }
+
+    float m_pointsPerSide = 0.0f;
+
+private:
+    AZStd::unique_ptr<MockGlobalEnvironment> m_mocks;
+    AZStd::unique_ptr<AZ::ComponentApplication> m_application;
+    AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+    AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+    AZStd::vector<AZStd::unique_ptr<MockSurfaceProvider>> m_providers;
+    AZStd::unique_ptr<MockSurfaceProvider> m_modifier;
+};
+
+//! Fills a list per position, which allocates a point list and a tag map per point.
+BENCHMARK_DEFINE_F(SurfaceDataBenchmark, BM_GetSurfacePointsFromRegion)(benchmark::State& state)
+{
+    const AZ::Aabb region = GetRegion();
+    for ([[maybe_unused]] auto _ : state)
+    {
+        SurfaceData::SurfacePointListPerPosition availablePointsPerPosition;
+        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+            &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+            region, AZ::Vector2(1.0f), SurfaceData::SurfaceTagVector(), availablePointsPerPosition);
+        benchmark::DoNotOptimize(availablePointsPerPosition.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+}
+
+//! Fills a buffer reused across the queries, the way the vegetation system fills its sectors.
+BENCHMARK_DEFINE_F(SurfaceDataBenchmark, BM_GetSurfacePointBufferFromRegion)(benchmark::State& state)
+{
+    const AZ::Aabb region = GetRegion();
+    SurfaceData::SurfacePointBuffer surfacePointBuffer;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+            &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointBufferFromRegion,
+            region, AZ::Vector2(1.0f), SurfaceData::SurfaceTagVector(), surfacePointBuffer);
+        benchmark::DoNotOptimize(surfacePointBuffer.GetSurfacePointCount());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+}
+
+BENCHMARK_REGISTER_F(SurfaceDataBenchmark, BM_GetSurfacePointsFromRegion)
+    ->RangeMultiplier(SurfaceDataBenchmarkSettings::PointsPerSideMultiplier)
+    ->Ranges({ {SurfaceDataBenchmarkSettings::StartPointsPerSide, SurfaceDataBenchmarkSettings::EndPointsPerSide},
+        {SurfaceDataBenchmarkSettings::StartProviderCount, SurfaceDataBenchmarkSettings::EndProviderCount},
+        {SurfaceDataBenchmarkSettings::Serial, SurfaceDataBenchmarkSettings::Parallel} })
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_REGISTER_F(SurfaceDataBenchmark, BM_GetSurfacePointBufferFromRegion)
+    ->RangeMultiplier(SurfaceDataBenchmarkSettings::PointsPerSideMultiplier)
+    ->Ranges({ {SurfaceDataBenchmarkSettings::StartPointsPerSide, SurfaceDataBenchmarkSettings::EndPointsPerSide},
+        {SurfaceDataBenchmarkSettings::StartProviderCount, SurfaceDataBenchmarkSettings::EndProviderCount},
+        {SurfaceDataBenchmarkSettings::Serial, SurfaceDataBenchmarkSettings::Parallel} })
+    ->Unit(benchmark::kMillisecond);
+#endif // HAVE_BENCHMARK
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -9,6 +9,7 @@
 set(FILES
     Include/SurfaceData/SurfaceDataConstants.h
     Include/SurfaceData/SurfaceDataTypes.h
+    Include/SurfaceData/SurfacePointBuffer.h
     Include/SurfaceData/SurfaceDataSystemRequestBus.h
     Include/SurfaceData/SurfaceDataSystemNotificationBus.h
     Include/SurfaceData/SurfaceDataTagEnumeratorRequestBus.h
@@ -303,7 +303,7 @@ namespace Terrain
             // GradientSurfaceDataComponent in the Editor when moving the threshold sliders back and forth rapidly)
 
             auto& surfaceDataContext = SurfaceData::SurfaceDataSystemRequestBus::GetOrCreateContext(false);
-            typename SurfaceData::SurfaceDataSystemRequestBus::Context::DispatchLockGuard scopeLock(surfaceDataContext.m_contextMutex);
+            AZStd::lock_guard<decltype(surfaceDataContext.m_contextMutex)> scopeLock(surfaceDataContext.m_contextMutex);
 
             for (int32_t y = yStart; y < yEnd; y++)
             {
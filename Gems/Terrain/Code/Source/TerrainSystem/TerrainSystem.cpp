@@ -658,7 +658,7 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
         // (One case where this was previously able to occur was in rapid updating of the Preview widget on the
         // GradientSurfaceDataComponent in the Editor when moving the threshold sliders back and forth rapidly)
         auto& surfaceDataContext = SurfaceData::SurfaceDataSystemRequestBus::GetOrCreateContext(false);
-        typename SurfaceData::SurfaceDataSystemRequestBus::Context::DispatchLockGuard scopeLock(surfaceDataContext.m_contextMutex);
+        AZStd::lock_guard<decltype(surfaceDataContext.m_contextMutex)> scopeLock(surfaceDataContext.m_contextMutex);
 
         Terrain::TerrainDataChangedMask changeMask = Terrain::TerrainDataChangedMask::None;
 
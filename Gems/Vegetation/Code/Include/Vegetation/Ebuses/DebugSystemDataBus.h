@@ -19,6 +19,8 @@ namespace Vegetation
     {
         AZStd::atomic_int m_areaTaskQueueCount{ 0 };
         AZStd::atomic_int m_areaTaskActiveCount{ 0 };
+        //! number of sectors filled by the vegetation thread during the last tick
+        AZStd::atomic_int m_sectorFillCount{ 0 };
     };
 
     class DebugSystemData
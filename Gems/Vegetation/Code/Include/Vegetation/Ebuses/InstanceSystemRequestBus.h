@@ -66,6 +66,9 @@ namespace Vegetation
         virtual AZ::u32 GetTotalTaskCount() const = 0;
         virtual AZ::u32 GetCreateTaskCount() const = 0;
         virtual AZ::u32 GetDestroyTaskCount() const = 0;
+
+        // number of instances created on the main thread during the last tick
+        virtual AZ::u32 GetLastTickCreatedInstanceCount() const = 0;
     };
 
     using InstanceSystemStatsRequestBus = AZ::EBus<InstanceSystemStatsRequests>;
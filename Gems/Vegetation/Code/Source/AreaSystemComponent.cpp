@@ -731,6 +731,7 @@ namespace Vegetation
         }
         m_worldToSector = 1.0f / m_configuration.m_sectorSizeInMeters;
         m_vegetationThreadTaskTimer -= deltaTime;
+        m_vegTasks.UpdateDebugStats();
 
         // Check to see if any vegetation data has changed since last tick, and if so, offload the updates to a vegetation thread.
         // - If the thread is currently stopped, check for data changes and start up the thread if changes are detected.
@@ -1093,7 +1094,7 @@ namespace Vegetation
         const float vegStep = sectorSizeInMeters / static_cast<float>(sectorDensity);
 
         //build a free list of all points in the sector for areas to consume
-        sectorInfo.m_baseContext.m_masks.clear();
+        sectorInfo.m_baseContext.m_masks.Clear();
         sectorInfo.m_baseContext.m_availablePoints.clear();
         sectorInfo.m_baseContext.m_availablePoints.reserve(sectorDensity * sectorDensity);
 
@@ -1101,7 +1102,6 @@ namespace Vegetation
         // 0 = lower left corner, 0.5 = center
         const float texelOffset = (sectorPointSnapMode == SnapMode::Center) ? 0.5f : 0.0f;
 
-        SurfaceData::SurfacePointListPerPosition availablePointsPerPosition;
         AZ::Vector2 stepSize(vegStep, vegStep);
         AZ::Vector3 regionOffset(texelOffset * vegStep, texelOffset * vegStep, 0.0f);
         AZ::Aabb regionBounds = sectorInfo.m_bounds;
@@ -1115,30 +1115,30 @@ namespace Vegetation
         regionBounds.SetMax(regionBounds.GetMin() + AZ::Vector3(vegStep * (sectorDensity - 0.5f),
             vegStep * (sectorDensity - 0.5f), 0.0f));
 
+        m_sectorSurfacePoints.Clear();
         SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
-            &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+            &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointBufferFromRegion,
             regionBounds,
             stepSize,
             SurfaceData::SurfaceTagVector(),
-            availablePointsPerPosition);
+            m_sectorSurfacePoints);
 
-        AZ_Assert(availablePointsPerPosition.size() == (sectorDensity * sectorDensity),
-            "Veg sector ended up with unexpected density (%d points created, %d expected)", availablePointsPerPosition.size(),
+        AZ_Assert(m_sectorSurfacePoints.GetInputPositionCount() == (sectorDensity * sectorDensity),
+            "Veg sector ended up with unexpected density (%d points created, %d expected)", m_sectorSurfacePoints.GetInputPositionCount(),
             (sectorDensity * sectorDensity));
 
-        uint claimIndex = 0;
-        for (auto& availablePoints : availablePointsPerPosition)
-        {
-            for (auto& surfacePoint : availablePoints.second)
-            {
-                sectorInfo.m_baseContext.m_availablePoints.push_back();
-                ClaimPoint& claimPoint = sectorInfo.m_baseContext.m_availablePoints.back();
-                claimPoint.m_handle = CreateClaimHandle(sectorInfo, ++claimIndex);
-                claimPoint.m_position = surfacePoint.m_position;
-                claimPoint.m_normal = surfacePoint.m_normal;
-                claimPoint.m_masks = surfacePoint.m_masks;
-                SurfaceData::AddMaxValueForMasks(sectorInfo.m_baseContext.m_masks, surfacePoint.m_masks);
-            }
+        // The points of all the input positions are contiguous in the buffer, in input position order
+        const size_t surfacePointCount = m_sectorSurfacePoints.GetSurfacePointCount();
+        sectorInfo.m_baseContext.m_availablePoints.reserve(surfacePointCount);
+        for (size_t pointIndex = 0; pointIndex < surfacePointCount; ++pointIndex)
+        {
+            sectorInfo.m_baseContext.m_availablePoints.push_back();
+            ClaimPoint& claimPoint = sectorInfo.m_baseContext.m_availablePoints.back();
+            claimPoint.m_handle = CreateClaimHandle(sectorInfo, aznumeric_cast<uint32_t>(pointIndex + 1));
+            claimPoint.m_position = m_sectorSurfacePoints.GetPosition(pointIndex);
+            claimPoint.m_normal = m_sectorSurfacePoints.GetNormal(pointIndex);
+            claimPoint.m_masks = m_sectorSurfacePoints.GetSurfaceTagWeights(pointIndex);
+            sectorInfo.m_baseContext.m_masks.AddSurfaceWeightsIfGreater(claimPoint.m_masks);
         }
     }
 
@@ -1346,6 +1346,7 @@ namespace Vegetation
         }
 
         ReleaseUnusedClaims(sectorInfo);
+        m_sectorFillCount.fetch_add(1, AZStd::memory_order_relaxed);
 
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FillSectorEnd, sectorInfo.GetSectorX(), sectorInfo.GetSectorY(), AZStd::chrono::system_clock::now(), aznumeric_cast<AZ::u32>(activeContext.m_availablePoints.size())));
     }
@@ -1442,6 +1443,15 @@ namespace Vegetation
         VEG_PROFILE_METHOD(DebugSystemDataBus::BroadcastResult(m_debugData, &DebugSystemDataBus::Events::GetDebugData));
     }
 
+    void AreaSystemComponent::VegetationThreadTasks::UpdateDebugStats()
+    {
+        const int sectorFillCount = m_sectorFillCount.exchange(0, AZStd::memory_order_relaxed);
+        if (m_debugData)
+        {
+            m_debugData->m_sectorFillCount.store(sectorFillCount, AZStd::memory_order_relaxed);
+        }
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // PersistentThreadData
 
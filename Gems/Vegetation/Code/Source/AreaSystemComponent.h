@@ -17,6 +17,7 @@
 #include <AzCore/std/parallel/thread.h>
 #include <GradientSignal/Ebuses/SectorDataRequestBus.h>
 #include <SurfaceData/SurfaceDataSystemNotificationBus.h>
+#include <SurfaceData/SurfacePointBuffer.h>
 #include <CrySystemBus.h>
 #include <StatObjBus.h>
 #include <ISystem.h>
@@ -303,6 +304,9 @@ namespace Vegetation
 
             void FetchDebugData();
 
+            //! Publishes the number of sectors filled since the last call to the debug data, called once per tick.
+            void UpdateDebugStats();
+
             void MarkDirtySectors(const AZ::Aabb& bounds, DirtySectors& dirtySet, float worldToSector, const ViewRect& viewRect);
             void AddUnregisteredVegetationArea(const VegetationAreaInfo& area, float worldToSector, const ViewRect& viewRect);
 
@@ -328,6 +332,9 @@ namespace Vegetation
             template<class Fn>
             static void EnumerateSectorsInAabb(const AZ::Aabb& bounds, float worldToSector, const ViewRect& viewRect, Fn&& fn);
 
+            //! Surface points of the sector being updated, kept between sectors to reuse its memory.
+            //! Only used from the vegetation thread.
+            SurfaceData::SurfacePointBuffer m_sectorSurfacePoints;
 
             //! Queued list of vegetation area state update requests.  These get queued on the main thread, and processed
             //! on the vegetation thread.
@@ -342,6 +349,9 @@ namespace Vegetation
             //! Cached pointer to the debug data.
             //! Note: This doesn't have an associated mutex because DebugData itself consists purely of atomics
             DebugData* m_debugData = nullptr;
+
+            //! Number of sectors filled since the last UpdateDebugStats.
+            AZStd::atomic_int m_sectorFillCount{ 0 };
         };
 
         //! Helper struct to hold the state data used by the vegetation thread.  This contains all the data
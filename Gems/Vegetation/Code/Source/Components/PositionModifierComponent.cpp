@@ -306,14 +306,14 @@ namespace Vegetation
             m_surfaceTagsToSnapToCombined.clear();
             m_surfaceTagsToSnapToCombined.reserve(
                 m_configuration.m_surfaceTagsToSnapTo.size() +
-                instanceData.m_masks.size());
+                instanceData.m_masks.GetSize());
 
             m_surfaceTagsToSnapToCombined.insert(m_surfaceTagsToSnapToCombined.end(),
                 m_configuration.m_surfaceTagsToSnapTo.begin(), m_configuration.m_surfaceTagsToSnapTo.end());
 
-            for (const auto& maskPair : instanceData.m_masks)
+            for (const auto& weight : instanceData.m_masks)
             {
-                m_surfaceTagsToSnapToCombined.push_back(maskPair.first);
+                m_surfaceTagsToSnapToCombined.push_back(weight.m_surfaceType);
             }
 
             //get the intersection data at the new position
@@ -329,7 +329,7 @@ namespace Vegetation
 
                 instanceData.m_position = m_points[0].m_position;
                 instanceData.m_normal = m_points[0].m_normal;
-                instanceData.m_masks = m_points[0].m_masks;
+                instanceData.m_masks = SurfaceData::SurfaceTagWeights(m_points[0].m_masks);
             }
         }
 
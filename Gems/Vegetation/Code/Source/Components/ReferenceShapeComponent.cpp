@@ -10,6 +10,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
 
 namespace Vegetation
 {
@@ -275,6 +276,32 @@ namespace Vegetation
         return result;
     }
 
+    void ReferenceShapeComponent::ArePointsInside(const AZ::Vector3* points, bool* results, size_t pointCount)
+    {
+        AZStd::fill(results, results + pointCount, false);
+
+        AZ_WarningOnce("Vegetation", !m_isRequestInProgress, "Detected cyclic dependences with vegetation entity references");
+        if (AllowRequest())
+        {
+            m_isRequestInProgress = true;
+            LmbrCentral::ShapeComponentRequestsBus::Event(m_configuration.m_shapeEntityId, &LmbrCentral::ShapeComponentRequestsBus::Events::ArePointsInside, points, results, pointCount);
+            m_isRequestInProgress = false;
+        }
+    }
+
+    void ReferenceShapeComponent::DistanceSquaredFromPoints(const AZ::Vector3* points, float* results, size_t pointCount)
+    {
+        AZStd::fill(results, results + pointCount, FLT_MAX);
+
+        AZ_WarningOnce("Vegetation", !m_isRequestInProgress, "Detected cyclic dependences with vegetation entity references");
+        if (AllowRequest())
+        {
+            m_isRequestInProgress = true;
+            LmbrCentral::ShapeComponentRequestsBus::Event(m_configuration.m_shapeEntityId, &LmbrCentral::ShapeComponentRequestsBus::Events::DistanceSquaredFromPoints, points, results, pointCount);
+            m_isRequestInProgress = false;
+        }
+    }
+
     AZ::Vector3 ReferenceShapeComponent::GenerateRandomPointInside(AZ::RandomDistributionType randomDistribution)
     {
         AZ::Vector3 result = AZ::Vector3::CreateZero();
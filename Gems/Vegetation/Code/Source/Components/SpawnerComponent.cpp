@@ -416,9 +416,9 @@ namespace Vegetation
         AZ_PROFILE_FUNCTION(Entity);
 
         //reject entire spawner if there are inclusion tags to consider that don't exist in the context
-        if (SurfaceData::HasValidTags(context.m_masks) &&
+        if (context.m_masks.HasValidTags() &&
             SurfaceData::HasValidTags(m_inclusiveTagsToConsider) &&
-            !SurfaceData::HasMatchingTags(context.m_masks, m_inclusiveTagsToConsider))
+            !context.m_masks.HasMatchingTags(m_inclusiveTagsToConsider))
         {
             VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::MarkAreaRejectedByMask, GetEntityId()));
             return;
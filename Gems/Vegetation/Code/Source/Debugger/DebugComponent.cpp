@@ -973,14 +973,18 @@ void DebugComponent::DrawDebugStats(AzFramework::DebugDisplayRequests& debugDisp
     AZ::u32 destroyTaskCount = 0;
     InstanceSystemStatsRequestBus::BroadcastResult(destroyTaskCount, &InstanceSystemStatsRequestBus::Events::GetDestroyTaskCount);
 
+    AZ::u32 createdInstanceCount = 0;
+    InstanceSystemStatsRequestBus::BroadcastResult(createdInstanceCount, &InstanceSystemStatsRequestBus::Events::GetLastTickCreatedInstanceCount);
+
     debugDisplay.SetColor(AZ::Color(1.0f));
     debugDisplay.Draw2dTextLabel(
         40.0f, 22.0f, 0.7f,
         AZStd::string::format(
             "VegetationSystemStats:\nActive Instances Count: %d\nInstance Register Queue: %d\nInstance Unregister Queue: %d\nThread "
-            "Queue Count: %d\nThread Processing Count: %d",
+            "Queue Count: %d\nThread Processing Count: %d\nSectors Filled Last Tick: %d\nInstances Created Last Tick: %d",
             instanceCount, createTaskCount, destroyTaskCount, m_debugData->m_areaTaskQueueCount.load(AZStd::memory_order_relaxed),
-            m_debugData->m_areaTaskActiveCount.load(AZStd::memory_order_relaxed))
+            m_debugData->m_areaTaskActiveCount.load(AZStd::memory_order_relaxed),
+            m_debugData->m_sectorFillCount.load(AZStd::memory_order_relaxed), createdInstanceCount)
             .c_str(),
         false);
 }
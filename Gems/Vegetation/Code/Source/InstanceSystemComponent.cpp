@@ -383,12 +383,19 @@ namespace Vegetation
         return m_destroyTaskCount;
     }
 
+    AZ::u32 InstanceSystemComponent::GetLastTickCreatedInstanceCount() const
+    {
+        return m_lastTickCreatedInstanceCount;
+    }
+
     void InstanceSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
+        m_tickCreatedInstanceCount = 0;
         if (HasTasks())
         {
             ProcessMainThreadTasks();
         }
+        m_lastTickCreatedInstanceCount = m_tickCreatedInstanceCount;
 
         GarbageCollectUniqueDescriptors();
     }
@@ -481,6 +488,7 @@ namespace Vegetation
             AZ_Assert(m_instanceMap.find(instanceData.m_instanceId) == m_instanceMap.end(), "InstanceId %llu is already in use!", instanceData.m_instanceId);
             m_instanceMap[instanceData.m_instanceId] = AZStd::make_pair(instanceData.m_descriptorPtr, opaqueInstanceData);
             m_instanceCount = static_cast<int>(m_instanceMap.size());
+            ++m_tickCreatedInstanceCount;
         }
     }
 
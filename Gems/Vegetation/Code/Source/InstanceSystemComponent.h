@@ -18,6 +18,7 @@
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/list.h>
 #include <AzCore/std/function/function_fwd.h>
+#include <AzCore/std/parallel/atomic.h>
 
 #include <Vegetation/Descriptor.h>
 #include <Vegetation/InstanceData.h>
@@ -103,6 +104,7 @@ namespace Vegetation
         AZ::u32 GetTotalTaskCount() const override;
         AZ::u32 GetCreateTaskCount() const override;
         AZ::u32 GetDestroyTaskCount() const override;
+        AZ::u32 GetLastTickCreatedInstanceCount() const override;
 
         // AZ::TickBus
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
@@ -163,5 +165,9 @@ namespace Vegetation
         AZStd::atomic_int m_instanceCount{ 0 };
         AZStd::atomic_int m_createTaskCount{ 0 };
         AZStd::atomic_int m_destroyTaskCount{ 0 };
+
+        //! Instances created by the tasks executed during the current tick, only accessed from the main thread.
+        int m_tickCreatedInstanceCount = 0;
+        AZStd::atomic_int m_lastTickCreatedInstanceCount{ 0 };
     };
 } // namespace Vegetation
@@ -78,7 +78,7 @@ namespace UnitTest
         });
 
         Vegetation::InstanceData vegInstance;
-        vegInstance.m_masks[maskValue] = 1.0f;
+        vegInstance.m_masks.AddSurfaceTagWeight(maskValue, 1.0f);
 
         // passes
         {
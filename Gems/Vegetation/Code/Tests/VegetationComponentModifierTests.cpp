@@ -80,7 +80,9 @@ namespace UnitTest
 
         Vegetation::ModifierRequestBus::Event(entity->GetId(), &Vegetation::ModifierRequestBus::Events::Execute, vegInstance);
         EXPECT_EQ(mockSurfaceHandler.m_outNormal, vegInstance.m_normal);
-        EXPECT_EQ(mockSurfaceHandler.m_outMasks, vegInstance.m_masks);
+        SurfaceData::SurfaceTagWeightMap instanceMasks;
+        vegInstance.m_masks.GetSurfaceTagWeightMap(instanceMasks);
+        EXPECT_EQ(mockSurfaceHandler.m_outMasks, instanceMasks);
     }
 
     TEST_F(VegetationComponentModifierTests, RotationModifierComponent)
@@ -21,6 +21,7 @@
 #include <Vegetation/EmptyInstanceSpawner.h>
 
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace UnitTest
 {
@@ -395,6 +396,52 @@ namespace UnitTest
         mockDescriptorProviderBus.BusDisconnect();
     }
 
+    TEST_F(VegetationComponentOperationTests, InstanceSystemComponent_QueuesTasksFromMultipleThreads)
+    {
+        Vegetation::InstanceSystemConfig instanceSystemConfig;
+        Vegetation::InstanceSystemComponent* instanceSystemComponent = nullptr;
+        auto instanceSystemEntity = CreateEntity(instanceSystemConfig, &instanceSystemComponent, [](AZ::Entity* e)
+        {
+            e->CreateComponent<Vegetation::DebugSystemComponent>();
+        });
+
+        MockDescriptorProvider mockDescriptorProviderBus(1);
+
+        // Queue instance creations from several threads at once
+        constexpr AZ::u32 threadCount = 4;
+        constexpr AZ::u32 instancesPerThread = 256;
+        AZStd::vector<AZStd::thread> threads;
+        for (AZ::u32 threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            threads.emplace_back([&mockDescriptorProviderBus]()
+            {
+                for (AZ::u32 instanceIndex = 0; instanceIndex < instancesPerThread; ++instanceIndex)
+                {
+                    Vegetation::InstanceData instanceData;
+                    instanceData.m_descriptorPtr = mockDescriptorProviderBus.m_descriptors[0];
+                    Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::CreateInstance, instanceData);
+                    EXPECT_NE(instanceData.m_instanceId, Vegetation::InvalidInstanceId);
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        AZ::u32 createTaskCount = 0;
+        Vegetation::InstanceSystemStatsRequestBus::BroadcastResult(createTaskCount, &Vegetation::InstanceSystemStatsRequestBus::Events::GetCreateTaskCount);
+        EXPECT_EQ(createTaskCount, threadCount * instancesPerThread);
+
+        //destroy all instances and queued tasks
+        Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::DestroyAllInstances);
+
+        Vegetation::InstanceSystemStatsRequestBus::BroadcastResult(createTaskCount, &Vegetation::InstanceSystemStatsRequestBus::Events::GetCreateTaskCount);
+        EXPECT_EQ(createTaskCount, 0);
+
+        mockDescriptorProviderBus.Clear();
+    }
+
     TEST_F(VegetationComponentOperationTests, AreaBlenderComponent)
     {
         auto entityBlocker = CreateEntity<Vegetation::BlockerComponent>(Vegetation::BlockerConfig(), nullptr, [](AZ::Entity* e)